@@ -0,0 +1,279 @@
+#include <CorePCH.hpp>
+#include <Allocator/AliasPlanner.hpp>
+#include <Math/Common.hpp>
+
+#include <numeric>
+
+namespace Neon::Allocator
+{
+    uint32_t AliasPlanner::Add(
+        const Resource& Res)
+    {
+        m_Resources.emplace_back(Res);
+        return uint32_t(m_Resources.size() - 1);
+    }
+
+    void AliasPlanner::Clear() noexcept
+    {
+        m_Resources.clear();
+        m_Placements.clear();
+        m_HeapSizes.clear();
+        m_Barriers.clear();
+        m_HeapResources.clear();
+    }
+
+    void AliasPlanner::Build()
+    {
+        m_Placements.assign(m_Resources.size(), {});
+        m_HeapSizes.clear();
+        m_Barriers.clear();
+        m_HeapResources.clear();
+
+        // Large resources first, the small ones fill the gaps left between them
+        std::vector<uint32_t> Order(m_Resources.size());
+        std::iota(Order.begin(), Order.end(), 0);
+        std::ranges::sort(
+            Order,
+            [this](uint32_t A, uint32_t B)
+            {
+                auto& ResA = m_Resources[A];
+                auto& ResB = m_Resources[B];
+                if (ResA.Size != ResB.Size)
+                {
+                    return ResA.Size > ResB.Size;
+                }
+                if (ResA.FirstUse != ResB.FirstUse)
+                {
+                    return ResA.FirstUse < ResB.FirstUse;
+                }
+                return A < B;
+            });
+
+        for (uint32_t Index : Order)
+        {
+            auto& Res = m_Resources[Index];
+
+            uint32_t Heap   = 0;
+            size_t   Offset = 0;
+            for (; Heap < m_HeapSizes.size(); Heap++)
+            {
+                Offset = FindOffset(Index, Heap);
+                if (!m_MaxHeapSize || Offset + Res.Size <= std::max(m_MaxHeapSize, m_HeapSizes[Heap]))
+                {
+                    break;
+                }
+            }
+
+            if (Heap == m_HeapSizes.size())
+            {
+                m_HeapSizes.emplace_back(0);
+                m_HeapResources.emplace_back();
+                Offset = 0;
+            }
+
+            m_Placements[Index] = { .Heap = Heap, .Offset = Offset };
+            m_HeapSizes[Heap]   = std::max(m_HeapSizes[Heap], Offset + Res.Size);
+            m_HeapResources[Heap].emplace_back(Index);
+        }
+
+        BuildBarriers();
+    }
+
+    size_t AliasPlanner::FindOffset(
+        uint32_t Index,
+        uint32_t Heap) const
+    {
+        auto& Res = m_Resources[Index];
+
+        std::vector<std::pair<size_t, size_t>> Ranges;
+        for (uint32_t Other : m_HeapResources[Heap])
+        {
+            if (LifetimesOverlap(Index, Other))
+            {
+                size_t Begin = m_Placements[Other].Offset;
+                Ranges.emplace_back(Begin, Begin + m_Resources[Other].Size);
+            }
+        }
+        std::ranges::sort(Ranges);
+
+        // Take the smallest gap that fits, or the end of the resources alive at the same time
+        size_t Best    = std::numeric_limits<size_t>::max();
+        size_t BestGap = std::numeric_limits<size_t>::max();
+        size_t Cursor  = 0;
+        for (auto& [Begin, End] : Ranges)
+        {
+            size_t Offset = Math::AlignUp(Cursor, Res.Alignement);
+            if (Offset + Res.Size <= Begin && Begin - Cursor < BestGap)
+            {
+                Best    = Offset;
+                BestGap = Begin - Cursor;
+            }
+            Cursor = std::max(Cursor, End);
+        }
+
+        return Best != std::numeric_limits<size_t>::max() ? Best : Math::AlignUp(Cursor, Res.Alignement);
+    }
+
+    void AliasPlanner::BuildBarriers()
+    {
+        std::vector<uint32_t>                  Previous;
+        std::vector<std::pair<size_t, size_t>> Covered;
+
+        for (uint32_t Index = 0; Index < m_Resources.size(); Index++)
+        {
+            auto& Res       = m_Resources[Index];
+            auto& Placement = m_Placements[Index];
+
+            Previous.clear();
+            bool IsAliased = false;
+            for (uint32_t Other : m_HeapResources[Placement.Heap])
+            {
+                if (Other == Index || !MemoryOverlaps(Index, Other))
+                {
+                    continue;
+                }
+
+                IsAliased = true;
+                if (m_Resources[Other].LastUse < Res.FirstUse)
+                {
+                    Previous.emplace_back(Other);
+                }
+            }
+
+            // The memory was last used by the previous frame's resources, which may be any of the aliased ones
+            if (Previous.empty())
+            {
+                if (IsAliased)
+                {
+                    m_Barriers.emplace_back(Res.FirstUse, s_NullResource, Index);
+                }
+                continue;
+            }
+
+            // Only the last resource to use each part of the memory needs a barrier, visit them from the most recent
+            std::ranges::sort(
+                Previous,
+                [this](uint32_t A, uint32_t B)
+                {
+                    return m_Resources[A].LastUse > m_Resources[B].LastUse;
+                });
+
+            Covered.clear();
+            for (uint32_t Other : Previous)
+            {
+                size_t Begin = std::max(Placement.Offset, m_Placements[Other].Offset);
+                size_t End   = std::min(Placement.Offset + Res.Size, m_Placements[Other].Offset + m_Resources[Other].Size);
+
+                std::ranges::sort(Covered);
+
+                size_t Cursor = Begin;
+                for (auto& [CoveredBegin, CoveredEnd] : Covered)
+                {
+                    if (CoveredBegin > Cursor)
+                    {
+                        break;
+                    }
+                    Cursor = std::max(Cursor, CoveredEnd);
+                }
+
+                if (Cursor < End)
+                {
+                    m_Barriers.emplace_back(Res.FirstUse, Other, Index);
+                    Covered.emplace_back(Begin, End);
+                }
+            }
+        }
+
+        std::ranges::sort(
+            m_Barriers,
+            [](const AliasingBarrier& A, const AliasingBarrier& B)
+            {
+                return A.Use != B.Use ? A.Use < B.Use : A.After < B.After;
+            });
+    }
+
+    //
+
+    bool AliasPlanner::Validate() const
+    {
+        if (m_Placements.size() != m_Resources.size())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < m_Resources.size(); i++)
+        {
+            auto& Res       = m_Resources[i];
+            auto& Placement = m_Placements[i];
+            if (Placement.Heap >= m_HeapSizes.size() ||
+                Placement.Offset % Res.Alignement ||
+                Placement.Offset + Res.Size > m_HeapSizes[Placement.Heap])
+            {
+                return false;
+            }
+
+            for (uint32_t j = i + 1; j < m_Resources.size(); j++)
+            {
+                if (LifetimesOverlap(i, j) && MemoryOverlaps(i, j))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    //
+
+    std::span<const AliasPlanner::AliasingBarrier> AliasPlanner::GetBarriers(
+        uint32_t Use) const noexcept
+    {
+        auto Range = std::ranges::equal_range(
+            m_Barriers,
+            Use,
+            std::less{},
+            &AliasingBarrier::Use);
+        return { Range.begin(), Range.end() };
+    }
+
+    size_t AliasPlanner::GetTotalSize() const noexcept
+    {
+        size_t Size = 0;
+        for (size_t HeapSize : m_HeapSizes)
+        {
+            Size += HeapSize;
+        }
+        return Size;
+    }
+
+    size_t AliasPlanner::GetUnaliasedSize() const noexcept
+    {
+        size_t Size = 0;
+        for (auto& Res : m_Resources)
+        {
+            Size += Res.Size;
+        }
+        return Size;
+    }
+
+    size_t AliasPlanner::GetLowerBound() const
+    {
+        // Sizes added at the first use and removed after the last one
+        std::vector<std::pair<uint64_t, int64_t>> Events;
+        Events.reserve(m_Resources.size() * 2);
+        for (auto& Res : m_Resources)
+        {
+            Events.emplace_back(Res.FirstUse, int64_t(Res.Size));
+            Events.emplace_back(uint64_t(Res.LastUse) + 1, -int64_t(Res.Size));
+        }
+        std::ranges::sort(Events);
+
+        int64_t Alive = 0, Peak = 0;
+        for (auto& [Use, Size] : Events)
+        {
+            Alive += Size;
+            Peak = std::max(Peak, Alive);
+        }
+        return size_t(Peak);
+    }
+} // namespace Neon::Allocator
\ No newline at end of file
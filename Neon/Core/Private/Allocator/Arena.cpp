@@ -0,0 +1,147 @@
+#include <CorePCH.hpp>
+#include <Allocator/Arena.hpp>
+
+#include <atomic>
+#include <mutex>
+
+namespace Neon::Allocator
+{
+    void LinearArena::Reset()
+    {
+        if (m_Chunks.size() > 1)
+        {
+            m_Chunks.clear();
+            m_Chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(m_Capacity), m_Capacity);
+        }
+
+        m_ChunkIndex = 0;
+        m_Offset     = 0;
+        m_UsedSize   = 0;
+    }
+
+    void* LinearArena::AllocateSlow(
+        size_t Size,
+        size_t Alignement)
+    {
+        // Try the chunks that were kept from before the last reset first
+        while (++m_ChunkIndex < m_Chunks.size())
+        {
+            auto&  CurChunk = m_Chunks[m_ChunkIndex];
+            size_t Offset   = GetAlignedOffset(CurChunk, 0, Alignement);
+            if (Offset + Size <= CurChunk.Size)
+            {
+                m_Offset = Offset + Size;
+                m_UsedSize += Size;
+                return CurChunk.Data.get() + Offset;
+            }
+        }
+
+        size_t ChunkSize = std::max(m_ChunkSize, Size + Alignement - 1);
+        auto&  NewChunk  = m_Chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(ChunkSize), ChunkSize);
+        m_ChunkIndex     = m_Chunks.size() - 1;
+        m_Capacity += ChunkSize;
+
+        size_t Offset = GetAlignedOffset(NewChunk, 0, Alignement);
+
+        m_Offset = Offset + Size;
+        m_UsedSize += Size;
+        return NewChunk.Data.get() + Offset;
+    }
+
+    //
+
+    namespace
+    {
+        struct ThreadFrameArenas
+        {
+            std::array<LinearArena, FrameArena::s_FrameCount> Arenas;
+            std::array<uint64_t, FrameArena::s_FrameCount>    Frames{};
+        };
+
+        /// <summary>
+        /// Forwards to the calling thread's frame arena, so a single instance serves every thread.
+        /// </summary>
+        class FrameMemoryResource : public std::pmr::memory_resource
+        {
+        protected:
+            void* do_allocate(
+                size_t Size,
+                size_t Alignement) override
+            {
+                return FrameArena::Allocate(Size, Alignement);
+            }
+
+            void do_deallocate(
+                void*,
+                size_t,
+                size_t) override
+            {
+            }
+
+            bool do_is_equal(
+                const std::pmr::memory_resource& Other) const noexcept override
+            {
+                return this == &Other;
+            }
+        };
+
+        std::atomic_uint64_t s_FrameIndex = 1;
+
+        // Arenas are owned by the registry rather than by their thread, since allocations of a thread
+        // may still be in use by other threads for a few frames after it exits
+        std::mutex                           s_RegistryMutex;
+        std::vector<UPtr<ThreadFrameArenas>> s_Registry;
+
+        thread_local ThreadFrameArenas* t_Arenas = nullptr;
+
+        FrameMemoryResource s_FrameResource;
+    } // namespace
+
+    void FrameArena::NewFrame()
+    {
+        s_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void FrameArena::Shutdown()
+    {
+        std::scoped_lock Lock(s_RegistryMutex);
+        for (auto& Arenas : s_Registry)
+        {
+            for (auto& Arena : Arenas->Arenas)
+            {
+                Arena = LinearArena();
+            }
+            Arenas->Frames.fill(0);
+        }
+    }
+
+    uint64_t FrameArena::GetFrameIndex() noexcept
+    {
+        return s_FrameIndex.load(std::memory_order_relaxed);
+    }
+
+    void* FrameArena::Allocate(
+        size_t Size,
+        size_t Alignement)
+    {
+        if (!t_Arenas) [[unlikely]]
+        {
+            std::scoped_lock Lock(s_RegistryMutex);
+            t_Arenas = s_Registry.emplace_back(std::make_unique<ThreadFrameArenas>()).get();
+        }
+
+        uint64_t Frame = s_FrameIndex.load(std::memory_order_relaxed);
+        uint32_t Slot  = uint32_t(Frame % s_FrameCount);
+        if (t_Arenas->Frames[Slot] != Frame)
+        {
+            t_Arenas->Arenas[Slot].Reset();
+            t_Arenas->Frames[Slot] = Frame;
+        }
+        return t_Arenas->Arenas[Slot].Allocate(Size, Alignement);
+    }
+
+    std::pmr::memory_resource* FrameArena::GetResource() noexcept
+    {
+        return &s_FrameResource;
+    }
+} // namespace Neon::Allocator
\ No newline at end of file
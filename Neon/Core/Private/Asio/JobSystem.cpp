@@ -0,0 +1,233 @@
+#include <CorePCH.hpp>
+#include <Asio/JobSystem.hpp>
+
+#include <Log/Logger.hpp>
+#include <utility>
+
+namespace Neon::Asio
+{
+    static std::mutex                 s_PoolMutex;
+    static UPtr<ThreadPool<>>         s_Pool;
+    static std::atomic<ThreadPool<>*> s_PoolPtr    = nullptr;
+    static std::atomic_bool           s_IsShutdown = false;
+
+    /// <summary>
+    /// Run a job of a group, the group is notified even if the job throws.
+    /// </summary>
+    static void RunGroupJob(
+        JobFunction& Job)
+    {
+        try
+        {
+            Job();
+        }
+        catch (const std::exception& Exception)
+        {
+            NEON_ERROR_TAG("Job", "Unhandled exception in job: {}", Exception.what());
+        }
+        catch (...)
+        {
+            NEON_ERROR_TAG("Job", "Unhandled exception in job");
+        }
+    }
+
+    //
+
+    void JobSystem::Initialize(
+        uint32_t WorkerCount)
+    {
+        std::scoped_lock Lock(s_PoolMutex);
+        if (s_Pool)
+        {
+            return;
+        }
+
+        if (!WorkerCount)
+        {
+            // The thread waiting for the jobs helps executing them
+            WorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        }
+
+        s_Pool = std::make_unique<ThreadPool<>>(WorkerCount);
+        s_PoolPtr.store(s_Pool.get(), std::memory_order_release);
+        s_IsShutdown.store(false, std::memory_order_release);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        std::scoped_lock Lock(s_PoolMutex);
+
+        // The pool stays reachable while it drains, running jobs can still enqueue more jobs
+        s_Pool.reset();
+        s_PoolPtr.store(nullptr, std::memory_order_release);
+        s_IsShutdown.store(true, std::memory_order_release);
+    }
+
+    uint32_t JobSystem::GetWorkerCount()
+    {
+        return uint32_t(GetPool().size());
+    }
+
+    bool JobSystem::IsWorkerThread()
+    {
+        auto Pool = s_PoolPtr.load(std::memory_order_acquire);
+        return Pool && Pool->is_worker_thread();
+    }
+
+    task_priority_stats JobSystem::GetStats(
+        JobPriority Priority)
+    {
+        return GetPool().stats(Priority);
+    }
+
+    void JobSystem::ResetStats()
+    {
+        GetPool().reset_stats();
+    }
+
+    void JobSystem::Enqueue(
+        JobFunction       Job,
+        const JobOptions& Options)
+    {
+        GetPool().enqueue_detach(Options, std::move(Job));
+    }
+
+    bool JobSystem::RunPendingJob()
+    {
+        return GetPool().run_pending_task();
+    }
+
+    ThreadPool<>& JobSystem::GetPool()
+    {
+        if (auto Pool = s_PoolPtr.load(std::memory_order_acquire))
+        {
+            return *Pool;
+        }
+
+        // Lazily creating the workers again would leave them running past the owner's shutdown
+        NEON_ASSERT(!s_IsShutdown.load(std::memory_order_acquire), "Job system used after shutdown");
+        Initialize();
+        return *s_PoolPtr.load(std::memory_order_acquire);
+    }
+
+    //
+
+    JobGroup::~JobGroup()
+    {
+        Wait();
+    }
+
+    void JobGroup::Run(
+        JobFunction       Job,
+        const JobOptions& Options)
+    {
+        Add();
+        JobSystem::Enqueue(
+            [this, Job = std::move(Job)]() mutable
+            {
+                RunGroupJob(Job);
+                Done();
+            },
+            Options);
+    }
+
+    void JobGroup::Then(
+        JobFunction       Job,
+        JobGroup*         Target,
+        const JobOptions& Options)
+    {
+        if (Target)
+        {
+            Target->Add();
+        }
+
+        {
+            std::scoped_lock Lock(m_Mutex);
+            if (m_Pending.load(std::memory_order_acquire))
+            {
+                m_Continuations.emplace_back(std::move(Job), Target, Options);
+                return;
+            }
+        }
+
+        Dispatch({ std::move(Job), Target, Options });
+    }
+
+    void JobGroup::Wait()
+    {
+        while (auto Pending = m_Pending.load(std::memory_order_acquire))
+        {
+            if (!JobSystem::RunPendingJob())
+            {
+                m_Pending.wait(Pending, std::memory_order_acquire);
+            }
+        }
+
+        // The job that completed the group may still hold the lock while taking the continuations
+        std::scoped_lock Lock(m_Mutex);
+    }
+
+    bool JobGroup::IsDone() const noexcept
+    {
+        return m_Pending.load(std::memory_order_acquire) == 0;
+    }
+
+    //
+
+    void JobGroup::Add() noexcept
+    {
+        m_Pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void JobGroup::Done()
+    {
+        // Jobs that don't complete the group only decrement the count
+        auto Pending = m_Pending.load(std::memory_order_relaxed);
+        while (Pending > 1)
+        {
+            if (m_Pending.compare_exchange_weak(Pending, Pending - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+
+        // The last one decrements under the lock, Wait takes it after seeing no pending jobs so the group can't be
+        // destroyed before we are done with it
+        std::vector<Continuation> Continuations;
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            // Another job could have been added to the group in the meantime, its completion dispatches the continuations
+            if (m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                Continuations = std::exchange(m_Continuations, {});
+                m_Pending.notify_all();
+            }
+        }
+
+        // The group may already be destroyed here
+        for (auto& Job : Continuations)
+        {
+            Dispatch(std::move(Job));
+        }
+    }
+
+    void JobGroup::Dispatch(
+        Continuation Job)
+    {
+        if (!Job.Target)
+        {
+            JobSystem::Enqueue(std::move(Job.Job), Job.Options);
+            return;
+        }
+
+        auto Options = Job.Options;
+        JobSystem::Enqueue(
+            [Job = std::move(Job)]() mutable
+            {
+                RunGroupJob(Job.Job);
+                Job.Target->Done();
+            },
+            Options);
+    }
+} // namespace Neon::Asio
\ No newline at end of file
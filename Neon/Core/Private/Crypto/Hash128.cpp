@@ -0,0 +1,342 @@
+#include <CorePCH.hpp>
+#include <Crypto/Hash128.hpp>
+
+#include <istream>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define NEON_HASH128_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace Neon::Crypto
+{
+    namespace
+    {
+        constexpr uint32_t Prime32_1 = 0x9E3779B1U;
+        constexpr uint64_t Prime64_1 = 0x9E3779B185EBCA87ULL;
+        constexpr uint64_t Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr uint64_t Prime64_3 = 0x165667B19E3779F9ULL;
+        constexpr uint64_t Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr uint64_t Prime64_5 = 0x27D4EB2F165667C5ULL;
+
+        constexpr size_t SecretConsumeRate = 8;
+        constexpr size_t StripesPerBlock   = (Hash128::s_SecretSize - Hash128::s_StripeSize) / SecretConsumeRate;
+        constexpr size_t LastStripeOffset  = 7;
+        constexpr size_t MergeOffset       = 11;
+
+        /// <summary>
+        /// Generate the default secret with splitmix64.
+        /// </summary>
+        constexpr auto GenerateSecret()
+        {
+            std::array<uint8_t, Hash128::s_SecretSize> Secret{};
+
+            uint64_t State = Prime64_5;
+            for (size_t i = 0; i < Secret.size(); i += sizeof(uint64_t))
+            {
+                State += 0x9E3779B97F4A7C15ULL;
+
+                uint64_t Value = State;
+                Value          = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                Value          = (Value ^ (Value >> 27)) * 0x94D049BB133111EBULL;
+                Value ^= Value >> 31;
+
+                for (size_t j = 0; j < sizeof(uint64_t); j++)
+                {
+                    Secret[i + j] = uint8_t(Value >> (j * 8));
+                }
+            }
+
+            return Secret;
+        }
+
+        alignas(64) constexpr std::array<uint8_t, Hash128::s_SecretSize> s_Secret = GenerateSecret();
+
+        //
+
+        [[nodiscard]] inline uint64_t Read64(
+            const uint8_t* Data) noexcept
+        {
+            uint64_t Value;
+            std::memcpy(&Value, Data, sizeof(Value));
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                Value = std::byteswap(Value);
+            }
+            return Value;
+        }
+
+        [[nodiscard]] inline uint64_t Mul128Fold64(
+            uint64_t Lhs,
+            uint64_t Rhs) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            uint64_t High;
+            uint64_t Low = _umul128(Lhs, Rhs, &High);
+            return Low ^ High;
+#elif defined(__SIZEOF_INT128__)
+            auto Product = static_cast<unsigned __int128>(Lhs) * Rhs;
+            return uint64_t(Product) ^ uint64_t(Product >> 64);
+#else
+            uint64_t LoLo = (Lhs & 0xFFFFFFFF) * (Rhs & 0xFFFFFFFF);
+            uint64_t HiLo = (Lhs >> 32) * (Rhs & 0xFFFFFFFF);
+            uint64_t LoHi = (Lhs & 0xFFFFFFFF) * (Rhs >> 32);
+            uint64_t HiHi = (Lhs >> 32) * (Rhs >> 32);
+
+            uint64_t Cross = (LoLo >> 32) + (HiLo & 0xFFFFFFFF) + LoHi;
+            uint64_t High  = (HiLo >> 32) + (Cross >> 32) + HiHi;
+            uint64_t Low   = (Cross << 32) | (LoLo & 0xFFFFFFFF);
+            return Low ^ High;
+#endif
+        }
+
+        [[nodiscard]] inline uint64_t Avalanche(
+            uint64_t Hash) noexcept
+        {
+            Hash ^= Hash >> 37;
+            Hash *= 0x165667919E3779F9ULL;
+            Hash ^= Hash >> 32;
+            return Hash;
+        }
+
+        //
+
+        /// <summary>
+        /// Accumulate a 64 bytes stripe.
+        /// </summary>
+        inline void Accumulate512(
+            uint64_t* __restrict      Acc,
+            const uint8_t* __restrict Data,
+            const uint8_t* __restrict Secret) noexcept
+        {
+#ifdef NEON_HASH128_SSE2
+            auto AccVec    = std::bit_cast<__m128i*>(Acc);
+            auto DataVec   = std::bit_cast<const __m128i*>(Data);
+            auto SecretVec = std::bit_cast<const __m128i*>(Secret);
+
+            for (size_t i = 0; i < Hash128::s_AccCount / 2; i++)
+            {
+                __m128i DataLane = _mm_loadu_si128(DataVec + i);
+                __m128i KeyLane  = _mm_loadu_si128(SecretVec + i);
+                __m128i DataKey  = _mm_xor_si128(DataLane, KeyLane);
+
+                // Multiply the low and high 32 bits of each 64 bits lane
+                __m128i DataKeyHi = _mm_shuffle_epi32(DataKey, _MM_SHUFFLE(0, 3, 0, 1));
+                __m128i Product   = _mm_mul_epu32(DataKey, DataKeyHi);
+
+                // Add the data to the neighbouring lane
+                __m128i DataSwap = _mm_shuffle_epi32(DataLane, _MM_SHUFFLE(1, 0, 3, 2));
+                __m128i Sum      = _mm_add_epi64(_mm_load_si128(AccVec + i), DataSwap);
+
+                _mm_store_si128(AccVec + i, _mm_add_epi64(Product, Sum));
+            }
+#else
+            for (size_t i = 0; i < Hash128::s_AccCount; i++)
+            {
+                uint64_t DataVal = Read64(Data + i * 8);
+                uint64_t DataKey = DataVal ^ Read64(Secret + i * 8);
+
+                Acc[i ^ 1] += DataVal;
+                Acc[i] += (DataKey & 0xFFFFFFFF) * (DataKey >> 32);
+            }
+#endif
+        }
+
+        /// <summary>
+        /// Scramble the accumulators at the end of a block.
+        /// </summary>
+        inline void Scramble(
+            uint64_t* __restrict      Acc,
+            const uint8_t* __restrict Secret) noexcept
+        {
+#ifdef NEON_HASH128_SSE2
+            auto AccVec    = std::bit_cast<__m128i*>(Acc);
+            auto SecretVec = std::bit_cast<const __m128i*>(Secret);
+            auto Prime     = _mm_set1_epi32(int(Prime32_1));
+
+            for (size_t i = 0; i < Hash128::s_AccCount / 2; i++)
+            {
+                __m128i AccLane = _mm_load_si128(AccVec + i);
+                AccLane         = _mm_xor_si128(AccLane, _mm_srli_epi64(AccLane, 47));
+                AccLane         = _mm_xor_si128(AccLane, _mm_loadu_si128(SecretVec + i));
+
+                // 64 bits by 32 bits multiply, done as two 32 bits multiplies
+                __m128i AccHi     = _mm_shuffle_epi32(AccLane, _MM_SHUFFLE(0, 3, 0, 1));
+                __m128i ProductLo = _mm_mul_epu32(AccLane, Prime);
+                __m128i ProductHi = _mm_mul_epu32(AccHi, Prime);
+
+                _mm_store_si128(AccVec + i, _mm_add_epi64(ProductLo, _mm_slli_epi64(ProductHi, 32)));
+            }
+#else
+            for (size_t i = 0; i < Hash128::s_AccCount; i++)
+            {
+                uint64_t Value = Acc[i];
+                Value ^= Value >> 47;
+                Value ^= Read64(Secret + i * 8);
+                Acc[i] = Value * Prime32_1;
+            }
+#endif
+        }
+
+        [[nodiscard]] inline uint64_t MergeAccs(
+            const uint64_t* Acc,
+            const uint8_t*  Secret,
+            uint64_t        Start) noexcept
+        {
+            uint64_t Result = Start;
+            for (size_t i = 0; i < Hash128::s_AccCount / 2; i++)
+            {
+                Result += Mul128Fold64(
+                    Acc[i * 2] ^ Read64(Secret + i * 16),
+                    Acc[i * 2 + 1] ^ Read64(Secret + i * 16 + 8));
+            }
+            return Avalanche(Result);
+        }
+    } // namespace
+
+    //
+
+    Hash128::Hash128()
+    {
+        Reset();
+    }
+
+    void Hash128::Reset()
+    {
+        m_Acc = {
+            Prime32_1, Prime64_1, Prime64_2, Prime64_3,
+            Prime64_4, Prime32_1, Prime64_5, Prime32_1
+        };
+
+        m_BufferedSize = 0;
+        m_StripesSoFar = 0;
+        m_TotalSize    = 0;
+    }
+
+    void Hash128::ConsumeStripes(
+        uint64_t*      Acc,
+        size_t&        StripesSoFar,
+        const uint8_t* Data,
+        size_t         StripeCount)
+    {
+        for (size_t i = 0; i < StripeCount; i++)
+        {
+            Accumulate512(Acc, Data + i * s_StripeSize, s_Secret.data() + StripesSoFar * SecretConsumeRate);
+            if (++StripesSoFar == StripesPerBlock)
+            {
+                Scramble(Acc, s_Secret.data() + s_SecretSize - s_StripeSize);
+                StripesSoFar = 0;
+            }
+        }
+    }
+
+    Hash128& Hash128::Append(
+        const void* Data,
+        size_t      Size)
+    {
+        auto Input = std::bit_cast<const uint8_t*>(Data);
+        m_TotalSize += Size;
+
+        // Always keep at least one byte in the buffer, the last stripe is processed in Digest
+        if (m_BufferedSize + Size <= s_BufferSize)
+        {
+            std::memcpy(m_Buffer.data() + m_BufferedSize, Input, Size);
+            m_BufferedSize += Size;
+            return *this;
+        }
+
+        if (m_BufferedSize)
+        {
+            size_t FillSize = s_BufferSize - m_BufferedSize;
+            std::memcpy(m_Buffer.data() + m_BufferedSize, Input, FillSize);
+            Input += FillSize;
+            Size -= FillSize;
+
+            ConsumeStripes(m_Acc.data(), m_StripesSoFar, m_Buffer.data(), s_BufferSize / s_StripeSize);
+            m_BufferedSize = 0;
+        }
+
+        while (Size > s_BufferSize)
+        {
+            ConsumeStripes(m_Acc.data(), m_StripesSoFar, Input, s_BufferSize / s_StripeSize);
+            Input += s_BufferSize;
+            Size -= s_BufferSize;
+        }
+
+        std::memcpy(m_Buffer.data(), Input, Size);
+        m_BufferedSize = Size;
+        return *this;
+    }
+
+    Hash128& Hash128::Append(
+        std::istream& Stream,
+        size_t        Size)
+    {
+        std::array<uint8_t, 4096> TmpBuffer;
+        while (Size)
+        {
+            size_t ReadSize = std::min(Size, TmpBuffer.size());
+            Stream.read(reinterpret_cast<char*>(TmpBuffer.data()), ReadSize);
+            Append(TmpBuffer.data(), ReadSize);
+            Size -= ReadSize;
+        }
+        return *this;
+    }
+
+    auto Hash128::Digest() const -> Bytes
+    {
+        alignas(16) auto Acc          = m_Acc;
+        size_t           StripesSoFar = m_StripesSoFar;
+
+        // Consume the buffered stripes, except the last one
+        size_t StripeCount = m_BufferedSize ? (m_BufferedSize - 1) / s_StripeSize : 0;
+        ConsumeStripes(Acc.data(), StripesSoFar, m_Buffer.data(), StripeCount);
+
+        // The last stripe is zero padded
+        alignas(16) std::array<uint8_t, s_StripeSize> LastStripe{};
+
+        size_t Remaining = m_BufferedSize - StripeCount * s_StripeSize;
+        std::memcpy(LastStripe.data(), m_Buffer.data() + StripeCount * s_StripeSize, Remaining);
+        Accumulate512(Acc.data(), LastStripe.data(), s_Secret.data() + s_SecretSize - s_StripeSize - LastStripeOffset);
+
+        uint64_t Low  = MergeAccs(Acc.data(), s_Secret.data() + MergeOffset, m_TotalSize * Prime64_1);
+        uint64_t High = MergeAccs(Acc.data(), s_Secret.data() + s_SecretSize - s_StripeSize - MergeOffset, ~(m_TotalSize * Prime64_2));
+
+        Bytes Result;
+        for (size_t i = 0; i < sizeof(uint64_t); i++)
+        {
+            Result[i]                    = uint8_t(Low >> (i * 8));
+            Result[i + sizeof(uint64_t)] = uint8_t(High >> (i * 8));
+        }
+        return Result;
+    }
+
+    //
+
+    std::string Hash128::Bytes::ToString() const
+    {
+        static constexpr char HexChars[] = "0123456789abcdef";
+
+        std::string Result(size() * 2, '\0');
+        for (size_t i = 0; i < size(); i++)
+        {
+            Result[i * 2]     = HexChars[(*this)[i] >> 4];
+            Result[i * 2 + 1] = HexChars[(*this)[i] & 0xF];
+        }
+        return Result;
+    }
+
+    uint64_t Hash128::Bytes::Low() const noexcept
+    {
+        return Read64(data());
+    }
+
+    uint64_t Hash128::Bytes::High() const noexcept
+    {
+        return Read64(data() + sizeof(uint64_t));
+    }
+} // namespace Neon::Crypto
\ No newline at end of file
@@ -0,0 +1,628 @@
+#include <CorePCH.hpp>
+#include <Geometry/BVH.hpp>
+
+namespace Neon::Geometry
+{
+    /// <summary>
+    /// Half of the surface area of the box, the SAH only compares areas.
+    /// </summary>
+    [[nodiscard]] static float HalfArea(
+        const Vector3& Min,
+        const Vector3& Max) noexcept
+    {
+        Vector3 Size = Max - Min;
+        return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+    }
+
+    //
+
+    DynamicBVH::DynamicBVH(
+        float Margin) :
+        m_Margin(Margin)
+    {
+    }
+
+    auto DynamicBVH::Insert(
+        const AABB& Box,
+        uint64_t    UserData) -> ProxyId
+    {
+        uint32_t Leaf = AllocateNode();
+
+        auto& LeafNode    = m_Nodes[Leaf];
+        LeafNode.Min      = Box.Min() - m_Margin;
+        LeafNode.Max      = Box.Max() + m_Margin;
+        LeafNode.UserData = UserData;
+        LeafNode.Height   = 0;
+
+        InsertLeaf(Leaf);
+        m_ProxyCount++;
+        return Leaf;
+    }
+
+    void DynamicBVH::Remove(
+        ProxyId Proxy)
+    {
+        RemoveLeaf(Proxy);
+        FreeNode(Proxy);
+        m_ProxyCount--;
+    }
+
+    bool DynamicBVH::Move(
+        ProxyId     Proxy,
+        const AABB& Box)
+    {
+        auto&   LeafNode = m_Nodes[Proxy];
+        Vector3 Min = Box.Min(), Max = Box.Max();
+
+        if (glm::all(glm::lessThanEqual(LeafNode.Min, Min)) && glm::all(glm::lessThanEqual(Max, LeafNode.Max)))
+        {
+            return false;
+        }
+
+        // A proxy that moved by less than the margin stays near its siblings, only the ancestors' boxes need to follow
+        // it. Chained refits would let it drift away, so it is reinserted after a few of them
+        bool SmallMove = glm::all(glm::lessThanEqual(LeafNode.Min - m_Margin, Min)) &&
+                         glm::all(glm::lessThanEqual(Max, LeafNode.Max + m_Margin));
+
+        LeafNode.Min = Min - m_Margin;
+        LeafNode.Max = Max + m_Margin;
+
+        if (SmallMove && LeafNode.Refits < s_MaxRefits)
+        {
+            LeafNode.Refits++;
+            RefitAncestors(LeafNode.Parent);
+        }
+        else
+        {
+            LeafNode.Refits = 0;
+            RemoveLeaf(Proxy);
+            InsertLeaf(Proxy);
+        }
+        return true;
+    }
+
+    void DynamicBVH::Rebuild()
+    {
+        std::vector<uint32_t> Leaves;
+        Leaves.reserve(m_ProxyCount);
+
+        for (uint32_t i = 0; i < m_Nodes.size(); i++)
+        {
+            auto& CurNode = m_Nodes[i];
+            if (CurNode.IsLeaf())
+            {
+                CurNode.Refits = 0;
+                Leaves.push_back(i);
+            }
+            else if (CurNode.Height > 0)
+            {
+                FreeNode(i);
+            }
+        }
+
+        m_Root = BuildSubtree(Leaves);
+        if (m_Root != s_NullNode)
+        {
+            m_Nodes[m_Root].Parent = s_NullNode;
+        }
+    }
+
+    void DynamicBVH::Clear()
+    {
+        m_Nodes.clear();
+        m_Root       = s_NullNode;
+        m_FreeList   = s_NullNode;
+        m_ProxyCount = 0;
+    }
+
+    //
+
+    auto DynamicBVH::GetStats() const -> Statistics
+    {
+        Statistics Stats{
+            .ProxyCount = m_ProxyCount,
+            .Height     = GetHeight()
+        };
+
+        if (m_Root == s_NullNode)
+        {
+            return Stats;
+        }
+
+        float InternalArea = 0.f;
+        for (auto& CurNode : m_Nodes)
+        {
+            if (CurNode.Height < 0)
+            {
+                continue;
+            }
+
+            Stats.NodeCount++;
+            if (CurNode.Height > 0)
+            {
+                InternalArea += HalfArea(CurNode.Min, CurNode.Max);
+            }
+        }
+
+        float RootArea  = HalfArea(m_Nodes[m_Root].Min, m_Nodes[m_Root].Max);
+        Stats.AreaRatio = RootArea > 0.f ? InternalArea / RootArea : 0.f;
+        return Stats;
+    }
+
+    bool DynamicBVH::Validate() const
+    {
+        if (m_Root == s_NullNode)
+        {
+            return m_ProxyCount == 0;
+        }
+        if (m_Nodes[m_Root].Parent != s_NullNode)
+        {
+            return false;
+        }
+
+        size_t    LeafCount = 0;
+        NodeStack Stack{ m_Root };
+        while (!Stack.empty())
+        {
+            uint32_t Index = Stack.back();
+            Stack.pop_back();
+
+            auto& CurNode = m_Nodes[Index];
+            if (CurNode.Height < 0)
+            {
+                return false;
+            }
+
+            if (CurNode.IsLeaf())
+            {
+                LeafCount++;
+                continue;
+            }
+
+            auto& Left  = m_Nodes[CurNode.Children[0]];
+            auto& Right = m_Nodes[CurNode.Children[1]];
+            if (Left.Parent != Index || Right.Parent != Index ||
+                CurNode.Height != 1 + std::max(Left.Height, Right.Height) ||
+                CurNode.Min != glm::min(Left.Min, Right.Min) ||
+                CurNode.Max != glm::max(Left.Max, Right.Max))
+            {
+                return false;
+            }
+
+            Stack.push_back(CurNode.Children[0]);
+            Stack.push_back(CurNode.Children[1]);
+        }
+        return LeafCount == m_ProxyCount;
+    }
+
+    //
+
+    uint32_t DynamicBVH::AllocateNode()
+    {
+        if (m_FreeList == s_NullNode)
+        {
+            m_Nodes.emplace_back();
+            return uint32_t(m_Nodes.size() - 1);
+        }
+
+        uint32_t Index = m_FreeList;
+        m_FreeList     = m_Nodes[Index].Parent;
+        m_Nodes[Index] = {};
+        return Index;
+    }
+
+    void DynamicBVH::FreeNode(
+        uint32_t Index)
+    {
+        auto& CurNode  = m_Nodes[Index];
+        CurNode.Height = -1;
+        CurNode.Parent = m_FreeList;
+        m_FreeList     = Index;
+    }
+
+    //
+
+    void DynamicBVH::InsertLeaf(
+        uint32_t Leaf)
+    {
+        if (m_Root == s_NullNode)
+        {
+            m_Root               = Leaf;
+            m_Nodes[Leaf].Parent = s_NullNode;
+            return;
+        }
+
+        Vector3 LeafMin = m_Nodes[Leaf].Min, LeafMax = m_Nodes[Leaf].Max;
+
+        // Walk down to the sibling that increases the surface area the least
+        uint32_t Sibling = m_Root;
+        while (!m_Nodes[Sibling].IsLeaf())
+        {
+            auto& CurNode = m_Nodes[Sibling];
+
+            float Area         = HalfArea(CurNode.Min, CurNode.Max);
+            float CombinedArea = HalfArea(glm::min(CurNode.Min, LeafMin), glm::max(CurNode.Max, LeafMax));
+
+            // Cost of making a new parent for this node and the leaf
+            float Cost = 2.f * CombinedArea;
+
+            // Minimum cost of pushing the leaf further down the tree
+            float InheritanceCost = 2.f * (CombinedArea - Area);
+
+            float ChildCosts[2];
+            for (uint32_t i = 0; i < 2; i++)
+            {
+                auto& Child   = m_Nodes[CurNode.Children[i]];
+                float NewArea = HalfArea(glm::min(Child.Min, LeafMin), glm::max(Child.Max, LeafMax));
+                ChildCosts[i] = (Child.IsLeaf() ? NewArea : NewArea - HalfArea(Child.Min, Child.Max)) + InheritanceCost;
+            }
+
+            if (Cost < ChildCosts[0] && Cost < ChildCosts[1])
+            {
+                break;
+            }
+            Sibling = CurNode.Children[ChildCosts[0] < ChildCosts[1] ? 0 : 1];
+        }
+
+        // Create a new parent for the leaf and its sibling
+        uint32_t OldParent = m_Nodes[Sibling].Parent;
+        uint32_t NewParent = AllocateNode();
+
+        auto& ParentNode       = m_Nodes[NewParent];
+        ParentNode.Parent      = OldParent;
+        ParentNode.Children[0] = Sibling;
+        ParentNode.Children[1] = Leaf;
+
+        if (OldParent == s_NullNode)
+        {
+            m_Root = NewParent;
+        }
+        else
+        {
+            auto& OldParentNode = m_Nodes[OldParent];
+
+            OldParentNode.Children[OldParentNode.Children[0] == Sibling ? 0 : 1] = NewParent;
+        }
+
+        m_Nodes[Sibling].Parent = NewParent;
+        m_Nodes[Leaf].Parent    = NewParent;
+
+        RefitAncestors(NewParent);
+    }
+
+    void DynamicBVH::RemoveLeaf(
+        uint32_t Leaf)
+    {
+        if (Leaf == m_Root)
+        {
+            m_Root = s_NullNode;
+            return;
+        }
+
+        uint32_t Parent      = m_Nodes[Leaf].Parent;
+        uint32_t GrandParent = m_Nodes[Parent].Parent;
+        uint32_t Sibling     = m_Nodes[Parent].Children[m_Nodes[Parent].Children[0] == Leaf ? 1 : 0];
+
+        m_Nodes[Sibling].Parent = GrandParent;
+        FreeNode(Parent);
+
+        if (GrandParent == s_NullNode)
+        {
+            m_Root = Sibling;
+        }
+        else
+        {
+            auto& GrandParentNode = m_Nodes[GrandParent];
+
+            GrandParentNode.Children[GrandParentNode.Children[0] == Parent ? 0 : 1] = Sibling;
+            RefitAncestors(GrandParent);
+        }
+    }
+
+    void DynamicBVH::RefitAncestors(
+        uint32_t Index)
+    {
+        for (; Index != s_NullNode; Index = m_Nodes[Index].Parent)
+        {
+            Refit(Index);
+            Rotate(Index);
+        }
+    }
+
+    void DynamicBVH::Refit(
+        uint32_t Index)
+    {
+        auto& CurNode = m_Nodes[Index];
+        auto& Left    = m_Nodes[CurNode.Children[0]];
+        auto& Right   = m_Nodes[CurNode.Children[1]];
+
+        CurNode.Min    = glm::min(Left.Min, Right.Min);
+        CurNode.Max    = glm::max(Left.Max, Right.Max);
+        CurNode.Height = int16_t(1 + std::max(Left.Height, Right.Height));
+    }
+
+    void DynamicBVH::Rotate(
+        uint32_t Index)
+    {
+        //       A
+        //     /   \
+        //    B     C
+        //   / \   / \
+        //  D   E F   G
+        uint32_t B = m_Nodes[Index].Children[0];
+        uint32_t C = m_Nodes[Index].Children[1];
+
+        auto& NodeB = m_Nodes[B];
+        auto& NodeC = m_Nodes[C];
+        if (NodeB.IsLeaf() && NodeC.IsLeaf())
+        {
+            return;
+        }
+
+        enum class Rotation : uint8_t
+        {
+            None,
+            BF,
+            BG,
+            CD,
+            CE,
+            DF,
+            DG
+        };
+
+        auto UnionArea = [this](uint32_t X, uint32_t Y)
+        {
+            return HalfArea(glm::min(m_Nodes[X].Min, m_Nodes[Y].Min), glm::max(m_Nodes[X].Max, m_Nodes[Y].Max));
+        };
+
+        Rotation Best     = Rotation::None;
+        float    BestGain = 0.f;
+
+        auto Consider = [&](Rotation Rot, float Gain)
+        {
+            if (Gain < BestGain)
+            {
+                Best     = Rot;
+                BestGain = Gain;
+            }
+        };
+
+        float AreaB = HalfArea(NodeB.Min, NodeB.Max);
+        float AreaC = HalfArea(NodeC.Min, NodeC.Max);
+
+        uint32_t D = NodeB.Children[0], E = NodeB.Children[1];
+        uint32_t F = NodeC.Children[0], G = NodeC.Children[1];
+
+        // Swapping B with a child of C changes the area of C, and the other way around
+        if (!NodeC.IsLeaf())
+        {
+            Consider(Rotation::BF, UnionArea(B, G) - AreaC);
+            Consider(Rotation::BG, UnionArea(B, F) - AreaC);
+        }
+        if (!NodeB.IsLeaf())
+        {
+            Consider(Rotation::CD, UnionArea(C, E) - AreaB);
+            Consider(Rotation::CE, UnionArea(C, D) - AreaB);
+        }
+        if (!NodeB.IsLeaf() && !NodeC.IsLeaf())
+        {
+            Consider(Rotation::DF, UnionArea(F, E) + UnionArea(D, G) - AreaB - AreaC);
+            Consider(Rotation::DG, UnionArea(G, E) + UnionArea(F, D) - AreaB - AreaC);
+        }
+
+        // Swap the child at Slot of X with the child at Slot of Y
+        auto Swap = [this](uint32_t X, uint32_t SlotX, uint32_t Y, uint32_t SlotY)
+        {
+            uint32_t ChildX = m_Nodes[X].Children[SlotX];
+            uint32_t ChildY = m_Nodes[Y].Children[SlotY];
+
+            m_Nodes[X].Children[SlotX] = ChildY;
+            m_Nodes[Y].Children[SlotY] = ChildX;
+            m_Nodes[ChildY].Parent     = X;
+            m_Nodes[ChildX].Parent     = Y;
+        };
+
+        switch (Best)
+        {
+        case Rotation::None:
+            return;
+        case Rotation::BF:
+            Swap(Index, 0, C, 0);
+            Refit(C);
+            break;
+        case Rotation::BG:
+            Swap(Index, 0, C, 1);
+            Refit(C);
+            break;
+        case Rotation::CD:
+            Swap(Index, 1, B, 0);
+            Refit(B);
+            break;
+        case Rotation::CE:
+            Swap(Index, 1, B, 1);
+            Refit(B);
+            break;
+        case Rotation::DF:
+            Swap(B, 0, C, 0);
+            Refit(B);
+            Refit(C);
+            break;
+        case Rotation::DG:
+            Swap(B, 0, C, 1);
+            Refit(B);
+            Refit(C);
+            break;
+        }
+        Refit(Index);
+    }
+
+    //
+
+    uint32_t DynamicBVH::BuildSubtree(
+        std::span<uint32_t> Leaves)
+    {
+        if (Leaves.empty())
+        {
+            return s_NullNode;
+        }
+
+        constexpr uint32_t BinCount = 16;
+
+        struct Bin
+        {
+            Vector3 Min{ std::numeric_limits<float>::max() };
+            Vector3 Max{ std::numeric_limits<float>::lowest() };
+            size_t  Count = 0;
+
+            void Grow(
+                const Vector3& BoxMin,
+                const Vector3& BoxMax)
+            {
+                Min = glm::min(Min, BoxMin);
+                Max = glm::max(Max, BoxMax);
+            }
+        };
+
+        struct BuildTask
+        {
+            std::span<uint32_t> Leaves;
+            uint32_t            Parent;
+            uint32_t            Slot;
+        };
+
+        uint32_t Root = s_NullNode;
+
+        // Subtrees are built from an explicit stack, degenerate inputs can't overflow the call stack
+        std::vector<BuildTask> Tasks{ { Leaves, s_NullNode, 0 } };
+        while (!Tasks.empty())
+        {
+            auto Task = Tasks.back();
+            Tasks.pop_back();
+
+            uint32_t Index;
+            if (Task.Leaves.size() == 1)
+            {
+                Index = Task.Leaves[0];
+            }
+            else
+            {
+                // Split along the longest axis of the centers' bounds
+                Vector3 CenterMin{ std::numeric_limits<float>::max() };
+                Vector3 CenterMax{ std::numeric_limits<float>::lowest() };
+                for (uint32_t Leaf : Task.Leaves)
+                {
+                    Vector3 Center = m_Nodes[Leaf].Min + m_Nodes[Leaf].Max;
+                    CenterMin      = glm::min(CenterMin, Center);
+                    CenterMax      = glm::max(CenterMax, Center);
+                }
+
+                Vector3 CenterSize = CenterMax - CenterMin;
+                int     Axis       = CenterSize.x > CenterSize.y ? (CenterSize.x > CenterSize.z ? 0 : 2) : (CenterSize.y > CenterSize.z ? 1 : 2);
+
+                size_t SplitCount = Task.Leaves.size() / 2;
+                if (CenterSize[Axis] > 0.f)
+                {
+                    float Scale  = float(BinCount) / CenterSize[Axis];
+                    auto  GetBin = [&](uint32_t Leaf)
+                    {
+                        float Center = m_Nodes[Leaf].Min[Axis] + m_Nodes[Leaf].Max[Axis];
+                        return std::min(uint32_t((Center - CenterMin[Axis]) * Scale), BinCount - 1);
+                    };
+
+                    std::array<Bin, BinCount> Bins;
+                    for (uint32_t Leaf : Task.Leaves)
+                    {
+                        auto& CurBin = Bins[GetBin(Leaf)];
+                        CurBin.Grow(m_Nodes[Leaf].Min, m_Nodes[Leaf].Max);
+                        CurBin.Count++;
+                    }
+
+                    // Sweep from the right to get the cost of each right side, then from the left
+                    std::array<float, BinCount> RightCosts;
+                    Bin                         Right;
+                    for (uint32_t i = BinCount - 1; i > 0; i--)
+                    {
+                        if (Bins[i].Count)
+                        {
+                            Right.Grow(Bins[i].Min, Bins[i].Max);
+                            Right.Count += Bins[i].Count;
+                        }
+                        RightCosts[i] = Right.Count ? HalfArea(Right.Min, Right.Max) * float(Right.Count) : 0.f;
+                    }
+
+                    Bin      Left;
+                    float    BestCost  = std::numeric_limits<float>::max();
+                    uint32_t BestSplit = 0;
+                    for (uint32_t i = 1; i < BinCount; i++)
+                    {
+                        if (Bins[i - 1].Count)
+                        {
+                            Left.Grow(Bins[i - 1].Min, Bins[i - 1].Max);
+                            Left.Count += Bins[i - 1].Count;
+                        }
+
+                        if (!Left.Count || Left.Count == Task.Leaves.size())
+                        {
+                            continue;
+                        }
+
+                        float Cost = HalfArea(Left.Min, Left.Max) * float(Left.Count) + RightCosts[i];
+                        if (Cost < BestCost)
+                        {
+                            BestCost  = Cost;
+                            BestSplit = i;
+                        }
+                    }
+
+                    if (BestSplit)
+                    {
+                        auto Middle = std::partition(
+                            Task.Leaves.begin(),
+                            Task.Leaves.end(),
+                            [&](uint32_t Leaf)
+                            {
+                                return GetBin(Leaf) < BestSplit;
+                            });
+                        SplitCount = size_t(Middle - Task.Leaves.begin());
+                    }
+                }
+
+                Index                 = AllocateNode();
+                m_Nodes[Index].Height = 1;
+
+                Tasks.push_back({ Task.Leaves.first(SplitCount), Index, 0 });
+                Tasks.push_back({ Task.Leaves.subspan(SplitCount), Index, 1 });
+            }
+
+            m_Nodes[Index].Parent = Task.Parent;
+            if (Task.Parent == s_NullNode)
+            {
+                Root = Index;
+            }
+            else
+            {
+                m_Nodes[Task.Parent].Children[Task.Slot] = Index;
+            }
+        }
+
+        // Internal nodes are allocated before their children, refit them in reverse order of allocation
+        std::vector<uint32_t> Internals;
+        NodeStack             Stack{ Root };
+        while (!Stack.empty())
+        {
+            uint32_t Index = Stack.back();
+            Stack.pop_back();
+            if (!m_Nodes[Index].IsLeaf())
+            {
+                Internals.push_back(Index);
+                Stack.push_back(m_Nodes[Index].Children[0]);
+                Stack.push_back(m_Nodes[Index].Children[1]);
+            }
+        }
+        for (auto Index : Internals | std::views::reverse)
+        {
+            Refit(Index);
+        }
+        return Root;
+    }
+} // namespace Neon::Geometry
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include <CorePCH.hpp>
+#include <Geometry/Culling.hpp>
+
+#if defined(__AVX__)
+#define NEON_CULLING_AVX
+#include <immintrin.h>
+#elif defined(_M_X64) || defined(__SSE2__)
+#define NEON_CULLING_SSE
+#include <emmintrin.h>
+#endif
+
+namespace Neon::Geometry
+{
+    void AABBList::Reserve(
+        size_t Count)
+    {
+        for (auto List : { &m_CenterX, &m_CenterY, &m_CenterZ, &m_ExtentX, &m_ExtentY, &m_ExtentZ })
+        {
+            List->reserve(Count);
+        }
+    }
+
+    void AABBList::Clear() noexcept
+    {
+        for (auto List : { &m_CenterX, &m_CenterY, &m_CenterZ, &m_ExtentX, &m_ExtentY, &m_ExtentZ })
+        {
+            List->clear();
+        }
+    }
+
+    size_t AABBList::Add(
+        const AABB& Box)
+    {
+        m_CenterX.push_back(Box.Center.x);
+        m_CenterY.push_back(Box.Center.y);
+        m_CenterZ.push_back(Box.Center.z);
+        m_ExtentX.push_back(Box.Extents.x);
+        m_ExtentY.push_back(Box.Extents.y);
+        m_ExtentZ.push_back(Box.Extents.z);
+        return m_CenterX.size() - 1;
+    }
+
+    void AABBList::Set(
+        size_t      Index,
+        const AABB& Box) noexcept
+    {
+        m_CenterX[Index] = Box.Center.x;
+        m_CenterY[Index] = Box.Center.y;
+        m_CenterZ[Index] = Box.Center.z;
+        m_ExtentX[Index] = Box.Extents.x;
+        m_ExtentY[Index] = Box.Extents.y;
+        m_ExtentZ[Index] = Box.Extents.z;
+    }
+
+    AABB AABBList::Get(
+        size_t Index) const noexcept
+    {
+        return {
+            .Center  = { m_CenterX[Index], m_CenterY[Index], m_CenterZ[Index] },
+            .Extents = { m_ExtentX[Index], m_ExtentY[Index], m_ExtentZ[Index] }
+        };
+    }
+
+    //
+
+    FrustumCuller::FrustumCuller(
+        const Frustum& Fr)
+    {
+        SetFrustum(Fr);
+    }
+
+    void FrustumCuller::SetFrustum(
+        const Frustum& Fr)
+    {
+        m_Planes = Fr.GetPlanes();
+        for (size_t i = 0; i < m_Planes.size(); i++)
+        {
+            auto& Plane = m_Planes[i];
+
+            m_Components.NormalX[i]    = Plane.x;
+            m_Components.NormalY[i]    = Plane.y;
+            m_Components.NormalZ[i]    = Plane.z;
+            m_Components.Distance[i]   = Plane.w;
+            m_Components.AbsNormalX[i] = std::abs(Plane.x);
+            m_Components.AbsNormalY[i] = std::abs(Plane.y);
+            m_Components.AbsNormalZ[i] = std::abs(Plane.z);
+        }
+    }
+
+    ContainmentType FrustumCuller::Contains(
+        const AABB& Box) const
+    {
+        return Box.Contains(m_Planes);
+    }
+
+    bool FrustumCuller::IsVisible(
+        const AABB& Box) const
+    {
+        return Contains(Box) != ContainmentType::Disjoint;
+    }
+
+    //
+
+    void FrustumCuller::Cull(
+        const AABBList&     Boxes,
+        std::span<uint64_t> Visibility) const
+    {
+        size_t Count = Boxes.GetSize();
+        size_t First = 0;
+
+        std::fill_n(Visibility.begin(), GetMaskSize(Count), 0);
+
+        auto [CenterX, CenterY, CenterZ] = Boxes.GetCenters();
+        auto [ExtentX, ExtentY, ExtentZ] = Boxes.GetExtents();
+
+        // The batches compute the distance and radius in the same order as Math::Plane::IntersectAxisAlignedBox
+        // (glm's dot products), so a box is culled only if the scalar test culls it too.
+#if defined(NEON_CULLING_AVX)
+        for (; First + 8 <= Count; First += 8)
+        {
+            __m256 Cx = _mm256_loadu_ps(CenterX + First);
+            __m256 Cy = _mm256_loadu_ps(CenterY + First);
+            __m256 Cz = _mm256_loadu_ps(CenterZ + First);
+            __m256 Ex = _mm256_loadu_ps(ExtentX + First);
+            __m256 Ey = _mm256_loadu_ps(ExtentY + First);
+            __m256 Ez = _mm256_loadu_ps(ExtentZ + First);
+
+            __m256 Outside = _mm256_setzero_ps();
+            for (size_t i = 0; i < 6; i++)
+            {
+                __m256 Dist = _mm256_add_ps(
+                    _mm256_add_ps(
+                        _mm256_mul_ps(Cx, _mm256_set1_ps(m_Components.NormalX[i])),
+                        _mm256_mul_ps(Cy, _mm256_set1_ps(m_Components.NormalY[i]))),
+                    _mm256_add_ps(
+                        _mm256_mul_ps(Cz, _mm256_set1_ps(m_Components.NormalZ[i])),
+                        _mm256_set1_ps(m_Components.Distance[i])));
+
+                __m256 Radius = _mm256_add_ps(
+                    _mm256_add_ps(
+                        _mm256_mul_ps(Ex, _mm256_set1_ps(m_Components.AbsNormalX[i])),
+                        _mm256_mul_ps(Ey, _mm256_set1_ps(m_Components.AbsNormalY[i]))),
+                    _mm256_mul_ps(Ez, _mm256_set1_ps(m_Components.AbsNormalZ[i])));
+
+                Outside = _mm256_or_ps(Outside, _mm256_cmp_ps(Dist, Radius, _CMP_GT_OQ));
+            }
+
+            uint64_t Visible = uint64_t(~_mm256_movemask_ps(Outside) & 0xFF);
+            Visibility[First / 64] |= Visible << (First % 64);
+        }
+#elif defined(NEON_CULLING_SSE)
+        for (; First + 4 <= Count; First += 4)
+        {
+            __m128 Cx = _mm_loadu_ps(CenterX + First);
+            __m128 Cy = _mm_loadu_ps(CenterY + First);
+            __m128 Cz = _mm_loadu_ps(CenterZ + First);
+            __m128 Ex = _mm_loadu_ps(ExtentX + First);
+            __m128 Ey = _mm_loadu_ps(ExtentY + First);
+            __m128 Ez = _mm_loadu_ps(ExtentZ + First);
+
+            __m128 Outside = _mm_setzero_ps();
+            for (size_t i = 0; i < 6; i++)
+            {
+                __m128 Dist = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps(Cx, _mm_set1_ps(m_Components.NormalX[i])),
+                        _mm_mul_ps(Cy, _mm_set1_ps(m_Components.NormalY[i]))),
+                    _mm_add_ps(
+                        _mm_mul_ps(Cz, _mm_set1_ps(m_Components.NormalZ[i])),
+                        _mm_set1_ps(m_Components.Distance[i])));
+
+                __m128 Radius = _mm_add_ps(
+                    _mm_add_ps(
+                        _mm_mul_ps(Ex, _mm_set1_ps(m_Components.AbsNormalX[i])),
+                        _mm_mul_ps(Ey, _mm_set1_ps(m_Components.AbsNormalY[i]))),
+                    _mm_mul_ps(Ez, _mm_set1_ps(m_Components.AbsNormalZ[i])));
+
+                Outside = _mm_or_ps(Outside, _mm_cmpgt_ps(Dist, Radius));
+            }
+
+            uint64_t Visible = uint64_t(~_mm_movemask_ps(Outside) & 0xF);
+            Visibility[First / 64] |= Visible << (First % 64);
+        }
+#endif
+
+        for (; First < Count; First++)
+        {
+            if (IsVisible(Boxes.Get(First)))
+            {
+                Visibility[First / 64] |= uint64_t(1) << (First % 64);
+            }
+        }
+    }
+
+    void FrustumCuller::CullScalar(
+        const AABBList&     Boxes,
+        std::span<uint64_t> Visibility) const
+    {
+        size_t Count = Boxes.GetSize();
+        std::fill_n(Visibility.begin(), GetMaskSize(Count), 0);
+
+        for (size_t i = 0; i < Count; i++)
+        {
+            if (IsVisible(Boxes.Get(i)))
+            {
+                Visibility[i / 64] |= uint64_t(1) << (i % 64);
+            }
+        }
+    }
+} // namespace Neon::Geometry
\ No newline at end of file
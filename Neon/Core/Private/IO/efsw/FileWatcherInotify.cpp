@@ -544,7 +544,7 @@ namespace efsw
         delete[] buff;
     }
 
-    void FileWatcherInotify::checkForNEON_NEWWatcher(Watcher* watch, std::string fpath)
+    void FileWatcherInotify::checkForNewWatcher(Watcher* watch, std::string fpath)
     {
         FileSystem::dirAddSlashAtEnd(fpath);
 
@@ -604,7 +604,7 @@ namespace efsw
                 watch->Listener->handleFileAction(watch->ID, watch->Directory, filename,
                                                   Actions::Modified);
 
-                checkForNEON_NEWWatcher(watch, fpath);
+                checkForNewWatcher(watch, fpath);
             }
             else
             {
@@ -642,7 +642,7 @@ namespace efsw
         {
             watch->Listener->handleFileAction(watch->ID, watch->Directory, filename, Actions::Add);
 
-            checkForNEON_NEWWatcher(watch, fpath);
+            checkForNewWatcher(watch, fpath);
         }
         else if (IN_MOVED_FROM & action)
         {
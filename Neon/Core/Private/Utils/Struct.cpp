@@ -150,7 +150,7 @@ namespace Neon::Structured
     }
 
     void LayoutBuilder::ElementView::GetHashCode(
-        Crypto::Sha256& Hash) const
+        Crypto::Hash128& Hash) const
     {
         auto NestedType = m_Element->GetType();
         Hash.Append(&NestedType, sizeof(NestedType));
@@ -212,10 +212,10 @@ namespace Neon::Structured
         return Layout(GPULayout, GetAlignement(), m_Element);
     }
 
-    Crypto::Sha256::Bytes LayoutBuilder::GetHashCode(
+    Crypto::Hash128::Bytes LayoutBuilder::GetHashCode(
         bool GPULayout) const
     {
-        Crypto::Sha256 Hash;
+        Crypto::Hash128 Hash;
         Hash << GPULayout << m_Alignement;
 
         ElementView(const_cast<Element*>(&m_Element)).GetHashCode(Hash);
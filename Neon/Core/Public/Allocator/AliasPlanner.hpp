@@ -0,0 +1,189 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Places transient resources in shared heaps so that resources whose lifetimes don't overlap use the same memory.
+    /// Lifetimes are inclusive ranges of uses (passes or dependency levels), two resources alive during a same use
+    /// never overlap in memory.
+    /// Resources are placed from the largest to the smallest, each one in the smallest gap left by the resources it is
+    /// alive with (greedy best fit), then the aliasing barriers needed when a resource takes over the memory of
+    /// another one are emitted at its first use.
+    /// Alignements must be powers of two.
+    /// </summary>
+    class AliasPlanner
+    {
+    public:
+        static constexpr uint32_t s_NullResource = std::numeric_limits<uint32_t>::max();
+
+        struct Resource
+        {
+            size_t   Size;
+            size_t   Alignement = 1;
+            uint32_t FirstUse;
+            uint32_t LastUse;
+        };
+
+        struct Placement
+        {
+            uint32_t Heap   = 0;
+            size_t   Offset = 0;
+        };
+
+        /// <summary>
+        /// Barrier to execute before After is first used, Before is the resource that used its memory last.
+        /// </summary>
+        struct AliasingBarrier
+        {
+            uint32_t Use;
+            uint32_t Before;
+            uint32_t After;
+        };
+
+    public:
+        /// <summary>
+        /// A max heap size of 0 puts every resource in a single heap, otherwise a new heap is created when a
+        /// resource doesn't fit in the existing ones. Resources larger than the max heap size get their own heap.
+        /// </summary>
+        explicit AliasPlanner(
+            size_t MaxHeapSize = 0) :
+            m_MaxHeapSize(MaxHeapSize)
+        {
+        }
+
+        /// <summary>
+        /// Add a resource and return its index.
+        /// </summary>
+        uint32_t Add(
+            const Resource& Res);
+
+        /// <summary>
+        /// Remove every resource and the plan.
+        /// </summary>
+        void Clear() noexcept;
+
+        /// <summary>
+        /// Compute the placements, heaps and barriers of the resources.
+        /// </summary>
+        void Build();
+
+        /// <summary>
+        /// Check that no two resources alive at the same time overlap and that the placements are aligned.
+        /// </summary>
+        [[nodiscard]] bool Validate() const;
+
+    public:
+        /// <summary>
+        /// Get the resources.
+        /// </summary>
+        [[nodiscard]] std::span<const Resource> GetResources() const noexcept
+        {
+            return m_Resources;
+        }
+
+        /// <summary>
+        /// Get the placement of a resource, valid after Build.
+        /// </summary>
+        [[nodiscard]] const Placement& GetPlacement(
+            uint32_t Index) const noexcept
+        {
+            return m_Placements[Index];
+        }
+
+        /// <summary>
+        /// Get the size of every heap, valid after Build.
+        /// </summary>
+        [[nodiscard]] std::span<const size_t> GetHeapSizes() const noexcept
+        {
+            return m_HeapSizes;
+        }
+
+        /// <summary>
+        /// Get the barriers sorted by use, valid after Build.
+        /// </summary>
+        [[nodiscard]] std::span<const AliasingBarrier> GetBarriers() const noexcept
+        {
+            return m_Barriers;
+        }
+
+        /// <summary>
+        /// Get the barriers to execute before a use, valid after Build.
+        /// </summary>
+        [[nodiscard]] std::span<const AliasingBarrier> GetBarriers(
+            uint32_t Use) const noexcept;
+
+        /// <summary>
+        /// Get the memory used by all the heaps, valid after Build.
+        /// </summary>
+        [[nodiscard]] size_t GetTotalSize() const noexcept;
+
+        /// <summary>
+        /// Get the memory the resources would use without aliasing.
+        /// </summary>
+        [[nodiscard]] size_t GetUnaliasedSize() const noexcept;
+
+        /// <summary>
+        /// Get the largest memory alive during a single use, no placement can use less.
+        /// </summary>
+        [[nodiscard]] size_t GetLowerBound() const;
+
+    private:
+        /// <summary>
+        /// Find the offset of the smallest gap of a heap where a resource fits between the resources it is alive with.
+        /// Returns the offset after them if no gap fits.
+        /// </summary>
+        [[nodiscard]] size_t FindOffset(
+            uint32_t Index,
+            uint32_t Heap) const;
+
+        /// <summary>
+        /// Emit the barriers of every resource placed over resources that died before it.
+        /// </summary>
+        void BuildBarriers();
+
+        /// <summary>
+        /// Check if both resources are alive during a same use.
+        /// </summary>
+        [[nodiscard]] bool LifetimesOverlap(
+            uint32_t First,
+            uint32_t Second) const noexcept
+        {
+            return m_Resources[First].FirstUse <= m_Resources[Second].LastUse &&
+                   m_Resources[Second].FirstUse <= m_Resources[First].LastUse;
+        }
+
+        /// <summary>
+        /// Check if both resources are in the same heap and share memory.
+        /// </summary>
+        [[nodiscard]] bool MemoryOverlaps(
+            uint32_t First,
+            uint32_t Second) const noexcept
+        {
+            auto& A = m_Placements[First];
+            auto& B = m_Placements[Second];
+            return A.Heap == B.Heap &&
+                   A.Offset < B.Offset + m_Resources[Second].Size &&
+                   B.Offset < A.Offset + m_Resources[First].Size;
+        }
+
+    private:
+        size_t m_MaxHeapSize;
+
+        std::vector<Resource>        m_Resources;
+        std::vector<Placement>       m_Placements;
+        std::vector<size_t>          m_HeapSizes;
+        std::vector<AliasingBarrier> m_Barriers;
+
+        /// <summary>
+        /// Resources already placed in each heap, used while building.
+        /// </summary>
+        std::vector<std::vector<uint32_t>> m_HeapResources;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <Math/Common.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Bump allocator over a list of chunks, memory is only released all at once with Reset.
+    /// Objects created in the arena are never destroyed, so they must be trivially destructible.
+    /// </summary>
+    class LinearArena
+    {
+    public:
+        static constexpr size_t s_DefaultChunkSize = 64 * 1024;
+
+        explicit LinearArena(
+            size_t ChunkSize = s_DefaultChunkSize) :
+            m_ChunkSize(ChunkSize)
+        {
+        }
+
+        NEON_CLASS_NO_COPY(LinearArena);
+        NEON_CLASS_MOVE(LinearArena);
+
+        ~LinearArena() = default;
+
+        /// <summary>
+        /// Allocate Size bytes aligned to Alignement (must be a power of two).
+        /// </summary>
+        [[nodiscard]] void* Allocate(
+            size_t Size,
+            size_t Alignement = alignof(std::max_align_t))
+        {
+            if (m_ChunkIndex < m_Chunks.size())
+            {
+                auto&  CurChunk = m_Chunks[m_ChunkIndex];
+                size_t Offset   = GetAlignedOffset(CurChunk, m_Offset, Alignement);
+                if (Offset + Size <= CurChunk.Size)
+                {
+                    m_Offset = Offset + Size;
+                    m_UsedSize += Size;
+                    return CurChunk.Data.get() + Offset;
+                }
+            }
+            return AllocateSlow(Size, Alignement);
+        }
+
+        /// <summary>
+        /// Create an object in the arena.
+        /// </summary>
+        template<typename _Ty, typename... _Args>
+            requires std::is_trivially_destructible_v<_Ty>
+        [[nodiscard]] _Ty* New(
+            _Args&&... Args)
+        {
+            return new (Allocate(sizeof(_Ty), alignof(_Ty))) _Ty(std::forward<_Args>(Args)...);
+        }
+
+        /// <summary>
+        /// Allocate an uninitialized array in the arena.
+        /// </summary>
+        template<typename _Ty>
+            requires std::is_trivially_destructible_v<_Ty>
+        [[nodiscard]] _Ty* NewArray(
+            size_t Count)
+        {
+            return static_cast<_Ty*>(Allocate(sizeof(_Ty) * Count, alignof(_Ty)));
+        }
+
+        /// <summary>
+        /// Release every allocation at once.
+        /// If the arena had to grow, its chunks are merged into a single one so the next round fits without growing.
+        /// </summary>
+        void Reset();
+
+        /// <summary>
+        /// Get the number of bytes allocated since the last reset.
+        /// </summary>
+        [[nodiscard]] size_t GetUsedSize() const noexcept
+        {
+            return m_UsedSize;
+        }
+
+        /// <summary>
+        /// Get the number of bytes reserved by the arena.
+        /// </summary>
+        [[nodiscard]] size_t GetCapacity() const noexcept
+        {
+            return m_Capacity;
+        }
+
+    private:
+        struct Chunk
+        {
+            UPtr<std::byte[]> Data;
+            size_t            Size;
+        };
+
+        /// <summary>
+        /// Align an offset in a chunk so that the address it points to is aligned.
+        /// </summary>
+        [[nodiscard]] static size_t GetAlignedOffset(
+            const Chunk& CurChunk,
+            size_t       Offset,
+            size_t       Alignement) noexcept
+        {
+            auto Base = reinterpret_cast<uintptr_t>(CurChunk.Data.get());
+            return Math::AlignUp(Base + Offset, Alignement) - Base;
+        }
+
+        /// <summary>
+        /// Move to the next chunk, or allocate a new one when the arena is full.
+        /// </summary>
+        [[nodiscard]] void* AllocateSlow(
+            size_t Size,
+            size_t Alignement);
+
+    private:
+        std::vector<Chunk> m_Chunks;
+        size_t             m_ChunkSize;
+        size_t             m_ChunkIndex = 0;
+        size_t             m_Offset     = 0;
+        size_t             m_UsedSize   = 0;
+        size_t             m_Capacity   = 0;
+    };
+
+    /// <summary>
+    /// Per-thread linear arenas for memory that only lives for a frame.
+    /// Each thread owns a ring of s_FrameCount arenas, an allocation made during frame N stays valid until
+    /// the same thread allocates during frame N + s_FrameCount, which covers the frames in flight.
+    /// Nothing is freed explicitly, the arena of a frame is rewound the first time it is used again.
+    /// </summary>
+    class FrameArena
+    {
+    public:
+        static constexpr uint32_t s_FrameCount = 3;
+
+        /// <summary>
+        /// Start a new frame, called once per frame by the engine's main loop.
+        /// </summary>
+        static void NewFrame();
+
+        /// <summary>
+        /// Release the memory of every thread's arenas, no frame allocation must be alive.
+        /// </summary>
+        static void Shutdown();
+
+        /// <summary>
+        /// Get the index of the current frame.
+        /// </summary>
+        [[nodiscard]] static uint64_t GetFrameIndex() noexcept;
+
+        /// <summary>
+        /// Allocate memory from the calling thread's arena for the current frame.
+        /// </summary>
+        [[nodiscard]] static void* Allocate(
+            size_t Size,
+            size_t Alignement = alignof(std::max_align_t));
+
+        /// <summary>
+        /// Create an object in the calling thread's arena for the current frame.
+        /// </summary>
+        template<typename _Ty, typename... _Args>
+            requires std::is_trivially_destructible_v<_Ty>
+        [[nodiscard]] static _Ty* New(
+            _Args&&... Args)
+        {
+            return new (Allocate(sizeof(_Ty), alignof(_Ty))) _Ty(std::forward<_Args>(Args)...);
+        }
+
+        /// <summary>
+        /// Get a memory resource allocating from the calling thread's arena for the current frame.
+        /// Containers using it must not outlive the frame, deallocation is a no-op.
+        /// </summary>
+        [[nodiscard]] static std::pmr::memory_resource* GetResource() noexcept;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
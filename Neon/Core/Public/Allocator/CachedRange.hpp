@@ -0,0 +1,399 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <Allocator/TLSF.hpp>
+#include <Log/Logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Offset allocator for a range of slots (e.g. descriptors in a heap) shared by many threads.
+    /// Small allocations are bumped from chunks cached per thread, so they don't take any lock. Each chunk counts its
+    /// live allocations and goes back to a lock-free free list once they are all freed, the space inside a chunk is
+    /// not reused before that. A single long-lived allocation keeps its whole chunk, and each thread slot keeps the last
+    /// chunk it bumped from, so in the worst case every live allocation and every thread that allocated pins ChunkSize
+    /// slots.
+    /// Chunks are carved from a shared TLSF allocator which also serves the allocations that don't fit in a chunk,
+    /// only this shared path is locked.
+    /// </summary>
+    class CachedRangeAllocator
+    {
+    public:
+        static constexpr uint32_t s_DefaultChunkSize = 64;
+        static constexpr uint32_t s_ThreadSlotCount  = 32;
+
+        struct Handle
+        {
+            uint32_t Offset = std::numeric_limits<uint32_t>::max();
+            uint32_t Size   = 0;
+
+            operator bool() const noexcept
+            {
+                return Size != 0;
+            }
+        };
+
+        struct Statistics
+        {
+            size_t CarvedChunks = 0;
+            size_t FreeChunks   = 0;
+
+            TLSFAllocator::Statistics Shared;
+        };
+
+    private:
+        static constexpr uint32_t s_NullChunk = std::numeric_limits<uint32_t>::max();
+
+        struct ChunkState
+        {
+            /// <summary>
+            /// Live allocations in the chunk, plus one while a thread slot owns it.
+            /// </summary>
+            std::atomic<uint32_t> Live   = 0;
+            std::atomic<uint32_t> Next   = s_NullChunk;
+            std::atomic<bool>     Carved = false;
+        };
+
+        struct alignas(64) ThreadSlot
+        {
+            std::atomic_flag Busy;
+            uint32_t         Chunk  = s_NullChunk;
+            uint32_t         Offset = 0;
+        };
+
+    public:
+        explicit CachedRangeAllocator(
+            uint32_t Size,
+            uint32_t ChunkSize = s_DefaultChunkSize) :
+            m_Size(Size),
+            m_ChunkSize(std::max(ChunkSize, 1u)),
+            m_ChunkCount(Size / m_ChunkSize),
+            m_Chunks(std::make_unique<ChunkState[]>(m_ChunkCount)),
+            m_Shared(Size, 64)
+        {
+            NEON_ASSERT(std::has_single_bit(m_ChunkSize), "Chunk size must be a power of two, chunks are aligned to it");
+        }
+
+        NEON_CLASS_NO_COPYMOVE(CachedRangeAllocator);
+
+        ~CachedRangeAllocator() = default;
+
+        /// <summary>
+        /// Allocate Count contiguous slots, returns an empty handle if the range is full.
+        /// </summary>
+        [[nodiscard]] Handle Allocate(
+            uint32_t Count)
+        {
+            if (!Count) [[unlikely]]
+            {
+                return {};
+            }
+
+            if (Count <= m_ChunkSize)
+            {
+                auto& Slot = m_Slots[GetThreadSlot()];
+                if (!Slot.Busy.test_and_set(std::memory_order_acquire)) [[likely]]
+                {
+                    Handle Hndl = AllocateFromSlot(Slot, Count);
+                    Slot.Busy.clear(std::memory_order_release);
+                    if (Hndl)
+                    {
+                        return Hndl;
+                    }
+                }
+            }
+            return AllocateShared(Count);
+        }
+
+        /// <summary>
+        /// Free a batch of handles, chunk counters are updated once per chunk and the shared allocator is locked once.
+        /// </summary>
+        void Free(
+            std::span<const Handle> Handles)
+        {
+            // Batches are usually a frame's worth of stale handles, group the ones that share a chunk
+            std::vector<uint32_t> ChunkFrees;
+            std::vector<Handle>   SharedFrees;
+            for (auto& Hndl : Handles)
+            {
+                if (!Hndl)
+                {
+                    continue;
+                }
+
+                uint32_t ChunkIndex = Hndl.Offset / m_ChunkSize;
+                if (ChunkIndex < m_ChunkCount && m_Chunks[ChunkIndex].Carved.load(std::memory_order_relaxed))
+                {
+                    ChunkFrees.push_back(ChunkIndex);
+                }
+                else
+                {
+                    SharedFrees.push_back(Hndl);
+                }
+            }
+
+            std::ranges::sort(ChunkFrees);
+            for (size_t i = 0; i < ChunkFrees.size();)
+            {
+                size_t First = i;
+                while (++i < ChunkFrees.size() && ChunkFrees[i] == ChunkFrees[First])
+                {
+                }
+                ReleaseChunk(ChunkFrees[First], uint32_t(i - First));
+            }
+
+            if (!SharedFrees.empty())
+            {
+                std::scoped_lock Lock(m_SharedMutex);
+                for (auto& Hndl : SharedFrees)
+                {
+                    m_Shared.Free({ .Offset = Hndl.Offset, .Size = Hndl.Size });
+                }
+            }
+        }
+
+        /// <summary>
+        /// Free a single handle.
+        /// </summary>
+        void Free(
+            const Handle& Hndl)
+        {
+            if (!Hndl)
+            {
+                return;
+            }
+
+            uint32_t ChunkIndex = Hndl.Offset / m_ChunkSize;
+            if (ChunkIndex < m_ChunkCount && m_Chunks[ChunkIndex].Carved.load(std::memory_order_relaxed))
+            {
+                ReleaseChunk(ChunkIndex, 1);
+            }
+            else
+            {
+                std::scoped_lock Lock(m_SharedMutex);
+                m_Shared.Free({ .Offset = Hndl.Offset, .Size = Hndl.Size });
+            }
+        }
+
+        /// <summary>
+        /// Free every allocation at once, must not be called while other threads use the allocator.
+        /// </summary>
+        void FreeAll()
+        {
+            std::scoped_lock Lock(m_SharedMutex);
+            for (auto& Slot : m_Slots)
+            {
+                Slot.Chunk  = s_NullChunk;
+                Slot.Offset = 0;
+            }
+            for (uint32_t i = 0; i < m_ChunkCount; i++)
+            {
+                m_Chunks[i].Live.store(0, std::memory_order_relaxed);
+                m_Chunks[i].Carved.store(false, std::memory_order_relaxed);
+            }
+            m_FreeChunks.store(s_NullChunk, std::memory_order_relaxed);
+            m_Shared = TLSFAllocator(m_Size, 64);
+        }
+
+        /// <summary>
+        /// Get the size of the range.
+        /// </summary>
+        [[nodiscard]] uint32_t GetSize() const noexcept
+        {
+            return m_Size;
+        }
+
+        /// <summary>
+        /// Get the chunk and shared allocator usage, must not be called while other threads use the allocator.
+        /// </summary>
+        [[nodiscard]] Statistics GetStats()
+        {
+            std::scoped_lock Lock(m_SharedMutex);
+
+            Statistics Stats{ .Shared = m_Shared.GetStats() };
+            for (uint32_t i = 0; i < m_ChunkCount; i++)
+            {
+                Stats.CarvedChunks += m_Chunks[i].Carved.load(std::memory_order_relaxed);
+            }
+            for (uint32_t Chunk = GetChunk(m_FreeChunks.load(std::memory_order_relaxed)); Chunk != s_NullChunk;
+                 Chunk          = m_Chunks[Chunk].Next.load(std::memory_order_relaxed))
+            {
+                Stats.FreeChunks++;
+            }
+            return Stats;
+        }
+
+    private:
+        /// <summary>
+        /// Threads are spread over the slots, two threads only share a slot when there are more threads than slots.
+        /// </summary>
+        [[nodiscard]] static uint32_t GetThreadSlot() noexcept
+        {
+            static std::atomic<uint32_t> s_NextSlot = 0;
+            thread_local uint32_t        t_Slot     = s_NextSlot.fetch_add(1, std::memory_order_relaxed) % s_ThreadSlotCount;
+            return t_Slot;
+        }
+
+        /// <summary>
+        /// Bump an allocation in the slot's chunk, switching to a new chunk if it doesn't fit.
+        /// </summary>
+        [[nodiscard]] Handle AllocateFromSlot(
+            ThreadSlot& Slot,
+            uint32_t    Count)
+        {
+            if (Slot.Chunk == s_NullChunk || Slot.Offset + Count > m_ChunkSize)
+            {
+                if (Slot.Chunk != s_NullChunk)
+                {
+                    ReleaseChunk(Slot.Chunk, 1);
+                }
+
+                Slot.Chunk  = AcquireChunk();
+                Slot.Offset = 0;
+                if (Slot.Chunk == s_NullChunk)
+                {
+                    return {};
+                }
+            }
+
+            m_Chunks[Slot.Chunk].Live.fetch_add(1, std::memory_order_relaxed);
+
+            Handle Hndl{
+                .Offset = Slot.Chunk * m_ChunkSize + Slot.Offset,
+                .Size   = Count
+            };
+            Slot.Offset += Count;
+            return Hndl;
+        }
+
+        /// <summary>
+        /// Pop a free chunk or carve a new one from the shared allocator, the chunk starts owned by the caller.
+        /// </summary>
+        [[nodiscard]] uint32_t AcquireChunk()
+        {
+            uint64_t Head = m_FreeChunks.load(std::memory_order_acquire);
+            while (GetChunk(Head) != s_NullChunk)
+            {
+                uint32_t Chunk = GetChunk(Head);
+                uint64_t Next  = MakeHead(m_Chunks[Chunk].Next.load(std::memory_order_relaxed), GetTag(Head) + 1);
+                if (m_FreeChunks.compare_exchange_weak(Head, Next, std::memory_order_acquire))
+                {
+                    m_Chunks[Chunk].Live.store(1, std::memory_order_relaxed);
+                    return Chunk;
+                }
+            }
+
+            std::scoped_lock Lock(m_SharedMutex);
+
+            auto Hndl = m_Shared.Allocate(m_ChunkSize, m_ChunkSize);
+            if (!Hndl)
+            {
+                return s_NullChunk;
+            }
+
+            uint32_t Chunk = uint32_t(Hndl.Offset / m_ChunkSize);
+            m_Chunks[Chunk].Live.store(1, std::memory_order_relaxed);
+            m_Chunks[Chunk].Carved.store(true, std::memory_order_relaxed);
+            return Chunk;
+        }
+
+        /// <summary>
+        /// Drop references to a chunk, the last one pushes it to the free list.
+        /// </summary>
+        void ReleaseChunk(
+            uint32_t Chunk,
+            uint32_t Count)
+        {
+            if (m_Chunks[Chunk].Live.fetch_sub(Count, std::memory_order_acq_rel) != Count)
+            {
+                return;
+            }
+
+            uint64_t Head = m_FreeChunks.load(std::memory_order_relaxed);
+            do
+            {
+                m_Chunks[Chunk].Next.store(GetChunk(Head), std::memory_order_relaxed);
+            } while (!m_FreeChunks.compare_exchange_weak(Head, MakeHead(Chunk, GetTag(Head) + 1), std::memory_order_release));
+        }
+
+        /// <summary>
+        /// Allocate from the shared allocator, giving the free chunks back to it if the allocation doesn't fit.
+        /// </summary>
+        [[nodiscard]] Handle AllocateShared(
+            uint32_t Count)
+        {
+            std::scoped_lock Lock(m_SharedMutex);
+
+            auto Hndl = m_Shared.Allocate(Count);
+            if (!Hndl)
+            {
+                // Keep the tag counting while taking the whole list, a pop that started before must not succeed
+                uint64_t Head = m_FreeChunks.load(std::memory_order_relaxed);
+                while (!m_FreeChunks.compare_exchange_weak(Head, MakeHead(s_NullChunk, GetTag(Head) + 1), std::memory_order_acquire))
+                {
+                }
+
+                uint32_t Chunk = GetChunk(Head);
+                if (Chunk == s_NullChunk)
+                {
+                    return {};
+                }
+
+                for (; Chunk != s_NullChunk; Chunk = m_Chunks[Chunk].Next.load(std::memory_order_relaxed))
+                {
+                    m_Chunks[Chunk].Carved.store(false, std::memory_order_relaxed);
+                    m_Shared.Free({ .Offset = size_t(Chunk) * m_ChunkSize, .Size = m_ChunkSize });
+                }
+                Hndl = m_Shared.Allocate(Count);
+            }
+
+            return {
+                .Offset = uint32_t(Hndl.Offset),
+                .Size   = uint32_t(Hndl.Size)
+            };
+        }
+
+    private:
+        [[nodiscard]] static uint64_t MakeHead(
+            uint32_t Chunk,
+            uint32_t Tag) noexcept
+        {
+            return uint64_t(Tag) << 32 | Chunk;
+        }
+
+        [[nodiscard]] static uint32_t GetChunk(
+            uint64_t Head) noexcept
+        {
+            return uint32_t(Head);
+        }
+
+        [[nodiscard]] static uint32_t GetTag(
+            uint64_t Head) noexcept
+        {
+            return uint32_t(Head >> 32);
+        }
+
+    private:
+        uint32_t m_Size;
+        uint32_t m_ChunkSize;
+        uint32_t m_ChunkCount;
+
+        std::unique_ptr<ChunkState[]>              m_Chunks;
+        std::atomic<uint64_t>                      m_FreeChunks = s_NullChunk;
+        std::array<ThreadSlot, s_ThreadSlotCount> m_Slots;
+
+        std::mutex    m_SharedMutex;
+        TLSFAllocator m_Shared;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <Math/Common.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Linear allocator for memory that only has to live for the frame it was allocated in, such as upload memory
+    /// written by the CPU and read by the GPU.
+    /// Each thread claims chunks of the current page by bumping its atomic offset and serves small allocations from its
+    /// own chunk without any atomic operation, larger ones bump the page directly. Only the switch to a new page takes
+    /// a lock. Pages are tagged with the last frame that allocated from them and are recycled once that frame is
+    /// reported as completed, the allocations themselves are never freed.
+    /// Pages come from a backend, the bookkeeping is independent from the graphics api.
+    /// </summary>
+    class FrameRingAllocator
+    {
+    public:
+        static constexpr size_t s_DefaultPageSize = 2 * 1024 * 1024;
+        static constexpr size_t s_ChunkSize       = 64 * 1024;
+
+        struct PageMemory
+        {
+            /// <summary>
+            /// Backend's resource for the page.
+            /// </summary>
+            void*    Context    = nullptr;
+            uint8_t* CpuAddress = nullptr;
+            uint64_t GpuAddress = 0;
+            size_t   Size       = 0;
+        };
+
+        struct Allocation
+        {
+            void*    Context    = nullptr;
+            uint8_t* CpuAddress = nullptr;
+            uint64_t GpuAddress = 0;
+
+            /// <summary>
+            /// Offset of the allocation in the page's resource.
+            /// </summary>
+            size_t Offset = 0;
+            size_t Size   = 0;
+
+            operator bool() const noexcept
+            {
+                return CpuAddress != nullptr;
+            }
+        };
+
+        struct Statistics
+        {
+            size_t PageCount      = 0;
+            size_t FreePageCount  = 0;
+            size_t DedicatedCount = 0;
+        };
+
+        using CreatePageFn  = std::move_only_function<PageMemory(size_t Size)>;
+        using DestroyPageFn = std::move_only_function<void(const PageMemory& Page)>;
+
+    private:
+        struct Page
+        {
+            PageMemory          Memory;
+            std::atomic<size_t> Offset  = 0;
+            uint64_t            FrameId = 0;
+        };
+
+        struct DedicatedPage
+        {
+            PageMemory Memory;
+            uint64_t   FrameId;
+        };
+
+        /// <summary>
+        /// Part of a page owned by a single thread, only valid for the frame it was claimed in.
+        /// </summary>
+        struct ThreadChunk
+        {
+            uint64_t          AllocatorId = 0;
+            uint64_t          Generation  = 0;
+            const PageMemory* Memory      = nullptr;
+            size_t            Offset      = 0;
+            size_t            End         = 0;
+        };
+
+        static constexpr size_t s_ThreadChunkSlots = 4;
+
+    public:
+        FrameRingAllocator(
+            CreatePageFn  CreatePage,
+            DestroyPageFn DestroyPage,
+            size_t        PageSize = s_DefaultPageSize) :
+            m_CreatePage(std::move(CreatePage)),
+            m_DestroyPage(std::move(DestroyPage)),
+            m_PageSize(PageSize),
+            m_ChunkSize(std::min(s_ChunkSize, PageSize / 8)),
+            m_Id(s_NextId.fetch_add(1, std::memory_order_relaxed) + 1)
+        {
+        }
+
+        NEON_CLASS_NO_COPYMOVE(FrameRingAllocator);
+
+        ~FrameRingAllocator()
+        {
+            Shutdown();
+        }
+
+        /// <summary>
+        /// Allocate Size bytes whose GPU address is aligned to Alignement (must be a power of two).
+        /// The memory is valid until the frame it was allocated in is completed.
+        /// </summary>
+        [[nodiscard]] Allocation Allocate(
+            size_t Size,
+            size_t Alignement = 1)
+        {
+            if (Size + Alignement > m_PageSize) [[unlikely]]
+            {
+                return AllocateDedicated(Size, Alignement);
+            }
+
+            // Small allocations come from the thread's chunk, the chunk is claimed from the shared page at once
+            if (Size + Alignement <= m_ChunkSize / 4) [[likely]]
+            {
+                auto& Chunk      = GetThreadChunk(m_Id);
+                auto  Generation = m_Generation.load(std::memory_order_acquire);
+                if (Chunk.AllocatorId != m_Id || Chunk.Generation != Generation)
+                {
+                    Chunk = { .AllocatorId = m_Id, .Generation = Generation };
+                }
+
+                while (true)
+                {
+                    if (Chunk.Memory)
+                    {
+                        size_t Aligned = Math::AlignUp(Chunk.Memory->GpuAddress + Chunk.Offset, Alignement) - Chunk.Memory->GpuAddress;
+                        if (Aligned + Size <= Chunk.End)
+                        {
+                            Chunk.Offset = Aligned + Size;
+                            return MakeAllocation(*Chunk.Memory, Aligned, Size);
+                        }
+                    }
+
+                    auto [ChunkPage, Offset] = ClaimFromPage(m_ChunkSize, 1);
+                    Chunk.Memory             = &ChunkPage->Memory;
+                    Chunk.Offset             = Offset;
+                    Chunk.End                = Offset + m_ChunkSize;
+                }
+            }
+
+            auto [CurPage, Offset] = ClaimFromPage(Size, Alignement);
+            return MakeAllocation(CurPage->Memory, Offset, Size);
+        }
+
+        /// <summary>
+        /// Mark the start of a new frame and recycle the pages of frames that the GPU is done with.
+        /// Frame ids must be increasing, a page is recycled once CompletedFrameId reaches the last frame that used it.
+        /// Must not be called while other threads are allocating.
+        /// </summary>
+        void BeginFrame(
+            uint64_t FrameId,
+            uint64_t CompletedFrameId)
+        {
+            std::scoped_lock Lock(m_Mutex);
+            m_FrameId = FrameId;
+
+            // The threads' chunks may belong to pages recycled below
+            m_Generation.fetch_add(1, std::memory_order_release);
+
+            // The current page keeps being bumped into, it belongs to the new frame as well
+            Page* Current = m_Current.load(std::memory_order_relaxed);
+            if (Current)
+            {
+                Current->FrameId = FrameId;
+            }
+
+            std::erase_if(
+                m_ActivePages,
+                [this, Current, CompletedFrameId](Page* ActivePage)
+                {
+                    if (ActivePage == Current || ActivePage->FrameId > CompletedFrameId)
+                    {
+                        return false;
+                    }
+                    m_FreePages.push_back(ActivePage);
+                    return true;
+                });
+
+            std::erase_if(
+                m_DedicatedPages,
+                [this, CompletedFrameId](const DedicatedPage& Dedicated)
+                {
+                    if (Dedicated.FrameId > CompletedFrameId)
+                    {
+                        return false;
+                    }
+                    m_DestroyPage(Dedicated.Memory);
+                    return true;
+                });
+        }
+
+        /// <summary>
+        /// Release every page, the GPU must be done with all of them.
+        /// </summary>
+        void Shutdown()
+        {
+            std::scoped_lock Lock(m_Mutex);
+            for (auto& CurPage : m_Pages)
+            {
+                m_DestroyPage(CurPage.Memory);
+            }
+            for (auto& Dedicated : m_DedicatedPages)
+            {
+                m_DestroyPage(Dedicated.Memory);
+            }
+
+            m_Current.store(nullptr, std::memory_order_relaxed);
+            m_Generation.fetch_add(1, std::memory_order_release);
+            m_Pages.clear();
+            m_ActivePages.clear();
+            m_FreePages.clear();
+            m_DedicatedPages.clear();
+        }
+
+        /// <summary>
+        /// Get the size of the pages.
+        /// </summary>
+        [[nodiscard]] size_t GetPageSize() const noexcept
+        {
+            return m_PageSize;
+        }
+
+        /// <summary>
+        /// Get the page counts of the allocator.
+        /// </summary>
+        [[nodiscard]] Statistics GetStats()
+        {
+            std::scoped_lock Lock(m_Mutex);
+            return {
+                .PageCount      = m_Pages.size(),
+                .FreePageCount  = m_FreePages.size(),
+                .DedicatedCount = m_DedicatedPages.size()
+            };
+        }
+
+    private:
+        /// <summary>
+        /// Bump the current page's offset, switching to a new page if it is full.
+        /// Returns the page and the offset of the aligned range.
+        /// </summary>
+        [[nodiscard]] std::pair<Page*, size_t> ClaimFromPage(
+            size_t Size,
+            size_t Alignement)
+        {
+            while (true)
+            {
+                Page* Current = m_Current.load(std::memory_order_acquire);
+                if (Current) [[likely]]
+                {
+                    size_t Offset = Current->Offset.load(std::memory_order_relaxed);
+                    while (true)
+                    {
+                        size_t Aligned = Math::AlignUp(Current->Memory.GpuAddress + Offset, Alignement) - Current->Memory.GpuAddress;
+                        if (Aligned + Size > Current->Memory.Size)
+                        {
+                            break;
+                        }
+
+                        if (Current->Offset.compare_exchange_weak(Offset, Aligned + Size, std::memory_order_relaxed))
+                        {
+                            return { Current, Aligned };
+                        }
+                    }
+                }
+                SwitchPage(Current);
+            }
+        }
+
+        /// <summary>
+        /// Get the calling thread's chunk for an allocator, a slot is reset when another allocator maps to it.
+        /// </summary>
+        [[nodiscard]] static ThreadChunk& GetThreadChunk(
+            uint64_t AllocatorId)
+        {
+            thread_local std::array<ThreadChunk, s_ThreadChunkSlots> t_Chunks{};
+            return t_Chunks[AllocatorId % s_ThreadChunkSlots];
+        }
+
+        [[nodiscard]] static Allocation MakeAllocation(
+            const PageMemory& Memory,
+            size_t            Offset,
+            size_t            Size)
+        {
+            return {
+                .Context    = Memory.Context,
+                .CpuAddress = Memory.CpuAddress + Offset,
+                .GpuAddress = Memory.GpuAddress + Offset,
+                .Offset     = Offset,
+                .Size       = Size
+            };
+        }
+
+        /// <summary>
+        /// Replace the current page with a free or a new one, unless another thread already did.
+        /// </summary>
+        void SwitchPage(
+            Page* Expected)
+        {
+            std::scoped_lock Lock(m_Mutex);
+            if (m_Current.load(std::memory_order_relaxed) != Expected)
+            {
+                return;
+            }
+
+            Page* NewPage;
+            if (m_FreePages.empty())
+            {
+                NewPage         = &m_Pages.emplace_back();
+                NewPage->Memory = m_CreatePage(m_PageSize);
+            }
+            else
+            {
+                NewPage = m_FreePages.back();
+                m_FreePages.pop_back();
+            }
+
+            NewPage->Offset.store(0, std::memory_order_relaxed);
+            NewPage->FrameId = m_FrameId;
+            m_ActivePages.push_back(NewPage);
+
+            m_Current.store(NewPage, std::memory_order_release);
+        }
+
+        /// <summary>
+        /// Allocations that don't fit in a page get their own page, which is released instead of being recycled.
+        /// </summary>
+        [[nodiscard]] Allocation AllocateDedicated(
+            size_t Size,
+            size_t Alignement)
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            auto& Dedicated = m_DedicatedPages.emplace_back(m_CreatePage(Size + Alignement - 1), m_FrameId);
+            auto& Memory    = Dedicated.Memory;
+
+            size_t Aligned = Math::AlignUp(Memory.GpuAddress, Alignement) - Memory.GpuAddress;
+            return MakeAllocation(Memory, Aligned, Size);
+        }
+
+    private:
+        static inline std::atomic_uint64_t s_NextId = 0;
+
+        CreatePageFn  m_CreatePage;
+        DestroyPageFn m_DestroyPage;
+        size_t        m_PageSize;
+        size_t        m_ChunkSize;
+        uint64_t      m_Id;
+
+        std::atomic<Page*>   m_Current    = nullptr;
+        std::atomic_uint64_t m_Generation = 0;
+
+        std::mutex                 m_Mutex;
+        uint64_t                   m_FrameId = 0;
+        std::list<Page>            m_Pages;
+        std::vector<Page*>         m_ActivePages;
+        std::vector<Page*>         m_FreePages;
+        std::vector<DedicatedPage> m_DedicatedPages;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Allocator/Arena.hpp>
+#include <Allocator/Pool.hpp>
+
+#include <memory_resource>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Memory resource allocating from a linear arena, so STL containers can use it.
+    /// Deallocation is a no-op, the memory is released when the arena is reset.
+    /// </summary>
+    class ArenaResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit ArenaResource(
+            LinearArena& Arena) :
+            m_Arena(Arena)
+        {
+        }
+
+    protected:
+        void* do_allocate(
+            size_t Size,
+            size_t Alignement) override
+        {
+            return m_Arena.Allocate(Size, Alignement);
+        }
+
+        void do_deallocate(
+            void*,
+            size_t,
+            size_t) override
+        {
+        }
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& Other) const noexcept override
+        {
+            return this == &Other;
+        }
+
+    private:
+        LinearArena& m_Arena;
+    };
+
+    /// <summary>
+    /// Memory resource serving allocations that fit in a block from a fixed size pool and forwarding the rest upstream.
+    /// Meant for node based containers (map, set, list) whose nodes are all the same size.
+    /// </summary>
+    class PoolResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit PoolResource(
+            size_t                     BlockSize,
+            size_t                     BlocksPerPage = FixedPool::s_DefaultBlocksPerPage,
+            std::pmr::memory_resource* Upstream      = std::pmr::get_default_resource()) :
+            m_Pool(BlockSize, alignof(std::max_align_t), BlocksPerPage),
+            m_Upstream(Upstream)
+        {
+        }
+
+        /// <summary>
+        /// Get the pool serving the blocks.
+        /// </summary>
+        [[nodiscard]] const FixedPool& GetPool() const noexcept
+        {
+            return m_Pool;
+        }
+
+    protected:
+        void* do_allocate(
+            size_t Size,
+            size_t Alignement) override
+        {
+            if (Size <= m_Pool.GetBlockSize() && Alignement <= alignof(std::max_align_t))
+            {
+                return m_Pool.Allocate();
+            }
+            return m_Upstream->allocate(Size, Alignement);
+        }
+
+        void do_deallocate(
+            void*  Pointer,
+            size_t Size,
+            size_t Alignement) override
+        {
+            if (Size <= m_Pool.GetBlockSize() && Alignement <= alignof(std::max_align_t))
+            {
+                m_Pool.Free(Pointer);
+            }
+            else
+            {
+                m_Upstream->deallocate(Pointer, Size, Alignement);
+            }
+        }
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& Other) const noexcept override
+        {
+            return this == &Other;
+        }
+
+    private:
+        FixedPool                  m_Pool;
+        std::pmr::memory_resource* m_Upstream;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
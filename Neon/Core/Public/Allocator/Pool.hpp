@@ -0,0 +1,181 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <Math/Common.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Pool of fixed size blocks allocated in pages.
+    /// Free blocks store the pointer to the next free block in place, so allocating and freeing are a pointer swap.
+    /// The pool is not thread safe.
+    /// </summary>
+    class FixedPool
+    {
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+    public:
+        static constexpr size_t s_DefaultBlocksPerPage = 256;
+
+        FixedPool(
+            size_t BlockSize,
+            size_t BlockAlignement = alignof(std::max_align_t),
+            size_t BlocksPerPage   = s_DefaultBlocksPerPage) :
+            m_BlockAlignement(std::max(BlockAlignement, alignof(FreeBlock))),
+            m_BlockSize(Math::AlignUp(std::max(BlockSize, sizeof(FreeBlock)), m_BlockAlignement)),
+            m_BlocksPerPage(std::max<size_t>(BlocksPerPage, 1))
+        {
+        }
+
+        NEON_CLASS_NO_COPYMOVE(FixedPool);
+
+        ~FixedPool()
+        {
+            for (auto Page : m_Pages)
+            {
+                ::operator delete(Page, std::align_val_t(m_BlockAlignement));
+            }
+        }
+
+        /// <summary>
+        /// Allocate a block.
+        /// </summary>
+        [[nodiscard]] void* Allocate()
+        {
+            if (!m_FreeList) [[unlikely]]
+            {
+                AllocatePage();
+            }
+
+            m_AllocatedCount++;
+            return std::exchange(m_FreeList, m_FreeList->Next);
+        }
+
+        /// <summary>
+        /// Return a block to the pool.
+        /// </summary>
+        void Free(
+            void* Block) noexcept
+        {
+            if (Block)
+            {
+                m_FreeList = new (Block) FreeBlock{ m_FreeList };
+                m_AllocatedCount--;
+            }
+        }
+
+        /// <summary>
+        /// Get the size of a block.
+        /// </summary>
+        [[nodiscard]] size_t GetBlockSize() const noexcept
+        {
+            return m_BlockSize;
+        }
+
+        /// <summary>
+        /// Get the number of blocks currently allocated.
+        /// </summary>
+        [[nodiscard]] size_t GetAllocatedCount() const noexcept
+        {
+            return m_AllocatedCount;
+        }
+
+        /// <summary>
+        /// Get the number of blocks reserved by the pool.
+        /// </summary>
+        [[nodiscard]] size_t GetCapacity() const noexcept
+        {
+            return m_Pages.size() * m_BlocksPerPage;
+        }
+
+    private:
+        /// <summary>
+        /// Allocate a page and thread its blocks into the free list.
+        /// </summary>
+        void AllocatePage()
+        {
+            auto Page = static_cast<std::byte*>(::operator new(m_BlockSize * m_BlocksPerPage, std::align_val_t(m_BlockAlignement)));
+            m_Pages.push_back(Page);
+
+            for (size_t i = m_BlocksPerPage; i-- > 0;)
+            {
+                m_FreeList = new (Page + i * m_BlockSize) FreeBlock{ m_FreeList };
+            }
+        }
+
+    private:
+        size_t m_BlockAlignement;
+        size_t m_BlockSize;
+        size_t m_BlocksPerPage;
+        size_t m_AllocatedCount = 0;
+
+        FreeBlock*              m_FreeList = nullptr;
+        std::vector<std::byte*> m_Pages;
+    };
+
+    /// <summary>
+    /// Typed pool of objects, see FixedPool.
+    /// </summary>
+    template<typename _Ty>
+    class ObjectPool
+    {
+    public:
+        explicit ObjectPool(
+            size_t ObjectsPerPage = FixedPool::s_DefaultBlocksPerPage) :
+            m_Pool(sizeof(_Ty), alignof(_Ty), ObjectsPerPage)
+        {
+        }
+
+        /// <summary>
+        /// Create an object in the pool.
+        /// </summary>
+        template<typename... _Args>
+        [[nodiscard]] _Ty* Create(
+            _Args&&... Args)
+        {
+            void* Block = m_Pool.Allocate();
+            try
+            {
+                return new (Block) _Ty(std::forward<_Args>(Args)...);
+            }
+            catch (...)
+            {
+                m_Pool.Free(Block);
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Destroy an object created by this pool.
+        /// </summary>
+        void Destroy(
+            _Ty* Object)
+        {
+            if (Object)
+            {
+                std::destroy_at(Object);
+                m_Pool.Free(Object);
+            }
+        }
+
+        /// <summary>
+        /// Get the number of live objects.
+        /// </summary>
+        [[nodiscard]] size_t GetCount() const noexcept
+        {
+            return m_Pool.GetAllocatedCount();
+        }
+
+    private:
+        FixedPool m_Pool;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
@@ -0,0 +1,563 @@
+#pragma once
+
+#include <Math/Common.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Neon::Allocator
+{
+    /// <summary>
+    /// Two-Level Segregated Fit offset allocator.
+    /// Free blocks are kept in size classes split into power of two ranges (first level) and linear steps inside each
+    /// range (second level), two bitmaps find a free list that fits the request, so allocating and freeing are O(1).
+    /// A request is rounded up to the next size class so any block found fits, when none does the free lists of its own
+    /// class are walked instead, so a request that fits a free block never fails.
+    /// The allocator only hands out offsets, block bookkeeping lives in preallocated arrays so operations don't
+    /// touch the heap except when the arrays have to grow.
+    /// </summary>
+    class TLSFAllocator
+    {
+        static constexpr uint32_t s_SecondLevelBits  = 4;
+        static constexpr uint32_t s_SecondLevelCount = 1 << s_SecondLevelBits;
+        static constexpr uint32_t s_FirstLevelCount  = std::numeric_limits<size_t>::digits - s_SecondLevelBits + 1;
+
+        static constexpr uint32_t s_NullBlock = std::numeric_limits<uint32_t>::max();
+
+    public:
+        struct Handle
+        {
+            size_t Offset = std::numeric_limits<size_t>::max();
+            size_t Size   = 0;
+
+            operator bool() const noexcept
+            {
+                return Size != 0;
+            }
+        };
+
+        struct Statistics
+        {
+            size_t TotalSize        = 0;
+            size_t UsedSize         = 0;
+            size_t FreeSize         = 0;
+            size_t LargestFreeBlock = 0;
+            size_t AllocationCount  = 0;
+            size_t FreeBlockCount   = 0;
+
+            /// <summary>
+            /// Ratio of the used size to the total size.
+            /// </summary>
+            [[nodiscard]] float GetUtilization() const noexcept
+            {
+                return TotalSize ? float(UsedSize) / float(TotalSize) : 0.f;
+            }
+
+            /// <summary>
+            /// How much of the free space can't be used by a single allocation, 0 when it is in one block.
+            /// </summary>
+            [[nodiscard]] float GetFragmentation() const noexcept
+            {
+                return FreeSize ? 1.f - float(LargestFreeBlock) / float(FreeSize) : 0.f;
+            }
+        };
+
+    public:
+        explicit TLSFAllocator(
+            size_t Size,
+            size_t ExpectedAllocations = 64) :
+            m_Size(Size)
+        {
+            m_FreeHeads.fill(s_NullBlock);
+            m_Blocks.reserve(ExpectedAllocations * 2 + 1);
+            m_UnusedBlocks.reserve(ExpectedAllocations * 2 + 1);
+            m_Offsets.Reserve(ExpectedAllocations);
+
+            if (Size)
+            {
+                InsertFreeBlock(CreateBlock(0, Size, s_NullBlock, s_NullBlock));
+            }
+        }
+
+        /// <summary>
+        /// Allocate a block of Size aligned to Alignement (must be a power of two).
+        /// Returns an empty handle if no free block fits.
+        /// </summary>
+        [[nodiscard]] Handle Allocate(
+            size_t Size,
+            size_t Alignement = 1)
+        {
+            Size = Math::AlignUp(Size, Alignement);
+            if (!Size || Size > m_Size - m_UsedSize)
+            {
+                return {};
+            }
+
+            uint32_t Index = FindFreeBlock(Size);
+            if (Index != s_NullBlock && !CanFit(m_Blocks[Index], Size, Alignement))
+            {
+                // The first block that fits may be misaligned, look for one big enough to be aligned
+                Index = Alignement - 1 <= m_Size - Size ? FindFreeBlock(Size + Alignement - 1) : s_NullBlock;
+            }
+            if (Index == s_NullBlock)
+            {
+                // No block of a larger class fits, some of the request's own class may still be big enough
+                Index = FindFittingBlock(Size, Alignement);
+                if (Index == s_NullBlock)
+                {
+                    return {};
+                }
+            }
+
+            RemoveFreeBlock(Index);
+
+            size_t Padding = Math::AlignUp(m_Blocks[Index].Offset, Alignement) - m_Blocks[Index].Offset;
+            if (Padding)
+            {
+                // Give the padding back as a free block in front of the allocation
+                auto& Cur = m_Blocks[Index];
+                auto  Pad = CreateBlock(Cur.Offset, Padding, Cur.PrevPhysical, Index);
+                if (m_Blocks[Pad].PrevPhysical != s_NullBlock)
+                {
+                    m_Blocks[m_Blocks[Pad].PrevPhysical].NextPhysical = Pad;
+                }
+
+                m_Blocks[Index].PrevPhysical = Pad;
+                m_Blocks[Index].Offset += Padding;
+                m_Blocks[Index].Size -= Padding;
+                InsertFreeBlock(Pad);
+            }
+
+            if (m_Blocks[Index].Size > Size)
+            {
+                auto& Cur  = m_Blocks[Index];
+                auto  Rest = CreateBlock(Cur.Offset + Size, Cur.Size - Size, Index, Cur.NextPhysical);
+                if (m_Blocks[Rest].NextPhysical != s_NullBlock)
+                {
+                    m_Blocks[m_Blocks[Rest].NextPhysical].PrevPhysical = Rest;
+                }
+
+                m_Blocks[Index].NextPhysical = Rest;
+                m_Blocks[Index].Size         = Size;
+                InsertFreeBlock(Rest);
+            }
+
+            m_UsedSize += Size;
+            m_Offsets.Insert(m_Blocks[Index].Offset, Index);
+
+            return { .Offset = m_Blocks[Index].Offset, .Size = Size };
+        }
+
+        /// <summary>
+        /// Free a block and merge it with its free neighbours.
+        /// </summary>
+        void Free(
+            Handle Hndl)
+        {
+            uint32_t Index = m_Offsets.Erase(Hndl.Offset);
+            if (Index == s_NullBlock)
+            {
+                return;
+            }
+
+            m_UsedSize -= m_Blocks[Index].Size;
+
+            if (auto Prev = m_Blocks[Index].PrevPhysical; Prev != s_NullBlock && m_Blocks[Prev].IsFree)
+            {
+                RemoveFreeBlock(Prev);
+                m_Blocks[Prev].Size += m_Blocks[Index].Size;
+                ReleaseBlock(Index);
+                Index = Prev;
+            }
+            if (auto Next = m_Blocks[Index].NextPhysical; Next != s_NullBlock && m_Blocks[Next].IsFree)
+            {
+                RemoveFreeBlock(Next);
+                m_Blocks[Index].Size += m_Blocks[Next].Size;
+                ReleaseBlock(Next);
+            }
+
+            InsertFreeBlock(Index);
+        }
+
+        /// <summary>
+        /// Get the size of the range managed by the allocator.
+        /// </summary>
+        [[nodiscard]] size_t GetSize() const noexcept
+        {
+            return m_Size;
+        }
+
+        /// <summary>
+        /// Get the usage and fragmentation of the allocator.
+        /// Walks the largest free size class, so it is not meant for hot paths.
+        /// </summary>
+        [[nodiscard]] Statistics GetStats() const
+        {
+            Statistics Stats{
+                .TotalSize       = m_Size,
+                .UsedSize        = m_UsedSize,
+                .FreeSize        = m_Size - m_UsedSize,
+                .AllocationCount = m_Offsets.GetCount(),
+                .FreeBlockCount  = m_FreeBlockCount
+            };
+
+            if (m_FirstLevelMap)
+            {
+                uint32_t FirstLevel  = uint32_t(std::bit_width(m_FirstLevelMap) - 1);
+                uint32_t SecondLevel = uint32_t(std::bit_width(m_SecondLevelMap[FirstLevel]) - 1);
+                for (uint32_t Index = m_FreeHeads[FirstLevel * s_SecondLevelCount + SecondLevel]; Index != s_NullBlock; Index = m_Blocks[Index].NextFree)
+                {
+                    Stats.LargestFreeBlock = std::max(Stats.LargestFreeBlock, m_Blocks[Index].Size);
+                }
+            }
+            return Stats;
+        }
+
+    private:
+        struct Block
+        {
+            size_t   Offset;
+            size_t   Size;
+            uint32_t PrevPhysical;
+            uint32_t NextPhysical;
+            uint32_t PrevFree = s_NullBlock;
+            uint32_t NextFree = s_NullBlock;
+            bool     IsFree   = false;
+        };
+
+        /// <summary>
+        /// Open addressing map from the offset of an allocated block to its index.
+        /// Callers only keep the offset and size of their allocations, this is what lets Free stay O(1).
+        /// </summary>
+        class OffsetIndex
+        {
+            static constexpr size_t s_EmptyKey = std::numeric_limits<size_t>::max();
+
+            struct Entry
+            {
+                size_t   Offset = s_EmptyKey;
+                uint32_t Index  = s_NullBlock;
+            };
+
+        public:
+            void Reserve(
+                size_t Count)
+            {
+                size_t Capacity = 16;
+                while (Capacity < Count * 2)
+                {
+                    Capacity <<= 1;
+                }
+                if (Capacity > m_Entries.size())
+                {
+                    Rehash(Capacity);
+                }
+            }
+
+            void Insert(
+                size_t   Offset,
+                uint32_t Index)
+            {
+                if ((m_Count + 1) * 2 > m_Entries.size())
+                {
+                    Rehash(std::max<size_t>(m_Entries.size() * 2, 16));
+                }
+
+                size_t Slot = GetSlot(Offset);
+                while (m_Entries[Slot].Offset != s_EmptyKey)
+                {
+                    Slot = (Slot + 1) & m_Mask;
+                }
+                m_Entries[Slot] = { Offset, Index };
+                m_Count++;
+            }
+
+            /// <summary>
+            /// Remove an offset and return its block index, or s_NullBlock if it is not allocated.
+            /// </summary>
+            uint32_t Erase(
+                size_t Offset)
+            {
+                if (!m_Count)
+                {
+                    return s_NullBlock;
+                }
+
+                size_t Slot = GetSlot(Offset);
+                while (m_Entries[Slot].Offset != Offset)
+                {
+                    if (m_Entries[Slot].Offset == s_EmptyKey)
+                    {
+                        return s_NullBlock;
+                    }
+                    Slot = (Slot + 1) & m_Mask;
+                }
+
+                uint32_t Index = m_Entries[Slot].Index;
+                m_Count--;
+
+                // Shift the following entries back so lookups never stop at the hole
+                size_t Hole = Slot;
+                for (size_t Next = (Hole + 1) & m_Mask; m_Entries[Next].Offset != s_EmptyKey; Next = (Next + 1) & m_Mask)
+                {
+                    size_t Ideal = GetSlot(m_Entries[Next].Offset);
+                    if (((Next - Ideal) & m_Mask) >= ((Next - Hole) & m_Mask))
+                    {
+                        m_Entries[Hole] = m_Entries[Next];
+                        Hole            = Next;
+                    }
+                }
+                m_Entries[Hole] = {};
+                return Index;
+            }
+
+            [[nodiscard]] size_t GetCount() const noexcept
+            {
+                return m_Count;
+            }
+
+        private:
+            [[nodiscard]] size_t GetSlot(
+                size_t Offset) const noexcept
+            {
+                return size_t((uint64_t(Offset) * 0x9E3779B97F4A7C15ull) >> m_Shift) & m_Mask;
+            }
+
+            void Rehash(
+                size_t Capacity)
+            {
+                auto OldEntries = std::exchange(m_Entries, std::vector<Entry>(Capacity));
+                m_Mask          = Capacity - 1;
+                m_Shift         = uint32_t(64 - std::countr_zero(Capacity));
+                m_Count         = 0;
+                for (auto& CurEntry : OldEntries)
+                {
+                    if (CurEntry.Offset != s_EmptyKey)
+                    {
+                        Insert(CurEntry.Offset, CurEntry.Index);
+                    }
+                }
+            }
+
+        private:
+            std::vector<Entry> m_Entries;
+            size_t             m_Mask  = 0;
+            size_t             m_Count = 0;
+            uint32_t           m_Shift = 0;
+        };
+
+    private:
+        /// <summary>
+        /// Get the size class a block of Size belongs to.
+        /// </summary>
+        [[nodiscard]] static uint32_t GetSizeClass(
+            size_t Size) noexcept
+        {
+            if (Size < s_SecondLevelCount)
+            {
+                return uint32_t(Size);
+            }
+
+            uint32_t HighBit     = uint32_t(std::bit_width(Size) - 1);
+            uint32_t FirstLevel  = HighBit - s_SecondLevelBits + 1;
+            uint32_t SecondLevel = uint32_t(Size >> (HighBit - s_SecondLevelBits)) - s_SecondLevelCount;
+            return FirstLevel * s_SecondLevelCount + SecondLevel;
+        }
+
+        /// <summary>
+        /// Find a free block of at least Size, by rounding up to the next size class every block found is big enough.
+        /// </summary>
+        [[nodiscard]] uint32_t FindFreeBlock(
+            size_t Size) const noexcept
+        {
+            if (Size >= s_SecondLevelCount)
+            {
+                size_t Round = (size_t(1) << (std::bit_width(Size) - 1 - s_SecondLevelBits)) - 1;
+                if (Size > std::numeric_limits<size_t>::max() - Round)
+                {
+                    return s_NullBlock;
+                }
+                Size += Round;
+            }
+
+            uint32_t SizeClass   = GetSizeClass(Size);
+            uint32_t FirstLevel  = SizeClass / s_SecondLevelCount;
+            uint32_t SecondLevel = SizeClass % s_SecondLevelCount;
+
+            uint32_t SecondLevelMap = m_SecondLevelMap[FirstLevel] & (~0u << SecondLevel);
+            if (!SecondLevelMap)
+            {
+                uint64_t FirstLevelMap = FirstLevel + 1 < 64 ? m_FirstLevelMap & (~0ull << (FirstLevel + 1)) : 0;
+                if (!FirstLevelMap)
+                {
+                    return s_NullBlock;
+                }
+                FirstLevel     = uint32_t(std::countr_zero(FirstLevelMap));
+                SecondLevelMap = m_SecondLevelMap[FirstLevel];
+            }
+
+            return m_FreeHeads[FirstLevel * s_SecondLevelCount + std::countr_zero(SecondLevelMap)];
+        }
+
+        /// <summary>
+        /// Find a free block that fits Size aligned to Alignement by walking the free lists from the request's own size
+        /// class up, for when the rounded search failed. Linear in the number of free blocks visited.
+        /// </summary>
+        [[nodiscard]] uint32_t FindFittingBlock(
+            size_t Size,
+            size_t Alignement) const noexcept
+        {
+            uint32_t SizeClass      = GetSizeClass(Size);
+            uint32_t FirstLevel     = SizeClass / s_SecondLevelCount;
+            uint32_t SecondLevelMap = m_SecondLevelMap[FirstLevel] & (~0u << (SizeClass % s_SecondLevelCount));
+            while (true)
+            {
+                for (; SecondLevelMap; SecondLevelMap &= SecondLevelMap - 1)
+                {
+                    uint32_t SecondLevel = uint32_t(std::countr_zero(SecondLevelMap));
+                    for (uint32_t Index = m_FreeHeads[FirstLevel * s_SecondLevelCount + SecondLevel]; Index != s_NullBlock; Index = m_Blocks[Index].NextFree)
+                    {
+                        if (CanFit(m_Blocks[Index], Size, Alignement))
+                        {
+                            return Index;
+                        }
+                    }
+                }
+
+                uint64_t FirstLevelMap = FirstLevel + 1 < 64 ? m_FirstLevelMap & (~0ull << (FirstLevel + 1)) : 0;
+                if (!FirstLevelMap)
+                {
+                    return s_NullBlock;
+                }
+                FirstLevel     = uint32_t(std::countr_zero(FirstLevelMap));
+                SecondLevelMap = m_SecondLevelMap[FirstLevel];
+            }
+        }
+
+        /// <summary>
+        /// Check if an allocation of Size aligned to Alignement fits in a block.
+        /// </summary>
+        [[nodiscard]] static bool CanFit(
+            const Block& CurBlock,
+            size_t       Size,
+            size_t       Alignement) noexcept
+        {
+            size_t Padding = Math::AlignUp(CurBlock.Offset, Alignement) - CurBlock.Offset;
+            return CurBlock.Size >= Padding && CurBlock.Size - Padding >= Size;
+        }
+
+        void InsertFreeBlock(
+            uint32_t Index)
+        {
+            auto&    CurBlock  = m_Blocks[Index];
+            uint32_t SizeClass = GetSizeClass(CurBlock.Size);
+            uint32_t Head      = m_FreeHeads[SizeClass];
+
+            CurBlock.IsFree   = true;
+            CurBlock.PrevFree = s_NullBlock;
+            CurBlock.NextFree = Head;
+            if (Head != s_NullBlock)
+            {
+                m_Blocks[Head].PrevFree = Index;
+            }
+            m_FreeHeads[SizeClass] = Index;
+
+            m_FirstLevelMap |= 1ull << (SizeClass / s_SecondLevelCount);
+            m_SecondLevelMap[SizeClass / s_SecondLevelCount] |= 1u << (SizeClass % s_SecondLevelCount);
+            m_FreeBlockCount++;
+        }
+
+        void RemoveFreeBlock(
+            uint32_t Index)
+        {
+            auto&    CurBlock  = m_Blocks[Index];
+            uint32_t SizeClass = GetSizeClass(CurBlock.Size);
+
+            if (CurBlock.PrevFree != s_NullBlock)
+            {
+                m_Blocks[CurBlock.PrevFree].NextFree = CurBlock.NextFree;
+            }
+            else
+            {
+                m_FreeHeads[SizeClass] = CurBlock.NextFree;
+            }
+            if (CurBlock.NextFree != s_NullBlock)
+            {
+                m_Blocks[CurBlock.NextFree].PrevFree = CurBlock.PrevFree;
+            }
+
+            if (m_FreeHeads[SizeClass] == s_NullBlock)
+            {
+                uint32_t FirstLevel = SizeClass / s_SecondLevelCount;
+                m_SecondLevelMap[FirstLevel] &= ~(1u << (SizeClass % s_SecondLevelCount));
+                if (!m_SecondLevelMap[FirstLevel])
+                {
+                    m_FirstLevelMap &= ~(1ull << FirstLevel);
+                }
+            }
+
+            CurBlock.IsFree = false;
+            m_FreeBlockCount--;
+        }
+
+        [[nodiscard]] uint32_t CreateBlock(
+            size_t   Offset,
+            size_t   Size,
+            uint32_t PrevPhysical,
+            uint32_t NextPhysical)
+        {
+            Block NewBlock{
+                .Offset       = Offset,
+                .Size         = Size,
+                .PrevPhysical = PrevPhysical,
+                .NextPhysical = NextPhysical
+            };
+
+            if (!m_UnusedBlocks.empty())
+            {
+                uint32_t Index = m_UnusedBlocks.back();
+                m_UnusedBlocks.pop_back();
+                m_Blocks[Index] = NewBlock;
+                return Index;
+            }
+
+            m_Blocks.emplace_back(NewBlock);
+            return uint32_t(m_Blocks.size() - 1);
+        }
+
+        /// <summary>
+        /// Unlink a block that was merged into its previous neighbour and recycle it.
+        /// </summary>
+        void ReleaseBlock(
+            uint32_t Index)
+        {
+            auto& CurBlock = m_Blocks[Index];
+            if (CurBlock.PrevPhysical != s_NullBlock)
+            {
+                m_Blocks[CurBlock.PrevPhysical].NextPhysical = CurBlock.NextPhysical;
+            }
+            if (CurBlock.NextPhysical != s_NullBlock)
+            {
+                m_Blocks[CurBlock.NextPhysical].PrevPhysical = CurBlock.PrevPhysical;
+            }
+            m_UnusedBlocks.push_back(Index);
+        }
+
+    private:
+        size_t m_Size;
+        size_t m_UsedSize       = 0;
+        size_t m_FreeBlockCount = 0;
+
+        uint64_t                                                      m_FirstLevelMap = 0;
+        std::array<uint32_t, s_FirstLevelCount>                       m_SecondLevelMap{};
+        std::array<uint32_t, s_FirstLevelCount * s_SecondLevelCount> m_FreeHeads;
+
+        std::vector<Block>    m_Blocks;
+        std::vector<uint32_t> m_UnusedBlocks;
+        OffsetIndex           m_Offsets;
+    };
+} // namespace Neon::Allocator
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <Asio/ThreadPool.hpp>
+
+#include <coroutine>
+#include <mutex>
+
+namespace Neon::Asio
+{
+    using JobFunction = Impl::default_function_type;
+    using JobPriority = task_priority;
+    using JobOptions  = task_options;
+
+    /// <summary>
+    /// Engine wide job system.
+    /// Every subsystem shares the same work stealing workers, so an idle subsystem does not keep cores away from a busy one.
+    /// Threads waiting for a job execute other pending jobs instead of blocking.
+    /// </summary>
+    class JobSystem
+    {
+    public:
+        class ScheduleAwaitable;
+
+        /// <summary>
+        /// Create the workers, a worker count of 0 uses one worker per core minus the calling thread.
+        /// Using the job system before initializing it creates the default number of workers,
+        /// using it after shutdown asserts unless it was initialized again.
+        /// </summary>
+        static void Initialize(
+            uint32_t WorkerCount = 0);
+
+        /// <summary>
+        /// Execute the remaining jobs and destroy the workers.
+        /// </summary>
+        static void Shutdown();
+
+        /// <summary>
+        /// Get the number of workers.
+        /// </summary>
+        [[nodiscard]] static uint32_t GetWorkerCount();
+
+        /// <summary>
+        /// Check if the calling thread is one of the job system's workers.
+        /// </summary>
+        [[nodiscard]] static bool IsWorkerThread();
+
+        /// <summary>
+        /// Get the queue depth and latency counters of a priority level.
+        /// </summary>
+        [[nodiscard]] static task_priority_stats GetStats(
+            JobPriority Priority);
+
+        /// <summary>
+        /// Reset the latency counters.
+        /// </summary>
+        static void ResetStats();
+
+    public:
+        /// <summary>
+        /// Enqueue a job.
+        /// </summary>
+        static void Enqueue(
+            JobFunction       Job,
+            const JobOptions& Options = {});
+
+        /// <summary>
+        /// Enqueue a job and get a future for its result.
+        /// JobOptions can be passed before the function to set the priority and affinity.
+        /// </summary>
+        template<typename _FnTy, typename... _Args>
+        [[nodiscard]] static auto Async(
+            _FnTy&& Function,
+            _Args&&... Args)
+        {
+            return GetPool().enqueue(std::forward<_FnTy>(Function), std::forward<_Args>(Args)...);
+        }
+
+        /// <summary>
+        /// Execute one pending job on the calling thread.
+        /// Returns false if there was none.
+        /// </summary>
+        static bool RunPendingJob();
+
+        /// <summary>
+        /// Wait for a future to be ready, executing other jobs meanwhile.
+        /// </summary>
+        template<typename _FutureTy>
+        static void Wait(
+            const _FutureTy& Future)
+        {
+            while (Future.wait_for(std::chrono::seconds::zero()) != std::future_status::ready)
+            {
+                if (!RunPendingJob())
+                {
+                    // Nothing to help with, the job we wait on is running on another thread
+                    Future.wait();
+                    break;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Resume the awaiting coroutine on a worker.
+        /// co_await JobSystem::Schedule();
+        /// </summary>
+        [[nodiscard]] static ScheduleAwaitable Schedule(
+            const JobOptions& Options = {}) noexcept;
+
+    private:
+        /// <summary>
+        /// Get the thread pool, creating it if the job system was not initialized yet.
+        /// </summary>
+        [[nodiscard]] static ThreadPool<>& GetPool();
+    };
+
+    //
+
+    class JobSystem::ScheduleAwaitable
+    {
+    public:
+        explicit ScheduleAwaitable(
+            const JobOptions& Options) noexcept :
+            m_Options(Options)
+        {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(
+            std::coroutine_handle<> Handle)
+        {
+            JobSystem::Enqueue(
+                [Handle]
+                { Handle.resume(); },
+                m_Options);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        JobOptions m_Options;
+    };
+
+    inline auto JobSystem::Schedule(
+        const JobOptions& Options) noexcept -> ScheduleAwaitable
+    {
+        return ScheduleAwaitable(Options);
+    }
+
+    //
+
+    /// <summary>
+    /// Group of jobs that can be waited on together.
+    /// Continuations added with Then run once every job in the group completed, and can be part of another group,
+    /// which makes it possible to express dependency edges between groups.
+    /// The group waits for its jobs when destroyed.
+    /// </summary>
+    class JobGroup
+    {
+    public:
+        JobGroup() = default;
+
+        NEON_CLASS_NO_COPYMOVE(JobGroup);
+
+        ~JobGroup();
+
+        /// <summary>
+        /// Enqueue a job as part of the group.
+        /// </summary>
+        void Run(
+            JobFunction       Job,
+            const JobOptions& Options = {});
+
+        /// <summary>
+        /// Enqueue a job as part of the group and get a future for its result.
+        /// </summary>
+        template<typename _FnTy>
+        [[nodiscard]] auto Async(
+            _FnTy&&           Function,
+            const JobOptions& Options = {})
+        {
+            using _RetTy = std::invoke_result_t<_FnTy>;
+
+            std::packaged_task<_RetTy()> Task(std::forward<_FnTy>(Function));
+            auto                         Future = Task.get_future();
+            Run([Task = std::move(Task)]() mutable
+                { Task(); },
+                Options);
+            return Future;
+        }
+
+        /// <summary>
+        /// Enqueue a job once every job in the group completed.
+        /// If Target is set, the continuation is part of the target group.
+        /// </summary>
+        void Then(
+            JobFunction       Continuation,
+            JobGroup*         Target  = nullptr,
+            const JobOptions& Options = {});
+
+        /// <summary>
+        /// Wait for every job in the group, executing other jobs meanwhile.
+        /// </summary>
+        void Wait();
+
+        /// <summary>
+        /// Check if every job in the group completed.
+        /// </summary>
+        [[nodiscard]] bool IsDone() const noexcept;
+
+    private:
+        struct Continuation
+        {
+            JobFunction Job;
+            JobGroup*   Target;
+            JobOptions  Options;
+        };
+
+        /// <summary>
+        /// Add a pending job to the group.
+        /// </summary>
+        void Add() noexcept;
+
+        /// <summary>
+        /// Mark a job as completed, enqueue the continuations if it was the last one.
+        /// </summary>
+        void Done();
+
+        /// <summary>
+        /// Enqueue a continuation.
+        /// </summary>
+        static void Dispatch(
+            Continuation Job);
+
+    private:
+        std::atomic_uint32_t      m_Pending = 0;
+        std::mutex                m_Mutex;
+        std::vector<Continuation> m_Continuations;
+    };
+} // namespace Neon::Asio
\ No newline at end of file
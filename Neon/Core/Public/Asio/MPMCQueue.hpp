@@ -0,0 +1,753 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Neon::Asio
+{
+    namespace Impl
+    {
+        static constexpr size_t s_QueueCacheLineSize = 64;
+
+        /// <summary>
+        /// Lets consumers sleep on an empty queue and producers sleep on a full one.
+        /// Waking up costs nothing while nobody waits.
+        /// </summary>
+        class QueueSignal
+        {
+        public:
+            /// <summary>
+            /// Wait until Ready returns true.
+            /// </summary>
+            template<typename _FnTy>
+            void Wait(
+                _FnTy&& Ready)
+            {
+                while (!Ready())
+                {
+                    m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+                    auto Epoch = m_Epoch.load(std::memory_order_seq_cst);
+                    // Check again now that we are registered, otherwise a notification could be missed
+                    if (!Ready())
+                    {
+                        m_Epoch.wait(Epoch, std::memory_order_seq_cst);
+                    }
+                    m_Waiters.fetch_sub(1, std::memory_order_seq_cst);
+                }
+            }
+
+            /// <summary>
+            /// Wake up the waiting threads, if any.
+            /// </summary>
+            void Notify()
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (m_Waiters.load(std::memory_order_relaxed))
+                {
+                    m_Epoch.fetch_add(1, std::memory_order_seq_cst);
+                    m_Epoch.notify_all();
+                }
+            }
+
+        private:
+            std::atomic_uint32_t m_Waiters = 0;
+            std::atomic_uint32_t m_Epoch   = 0;
+        };
+    } // namespace Impl
+
+    /// <summary>
+    /// Lock-free bounded multi-producer multi-consumer queue (Vyukov).
+    /// Each cell carries a sequence number telling producers and consumers whose turn it is,
+    /// so a push or a pop costs a single compare-exchange on the shared position.
+    /// </summary>
+    template<typename _Ty>
+        requires std::is_nothrow_move_constructible_v<_Ty>
+    class BoundedMPMCQueue
+    {
+        struct alignas(Impl::s_QueueCacheLineSize) Cell
+        {
+            std::atomic_size_t Sequence;
+            alignas(_Ty) std::byte Storage[sizeof(_Ty)];
+
+            [[nodiscard]] _Ty* Get() noexcept
+            {
+                return std::launder(reinterpret_cast<_Ty*>(Storage));
+            }
+        };
+
+    public:
+        /// <summary>
+        /// Create the queue, the capacity is rounded up to a power of two.
+        /// </summary>
+        explicit BoundedMPMCQueue(
+            size_t Capacity)
+        {
+            size_t RingCapacity = 2;
+            while (RingCapacity < Capacity)
+            {
+                RingCapacity <<= 1;
+            }
+
+            m_Mask  = RingCapacity - 1;
+            m_Cells = std::make_unique<Cell[]>(RingCapacity);
+            for (size_t i = 0; i < RingCapacity; i++)
+            {
+                m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedMPMCQueue(const BoundedMPMCQueue&)            = delete;
+        BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+        BoundedMPMCQueue(BoundedMPMCQueue&&)            = delete;
+        BoundedMPMCQueue& operator=(BoundedMPMCQueue&&) = delete;
+
+        ~BoundedMPMCQueue()
+        {
+            while (TryPop())
+            {
+            }
+        }
+
+        /// <summary>
+        /// Push an item, returns false if the queue is full.
+        /// </summary>
+        template<typename... _Args>
+        bool TryEmplace(
+            _Args&&... Args)
+        {
+            size_t Position = m_EnqueuePos.load(std::memory_order_relaxed);
+            Cell*  CurCell;
+            while (true)
+            {
+                CurCell       = &m_Cells[Position & m_Mask];
+                size_t   Seq  = CurCell->Sequence.load(std::memory_order_acquire);
+                intptr_t Diff = intptr_t(Seq) - intptr_t(Position);
+                if (Diff == 0)
+                {
+                    if (m_EnqueuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (Diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    Position = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (CurCell->Storage) _Ty(std::forward<_Args>(Args)...);
+            CurCell->Sequence.store(Position + 1, std::memory_order_release);
+            m_NotEmpty.Notify();
+            return true;
+        }
+
+        /// <summary>
+        /// Push an item, returns false if the queue is full.
+        /// The item is only moved from if it was pushed.
+        /// </summary>
+        bool TryPush(
+            _Ty&& Item)
+        {
+            return TryEmplace(std::move(Item));
+        }
+
+        /// <summary>
+        /// Push an item, returns false if the queue is full.
+        /// </summary>
+        bool TryPush(
+            const _Ty& Item)
+        {
+            return TryEmplace(Item);
+        }
+
+        /// <summary>
+        /// Pop an item, returns nothing if the queue is empty.
+        /// </summary>
+        [[nodiscard]] std::optional<_Ty> TryPop()
+        {
+            size_t Position = m_DequeuePos.load(std::memory_order_relaxed);
+            Cell*  CurCell;
+            while (true)
+            {
+                CurCell       = &m_Cells[Position & m_Mask];
+                size_t   Seq  = CurCell->Sequence.load(std::memory_order_acquire);
+                intptr_t Diff = intptr_t(Seq) - intptr_t(Position + 1);
+                if (Diff == 0)
+                {
+                    if (m_DequeuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (Diff < 0)
+                {
+                    return std::nullopt;
+                }
+                else
+                {
+                    Position = m_DequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            std::optional<_Ty> Item(std::move(*CurCell->Get()));
+            CurCell->Get()->~_Ty();
+            CurCell->Sequence.store(Position + m_Mask + 1, std::memory_order_release);
+            m_NotFull.Notify();
+            return Item;
+        }
+
+        /// <summary>
+        /// Push as many items of [First, Last) as fit with a single compare-exchange.
+        /// Returns the number of items pushed, the items are moved from.
+        /// </summary>
+        template<typename _IterTy>
+        size_t TryPushBatch(
+            _IterTy First,
+            _IterTy Last)
+        {
+            const size_t Count = size_t(std::distance(First, Last));
+            if (!Count)
+            {
+                return 0;
+            }
+
+            size_t Position, Reserved;
+            do
+            {
+                Position = m_EnqueuePos.load(std::memory_order_relaxed);
+                Reserved = 0;
+                while (Reserved < Count &&
+                       m_Cells[(Position + Reserved) & m_Mask].Sequence.load(std::memory_order_acquire) == Position + Reserved)
+                {
+                    Reserved++;
+                }
+                if (!Reserved)
+                {
+                    return 0;
+                }
+            } while (!m_EnqueuePos.compare_exchange_weak(Position, Position + Reserved, std::memory_order_relaxed));
+
+            for (size_t i = 0; i < Reserved; i++, ++First)
+            {
+                auto& CurCell = m_Cells[(Position + i) & m_Mask];
+                new (CurCell.Storage) _Ty(std::move(*First));
+                CurCell.Sequence.store(Position + i + 1, std::memory_order_release);
+            }
+            m_NotEmpty.Notify();
+            return Reserved;
+        }
+
+        /// <summary>
+        /// Pop up to MaxCount items with a single compare-exchange and write them to Output.
+        /// Returns the number of items popped.
+        /// </summary>
+        template<typename _OutIterTy>
+        size_t TryPopBatch(
+            _OutIterTy Output,
+            size_t     MaxCount)
+        {
+            if (!MaxCount)
+            {
+                return 0;
+            }
+
+            size_t Position, Reserved;
+            do
+            {
+                Position = m_DequeuePos.load(std::memory_order_relaxed);
+                Reserved = 0;
+                while (Reserved < MaxCount &&
+                       m_Cells[(Position + Reserved) & m_Mask].Sequence.load(std::memory_order_acquire) == Position + Reserved + 1)
+                {
+                    Reserved++;
+                }
+                if (!Reserved)
+                {
+                    return 0;
+                }
+            } while (!m_DequeuePos.compare_exchange_weak(Position, Position + Reserved, std::memory_order_relaxed));
+
+            for (size_t i = 0; i < Reserved; i++, ++Output)
+            {
+                auto& CurCell = m_Cells[(Position + i) & m_Mask];
+                *Output       = std::move(*CurCell.Get());
+                CurCell.Get()->~_Ty();
+                CurCell.Sequence.store(Position + i + m_Mask + 1, std::memory_order_release);
+            }
+            m_NotFull.Notify();
+            return Reserved;
+        }
+
+        /// <summary>
+        /// Push an item, waiting for room if the queue is full.
+        /// </summary>
+        void Push(
+            _Ty Item)
+        {
+            m_NotFull.Wait(
+                [&]
+                { return TryEmplace(std::move(Item)); });
+        }
+
+        /// <summary>
+        /// Pop an item, waiting for one if the queue is empty.
+        /// </summary>
+        [[nodiscard]] _Ty Pop()
+        {
+            std::optional<_Ty> Item;
+            m_NotEmpty.Wait(
+                [&]
+                { return (Item = TryPop()).has_value(); });
+            return std::move(*Item);
+        }
+
+        /// <summary>
+        /// Get the capacity of the queue.
+        /// </summary>
+        [[nodiscard]] size_t Capacity() const noexcept
+        {
+            return m_Mask + 1;
+        }
+
+        /// <summary>
+        /// Get the approximate number of items in the queue.
+        /// </summary>
+        [[nodiscard]] size_t Size() const noexcept
+        {
+            size_t Enqueue = m_EnqueuePos.load(std::memory_order_relaxed);
+            size_t Dequeue = m_DequeuePos.load(std::memory_order_relaxed);
+            return Enqueue > Dequeue ? Enqueue - Dequeue : 0;
+        }
+
+        /// <summary>
+        /// Check if the queue is (approximately) empty.
+        /// </summary>
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+    private:
+        std::unique_ptr<Cell[]> m_Cells;
+        size_t                  m_Mask = 0;
+
+        alignas(Impl::s_QueueCacheLineSize) std::atomic_size_t m_EnqueuePos = 0;
+        alignas(Impl::s_QueueCacheLineSize) std::atomic_size_t m_DequeuePos = 0;
+
+        alignas(Impl::s_QueueCacheLineSize) Impl::QueueSignal m_NotEmpty;
+        Impl::QueueSignal m_NotFull;
+    };
+
+    /// <summary>
+    /// Lock-free unbounded multi-producer multi-consumer queue.
+    /// Items live in a linked list of fixed size segments, producers and consumers claim slots with a fetch-add on
+    /// the segment's indices and move to the next segment once it is exhausted.
+    /// Consumed segments are reclaimed once no operation that could still see them is in progress,
+    /// operations register themselves in per-thread shards so they don't contend on a shared counter.
+    /// Reclamation needs a moment where no operation is in progress at all: a queue that is never idle keeps its
+    /// consumed segments until it is, or until it is destroyed.
+    /// </summary>
+    template<typename _Ty>
+        requires std::is_nothrow_move_constructible_v<_Ty>
+    class UnboundedMPMCQueue
+    {
+        static constexpr size_t s_ShardCount = 16;
+
+        enum class CellState : uint8_t
+        {
+            Empty,
+            Full,
+            Taken
+        };
+
+        struct Cell
+        {
+            std::atomic<CellState> State = CellState::Empty;
+            alignas(_Ty) std::byte Storage[sizeof(_Ty)];
+
+            [[nodiscard]] _Ty* Get() noexcept
+            {
+                return std::launder(reinterpret_cast<_Ty*>(Storage));
+            }
+        };
+
+        struct Segment
+        {
+            explicit Segment(
+                size_t Size) :
+                Cells(std::make_unique<Cell[]>(Size))
+            {
+            }
+
+            alignas(Impl::s_QueueCacheLineSize) std::atomic_size_t EnqueueIndex = 0;
+            alignas(Impl::s_QueueCacheLineSize) std::atomic_size_t DequeueIndex = 0;
+            alignas(Impl::s_QueueCacheLineSize) std::atomic<Segment*> Next     = nullptr;
+
+            std::unique_ptr<Cell[]> Cells;
+            Segment*                NextRetired = nullptr;
+        };
+
+        struct alignas(Impl::s_QueueCacheLineSize) Shard
+        {
+            std::atomic_size_t Active = 0;
+        };
+
+        /// <summary>
+        /// Registers an operation in the calling thread's shard for its lifetime.
+        /// </summary>
+        class OperationGuard
+        {
+        public:
+            explicit OperationGuard(
+                UnboundedMPMCQueue* Queue) :
+                m_Queue(Queue),
+                m_Shard(&Queue->m_Shards[GetShardIndex()])
+            {
+                m_Shard->Active.fetch_add(1, std::memory_order_seq_cst);
+            }
+
+            OperationGuard(const OperationGuard&)            = delete;
+            OperationGuard& operator=(const OperationGuard&) = delete;
+
+            ~OperationGuard()
+            {
+                m_Shard->Active.fetch_sub(1, std::memory_order_seq_cst);
+                if (m_Queue->m_Retired.load(std::memory_order_relaxed))
+                {
+                    m_Queue->TryReclaim();
+                }
+            }
+
+        private:
+            UnboundedMPMCQueue* m_Queue;
+            Shard*              m_Shard;
+        };
+
+    public:
+        explicit UnboundedMPMCQueue(
+            size_t SegmentSize = 256) :
+            m_SegmentSize(std::max<size_t>(SegmentSize, 2))
+        {
+            auto First = new Segment(m_SegmentSize);
+            m_Head.store(First, std::memory_order_relaxed);
+            m_Tail.store(First, std::memory_order_relaxed);
+        }
+
+        UnboundedMPMCQueue(const UnboundedMPMCQueue&)            = delete;
+        UnboundedMPMCQueue& operator=(const UnboundedMPMCQueue&) = delete;
+
+        UnboundedMPMCQueue(UnboundedMPMCQueue&&)            = delete;
+        UnboundedMPMCQueue& operator=(UnboundedMPMCQueue&&) = delete;
+
+        ~UnboundedMPMCQueue()
+        {
+            while (TryPop())
+            {
+            }
+
+            FreeSegments(m_Retired.exchange(nullptr, std::memory_order_acquire));
+            for (auto CurSegment = m_Head.load(std::memory_order_relaxed); CurSegment;)
+            {
+                delete std::exchange(CurSegment, CurSegment->Next.load(std::memory_order_relaxed));
+            }
+        }
+
+        /// <summary>
+        /// Push an item, never fails.
+        /// </summary>
+        template<typename... _Args>
+        void Emplace(
+            _Args&&... Args)
+        {
+            {
+                OperationGuard Guard(this);
+
+                _Ty Item(std::forward<_Args>(Args)...);
+                while (true)
+                {
+                    Segment* Tail  = m_Tail.load(std::memory_order_acquire);
+                    size_t   Index = Tail->EnqueueIndex.fetch_add(1, std::memory_order_relaxed);
+                    if (Index < m_SegmentSize)
+                    {
+                        auto& CurCell = Tail->Cells[Index];
+                        new (CurCell.Storage) _Ty(std::move(Item));
+
+                        CellState Expected = CellState::Empty;
+                        if (CurCell.State.compare_exchange_strong(Expected, CellState::Full, std::memory_order_release, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+
+                        // A consumer gave up on this cell before we filled it, take the item back and retry
+                        Item = std::move(*CurCell.Get());
+                        CurCell.Get()->~_Ty();
+                        continue;
+                    }
+
+                    // The segment is exhausted, link a new one or help the producer that did
+                    if (Tail != m_Tail.load(std::memory_order_acquire))
+                    {
+                        continue;
+                    }
+
+                    Segment* Next = Tail->Next.load(std::memory_order_acquire);
+                    if (!Next)
+                    {
+                        auto NewSegment = new Segment(m_SegmentSize);
+
+                        // Publish the segment with the item already in its first cell
+                        new (NewSegment->Cells[0].Storage) _Ty(std::move(Item));
+                        NewSegment->Cells[0].State.store(CellState::Full, std::memory_order_relaxed);
+                        NewSegment->EnqueueIndex.store(1, std::memory_order_relaxed);
+
+                        Segment* Expected = nullptr;
+                        if (Tail->Next.compare_exchange_strong(Expected, NewSegment, std::memory_order_acq_rel))
+                        {
+                            m_Tail.compare_exchange_strong(Tail, NewSegment, std::memory_order_acq_rel);
+                            break;
+                        }
+
+                        Item = std::move(*NewSegment->Cells[0].Get());
+                        NewSegment->Cells[0].Get()->~_Ty();
+                        NewSegment->Cells[0].State.store(CellState::Empty, std::memory_order_relaxed);
+                        delete NewSegment;
+                    }
+                    else
+                    {
+                        m_Tail.compare_exchange_strong(Tail, Next, std::memory_order_acq_rel);
+                    }
+                }
+            }
+            m_NotEmpty.Notify();
+        }
+
+        /// <summary>
+        /// Push an item, never fails.
+        /// </summary>
+        void Push(
+            _Ty Item)
+        {
+            Emplace(std::move(Item));
+        }
+
+        /// <summary>
+        /// Push an item, never fails.
+        /// Provided so the queue can be used where a bounded queue is expected.
+        /// </summary>
+        bool TryPush(
+            _Ty Item)
+        {
+            Emplace(std::move(Item));
+            return true;
+        }
+
+        /// <summary>
+        /// Push every item of [First, Last), the items are moved from.
+        /// </summary>
+        template<typename _IterTy>
+        size_t TryPushBatch(
+            _IterTy First,
+            _IterTy Last)
+        {
+            size_t Count = 0;
+            for (; First != Last; ++First, ++Count)
+            {
+                Emplace(std::move(*First));
+            }
+            return Count;
+        }
+
+        /// <summary>
+        /// Pop an item, returns nothing if the queue is empty.
+        /// </summary>
+        [[nodiscard]] std::optional<_Ty> TryPop()
+        {
+            OperationGuard Guard(this);
+            while (true)
+            {
+                Segment* Head = m_Head.load(std::memory_order_acquire);
+
+                // Don't burn indices of a drained segment, producers would have to skip them
+                if (Head->DequeueIndex.load(std::memory_order_relaxed) >= Head->EnqueueIndex.load(std::memory_order_relaxed) &&
+                    !Head->Next.load(std::memory_order_acquire))
+                {
+                    return std::nullopt;
+                }
+
+                size_t Index = Head->DequeueIndex.fetch_add(1, std::memory_order_relaxed);
+                if (Index >= m_SegmentSize)
+                {
+                    Segment* Next = Head->Next.load(std::memory_order_acquire);
+                    if (!Next)
+                    {
+                        return std::nullopt;
+                    }
+                    if (m_Head.compare_exchange_strong(Head, Next, std::memory_order_acq_rel))
+                    {
+                        Retire(Head);
+                    }
+                    continue;
+                }
+
+                auto& CurCell = Head->Cells[Index];
+                if (CurCell.State.exchange(CellState::Taken, std::memory_order_acquire) != CellState::Full)
+                {
+                    // The producer of this cell did not finish yet, it will retry with another cell
+                    continue;
+                }
+
+                std::optional<_Ty> Item(std::move(*CurCell.Get()));
+                CurCell.Get()->~_Ty();
+                return Item;
+            }
+        }
+
+        /// <summary>
+        /// Pop up to MaxCount items and write them to Output.
+        /// Returns the number of items popped.
+        /// </summary>
+        template<typename _OutIterTy>
+        size_t TryPopBatch(
+            _OutIterTy Output,
+            size_t     MaxCount)
+        {
+            size_t Count = 0;
+            for (; Count < MaxCount; ++Count, ++Output)
+            {
+                auto Item = TryPop();
+                if (!Item)
+                {
+                    break;
+                }
+                *Output = std::move(*Item);
+            }
+            return Count;
+        }
+
+        /// <summary>
+        /// Pop an item, waiting for one if the queue is empty.
+        /// </summary>
+        [[nodiscard]] _Ty Pop()
+        {
+            std::optional<_Ty> Item;
+            m_NotEmpty.Wait(
+                [&]
+                { return (Item = TryPop()).has_value(); });
+            return std::move(*Item);
+        }
+
+        /// <summary>
+        /// Check if the queue is (approximately) empty.
+        /// </summary>
+        [[nodiscard]] bool Empty()
+        {
+            OperationGuard Guard(this);
+
+            Segment* Head = m_Head.load(std::memory_order_acquire);
+            return Head->DequeueIndex.load(std::memory_order_relaxed) >= std::min(Head->EnqueueIndex.load(std::memory_order_relaxed), m_SegmentSize) &&
+                   !Head->Next.load(std::memory_order_acquire);
+        }
+
+    private:
+        [[nodiscard]] static size_t GetShardIndex() noexcept
+        {
+            static std::atomic_size_t s_NextShard = 0;
+            thread_local size_t       t_Shard     = s_NextShard.fetch_add(1, std::memory_order_relaxed) % s_ShardCount;
+            return t_Shard;
+        }
+
+        /// <summary>
+        /// Add a segment that is no longer reachable from the head to the retired list.
+        /// </summary>
+        void Retire(
+            Segment* OldSegment)
+        {
+            OldSegment->NextRetired = m_Retired.load(std::memory_order_relaxed);
+            while (!m_Retired.compare_exchange_weak(OldSegment->NextRetired, OldSegment, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// <summary>
+        /// Check if no operation is registered in any shard.
+        /// </summary>
+        [[nodiscard]] bool IsQuiescent() const noexcept
+        {
+            return std::ranges::all_of(
+                m_Shards,
+                [](const Shard& CurShard)
+                { return CurShard.Active.load(std::memory_order_seq_cst) == 0; });
+        }
+
+        /// <summary>
+        /// Free the retired segments if no operation is in progress.
+        /// An operation that started after a segment was retired can't reach it, so the retired list is taken first,
+        /// and freed only if no operation is registered afterwards, otherwise it is put back for a later attempt.
+        /// </summary>
+        void TryReclaim()
+        {
+            // Cheap check first so busy queues don't keep taking and putting back the list
+            if (!IsQuiescent())
+            {
+                return;
+            }
+
+            Segment* Retired = m_Retired.exchange(nullptr, std::memory_order_seq_cst);
+            if (!Retired)
+            {
+                return;
+            }
+
+            if (!IsQuiescent())
+            {
+                Segment* Last = Retired;
+                while (Last->NextRetired)
+                {
+                    Last = Last->NextRetired;
+                }
+
+                Last->NextRetired = m_Retired.load(std::memory_order_relaxed);
+                while (!m_Retired.compare_exchange_weak(Last->NextRetired, Retired, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                }
+                return;
+            }
+
+            FreeSegments(Retired);
+        }
+
+        /// <summary>
+        /// Free a list of retired segments, they only contain consumed cells.
+        /// </summary>
+        static void FreeSegments(
+            Segment* Retired)
+        {
+            while (Retired)
+            {
+                delete std::exchange(Retired, Retired->NextRetired);
+            }
+        }
+
+    private:
+        size_t m_SegmentSize;
+
+        alignas(Impl::s_QueueCacheLineSize) std::atomic<Segment*> m_Head = nullptr;
+        alignas(Impl::s_QueueCacheLineSize) std::atomic<Segment*> m_Tail = nullptr;
+        alignas(Impl::s_QueueCacheLineSize) std::atomic<Segment*> m_Retired = nullptr;
+
+        std::array<Shard, s_ShardCount> m_Shards;
+        Impl::QueueSignal               m_NotEmpty;
+    };
+} // namespace Neon::Asio
\ No newline at end of file
@@ -1,13 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <barrier>
+#include <bit>
+#include <chrono>
 #include <concepts>
 #include <deque>
 #include <functional>
 #include <future>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <semaphore>
+#include <stdexcept>
 #include <thread>
 #include <type_traits>
 #ifdef __has_include
@@ -16,7 +23,8 @@
 #endif
 #endif
 
-#include <Asio/QueueTS.hpp>
+#include <Asio/MPMCQueue.hpp>
+#include <Asio/WorkStealingDeque.hpp>
 
 namespace Neon::Asio
 {
@@ -30,6 +38,57 @@ namespace Neon::Asio
 #endif
     } // namespace Impl
 
+
+    /**
+     * @brief Priority of a task, workers always pick the most urgent task available.
+     */
+    enum class task_priority : std::uint8_t
+    {
+        critical,
+        normal,
+        background,
+
+        count
+    };
+
+    /**
+     * @brief Options of an enqueued task.
+     */
+    struct task_options
+    {
+        task_priority priority = task_priority::normal;
+
+        /// mask of the workers allowed to run the task, bit i is worker i, 0 lets any worker run it
+        /// bits of workers that don't exist are ignored, a mask without any existing worker is rejected
+        std::uint64_t affinity = 0;
+    };
+
+    /**
+     * @brief Counters of the tasks of a priority level.
+     */
+    struct task_priority_stats
+    {
+        /// number of tasks waiting to be executed
+        std::int64_t queued = 0;
+
+        /// number of tasks that started executing
+        std::uint64_t executed = 0;
+
+        /// time between enqueuing a task and starting it
+        std::chrono::nanoseconds average_latency{};
+        std::chrono::nanoseconds max_latency{};
+    };
+
+    /**
+     * @brief Work stealing thread pool.
+     * @details Each worker owns a lock-free Chase-Lev deque per priority: tasks enqueued from a worker are pushed
+     * to and popped from the bottom of its own deque (LIFO), idle workers steal from the top of a random victim's
+     * deque (FIFO) and take up to half of it at once. Tasks enqueued from outside the pool are spread over the
+     * workers' injection queues.
+     * Workers run the most urgent task available, except every few tasks where they run the least urgent one so
+     * background work is never starved. Tasks with an affinity are queued per distinct mask, whichever worker of
+     * the mask is free first runs them, and workers outside the mask never see them.
+     */
     template<typename FunctionType = Impl::default_function_type,
              typename ThreadType   = std::jthread>
         requires std::invocable<FunctionType> &&
@@ -39,59 +98,30 @@ namespace Neon::Asio
     public:
         explicit ThreadPool(
             unsigned int number_of_threads = std::thread::hardware_concurrency()) :
-            tasks_(number_of_threads)
+            workers_(std::max(number_of_threads, 1u)),
+            groups_(std::min<std::size_t>(workers_.size(), max_affinity_workers) + max_affinity_groups)
         {
-            std::size_t current_id = 0;
+            // every worker that can be named in a mask has a group of its own
+            const std::size_t single_groups = std::min<std::size_t>(workers_.size(), max_affinity_workers);
+            for (std::size_t i = 0; i < single_groups; ++i)
+            {
+                groups_[i].mask.store(std::uint64_t(1) << i, std::memory_order_relaxed);
+            }
+            group_count_.store(single_groups, std::memory_order_release);
+
             for (std::size_t i = 0; i < number_of_threads; ++i)
             {
-                priority_queue_.push_back(size_t(current_id));
                 try
                 {
-                    threads_.emplace_back([&, id = current_id](const std::stop_token& stop_tok)
-                                          {
-                        do {
-                            // wait until signaled
-                            tasks_[id].signal.acquire();
-
-                            do {
-                                // invoke the task
-                                while (auto task = tasks_[id].tasks.pop_front()) {
-                                    try {
-                                        pending_tasks_.fetch_sub(1, std::memory_order_release);
-                                        std::invoke(std::move(task.value()));
-                                    } catch (...) {
-                                    }
-                                }
-
-                                // try to steal a task
-                                for (std::size_t j = 1; j < tasks_.size(); ++j) {
-                                    const std::size_t index = (id + j) % tasks_.size();
-                                    if (auto task = tasks_[index].tasks.steal()) {
-                                        // steal a task
-                                        pending_tasks_.fetch_sub(1, std::memory_order_release);
-                                        std::invoke(std::move(task.value()));
-                                        // stop stealing once we have invoked a stolen task
-                                        break;
-                                    }
-                                }
-
-                            } while (pending_tasks_.load(std::memory_order_acquire) > 0);
-
-                            priority_queue_.rotate_to_front(id);
-
-                        } while (!stop_tok.stop_requested()); });
-                    // increment the thread id
-                    ++current_id;
+                    threads_.emplace_back([this, id = i](const std::stop_token& stop_tok)
+                                          { worker_loop(stop_tok, id); });
                 }
                 catch (...)
                 {
                     // catch all
 
-                    // remove one item from the tasks
-                    tasks_.pop_back();
-
-                    // remove our thread from the priority queue
-                    std::ignore = priority_queue_.pop_back();
+                    // the worker's queues stay, other workers will steal from them
+                    break;
                 }
             }
         }
@@ -99,11 +129,43 @@ namespace Neon::Asio
         ~ThreadPool()
         {
             // stop all threads
-            for (std::size_t i = 0; i < threads_.size(); ++i)
+            for (auto& thread : threads_)
+            {
+                thread.request_stop();
+            }
+
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+            epoch_.notify_all();
+
+            for (auto& thread : threads_)
+            {
+                thread.join();
+            }
+
+            // release the tasks that were never executed
+            for (auto& worker : workers_)
+            {
+                for (std::size_t priority = 0; priority < priority_count; ++priority)
+                {
+                    while (auto task = worker.tasks[priority].Pop())
+                    {
+                        delete *task;
+                    }
+                    while (auto task = worker.injected[priority].TryPop())
+                    {
+                        delete *task;
+                    }
+                }
+            }
+            for (auto& group : groups_)
             {
-                threads_[i].request_stop();
-                tasks_[i].signal.release();
-                threads_[i].join();
+                for (auto& queue : group.tasks)
+                {
+                    while (auto task = queue.TryPop())
+                    {
+                        delete *task;
+                    }
+                }
             }
         }
 
@@ -121,14 +183,16 @@ namespace Neon::Asio
          * @tparam Function An invokable type.
          * @tparam Args Argument parameter pack
          * @tparam ReturnType The return type of the Function
+         * @param options The priority and affinity of the task
          * @param f The callable function
          * @param args The parameters that will be passed (copied) to the function.
          * @return A std::future<ReturnType> that can be used to retrieve the returned value.
+         * @throw std::invalid_argument if the affinity does not contain any worker.
          */
         template<typename Function, typename... Args,
                  typename ReturnType = std::invoke_result_t<Function&&, Args&&...>>
             requires std::invocable<Function, Args...>
-        [[nodiscard]] std::future<ReturnType> enqueue(Function f, Args... args)
+        [[nodiscard]] std::future<ReturnType> enqueue(task_options options, Function f, Args... args)
         {
 #if __cpp_lib_move_only_function
             // we can do this in C++23 because we now have support for move only functions
@@ -154,7 +218,7 @@ namespace Neon::Asio
                     promise.set_exception(std::current_exception());
                 }
             };
-            enqueue_task(std::move(task));
+            enqueue_task(options, std::move(task));
             return future;
 #else
             /*
@@ -192,7 +256,7 @@ namespace Neon::Asio
             // get the future before enqueuing the task
             auto future = shared_promise->get_future();
             // enqueue the task
-            enqueue_task(std::move(task));
+            enqueue_task(options, std::move(task));
             return future;
 #endif
         }
@@ -201,15 +265,18 @@ namespace Neon::Asio
          * @brief Enqueue a task to be executed in the thread pool that returns void.
          * @tparam Function An invokable type.
          * @tparam Args Argument parameter pack for Function
+         * @param options The priority and affinity of the task
          * @param func The callable to be executed
          * @param args Arguments that will be passed to the function.
+         * @throw std::invalid_argument if the affinity does not contain any worker.
          */
         template<typename Function, typename... Args>
             requires std::invocable<Function, Args...> &&
                      std::is_same_v<void, std::invoke_result_t<Function&&, Args&&...>>
-        void enqueue_detach(Function&& func, Args&&... args)
+        void enqueue_detach(task_options options, Function&& func, Args&&... args)
         {
             enqueue_task(
+                options,
                 std::move([f         = std::forward<Function>(func),
                            ... largs = std::forward<Args>(args)]() mutable -> decltype(auto)
                           {
@@ -220,37 +287,550 @@ namespace Neon::Asio
                     } }));
         }
 
+        /**
+         * @brief Enqueue a task with normal priority that returns a result.
+         */
+        template<typename Function, typename... Args,
+                 typename ReturnType = std::invoke_result_t<Function&&, Args&&...>>
+            requires std::invocable<Function, Args...>
+        [[nodiscard]] std::future<ReturnType> enqueue(Function f, Args... args)
+        {
+            return enqueue(task_options{}, std::move(f), std::move(args)...);
+        }
+
+        /**
+         * @brief Enqueue a task with normal priority that returns void.
+         */
+        template<typename Function, typename... Args>
+            requires std::invocable<Function, Args...> &&
+                     std::is_same_v<void, std::invoke_result_t<Function&&, Args&&...>>
+        void enqueue_detach(Function&& func, Args&&... args)
+        {
+            enqueue_detach(task_options{}, std::forward<Function>(func), std::forward<Args>(args)...);
+        }
+
         [[nodiscard]] auto size() const
         {
             return threads_.size();
         }
 
+        /**
+         * @brief Execute one queued task on the calling thread.
+         * @details Lets a thread that waits on a result help the pool instead of blocking.
+         * Threads outside the pool never run tasks with an affinity.
+         * @return false if no task was found.
+         */
+        bool run_pending_task()
+        {
+            task_pointer task = nullptr;
+            if (is_worker_thread())
+            {
+                task = find_task(current_worker_.id);
+            }
+            else
+            {
+                for (std::size_t priority = 0; priority < priority_count && !task; ++priority)
+                {
+                    if (queued_[priority].load(std::memory_order_relaxed) > 0)
+                    {
+                        task = steal_task(no_worker, priority);
+                    }
+                }
+            }
+            if (!task)
+            {
+                return false;
+            }
+            run_task(task);
+            return true;
+        }
+
+        /**
+         * @brief Check if the calling thread is one of the pool's workers.
+         */
+        [[nodiscard]] bool is_worker_thread() const noexcept
+        {
+            return current_worker_.pool == this;
+        }
+
+        /**
+         * @brief Get the queue depth and latency counters of a priority level.
+         */
+        [[nodiscard]] task_priority_stats stats(task_priority priority) const
+        {
+            const std::size_t index = std::size_t(priority);
+
+            std::uint64_t total_latency = 0, max_latency = 0;
+
+            task_priority_stats result;
+            result.queued = queued_[index].load(std::memory_order_relaxed);
+
+            auto accumulate = [&](const latency_counters& counters)
+            {
+                result.executed += counters.executed.load(std::memory_order_relaxed);
+                total_latency += counters.total_latency.load(std::memory_order_relaxed);
+                max_latency = std::max(max_latency, counters.max_latency.load(std::memory_order_relaxed));
+            };
+            for (auto& worker : workers_)
+            {
+                accumulate(worker.counters[index]);
+            }
+            accumulate(external_counters_[index]);
+
+            if (result.executed)
+            {
+                result.average_latency = std::chrono::nanoseconds(total_latency / result.executed);
+            }
+            result.max_latency = std::chrono::nanoseconds(max_latency);
+            return result;
+        }
+
+        /**
+         * @brief Reset the latency counters, the queue depths are kept.
+         * @details Tasks starting during the reset may still be counted.
+         */
+        void reset_stats()
+        {
+            auto reset = [](latency_counters& counters)
+            {
+                counters.executed.store(0, std::memory_order_relaxed);
+                counters.total_latency.store(0, std::memory_order_relaxed);
+                counters.max_latency.store(0, std::memory_order_relaxed);
+            };
+            for (auto& worker : workers_)
+            {
+                std::ranges::for_each(worker.counters, reset);
+            }
+            std::ranges::for_each(external_counters_, reset);
+        }
+
     private:
+        using clock_type = std::chrono::steady_clock;
+
+        struct task_item
+        {
+            FunctionType           function;
+            task_priority          priority;
+            std::size_t            group;
+            clock_type::time_point enqueue_time;
+        };
+
+        using task_pointer = task_item*;
+
+        static constexpr std::size_t priority_count = std::size_t(task_priority::count);
+
+        /// id used for threads that are not part of the pool
+        static constexpr std::size_t no_worker = std::size_t(-1);
+
+        /// group of the tasks without an affinity
+        static constexpr std::size_t no_group = std::size_t(-1);
+
+        /// only the first 64 workers can be named in an affinity mask
+        static constexpr std::size_t max_affinity_workers = 64;
+
+        /// number of masks naming several workers that get a group of their own
+        static constexpr std::size_t max_affinity_groups = 16;
+
+        /// number of times an idle worker yields before going to sleep
+        static constexpr std::size_t spin_rounds = 16;
+
+        /// maximum number of tasks taken from a victim in a single steal
+        static constexpr std::size_t max_steal_batch = 32;
+
+        /// every n-th task picked by a worker is the least urgent one available
+        static constexpr std::size_t starvation_interval = 8;
+
+        struct latency_counters
+        {
+            std::atomic_uint64_t executed{};
+            std::atomic_uint64_t total_latency{};
+            std::atomic_uint64_t max_latency{};
+        };
+
+        struct alignas(64) worker_queue
+        {
+            std::array<WorkStealingDeque<task_pointer>, priority_count>  tasks;
+            std::array<UnboundedMPMCQueue<task_pointer>, priority_count> injected;
+
+            /// only written by the owner, so they are updated without read-modify-write operations
+            std::array<latency_counters, priority_count> counters;
+
+            /// number of tasks picked, only accessed by the owner
+            std::size_t picks = 0;
+        };
+
+        /// tasks sharing an affinity mask, any worker of the mask can take them
+        struct alignas(64) affinity_group
+        {
+            std::atomic_uint64_t                                         mask{};
+            std::array<UnboundedMPMCQueue<task_pointer>, priority_count> tasks;
+            std::atomic_int64_t                                          pending{};
+        };
+
+        struct worker_context
+        {
+            const ThreadPool* pool = nullptr;
+            std::size_t       id   = 0;
+        };
+
+        static inline thread_local worker_context current_worker_{};
+
         template<typename Function>
-        void enqueue_task(Function&& f)
+        void enqueue_task(const task_options& options, Function&& f)
         {
-            auto i_opt = priority_queue_.copy_front_and_rotate_to_back();
-            if (!i_opt.has_value())
+            if (threads_.empty())
             {
                 // would only be a problem if there are zero threads
                 return;
             }
-            auto i = *(i_opt);
-            pending_tasks_.fetch_add(1, std::memory_order_relaxed);
-            tasks_[i].tasks.push_back(std::forward<Function>(f));
-            tasks_[i].signal.release();
+
+            const std::size_t priority = std::min(std::size_t(options.priority), priority_count - 1);
+            const std::size_t group    = options.affinity ? select_affinity_group(options.affinity) : no_group;
+
+            auto task = new task_item{
+                FunctionType(std::forward<Function>(f)),
+                task_priority(priority),
+                group,
+                clock_type::now()
+            };
+            queued_[priority].fetch_add(1, std::memory_order_relaxed);
+
+            if (group != no_group)
+            {
+                affinity_pending_.fetch_add(1, std::memory_order_seq_cst);
+                groups_[group].pending.fetch_add(1, std::memory_order_seq_cst);
+                groups_[group].tasks[priority].Push(task);
+            }
+            else
+            {
+                pending_tasks_.fetch_add(1, std::memory_order_seq_cst);
+                if (is_worker_thread())
+                {
+                    // enqueued from one of our workers, keep it local
+                    workers_[current_worker_.id].tasks[priority].Push(task);
+                }
+                else
+                {
+                    auto i = next_queue_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+                    workers_[i].injected[priority].Push(task);
+                }
+            }
+
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+            if (sleeping_.load(std::memory_order_seq_cst) > 0)
+            {
+                // only the workers of the mask can run the task, so every sleeper is woken up
+                if (group != no_group)
+                {
+                    epoch_.notify_all();
+                }
+                else
+                {
+                    epoch_.notify_one();
+                }
+            }
         }
 
-        struct task_item
+        /**
+         * @brief Find or register the group of an affinity mask.
+         * @details The group table only grows, so workers scan it without locking. Once it is full, the task goes
+         * to the group of the mask's worker with the fewest pending tasks.
+         */
+        [[nodiscard]] std::size_t select_affinity_group(std::uint64_t affinity)
         {
-            QueueTS<FunctionType> tasks{};
-            std::binary_semaphore signal{ 0 };
-        };
+            const std::size_t   workers = std::min(threads_.size(), max_affinity_workers);
+            const std::uint64_t valid   = workers == max_affinity_workers ? ~std::uint64_t(0) : (std::uint64_t(1) << workers) - 1;
+
+            affinity &= valid;
+            if (!affinity)
+            {
+                throw std::invalid_argument("task affinity does not contain any worker");
+            }
+
+            auto find = [this, affinity](std::size_t count) -> std::size_t
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if (groups_[i].mask.load(std::memory_order_relaxed) == affinity)
+                    {
+                        return i;
+                    }
+                }
+                return no_group;
+            };
+
+            if (auto group = find(group_count_.load(std::memory_order_acquire)); group != no_group)
+            {
+                return group;
+            }
+
+            std::scoped_lock lock(groups_mutex_);
+
+            const std::size_t count = group_count_.load(std::memory_order_relaxed);
+            if (auto group = find(count); group != no_group)
+            {
+                return group;
+            }
+            if (count < groups_.size())
+            {
+                groups_[count].mask.store(affinity, std::memory_order_relaxed);
+                group_count_.store(count + 1, std::memory_order_release);
+                return count;
+            }
+
+            std::size_t  selected = no_group;
+            std::int64_t lowest   = std::numeric_limits<std::int64_t>::max();
+            for (std::uint64_t mask = affinity; mask; mask &= mask - 1)
+            {
+                const std::size_t id      = std::size_t(std::countr_zero(mask));
+                const auto        pending = groups_[id].pending.load(std::memory_order_relaxed);
+                if (pending < lowest)
+                {
+                    lowest   = pending;
+                    selected = id;
+                }
+            }
+            return selected;
+        }
+
+        /**
+         * @brief Pop a task of a group the worker belongs to, starting with its own group.
+         */
+        [[nodiscard]] task_pointer pop_affinity_task(std::size_t id, std::size_t priority)
+        {
+            if (id >= max_affinity_workers || affinity_pending_.load(std::memory_order_relaxed) <= 0)
+            {
+                return nullptr;
+            }
+
+            const std::uint64_t bit   = std::uint64_t(1) << id;
+            const std::size_t   count = group_count_.load(std::memory_order_acquire);
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                auto& group = groups_[(id + j) % count];
+                if (!(group.mask.load(std::memory_order_relaxed) & bit) ||
+                    group.pending.load(std::memory_order_relaxed) <= 0)
+                {
+                    continue;
+                }
+                if (auto task = group.tasks[priority].TryPop())
+                {
+                    return *task;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Check if a group the worker belongs to has pending tasks.
+         */
+        [[nodiscard]] bool has_affinity_task(std::size_t id) const
+        {
+            if (id >= max_affinity_workers || affinity_pending_.load(std::memory_order_seq_cst) <= 0)
+            {
+                return false;
+            }
+
+            const std::uint64_t bit   = std::uint64_t(1) << id;
+            const std::size_t   count = group_count_.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if ((groups_[i].mask.load(std::memory_order_relaxed) & bit) &&
+                    groups_[i].pending.load(std::memory_order_seq_cst) > 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void worker_loop(const std::stop_token& stop_tok, std::size_t id)
+        {
+            current_worker_ = { this, id };
+
+            std::size_t idle_rounds = 0;
+            while (true)
+            {
+                if (auto task = find_task(id))
+                {
+                    idle_rounds = 0;
+                    run_task(task);
+                    continue;
+                }
+
+                // drain every task before stopping
+                if (stop_tok.stop_requested())
+                {
+                    break;
+                }
+
+                if (++idle_rounds < spin_rounds)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                idle_rounds = 0;
+
+                // the epoch is read before checking for work, so a task enqueued after the check wakes us
+                sleeping_.fetch_add(1, std::memory_order_seq_cst);
+                auto epoch = epoch_.load(std::memory_order_seq_cst);
+                if (pending_tasks_.load(std::memory_order_seq_cst) <= 0 &&
+                    !has_affinity_task(id) &&
+                    !stop_tok.stop_requested())
+                {
+                    epoch_.wait(epoch, std::memory_order_seq_cst);
+                }
+                sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+            }
+
+            current_worker_ = {};
+        }
+
+        [[nodiscard]] task_pointer find_task(std::size_t id)
+        {
+            auto& self = workers_[id];
+
+            // most urgent first, but every few picks start from the least urgent so it is never starved
+            const bool urgent_first = (++self.picks % starvation_interval) != 0;
+            for (std::size_t i = 0; i < priority_count; ++i)
+            {
+                const std::size_t priority = urgent_first ? i : priority_count - 1 - i;
+                if (queued_[priority].load(std::memory_order_relaxed) <= 0)
+                {
+                    // the counter is raised before a task is queued, so it can't miss one
+                    continue;
+                }
+                if (auto task = self.tasks[priority].Pop())
+                {
+                    return *task;
+                }
+                if (auto task = pop_affinity_task(id, priority))
+                {
+                    return task;
+                }
+                if (auto task = self.injected[priority].TryPop())
+                {
+                    return *task;
+                }
+                if (auto task = steal_task(id, priority))
+                {
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
+        [[nodiscard]] task_pointer steal_task(std::size_t id, std::size_t priority)
+        {
+            const std::size_t count = workers_.size();
+            const std::size_t start = next_random() % count;
+
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                const std::size_t index = (start + j) % count;
+                if (index == id)
+                {
+                    continue;
+                }
+
+                auto& victim = workers_[index];
+                if (auto task = victim.tasks[priority].Steal())
+                {
+                    // take up to half of the victim's tasks, the first one is executed right away
+                    // threads outside the pool have no deque to move them to
+                    std::size_t batch = id != no_worker ? std::min(victim.tasks[priority].Size() / 2, max_steal_batch) : 0;
+                    while (batch--)
+                    {
+                        auto extra = victim.tasks[priority].Steal();
+                        if (!extra)
+                        {
+                            break;
+                        }
+                        workers_[id].tasks[priority].Push(*extra);
+                    }
+                    return *task;
+                }
+
+                if (auto task = victim.injected[priority].TryPop())
+                {
+                    return *task;
+                }
+            }
+            return nullptr;
+        }
+
+        void run_task(task_pointer task)
+        {
+            std::unique_ptr<task_item> owned(task);
+            if (owned->group != no_group)
+            {
+                groups_[owned->group].pending.fetch_sub(1, std::memory_order_release);
+                affinity_pending_.fetch_sub(1, std::memory_order_release);
+            }
+            else
+            {
+                pending_tasks_.fetch_sub(1, std::memory_order_release);
+            }
+
+            const std::size_t priority = std::size_t(owned->priority);
+            const auto        latency  = std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - owned->enqueue_time).count());
+
+            queued_[priority].fetch_sub(1, std::memory_order_relaxed);
+            if (is_worker_thread())
+            {
+                auto& counters = workers_[current_worker_.id].counters[priority];
+                counters.executed.store(counters.executed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                counters.total_latency.store(counters.total_latency.load(std::memory_order_relaxed) + latency, std::memory_order_relaxed);
+                if (latency > counters.max_latency.load(std::memory_order_relaxed))
+                {
+                    counters.max_latency.store(latency, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                auto& counters = external_counters_[priority];
+                counters.executed.fetch_add(1, std::memory_order_relaxed);
+                counters.total_latency.fetch_add(latency, std::memory_order_relaxed);
+                for (auto max_latency = counters.max_latency.load(std::memory_order_relaxed);
+                     latency > max_latency &&
+                     !counters.max_latency.compare_exchange_weak(max_latency, latency, std::memory_order_relaxed);)
+                {
+                }
+            }
+
+            try
+            {
+                std::invoke(owned->function);
+            }
+            catch (...)
+            {
+            }
+        }
+
+        [[nodiscard]] static std::uint32_t next_random() noexcept
+        {
+            // xorshift32, seeded per thread
+            static thread_local std::uint32_t state =
+                static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
 
-        std::vector<ThreadType>  threads_;
-        std::deque<task_item>    tasks_;
-        QueueTS<std::size_t>     priority_queue_;
-        std::atomic_int_fast64_t pending_tasks_{};
+        std::vector<ThreadType>                              threads_;
+        std::deque<worker_queue>                             workers_;
+        std::deque<affinity_group>                           groups_;
+        std::atomic_size_t                                   group_count_{};
+        std::mutex                                           groups_mutex_;
+        std::array<std::atomic_int64_t, priority_count>      queued_{};
+        std::array<latency_counters, priority_count>         external_counters_;
+        std::atomic_size_t                                   next_queue_{};
+        std::atomic_int_fast64_t                             pending_tasks_{};
+        std::atomic_int_fast64_t                             affinity_pending_{};
+        std::atomic_uint32_t                                 epoch_{};
+        std::atomic_uint32_t                                 sleeping_{};
     };
 
     /**
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace Neon::Asio
+{
+    /// <summary>
+    /// Lock-free Chase-Lev work stealing deque.
+    /// The owner thread pushes and pops at the bottom (LIFO), any other thread steals from the top (FIFO).
+    /// Items are read by thieves before they own them, so they must be trivially copyable (usually a pointer).
+    /// </summary>
+    template<typename _Ty>
+        requires std::is_trivially_copyable_v<_Ty>
+    class WorkStealingDeque
+    {
+        class Ring
+        {
+        public:
+            explicit Ring(
+                int64_t Capacity) :
+                m_Capacity(Capacity),
+                m_Mask(Capacity - 1),
+                m_Data(std::make_unique<std::atomic<_Ty>[]>(size_t(Capacity)))
+            {
+            }
+
+            [[nodiscard]] int64_t GetCapacity() const noexcept
+            {
+                return m_Capacity;
+            }
+
+            [[nodiscard]] _Ty Load(
+                int64_t Index) const noexcept
+            {
+                return m_Data[Index & m_Mask].load(std::memory_order_relaxed);
+            }
+
+            void Store(
+                int64_t Index,
+                _Ty     Item) noexcept
+            {
+                m_Data[Index & m_Mask].store(Item, std::memory_order_relaxed);
+            }
+
+            /// <summary>
+            /// Create a ring twice as large containing the items in [Top, Bottom).
+            /// </summary>
+            [[nodiscard]] std::unique_ptr<Ring> Grow(
+                int64_t Bottom,
+                int64_t Top) const
+            {
+                auto NewRing = std::make_unique<Ring>(m_Capacity * 2);
+                for (int64_t i = Top; i < Bottom; i++)
+                {
+                    NewRing->Store(i, Load(i));
+                }
+                return NewRing;
+            }
+
+        private:
+            int64_t                             m_Capacity;
+            int64_t                             m_Mask;
+            std::unique_ptr<std::atomic<_Ty>[]> m_Data;
+        };
+
+        static constexpr size_t s_CacheLineSize = 64;
+
+    public:
+        explicit WorkStealingDeque(
+            int64_t Capacity = 256)
+        {
+            int64_t RingCapacity = 1;
+            while (RingCapacity < Capacity)
+            {
+                RingCapacity <<= 1;
+            }
+
+            auto& InitialRing = m_Rings.emplace_back(std::make_unique<Ring>(RingCapacity));
+            m_Ring.store(InitialRing.get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&)            = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        WorkStealingDeque(WorkStealingDeque&&)            = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+        ~WorkStealingDeque() = default;
+
+        /// <summary>
+        /// Push an item at the bottom of the deque.
+        /// Must only be called by the owner thread.
+        /// </summary>
+        void Push(
+            _Ty Item)
+        {
+            int64_t Bottom  = m_Bottom.load(std::memory_order_relaxed);
+            int64_t Top     = m_Top.load(std::memory_order_acquire);
+            Ring*   CurRing = m_Ring.load(std::memory_order_relaxed);
+
+            if (Bottom - Top > CurRing->GetCapacity() - 1)
+            {
+                // Thieves may still be reading from the old ring, so it is only released with the deque
+                CurRing = m_Rings.emplace_back(CurRing->Grow(Bottom, Top)).get();
+                m_Ring.store(CurRing, std::memory_order_release);
+            }
+
+            CurRing->Store(Bottom, Item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Pop the most recently pushed item from the bottom of the deque.
+        /// Must only be called by the owner thread.
+        /// </summary>
+        [[nodiscard]] std::optional<_Ty> Pop()
+        {
+            int64_t Bottom  = m_Bottom.load(std::memory_order_relaxed) - 1;
+            Ring*   CurRing = m_Ring.load(std::memory_order_relaxed);
+            m_Bottom.store(Bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t Top = m_Top.load(std::memory_order_relaxed);
+
+            std::optional<_Ty> Item;
+            if (Top <= Bottom)
+            {
+                Item = CurRing->Load(Bottom);
+                if (Top == Bottom)
+                {
+                    // Last item, race against the thieves for it
+                    if (!m_Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        Item.reset();
+                    }
+                    m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                m_Bottom.store(Bottom + 1, std::memory_order_relaxed);
+            }
+            return Item;
+        }
+
+        /// <summary>
+        /// Steal the oldest item from the top of the deque.
+        /// Can be called from any thread, returns nothing if the deque is empty or another thread won the item.
+        /// </summary>
+        [[nodiscard]] std::optional<_Ty> Steal()
+        {
+            int64_t Top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t Bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (Top < Bottom)
+            {
+                Ring* CurRing = m_Ring.load(std::memory_order_acquire);
+                _Ty   Item    = CurRing->Load(Top);
+                if (m_Top.compare_exchange_strong(Top, Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    return Item;
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// <summary>
+        /// Get the approximate number of items in the deque.
+        /// </summary>
+        [[nodiscard]] size_t Size() const noexcept
+        {
+            int64_t Bottom = m_Bottom.load(std::memory_order_relaxed);
+            int64_t Top    = m_Top.load(std::memory_order_relaxed);
+            return Bottom > Top ? size_t(Bottom - Top) : 0;
+        }
+
+        /// <summary>
+        /// Check if the deque is (approximately) empty.
+        /// </summary>
+        [[nodiscard]] bool Empty() const noexcept
+        {
+            return Size() == 0;
+        }
+
+    private:
+        alignas(s_CacheLineSize) std::atomic_int64_t m_Top{ 0 };
+        alignas(s_CacheLineSize) std::atomic_int64_t m_Bottom{ 0 };
+        alignas(s_CacheLineSize) std::atomic<Ring*> m_Ring{ nullptr };
+
+        std::vector<std::unique_ptr<Ring>> m_Rings;
+    };
+} // namespace Neon::Asio
\ No newline at end of file
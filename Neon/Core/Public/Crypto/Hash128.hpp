@@ -0,0 +1,135 @@
+#pragma once
+
+#include <string>
+#include <array>
+#include <iosfwd>
+
+namespace Neon::Crypto
+{
+    /// <summary>
+    /// Fast non-cryptographic 128-bit hash, in the style of XXH3.
+    /// Use it for cache keys and change detection, use Sha256 where integrity matters.
+    /// </summary>
+    class Hash128
+    {
+    public:
+        struct Bytes;
+
+        static constexpr size_t s_StripeSize = 64;
+        static constexpr size_t s_SecretSize = 192;
+        static constexpr size_t s_BufferSize = s_StripeSize * 4;
+        static constexpr size_t s_AccCount   = s_StripeSize / sizeof(uint64_t);
+
+        Hash128();
+
+        /// <summary>
+        /// Append data to the hash.
+        /// </summary>
+        Hash128& Append(
+            const void* Data,
+            size_t      Size);
+
+        /// <summary>
+        /// Append data to the hash.
+        /// </summary>
+        Hash128& Append(
+            std::istream& Stream,
+            size_t        Size);
+
+        /// <summary>
+        /// Reset the hash.
+        /// </summary>
+        void Reset();
+
+        /// <summary>
+        /// Get the hash digest.
+        /// The state is not modified, more data can be appended after.
+        /// </summary>
+        [[nodiscard]] Bytes Digest() const;
+
+    private:
+        /// <summary>
+        /// Consume full stripes into the accumulators.
+        /// </summary>
+        static void ConsumeStripes(
+            uint64_t*      Acc,
+            size_t&        StripesSoFar,
+            const uint8_t* Data,
+            size_t         StripeCount);
+
+    private:
+        alignas(16) std::array<uint64_t, s_AccCount> m_Acc;
+        alignas(16) std::array<uint8_t, s_BufferSize> m_Buffer;
+
+        size_t   m_BufferedSize;
+        size_t   m_StripesSoFar;
+        uint64_t m_TotalSize;
+    };
+
+    struct Hash128::Bytes : std::array<uint8_t, 16>
+    {
+        /// <summary>
+        /// Convert to hex string
+        /// </summary>
+        [[nodiscard]] std::string ToString() const;
+
+        /// <summary>
+        /// Get the low 64 bits of the hash.
+        /// </summary>
+        [[nodiscard]] uint64_t Low() const noexcept;
+
+        /// <summary>
+        /// Get the high 64 bits of the hash.
+        /// </summary>
+        [[nodiscard]] uint64_t High() const noexcept;
+    };
+
+    //
+
+    /// <summary>
+    /// Append string type to the hash.
+    /// </summary>
+    template<typename _CharTy, typename _CharTraits = std::char_traits<_CharTy>>
+    inline Hash128& operator<<(
+        Hash128&                                            Hash,
+        const std::basic_string_view<_CharTy, _CharTraits>& String)
+    {
+        return Hash.Append(String.data(), String.size() * sizeof(typename _CharTraits::char_type));
+    }
+
+    /// <summary>
+    /// Append string type to the hash.
+    /// </summary>
+    template<typename _CharTy, typename _CharTraits = std::char_traits<_CharTy>>
+    inline Hash128& operator<<(
+        Hash128&                                       Hash,
+        const std::basic_string<_CharTy, _CharTraits>& String)
+    {
+        return Hash.Append(String.data(), String.size() * sizeof(typename _CharTraits::char_type));
+    }
+
+    /// <summary>
+    /// Append standard layout type to the hash.
+    /// </summary>
+    template<typename _Ty>
+        requires std::is_standard_layout_v<_Ty>
+    inline Hash128& operator<<(
+        Hash128& Hash,
+        _Ty      Data)
+    {
+        return Hash.Append(std::bit_cast<uint8_t*>(std::addressof(Data)), sizeof(_Ty));
+    }
+} // namespace Neon::Crypto
+
+namespace std
+{
+    template<>
+    struct hash<Neon::Crypto::Hash128::Bytes>
+    {
+        size_t operator()(
+            const Neon::Crypto::Hash128::Bytes& Bytes) const noexcept
+        {
+            return size_t(Bytes.Low());
+        }
+    };
+} // namespace std
\ No newline at end of file
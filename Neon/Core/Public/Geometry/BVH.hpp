@@ -0,0 +1,506 @@
+#pragma once
+
+#include <Geometry/AABB.hpp>
+#include <Geometry/Ray.hpp>
+
+#include <boost/container/small_vector.hpp>
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Neon::Geometry
+{
+    /// <summary>
+    /// Dynamic bounding volume hierarchy over boxes, each leaf is a proxy carrying user data (e.g. an entity id).
+    /// Leaves store their box enlarged by a margin, so small moves don't touch the tree. Inserts pick their sibling
+    /// with the surface area heuristic and the ancestors are refit and rotated on the way up to keep the tree balanced.
+    /// Rebuild does a full binned SAH build, which is better for large batches of static boxes.
+    /// </summary>
+    class DynamicBVH
+    {
+    public:
+        using ProxyId = uint32_t;
+
+        static constexpr ProxyId  s_NullProxy     = std::numeric_limits<uint32_t>::max();
+        static constexpr float    s_DefaultMargin = 0.1f;
+        static constexpr uint32_t s_MaxRefits     = 4;
+
+        struct Statistics
+        {
+            size_t   ProxyCount = 0;
+            size_t   NodeCount  = 0;
+            uint32_t Height     = 0;
+
+            /// <summary>
+            /// Sum of the internal nodes' areas over the root's area, lower is better.
+            /// </summary>
+            float AreaRatio = 0.f;
+        };
+
+        struct NearestResult
+        {
+            ProxyId Proxy     = s_NullProxy;
+            float   Distance2 = std::numeric_limits<float>::max();
+        };
+
+    private:
+        static constexpr uint32_t s_NullNode = s_NullProxy;
+
+        struct Node
+        {
+            Vector3 Min;
+            Vector3 Max;
+
+            uint64_t UserData = 0;
+
+            /// <summary>
+            /// Parent of the node, or the next free node if the node isn't used.
+            /// </summary>
+            uint32_t Parent      = s_NullNode;
+            uint32_t Children[2] = { s_NullNode, s_NullNode };
+
+            /// <summary>
+            /// 0 for leaves, -1 for free nodes.
+            /// </summary>
+            int16_t Height = -1;
+
+            /// <summary>
+            /// Number of times a leaf was refit in place since it was last inserted.
+            /// </summary>
+            uint16_t Refits = 0;
+
+            [[nodiscard]] bool IsLeaf() const noexcept
+            {
+                return Height == 0;
+            }
+        };
+
+        using NodeStack = boost::container::small_vector<uint32_t, 64>;
+
+    public:
+        explicit DynamicBVH(
+            float Margin = s_DefaultMargin);
+
+    public:
+        /// <summary>
+        /// Insert a box in the tree, the returned id stays valid until the proxy is removed.
+        /// </summary>
+        [[nodiscard]] ProxyId Insert(
+            const AABB& Box,
+            uint64_t    UserData);
+
+        /// <summary>
+        /// Remove a proxy from the tree.
+        /// </summary>
+        void Remove(
+            ProxyId Proxy);
+
+        /// <summary>
+        /// Update the box of a proxy, returns true if the tree was modified.
+        /// Boxes that stay inside the enlarged box are ignored. Boxes that leave it by less than the margin refit the
+        /// ancestors in place, up to s_MaxRefits times in a row so the proxy can't drift away from its siblings, any
+        /// other move reinserts the proxy.
+        /// </summary>
+        bool Move(
+            ProxyId     Proxy,
+            const AABB& Box);
+
+        /// <summary>
+        /// Rebuild the whole tree with a binned SAH build, proxy ids are kept.
+        /// </summary>
+        void Rebuild();
+
+        /// <summary>
+        /// Remove all proxies.
+        /// </summary>
+        void Clear();
+
+    public:
+        /// <summary>
+        /// Get the user data of a proxy.
+        /// </summary>
+        [[nodiscard]] uint64_t GetUserData(
+            ProxyId Proxy) const noexcept
+        {
+            return m_Nodes[Proxy].UserData;
+        }
+
+        /// <summary>
+        /// Get the enlarged box of a proxy.
+        /// </summary>
+        [[nodiscard]] AABB GetFatBox(
+            ProxyId Proxy) const noexcept
+        {
+            return ToAABB(m_Nodes[Proxy]);
+        }
+
+        /// <summary>
+        /// Get the number of proxies in the tree.
+        /// </summary>
+        [[nodiscard]] size_t GetProxyCount() const noexcept
+        {
+            return m_ProxyCount;
+        }
+
+        /// <summary>
+        /// Get the height of the tree, 0 if empty or with a single proxy.
+        /// </summary>
+        [[nodiscard]] uint32_t GetHeight() const noexcept
+        {
+            return m_Root == s_NullNode ? 0 : uint32_t(m_Nodes[m_Root].Height);
+        }
+
+        /// <summary>
+        /// Get the tree's statistics.
+        /// </summary>
+        [[nodiscard]] Statistics GetStats() const;
+
+        /// <summary>
+        /// Check the links, heights and boxes of every node.
+        /// </summary>
+        [[nodiscard]] bool Validate() const;
+
+    public:
+        /// <summary>
+        /// Call Callback(ProxyId, UserData, Inside) for every proxy whose enlarged box isn't outside the planes, there can
+        /// be up to 64 planes. Inside is true when the enlarged box, and so the proxy's box, is fully inside the planes,
+        /// other proxies may still be outside. Returning false from the callback stops the query.
+        /// </summary>
+        template<typename _FnTy>
+        void QueryFrustum(
+            std::span<const Math::Plane> Planes,
+            _FnTy&&                      Callback) const
+        {
+            if (m_Root == s_NullNode)
+            {
+                return;
+            }
+
+            // Each entry keeps the mask of the planes that its parent intersects, the planes a parent is fully inside
+            // of don't need to be tested for its children
+            uint64_t AllPlanes = Planes.size() == 64 ? ~0ull : (1ull << Planes.size()) - 1;
+
+            boost::container::small_vector<std::pair<uint32_t, uint64_t>, 64> Stack{ { m_Root, AllPlanes } };
+            while (!Stack.empty())
+            {
+                auto [Index, PlaneMask] = Stack.back();
+                Stack.pop_back();
+
+                auto& CurNode = m_Nodes[Index];
+                if (PlaneMask)
+                {
+                    Vector4 Center((CurNode.Min + CurNode.Max) * 0.5f, 1.f);
+                    Vector3 Extents = (CurNode.Max - CurNode.Min) * 0.5f;
+
+                    bool Outside = false;
+                    for (size_t i = 0; i < Planes.size() && !Outside; i++)
+                    {
+                        if (PlaneMask & (uint64_t(1) << i))
+                        {
+                            bool Inside;
+                            Planes[i].IntersectAxisAlignedBox(Center, Extents, Outside, Inside);
+                            if (Inside)
+                            {
+                                PlaneMask &= ~(uint64_t(1) << i);
+                            }
+                        }
+                    }
+
+                    if (Outside)
+                    {
+                        continue;
+                    }
+                }
+
+                if (CurNode.IsLeaf())
+                {
+                    if (!Callback(ProxyId(Index), CurNode.UserData, PlaneMask == 0))
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    Stack.emplace_back(CurNode.Children[0], PlaneMask);
+                    Stack.emplace_back(CurNode.Children[1], PlaneMask);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Call Callback(ProxyId, UserData) for every proxy whose enlarged box overlaps the box.
+        /// Returning false from the callback stops the query.
+        /// </summary>
+        template<typename _FnTy>
+        void QueryOverlap(
+            const AABB& Box,
+            _FnTy&&     Callback) const
+        {
+            if (m_Root == s_NullNode)
+            {
+                return;
+            }
+
+            Vector3 Min = Box.Min(), Max = Box.Max();
+
+            NodeStack Stack{ m_Root };
+            while (!Stack.empty())
+            {
+                uint32_t Index = Stack.back();
+                Stack.pop_back();
+
+                auto& CurNode = m_Nodes[Index];
+                if (!Overlaps(CurNode, Min, Max))
+                {
+                    continue;
+                }
+
+                if (CurNode.IsLeaf())
+                {
+                    if (!Callback(ProxyId(Index), CurNode.UserData))
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    Stack.push_back(CurNode.Children[0]);
+                    Stack.push_back(CurNode.Children[1]);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Call Callback(ProxyId, UserData, MaxFraction) for every proxy whose enlarged box is hit by the ray
+        /// between Origin and Origin + Direction * MaxFraction, the nearest nodes are visited first.
+        /// The callback returns the new max fraction: the distance of its own hit to clip the ray, MaxFraction to
+        /// ignore the proxy or 0 to stop the cast.
+        /// </summary>
+        template<typename _FnTy>
+        void RayCast(
+            const Ray& CastRay,
+            float      MaxFraction,
+            _FnTy&&    Callback) const
+        {
+            if (m_Root == s_NullNode)
+            {
+                return;
+            }
+
+            Vector3 InvDirection = 1.f / CastRay.Direction;
+
+            NodeStack Stack{ m_Root };
+            while (!Stack.empty())
+            {
+                uint32_t Index = Stack.back();
+                Stack.pop_back();
+
+                auto& CurNode = m_Nodes[Index];
+                if (RayDistance(CurNode, CastRay.Origin, InvDirection, MaxFraction) > MaxFraction)
+                {
+                    continue;
+                }
+
+                if (CurNode.IsLeaf())
+                {
+                    MaxFraction = Callback(ProxyId(Index), CurNode.UserData, MaxFraction);
+                    if (MaxFraction <= 0.f)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    uint32_t Near = CurNode.Children[0], Far = CurNode.Children[1];
+                    if (RayDistance(m_Nodes[Far], CastRay.Origin, InvDirection, MaxFraction) <
+                        RayDistance(m_Nodes[Near], CastRay.Origin, InvDirection, MaxFraction))
+                    {
+                        std::swap(Near, Far);
+                    }
+                    Stack.push_back(Far);
+                    Stack.push_back(Near);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Find the proxy nearest to the point within MaxDistance2 (squared).
+        /// Distance2(ProxyId, UserData) returns the squared distance from the point to the proxy, it is only called for
+        /// proxies whose enlarged box is nearer than the best distance found so far.
+        /// </summary>
+        template<typename _FnTy>
+        [[nodiscard]] NearestResult QueryNearest(
+            const Vector3& Point,
+            float          MaxDistance2,
+            _FnTy&&        Distance2) const
+        {
+            NearestResult Result{ .Distance2 = MaxDistance2 };
+            if (m_Root == s_NullNode)
+            {
+                return Result;
+            }
+
+            // Best first, nodes are popped by distance to their box
+            using QueueEntry = std::pair<float, uint32_t>;
+            boost::container::small_vector<QueueEntry, 64> Queue{ { BoxDistance2(m_Nodes[m_Root], Point), m_Root } };
+
+            auto Compare = [](const QueueEntry& A, const QueueEntry& B)
+            {
+                return A.first > B.first;
+            };
+
+            while (!Queue.empty())
+            {
+                std::ranges::pop_heap(Queue, Compare);
+                auto [NodeDistance, Index] = Queue.back();
+                Queue.pop_back();
+
+                if (NodeDistance >= Result.Distance2)
+                {
+                    break;
+                }
+
+                auto& CurNode = m_Nodes[Index];
+                if (CurNode.IsLeaf())
+                {
+                    float Distance = Distance2(ProxyId(Index), CurNode.UserData);
+                    if (Distance < Result.Distance2)
+                    {
+                        Result = { ProxyId(Index), Distance };
+                    }
+                    continue;
+                }
+
+                for (uint32_t Child : CurNode.Children)
+                {
+                    float ChildDistance = BoxDistance2(m_Nodes[Child], Point);
+                    if (ChildDistance < Result.Distance2)
+                    {
+                        Queue.emplace_back(ChildDistance, Child);
+                        std::ranges::push_heap(Queue, Compare);
+                    }
+                }
+            }
+            return Result;
+        }
+
+        /// <summary>
+        /// Find the proxy whose enlarged box is nearest to the point within MaxDistance2 (squared).
+        /// </summary>
+        [[nodiscard]] NearestResult QueryNearest(
+            const Vector3& Point,
+            float          MaxDistance2 = std::numeric_limits<float>::max()) const
+        {
+            return QueryNearest(
+                Point,
+                MaxDistance2,
+                [this, &Point](ProxyId Proxy, uint64_t)
+                {
+                    return BoxDistance2(m_Nodes[Proxy], Point);
+                });
+        }
+
+    private:
+        /// <summary>
+        /// Get a node from the free list, or grow the pool.
+        /// </summary>
+        [[nodiscard]] uint32_t AllocateNode();
+
+        /// <summary>
+        /// Put a node back on the free list.
+        /// </summary>
+        void FreeNode(
+            uint32_t Index);
+
+        /// <summary>
+        /// Link a leaf in the tree next to the sibling with the lowest cost.
+        /// </summary>
+        void InsertLeaf(
+            uint32_t Leaf);
+
+        /// <summary>
+        /// Unlink a leaf from the tree, its parent is freed.
+        /// </summary>
+        void RemoveLeaf(
+            uint32_t Leaf);
+
+        /// <summary>
+        /// Recompute the boxes and heights from the node up to the root, rotating each node.
+        /// </summary>
+        void RefitAncestors(
+            uint32_t Index);
+
+        /// <summary>
+        /// Recompute the box and height of an internal node from its children.
+        /// </summary>
+        void Refit(
+            uint32_t Index);
+
+        /// <summary>
+        /// Swap a child of the node with one of its grandchildren, or two grandchildren, if it lowers the area.
+        /// </summary>
+        void Rotate(
+            uint32_t Index);
+
+        /// <summary>
+        /// Build a subtree over the leaves with a binned SAH, returns the subtree's root.
+        /// </summary>
+        [[nodiscard]] uint32_t BuildSubtree(
+            std::span<uint32_t> Leaves);
+
+    private:
+        [[nodiscard]] static AABB ToAABB(
+            const Node& CurNode) noexcept
+        {
+            return {
+                .Center  = (CurNode.Min + CurNode.Max) * 0.5f,
+                .Extents = (CurNode.Max - CurNode.Min) * 0.5f
+            };
+        }
+
+        [[nodiscard]] static bool Overlaps(
+            const Node&    CurNode,
+            const Vector3& Min,
+            const Vector3& Max) noexcept
+        {
+            return CurNode.Min.x <= Max.x && CurNode.Min.y <= Max.y && CurNode.Min.z <= Max.z &&
+                   Min.x <= CurNode.Max.x && Min.y <= CurNode.Max.y && Min.z <= CurNode.Max.z;
+        }
+
+        /// <summary>
+        /// Get the distance along the ray to the node's box, or infinity if it is missed.
+        /// </summary>
+        [[nodiscard]] static float RayDistance(
+            const Node&    CurNode,
+            const Vector3& Origin,
+            const Vector3& InvDirection,
+            float          MaxFraction) noexcept
+        {
+            Vector3 T0 = (CurNode.Min - Origin) * InvDirection;
+            Vector3 T1 = (CurNode.Max - Origin) * InvDirection;
+
+            Vector3 TMin = glm::min(T0, T1), TMax = glm::max(T0, T1);
+
+            float Enter = std::max({ TMin.x, TMin.y, TMin.z, 0.f });
+            float Exit  = std::min({ TMax.x, TMax.y, TMax.z, MaxFraction });
+            return Enter <= Exit ? Enter : std::numeric_limits<float>::infinity();
+        }
+
+        [[nodiscard]] static float BoxDistance2(
+            const Node&    CurNode,
+            const Vector3& Point) noexcept
+        {
+            Vector3 Delta = glm::max(glm::max(CurNode.Min - Point, Point - CurNode.Max), Vec::Zero<Vector3>);
+            return glm::dot(Delta, Delta);
+        }
+
+    private:
+        std::vector<Node> m_Nodes;
+
+        uint32_t m_Root       = s_NullNode;
+        uint32_t m_FreeList   = s_NullNode;
+        size_t   m_ProxyCount = 0;
+        float    m_Margin;
+    };
+} // namespace Neon::Geometry
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Geometry/AABB.hpp>
+#include <Geometry/Frustum.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace Neon::Geometry
+{
+    /// <summary>
+    /// Boxes stored as one array per component, so they can be tested in batches.
+    /// </summary>
+    class AABBList
+    {
+    public:
+        /// <summary>
+        /// Reserve memory for Count boxes.
+        /// </summary>
+        void Reserve(
+            size_t Count);
+
+        /// <summary>
+        /// Remove all boxes, the memory is kept.
+        /// </summary>
+        void Clear() noexcept;
+
+        /// <summary>
+        /// Add a box and return its index.
+        /// </summary>
+        size_t Add(
+            const AABB& Box);
+
+        /// <summary>
+        /// Replace the box at index.
+        /// </summary>
+        void Set(
+            size_t      Index,
+            const AABB& Box) noexcept;
+
+        /// <summary>
+        /// Get the box at index.
+        /// </summary>
+        [[nodiscard]] AABB Get(
+            size_t Index) const noexcept;
+
+        /// <summary>
+        /// Get the number of boxes.
+        /// </summary>
+        [[nodiscard]] size_t GetSize() const noexcept
+        {
+            return m_CenterX.size();
+        }
+
+    public:
+        /// <summary>
+        /// Get the center's components.
+        /// </summary>
+        [[nodiscard]] std::array<const float*, 3> GetCenters() const noexcept
+        {
+            return { m_CenterX.data(), m_CenterY.data(), m_CenterZ.data() };
+        }
+
+        /// <summary>
+        /// Get the extents' components.
+        /// </summary>
+        [[nodiscard]] std::array<const float*, 3> GetExtents() const noexcept
+        {
+            return { m_ExtentX.data(), m_ExtentY.data(), m_ExtentZ.data() };
+        }
+
+    private:
+        std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+        std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+    };
+
+    //
+
+    /// <summary>
+    /// Frustum whose planes are computed once, so many boxes can be tested against it.
+    /// Batches are tested 8 (AVX) or 4 (SSE) boxes at a time, the results are the same as Frustum::Contains.
+    /// </summary>
+    class FrustumCuller
+    {
+    public:
+        FrustumCuller() = default;
+
+        explicit FrustumCuller(
+            const Frustum& Fr);
+
+        /// <summary>
+        /// Compute the planes of the frustum.
+        /// </summary>
+        void SetFrustum(
+            const Frustum& Fr);
+
+        /// <summary>
+        /// Get the planes of the frustum.
+        /// </summary>
+        [[nodiscard]] const std::array<Math::Plane, 6>& GetPlanes() const noexcept
+        {
+            return m_Planes;
+        }
+
+    public:
+        /// <summary>
+        /// Check collision
+        /// </summary>
+        [[nodiscard]] ContainmentType Contains(
+            const AABB& Box) const;
+
+        /// <summary>
+        /// Check if the box is at least partially inside the frustum
+        /// </summary>
+        [[nodiscard]] bool IsVisible(
+            const AABB& Box) const;
+
+        /// <summary>
+        /// Test every box of the list, bit i of Visibility is set if box i is at least partially inside the frustum.
+        /// Visibility must hold at least GetMaskSize(Boxes.GetSize()) words.
+        /// </summary>
+        void Cull(
+            const AABBList&     Boxes,
+            std::span<uint64_t> Visibility) const;
+
+        /// <summary>
+        /// Same as Cull, without the SIMD paths.
+        /// </summary>
+        void CullScalar(
+            const AABBList&     Boxes,
+            std::span<uint64_t> Visibility) const;
+
+        /// <summary>
+        /// Get the number of words needed for the visibility mask of Count boxes.
+        /// </summary>
+        [[nodiscard]] static constexpr size_t GetMaskSize(
+            size_t Count) noexcept
+        {
+            return (Count + 63) / 64;
+        }
+
+    private:
+        std::array<Math::Plane, 6> m_Planes;
+
+        /// <summary>
+        /// Planes' components with the absolute value of the normals, laid out for the batch tests.
+        /// </summary>
+        struct PlaneComponents
+        {
+            float NormalX[6], NormalY[6], NormalZ[6], Distance[6];
+            float AbsNormalX[6], AbsNormalY[6], AbsNormalZ[6];
+        } m_Components{};
+    };
+} // namespace Neon::Geometry
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <bit>
+#include <istream>
+#include <streambuf>
+
+namespace Neon::IO
+{
+    /// <summary>
+    /// Read only stream buffer over a memory region, no data is copied.
+    /// </summary>
+    class MemoryStreamBuf : public std::streambuf
+    {
+    public:
+        MemoryStreamBuf() = default;
+        MemoryStreamBuf(
+            const void* Data,
+            size_t      Size)
+        {
+            auto Begin = const_cast<char*>(std::bit_cast<const char*>(Data));
+            setg(Begin, Begin, Begin + Size);
+        }
+
+    protected:
+        pos_type seekoff(
+            off_type                Offset,
+            std::ios_base::seekdir  Direction,
+            std::ios_base::openmode Mode) override
+        {
+            if (!(Mode & std::ios_base::in))
+            {
+                return pos_type(off_type(-1));
+            }
+
+            char* Position = nullptr;
+            switch (Direction)
+            {
+            case std::ios_base::beg:
+                Position = eback() + Offset;
+                break;
+            case std::ios_base::cur:
+                Position = gptr() + Offset;
+                break;
+            case std::ios_base::end:
+                Position = egptr() + Offset;
+                break;
+            default:
+                return pos_type(off_type(-1));
+            }
+
+            if (Position < eback() || Position > egptr())
+            {
+                return pos_type(off_type(-1));
+            }
+
+            setg(eback(), Position, egptr());
+            return pos_type(off_type(Position - eback()));
+        }
+
+        pos_type seekpos(
+            pos_type                Position,
+            std::ios_base::openmode Mode) override
+        {
+            return seekoff(off_type(Position), std::ios_base::beg, Mode);
+        }
+
+        std::streamsize showmanyc() override
+        {
+            return egptr() - gptr();
+        }
+    };
+
+    /// <summary>
+    /// Read only stream over a memory region, no data is copied.
+    /// </summary>
+    class MemoryInputStream : public std::istream
+    {
+    public:
+        MemoryInputStream(
+            const void* Data,
+            size_t      Size) :
+            std::istream(nullptr),
+            m_Buffer(Data, Size)
+        {
+            rdbuf(&m_Buffer);
+        }
+
+        MemoryInputStream(const MemoryInputStream&)            = delete;
+        MemoryInputStream& operator=(const MemoryInputStream&) = delete;
+
+    private:
+        MemoryStreamBuf m_Buffer;
+    };
+} // namespace Neon::IO
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace Neon::Utils
+{
+    /// <summary>
+    /// Stable sort of items by an unsigned 64 bit key, least significant byte first.
+    /// The histograms of every byte are computed in a single read, and passes where all the keys share the same byte
+    /// are skipped, so keys that only use a few bits only pay for those.
+    /// Scratch must hold at least as many items as Items, the sorted items end up in Items.
+    /// </summary>
+    template<typename _Ty, typename _KeyFnTy>
+    void RadixSort(
+        std::span<_Ty> Items,
+        std::span<_Ty> Scratch,
+        _KeyFnTy&&     GetKey)
+    {
+        constexpr size_t PassCount  = sizeof(uint64_t);
+        constexpr size_t DigitCount = 256;
+
+        size_t Count = Items.size();
+        if (Count < 2)
+        {
+            return;
+        }
+
+        std::array<std::array<size_t, DigitCount>, PassCount> Histograms{};
+        for (auto& Item : Items)
+        {
+            uint64_t Key = GetKey(Item);
+            for (size_t Pass = 0; Pass < PassCount; Pass++)
+            {
+                Histograms[Pass][(Key >> (Pass * 8)) & 0xFF]++;
+            }
+        }
+
+        _Ty* Src = Items.data();
+        _Ty* Dst = Scratch.data();
+        for (size_t Pass = 0; Pass < PassCount; Pass++)
+        {
+            auto&  Histogram = Histograms[Pass];
+            size_t Shift     = Pass * 8;
+            if (Histogram[(GetKey(Src[0]) >> Shift) & 0xFF] == Count)
+            {
+                continue;
+            }
+
+            size_t Offset = 0;
+            for (auto& Digit : Histogram)
+            {
+                size_t DigitSize = Digit;
+                Digit            = Offset;
+                Offset += DigitSize;
+            }
+
+            for (size_t i = 0; i < Count; i++)
+            {
+                Dst[Histogram[(GetKey(Src[i]) >> Shift) & 0xFF]++] = Src[i];
+            }
+            std::swap(Src, Dst);
+        }
+
+        if (Src != Items.data())
+        {
+            std::copy_n(Src, Count, Items.data());
+        }
+    }
+} // namespace Neon::Utils
\ No newline at end of file
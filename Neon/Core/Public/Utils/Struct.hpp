@@ -2,7 +2,7 @@
 
 #include <Core/Neon.hpp>
 #include <Core/String.hpp>
-#include <Crypto/SHA256.hpp>
+#include <Crypto/Hash128.hpp>
 
 #include <vector>
 #include <memory>
@@ -203,7 +203,7 @@ namespace Neon::Structured
             /// Get hash code of the layout
             /// </summary>
             [[nodiscard]] void GetHashCode(
-                Crypto::Sha256& Sha256) const;
+                Crypto::Hash128& Hash) const;
 
             operator bool() const noexcept
             {
@@ -272,7 +272,7 @@ namespace Neon::Structured
         /// <summary>
         /// Serialize layout
         /// </summary>
-        [[nodiscard]] Crypto::Sha256::Bytes GetHashCode(
+        [[nodiscard]] Crypto::Hash128::Bytes GetHashCode(
             bool GPULayout) const;
 
     private:
@@ -1,10 +1,10 @@
 #include <EnginePCH.hpp>
 #include <Asset/Handlers/Model.hpp>
-#include <RHI/Material/Shared.hpp>
+#include <Mdl/CookedModel.hpp>
 #include <Utils/Struct.hpp>
 
 #ifndef NEON_DIST
-#include <Runtime/GameEngine.hpp>
+#include <Crypto/Hash128.hpp>
 
 #include <AssImp/Importer.hpp>
 #include <AssImp/postprocess.h>
@@ -146,359 +146,395 @@ namespace Neon::Asset
 #endif
         }
     }
-#endif
 
-    bool ModelAsset::Handler::CanHandle(
-        const Ptr<IAsset>& Asset)
+    /// <summary>
+    /// Import a model with assimp and convert it to a cooked model.
+    /// </summary>
+    [[nodiscard]] static bool ImportAssimpModel(
+        const std::vector<uint8_t>& Buffer,
+        const StringU8&             Extension,
+        Mdl::CookedModel&           Cooked)
     {
-        return dynamic_cast<ModelAsset*>(Asset.get());
-    }
+        AssimpLogStream::InitializeOnce();
 
-    Ptr<IAsset> ModelAsset::Handler::Load(
-        std::istream& Stream,
-        const Asset::DependencyReader&,
-        const Handle&        AssetGuid,
-        StringU8             Path,
-        const AssetMetaData& LoaderData)
-    {
-        // Get extension from path.
-        size_t ExtensionIndex = Path.find_last_of('.');
-        if (ExtensionIndex == StringU8::npos)
+        Assimp::Importer Importer;
+        Importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, true);
+
+        const aiScene* AIScene = Importer.ReadFileFromMemory(Buffer.data(), Buffer.size(), s_MeshImportFlags, Extension.c_str());
+        if (!AIScene)
         {
-            return nullptr;
+            return false;
         }
 
-        Ptr<Mdl::Model> Model;
+        std::map<aiTextureType, const char*> TextureKvMap{
+            std::pair{ aiTextureType_DIFFUSE, "p_AlbedoMap" },
+            std::pair{ aiTextureType_NORMALS, "p_NormalMap" },
+            std::pair{ aiTextureType_EMISSIVE, "p_EmissiveMap" }
+        };
 
-        auto Extension = Path.substr(ExtensionIndex + 1);
-        switch (StringUtils::Hash(Extension))
-        {
-        case StringUtils::Hash("nmdl"):
-            break;
+        std::array MaterialKvList{
+            std::tuple{ Structured::Type::Float3, "$clr.diffuse", "Color_Albedo" },
+            std::tuple{ Structured::Type::Float3, "$clr.specular", "Color_Specular" },
+            std::tuple{ Structured::Type::Float4, "$clr.emissive", "Color_Emissive" }
+        };
 
-#ifndef NEON_DIST
-        default:
+        // Process materials.
+        if (AIScene->HasMaterials())
         {
-            AssimpLogStream::InitializeOnce();
-
-            Assimp::Importer Importer;
-            Importer.SetPropertyBool(AI_CONFIG_IMPORT_FBX_PRESERVE_PIVOTS, true);
+            Cooked.Materials.reserve(AIScene->mNumMaterials);
 
-            const aiScene* AIScene = nullptr;
+            for (uint32_t i = 0; i < AIScene->mNumMaterials; i++)
             {
-                std::vector<uint8_t> Buffer{ std::istreambuf_iterator<char>(Stream), std::istreambuf_iterator<char>() };
-                AIScene = Importer.ReadFileFromMemory(Buffer.data(), Buffer.size(), s_MeshImportFlags, Extension.c_str());
-            }
+                aiMaterial* AIMaterial = AIScene->mMaterials[i];
+                auto&       Material   = Cooked.Materials.emplace_back(
+                    Mdl::CookedMaterial{
+                        .Name = AIMaterial->GetName().C_Str() });
 
-            if (!AIScene)
-            {
-                return nullptr;
-            }
+                NEON_TRACE_TAG("Model", "Loading material {}", Material.Name);
 
-            Mdl::Model::SubmeshList    Submeshes;
-            Mdl::Model::MeshNodeList   MeshNodes;
-            Mdl::Model::MaterialsTable Materials;
+                aiString TexturePath;
+                for (auto& [Type, Tag] : TextureKvMap)
+                {
+                    if (AIMaterial->GetTexture(Type, 0, &TexturePath) != AI_SUCCESS)
+                    {
+                        continue;
+                    }
 
-            std::vector<Mdl::MeshVertex> Vertices;
-            std::vector<uint32_t>        Indices;
+                    NEON_TRACE_TAG("Model", "Loading texture '{}'", TexturePath.C_Str());
 
-            //
+                    Mdl::CookedMaterialTexture Texture{
+                        .Name = Tag,
+                        .Path = StringU8(TexturePath.data, TexturePath.length)
+                    };
 
-            using TextureMap         = std::unordered_map<aiTextureType, RHI::SSyncGpuResource>;
-            using MaterialTextureMap = std::unordered_map<RHI::IMaterial*, TextureMap>;
+                    if (auto AITexture = AIScene->GetEmbeddedTexture(TexturePath.C_Str()))
+                    {
+                        auto Data = std::bit_cast<const uint8_t*>(AITexture->pcData);
 
-            // Deferred loading of textures until we process all meshes.
-            MaterialTextureMap MaterialsToSet;
+                        Texture.Width  = AITexture->mWidth;
+                        Texture.Height = AITexture->mHeight;
+                        Texture.Data.assign(Data, Data + size_t(AITexture->mWidth) * AITexture->mHeight * sizeof(aiTexel));
+                    }
 
-            std::map<aiTextureType, const char*> TextureKvMap{
-                std::pair{ aiTextureType_DIFFUSE, "p_AlbedoMap" },
-                std::pair{ aiTextureType_NORMALS, "p_NormalMap" },
-                std::pair{ aiTextureType_EMISSIVE, "p_EmissiveMap" }
-            };
+                    Material.Textures.emplace_back(std::move(Texture));
+                }
 
-            std::array MaterialKvList{
-                std::tuple{ Structured::Type::Float3, "$clr.diffuse", "Color_Albedo" },
-                std::tuple{ Structured::Type::Float3, "$clr.specular", "Color_Specular" },
-                std::tuple{ Structured::Type::Float4, "$clr.emissive", "Color_Emissive" }
-            };
+                for (auto& [Type, AIType, Tag] : MaterialKvList)
+                {
+                    switch (Type)
+                    {
+                    case Structured::Type::Float3:
+                    {
+                        aiColor3D Color;
+                        if (AIMaterial->Get(AIType, 0, 0, Color) == AI_SUCCESS)
+                        {
+                            Material.Parameters.emplace_back(Tag, 3, Vector4(Color.r, Color.g, Color.b, 0.f));
+                        }
+                        break;
+                    }
+                    case Structured::Type::Float4:
+                    {
+                        aiColor4D Color;
+                        if (AIMaterial->Get(AIType, 0, 0, Color) == AI_SUCCESS)
+                        {
+                            Material.Parameters.emplace_back(Tag, 4, Vector4(Color.r, Color.g, Color.b, Color.a));
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        NEON_WARNING_TAG("Model", "Unsupported data type: {}", AIType);
+                    }
+                    }
+                }
+            }
+        }
 
-            auto& ThreadPool = Runtime::GameEngine::Get()->GetThreadPool();
+        // Process nodes
+        if (AIScene->HasMeshes())
+        {
+            std::vector<uint32_t> Indices;
 
-            //
+            uint32_t VerticesCount = 0, IndicesCount = 0;
+            Cooked.Submeshes.reserve(AIScene->mNumMeshes);
 
-            // Process materials.
-            std::future<void> LoadMaterialTask;
-            if (AIScene->HasMaterials())
+            for (uint32_t i = 0; i < AIScene->mNumMeshes; i++)
             {
-                LoadMaterialTask = ThreadPool.enqueue(
-                    [&]
-                    {
-                        auto& WhiteTexture = RHI::IGpuResource::GetDefaultTexture(RHI::DefaultTextures::White_2D);
+                aiMesh* AIMesh = AIScene->mMeshes[i];
 
-                        Materials.reserve(AIScene->mNumMaterials);
-                        auto LitMaterial = RHI::SharedMaterials::Get(RHI::SharedMaterials::Type::Lit);
+                NEON_VALIDATE(AIMesh->HasPositions(), "Mesh has no positions");
+                NEON_VALIDATE(AIMesh->HasNormals(), "Mesh has no normals");
 
-                        for (uint32_t i = 0; i < AIScene->mNumMaterials; i++)
-                        {
-                            aiMaterial* AIMaterial = AIScene->mMaterials[i];
-                            auto&       Material   = Materials.emplace_back(LitMaterial->CreateInstance());
+                uint32_t VertexCount = AIMesh->mNumVertices;
+                Cooked.Vertices.reserve(Cooked.Vertices.size() + VertexCount);
 
-                            NEON_TRACE_TAG("Model", "Loading material {}", AIMaterial->GetName().C_Str());
+                Vector3 Min(std::numeric_limits<float>::max()),
+                    Max(std::numeric_limits<float>::lowest());
 
-                            TextureMap TexturesToSet;
-                            aiString   TexturePath;
+                for (uint32_t j = 0; j < VertexCount; j++)
+                {
+                    Vector3 Position(AIMesh->mVertices[j].x, AIMesh->mVertices[j].y, AIMesh->mVertices[j].z);
+                    Min = glm::min(Min, Position);
+                    Max = glm::max(Max, Position);
 
-                            for (auto& [Type, Tag] : TextureKvMap)
-                            {
-                                if (AIMaterial->GetTexture(Type, 0, &TexturePath) == AI_SUCCESS)
-                                {
-                                    NEON_TRACE_TAG("Model", "Loading texture '{}'", TexturePath.C_Str());
+                    auto& Vertex = Cooked.Vertices.emplace_back(
+                        Mdl::MeshVertex{
+                            .Position = Position,
+                            .Normal   = Vector3(AIMesh->mNormals[j].x, AIMesh->mNormals[j].y, AIMesh->mNormals[j].z) });
 
-#ifndef NEON_DIST
-                                    auto MatTextureName = TexturePath.length ? StringUtils::Transform<String>(StringU8View(TexturePath.data, TexturePath.length)) : STR("Unnamed Texture");
-                                    auto TextureName    = StringUtils::Format(STR("Assimp_Texture::{}"), std::move(MatTextureName));
-                                    auto TextureNamePtr = TextureName.c_str();
-#else
-                                    const wchar_t* TextureNamePtr = nullptr;
-#endif
+                    if (AIMesh->HasTangentsAndBitangents())
+                    {
+                        Vertex.Tangent   = Vector3(AIMesh->mTangents[j].x, AIMesh->mTangents[j].y, AIMesh->mTangents[j].z);
+                        Vertex.Bitangent = Vector3(AIMesh->mBitangents[j].x, AIMesh->mBitangents[j].y, AIMesh->mBitangents[j].z);
+                    }
 
-                                    if (auto AITexture = AIScene->GetEmbeddedTexture(TexturePath.C_Str()))
-                                    {
-                                        std::array Subresources{
-                                            RHI::ComputeSubresource(
-                                                RHI::EResourceFormat::R8G8B8A8_UNorm,
-                                                AITexture->pcData,
-                                                AITexture->mWidth,
-                                                AITexture->mHeight)
-                                        };
-                                        auto Texture = RHI::SSyncGpuResource(
-                                            RHI::ResourceDesc::Tex2D(
-                                                RHI::EResourceFormat::R8G8B8A8_UNorm,
-                                                AITexture->mWidth,
-                                                AITexture->mHeight,
-                                                1),
-                                            Subresources,
-                                            TextureNamePtr);
-                                        TexturesToSet.emplace(Type, std::move(Texture));
-                                    }
-                                    else
-                                    {
-                                        std::fstream File(TexturePath.C_Str(), std::ios::in | std::ios::binary);
-                                        if (File.is_open())
-                                        {
-                                            std::vector<uint8_t> Data((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
-
-                                            RHI::TextureRawImage ImageInfo{
-                                                .Data = Data.data(),
-                                                .Size = Data.size(),
-                                                .Type = RHI::TextureRawImage::Format::Png
-                                            };
-
-                                            TexturesToSet.emplace(Type, RHI::SSyncGpuResource(ImageInfo, TextureNamePtr, RHI::MResourceState_AllShaderResource));
-                                        }
-                                        else
-                                        {
-                                            NEON_WARNING("Failed to load texture '{}'", TexturePath.C_Str());
-                                        }
-                                    }
-                                }
-                            }
-
-                            for (auto& [Type, AIType, Tag] : MaterialKvList)
-                            {
-                                switch (Type)
-                                {
-                                case Structured::Type::Float3:
-                                {
-                                    aiColor3D Color;
-                                    if (AIMaterial->Get(AIType, 0, 0, Color) == AI_SUCCESS)
-                                    {
-                                        Material->Set(Tag, Color);
-                                    }
-                                    break;
-                                }
-                                case Structured::Type::Float4:
-                                {
-                                    aiColor4D Color;
-                                    if (AIMaterial->Get(AIType, 0, 0, Color) == AI_SUCCESS)
-                                    {
-                                        Material->Set(Tag, Color);
-                                    }
-                                    break;
-                                }
-                                default:
-                                {
-                                    NEON_WARNING_TAG("Model", "Unsupported data type: {}", AIType);
-                                }
-                                }
-                            }
-
-                            MaterialsToSet.emplace(Material.get(), std::move(TexturesToSet));
-                        }
-                    });
-            }
+                    if (AIMesh->HasTextureCoords(0))
+                    {
+                        Vertex.TexCoord = Vector2(AIMesh->mTextureCoords[0][j].x, AIMesh->mTextureCoords[0][j].y);
+                    }
+                }
 
-            //
+                uint32_t OldIndexCount = uint32_t(Indices.size());
 
-            RHI::USyncGpuResource VertexBuffer, IndexBuffer;
+                for (uint32_t j = 0; j < AIMesh->mNumFaces; j++)
+                {
+                    aiFace& Face = AIMesh->mFaces[j];
+                    for (uint32_t k = 0; k < Face.mNumIndices; k++)
+                    {
+                        Indices.emplace_back(Face.mIndices[k]);
+                    }
+                }
 
-            // Process nodes
-            if (AIScene->HasMeshes())
-            {
-                uint32_t VerticesCount = 0, IndicesCount = 0;
-                Submeshes.reserve(AIScene->mNumMeshes);
+                uint32_t IndexCount = uint32_t(Indices.size()) - OldIndexCount;
 
-                for (uint32_t i = 0; i < AIScene->mNumMeshes; i++)
+                RHI::PrimitiveTopology Toplogy = RHI::PrimitiveTopology::Undefined;
+                switch (AIMesh->mPrimitiveTypes & (aiPrimitiveType_POINT | aiPrimitiveType_LINE | aiPrimitiveType_TRIANGLE))
                 {
-                    aiMesh* AIMesh = AIScene->mMeshes[i];
+                case aiPrimitiveType_POINT:
+                    Toplogy = RHI::PrimitiveTopology::PointList;
+                    break;
+                case aiPrimitiveType_LINE:
+                    Toplogy = RHI::PrimitiveTopology::LineList;
+                    break;
+                case aiPrimitiveType_TRIANGLE:
+                    Toplogy = RHI::PrimitiveTopology::TriangleList;
+                    break;
+                }
 
-                    uint32_t VertexCount = AIMesh->mNumVertices;
-                    Vertices.reserve(Vertices.size() + VertexCount);
+                Geometry::AABB Box{
+                    .Center  = (Max + Min) * 0.5f,
+                    .Extents = (Max - Min) * 0.5f
+                };
+
+                Cooked.Submeshes.emplace_back(
+                    Mdl::SubMeshData{
+                        .AABB          = std::move(Box),
+                        .VertexCount   = VertexCount,
+                        .IndexCount    = IndexCount,
+                        .VertexOffset  = VerticesCount,
+                        .IndexOffset   = IndicesCount,
+                        .MaterialIndex = AIMesh->mMaterialIndex,
+                        .Topology      = Toplogy });
+
+                VerticesCount += VertexCount;
+                IndicesCount += IndexCount;
+            }
 
-                    Vector3 Min(std::numeric_limits<float>::max()),
-                        Max(std::numeric_limits<float>::lowest());
+            Cooked.Nodes.reserve(AIScene->mNumMeshes);
+            TraverseAISubMesh(AIScene->mRootNode, Cooked.Submeshes, Cooked.Nodes);
 
-                    for (uint32_t j = 0; j < VertexCount; j++)
-                    {
-                        Vector3 Position(AIMesh->mVertices[j].x, AIMesh->mVertices[j].y, AIMesh->mVertices[j].z);
-                        Min = glm::min(Min, Position);
-                        Max = glm::max(Max, Position);
+            Cooked.Indices.resize(Indices.size() * sizeof(uint32_t));
+            std::memcpy(Cooked.Indices.data(), Indices.data(), Cooked.Indices.size());
 
-                        auto& Vertex = Vertices.emplace_back(
-                            Mdl::MeshVertex{
-                                .Position = Position,
-                                .Normal   = Vector3(AIMesh->mNormals[j].x, AIMesh->mNormals[j].y, AIMesh->mNormals[j].z) });
+            Cooked.CompactIndices();
+        }
 
-                        if (AIMesh->HasTangentsAndBitangents())
-                        {
-                            Vertex.Tangent   = Vector3(AIMesh->mTangents[j].x, AIMesh->mTangents[j].y, AIMesh->mTangents[j].z);
-                            Vertex.Bitangent = Vector3(AIMesh->mBitangents[j].x, AIMesh->mBitangents[j].y, AIMesh->mBitangents[j].z);
-                        }
+        return true;
+    }
 
-                        if (AIMesh->HasTextureCoords(0))
-                        {
-                            Vertex.TexCoord = Vector2(AIMesh->mTextureCoords[0][j].x, AIMesh->mTextureCoords[0][j].y);
-                        }
-                    }
+    /// <summary>
+    /// Get the path of the cooked model cache for the source file's content.
+    /// </summary>
+    [[nodiscard]] static std::filesystem::path GetCookedCachePath(
+        const std::vector<uint8_t>& Buffer)
+    {
+        Crypto::Hash128 Hash;
+        Hash << Mdl::CookedModel::Version << s_MeshImportFlags;
+        Hash.Append(Buffer.data(), Buffer.size());
+        return std::filesystem::temp_directory_path() / StringUtils::Format("{}.nmdl", Hash.Digest().ToString());
+    }
+#endif
 
-                    uint32_t OldIndexCount = uint32_t(Indices.size());
+    /// <summary>
+    /// Get the size of the cooked data, roughly what the model holds on the gpu as well.
+    /// </summary>
+    [[nodiscard]] static size_t GetCookedSize(
+        const Mdl::CookedModel& Cooked)
+    {
+        size_t Size = Cooked.Vertices.size() * sizeof(Mdl::MeshVertex) + Cooked.Indices.size();
+        for (auto& Material : Cooked.Materials)
+        {
+            for (auto& Texture : Material.Textures)
+            {
+                Size += Texture.Data.size();
+            }
+        }
+        return Size;
+    }
 
-                    for (uint32_t j = 0; j < AIMesh->mNumFaces; j++)
-                    {
-                        aiFace& Face = AIMesh->mFaces[j];
-                        for (uint32_t k = 0; k < Face.mNumIndices; k++)
-                        {
-                            Indices.emplace_back(Face.mIndices[k]);
-                        }
-                    }
+    size_t ModelAsset::GetResidentSize() const noexcept
+    {
+        return IAsset::GetResidentSize() + m_ModelSize;
+    }
 
-                    uint32_t IndexCount = uint32_t(Indices.size()) - OldIndexCount;
+    //
 
-                    RHI::PrimitiveTopology Toplogy = RHI::PrimitiveTopology::Undefined;
-                    switch (AIMesh->mPrimitiveTypes & (aiPrimitiveType_POINT | aiPrimitiveType_LINE | aiPrimitiveType_TRIANGLE))
-                    {
-                    case aiPrimitiveType_POINT:
-                        Toplogy = RHI::PrimitiveTopology::PointList;
-                        break;
-                    case aiPrimitiveType_LINE:
-                        Toplogy = RHI::PrimitiveTopology::LineList;
-                        break;
-                    case aiPrimitiveType_TRIANGLE:
-                        Toplogy = RHI::PrimitiveTopology::TriangleList;
-                        break;
-                    }
+    bool ModelAsset::Handler::CanHandle(
+        const Ptr<IAsset>& Asset)
+    {
+        return dynamic_cast<ModelAsset*>(Asset.get());
+    }
 
-                    Geometry::AABB Box{
-                        .Center  = (Max + Min) * 0.5f,
-                        .Extents = (Max - Min) * 0.5f
-                    };
+    ModelAsset::Handler::Handler(
+        LoadMode Mode) :
+        m_Mode(Mode)
+    {
+    }
 
-                    Submeshes.emplace_back(
-                        Mdl::SubMeshData{
-                            .AABB          = std::move(Box),
-                            .VertexCount   = VertexCount,
-                            .IndexCount    = IndexCount,
-                            .VertexOffset  = VerticesCount,
-                            .IndexOffset   = IndicesCount,
-                            .MaterialIndex = AIMesh->mMaterialIndex,
-                            .Topology      = Toplogy });
-
-                    VerticesCount += VertexCount;
-                    IndicesCount += IndexCount;
-
-                    NEON_VALIDATE(AIMesh->HasPositions(), "Mesh has no positions");
-                    NEON_VALIDATE(AIMesh->HasNormals(), "Mesh has no normals");
-                }
+    Ptr<IAsset> ModelAsset::Handler::Load(
+        std::istream& Stream,
+        const Asset::DependencyReader&,
+        const Handle&        AssetGuid,
+        StringU8             Path,
+        const AssetMetaData& LoaderData)
+    {
+        auto Cooked = LoadCooked(Stream, Path);
+        if (!Cooked)
+        {
+            return nullptr;
+        }
 
-                MeshNodes.reserve(AIScene->mNumMeshes);
-                TraverseAISubMesh(AIScene->mRootNode, Submeshes, MeshNodes);
+        auto ModelSize = GetCookedSize(*Cooked);
+        if (m_Mode == LoadMode::CookedOnly)
+        {
+            return std::make_shared<ModelAsset>(nullptr, std::move(Cooked), ModelSize, AssetGuid, std::move(Path));
+        }
 
-#ifndef NEON_DIST
-                auto SceneName     = AIScene->mName.length ? StringUtils::Transform<String>(StringU8View(AIScene->mName.data, AIScene->mName.length)) : STR("Unnamed Scene");
-                auto VtxBufferName = StringUtils::Format(STR("Assimp_VertexBuffer::{}"), SceneName);
-                auto IdxBufferName = StringUtils::Format(STR("Assimp_IndexBuffer::{}"), SceneName);
+        // The buffers and textures are copied to the upload queue by CreateModel, so the cooked data can be released right after
+        auto Model = Cooked->CreateModel(Path);
+        if (m_Mode != LoadMode::GpuAndCooked)
+        {
+            Cooked.reset();
+        }
 
-                auto VtxBufferNamePtr = VtxBufferName.c_str();
-                auto IdxBufferNamePtr = IdxBufferName.c_str();
-#else
-                const wchar_t* VtxBufferNamePtr = nullptr;
-                const wchar_t* IdxBufferNamePtr = nullptr;
-#endif
+        return std::make_shared<ModelAsset>(std::move(Model), std::move(Cooked), ModelSize, AssetGuid, std::move(Path));
+    }
 
-                VertexBuffer = RHI::USyncGpuResource::Buffer(
-                    sizeof(Mdl::MeshVertex),
-                    Vertices.size(),
-                    Vertices.data(),
-                    VtxBufferNamePtr,
-                    {},
-                    RHI::MResourceState_AllShaderResource);
-
-                IndexBuffer = RHI::USyncGpuResource::Buffer(
-                    sizeof(uint32_t),
-                    Indices.size(),
-                    Indices.data(),
-                    IdxBufferNamePtr,
-                    {},
-                    RHI::MResourceState_AllShaderResource);
-            }
+    void ModelAsset::Handler::Save(
+        std::iostream& Stream,
+        DependencyWriter&,
+        const Ptr<IAsset>& Asset,
+        AssetMetaData&     LoaderData)
+    {
+        auto AssetPtr = static_cast<Asset::ModelAsset*>(Asset.get());
+        if (auto& Cooked = AssetPtr->GetCookedData())
+        {
+            Cooked->Write(Stream);
+        }
+        else
+        {
+            NEON_WARNING_TAG("Model", "Model '{}' has no cooked data to save, its handler must keep the cooked data", AssetPtr->GetPath());
+        }
+    }
 
-            //
+    Ptr<Mdl::CookedModel> ModelAsset::Handler::LoadCooked(
+        std::istream&   Stream,
+        const StringU8& Path,
+        bool            UseCache)
+    {
+        auto Cooked    = std::make_shared<Mdl::CookedModel>();
+        auto StartTime = std::chrono::high_resolution_clock::now();
 
-            if (LoadMaterialTask.valid())
+        // Cooked models are loaded directly, regardless of their extension.
+        if (Mdl::CookedModel::IsCooked(Stream))
+        {
+            if (!Cooked->Read(Stream))
             {
-                LoadMaterialTask.get();
+                NEON_ERROR_TAG("Model", "Failed to read cooked model '{}'", Path);
+                return nullptr;
             }
 
-            for (auto& [Material, Textures] : MaterialsToSet)
+            NEON_TRACE_TAG("Model", "Loaded cooked model '{}' in {}ms", Path, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count());
+        }
+#ifndef NEON_DIST
+        else
+        {
+            // Get extension from path.
+            size_t ExtensionIndex = Path.find_last_of('.');
+            if (ExtensionIndex == StringU8::npos)
             {
-                for (auto& [Type, Texture] : Textures)
+                return nullptr;
+            }
+
+            auto Extension = Path.substr(ExtensionIndex + 1);
+
+            std::vector<uint8_t> Buffer{ std::istreambuf_iterator<char>(Stream), std::istreambuf_iterator<char>() };
+
+            // Try to load the model from the cooked cache of a previous import, otherwise import it with assimp.
+            std::filesystem::path CachePath;
+            bool                  IsCached = false;
+            if (UseCache)
+            {
+                CachePath = GetCookedCachePath(Buffer);
+                if (std::ifstream CacheFile(CachePath, std::ios::binary); CacheFile.is_open())
                 {
-                    Material->SetTexture(TextureKvMap[Type], Texture.Get());
+                    IsCached = Cooked->Read(CacheFile);
+                    if (!IsCached)
+                    {
+                        *Cooked = {};
+                    }
                 }
             }
 
-            Model = std::make_shared<Mdl::Model>(
-                std::move(VertexBuffer),
-                std::move(IndexBuffer),
-                false,
-                std::move(Submeshes),
-                std::move(MeshNodes),
-                std::move(Materials));
-            break;
+            if (IsCached)
+            {
+                NEON_TRACE_TAG("Model", "Loaded cached model '{}' in {}ms", Path, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count());
+            }
+            else
+            {
+                if (!ImportAssimpModel(Buffer, Extension, *Cooked))
+                {
+                    return nullptr;
+                }
+
+                NEON_TRACE_TAG("Model", "Imported model '{}' with assimp in {}ms", Path, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count());
+
+                if (UseCache)
+                {
+                    if (std::ofstream CacheFile(CachePath, std::ios::binary | std::ios::trunc); CacheFile.is_open())
+                    {
+                        Cooked->Write(CacheFile);
+                    }
+                    else
+                    {
+                        NEON_WARNING_TAG("Model", "Failed to write cooked model cache '{}'", CachePath.string());
+                    }
+                }
+            }
         }
-#endif
+#else
+        else
+        {
+            NEON_ERROR_TAG("Model", "Model '{}' is not cooked", Path);
+            return nullptr;
         }
+#endif
 
-        auto Asset = std::make_shared<ModelAsset>(Model, AssetGuid, std::move(Path));
-        return Asset;
+        return Cooked;
     }
 
-    void ModelAsset::Handler::Save(
-        std::iostream& Stream,
-        DependencyWriter&,
-        const Ptr<IAsset>& Asset,
-        AssetMetaData&     LoaderData)
+    uint32_t ModelAsset::Handler::GetVersion() const
     {
-        auto AssetPtr = static_cast<Asset::ModelAsset*>(Asset.get());
+        return Mdl::CookedModel::Version;
     }
 } // namespace Neon::Asset
\ No newline at end of file
@@ -90,4 +90,9 @@ namespace Neon::Asset
         boost::archive::text_oarchive Archive(Stream, boost::archive::no_header | boost::archive::no_tracking);
         Archive << RootSig->GetRootSignatureBuilder();
     }
+
+    bool RootSignatureAsset::Handler::IsPassthrough() const
+    {
+        return true;
+    }
 } // namespace Neon::Asset
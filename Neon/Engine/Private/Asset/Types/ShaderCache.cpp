@@ -0,0 +1,341 @@
+#include <EnginePCH.hpp>
+#include <Asset/Types/ShaderCache.hpp>
+#include <Asset/Types/TextFile.hpp>
+#include <Asset/Storage.hpp>
+#include <Asset/Pack.hpp>
+#include <Asset/Manager.hpp>
+#include <IO/BinaryFile.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::Asset
+{
+    ShaderCache::ShaderCache(
+        const Handle&   AssetGuid,
+        const StringU8& SourceCode)
+    {
+        auto CachePath = std::filesystem::temp_directory_path() / AssetGuid.ToString();
+
+        m_DataPath   = CachePath.replace_extension(".nsc");
+        m_IndexPath  = CachePath.replace_extension(".nsci");
+        m_SourceHash = Crypto::Hash128().Append(SourceCode.data(), SourceCode.size()).Digest();
+
+        std::unique_lock Lock(m_Mutex);
+        if (!ReadIndex())
+        {
+            ResetLocked();
+        }
+    }
+
+    auto ShaderCache::GetKey(
+        const RHI::ShaderCompileDesc& Desc,
+        const StringU8&               IncludeDirectory) -> Key
+    {
+        Crypto::Hash128 Hash;
+        Hash << Desc.Stage << Desc.Flags.ToUllong() << Desc.Profile << IncludeDirectory;
+        for (auto& [Name, Value] : Desc.Macros.Defines)
+        {
+            Hash << Name << Value;
+        }
+        return Hash.Digest();
+    }
+
+    UPtr<RHI::IShader> ShaderCache::Load(
+        const Key& PermutationKey)
+    {
+        std::vector<IncludeInfo> Includes;
+        {
+            std::shared_lock Lock(m_Mutex);
+
+            auto Iter = m_Entries.find(PermutationKey);
+            if (Iter == m_Entries.end())
+            {
+                return nullptr;
+            }
+            Includes = Iter->second.Includes;
+        }
+
+        // Loading the includes may be slow, so validate them without holding the lock
+        for (auto& Include : Includes)
+        {
+            if (GetIncludeHash(Include.Path) != Include.Hash)
+            {
+                return nullptr;
+            }
+        }
+
+        std::unique_ptr<uint8_t[]> ShaderData;
+        uint64_t                   ShaderSize = 0;
+        {
+            std::shared_lock Lock(m_Mutex);
+
+            // The entry may have been replaced or moved by a compaction in the meantime
+            auto Iter = m_Entries.find(PermutationKey);
+            if (Iter == m_Entries.end())
+            {
+                return nullptr;
+            }
+
+            ShaderSize = Iter->second.Size;
+            ShaderData = std::make_unique<uint8_t[]>(ShaderSize);
+
+            // Each reader opens its own stream, so concurrent loads never share a file position
+            std::ifstream DataFile(m_DataPath, std::ios::in | std::ios::binary);
+            DataFile.seekg(Iter->second.Offset, std::ios::beg);
+            DataFile.read(std::bit_cast<char*>(ShaderData.get()), ShaderSize);
+
+            if (!DataFile)
+            {
+                NEON_WARNING_TAG("ShaderCache", "Failed to read shader cache '{}'", m_DataPath.string());
+                return nullptr;
+            }
+        }
+
+        return RHI::IShader::Create(std::move(ShaderData), ShaderSize);
+    }
+
+    void ShaderCache::Store(
+        const Key&                    PermutationKey,
+        const RHI::IShader::ByteCode& ByteCode,
+        std::span<const StringU8>     Includes)
+    {
+        Entry CacheEntry{
+            .Size = ByteCode.Size
+        };
+
+        CacheEntry.Includes.reserve(Includes.size());
+        for (auto& Path : Includes)
+        {
+            CacheEntry.Includes.emplace_back(Path, GetIncludeHash(Path));
+        }
+
+        std::unique_lock Lock(m_Mutex);
+
+        {
+            std::ofstream DataFile(m_DataPath, std::ios::out | std::ios::binary | std::ios::app);
+            if (!DataFile.is_open())
+            {
+                NEON_WARNING_TAG("ShaderCache", "Failed to open shader cache '{}'", m_DataPath.string());
+                return;
+            }
+
+            CacheEntry.Offset = m_DataSize;
+            DataFile.write(std::bit_cast<const char*>(ByteCode.Data), ByteCode.Size);
+            m_DataSize += ByteCode.Size;
+        }
+
+        auto [Iter, Inserted] = m_Entries.try_emplace(PermutationKey);
+        if (!Inserted)
+        {
+            m_DeadSize += Iter->second.Size;
+        }
+        Iter->second = std::move(CacheEntry);
+
+        if (m_DeadSize > s_CompactThreshold && m_DeadSize * 2 > m_DataSize)
+        {
+            CompactLocked();
+        }
+        else
+        {
+            WriteIndex();
+        }
+    }
+
+    void ShaderCache::Reset()
+    {
+        std::unique_lock Lock(m_Mutex);
+        ResetLocked();
+
+        std::scoped_lock IncludeLock(m_IncludeMutex);
+        m_IncludeHashes.clear();
+    }
+
+    void ShaderCache::Compact()
+    {
+        std::unique_lock Lock(m_Mutex);
+        CompactLocked();
+    }
+
+    //
+
+    bool ShaderCache::ReadIndex()
+    {
+        std::ifstream IndexFile(m_IndexPath, std::ios::in | std::ios::binary);
+        if (!IndexFile.is_open())
+        {
+            return false;
+        }
+
+        IO::BinaryStreamReader Reader(IndexFile);
+        if (Reader.Read<uint32_t>() != s_Magic ||
+            Reader.Read<uint32_t>() != s_Version ||
+            Reader.Read<Crypto::Hash128::Bytes>() != m_SourceHash)
+        {
+            return false;
+        }
+
+        m_DataSize = Reader.Read<uint64_t>();
+        m_DeadSize = Reader.Read<uint64_t>();
+
+        // The data file must hold at least everything the index refers to
+        std::error_code Error;
+        if (std::filesystem::file_size(m_DataPath, Error) < m_DataSize || Error)
+        {
+            return false;
+        }
+
+        auto Count = Reader.Read<uint32_t>();
+        m_Entries.reserve(Count);
+        for (uint32_t i = 0; i < Count && Reader; i++)
+        {
+            auto  PermutationKey = Reader.Read<Key>();
+            auto& CacheEntry     = m_Entries[PermutationKey];
+
+            Reader.Read(CacheEntry.Offset);
+            Reader.Read(CacheEntry.Size);
+
+            CacheEntry.Includes.resize(Reader.Read<uint32_t>());
+            for (auto& Include : CacheEntry.Includes)
+            {
+                Reader.Read(Include.Path);
+                Reader.Read(Include.Hash);
+            }
+        }
+
+        if (!Reader)
+        {
+            m_Entries.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void ShaderCache::WriteIndex() const
+    {
+        std::ofstream IndexFile(m_IndexPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!IndexFile.is_open())
+        {
+            NEON_WARNING_TAG("ShaderCache", "Failed to write shader cache index '{}'", m_IndexPath.string());
+            return;
+        }
+
+        IO::BinaryStreamWriter Writer(IndexFile);
+        Writer.Write(s_Magic);
+        Writer.Write(s_Version);
+        Writer.Write(m_SourceHash);
+        Writer.Write(m_DataSize);
+        Writer.Write(m_DeadSize);
+
+        Writer.Write(uint32_t(m_Entries.size()));
+        for (auto& [PermutationKey, CacheEntry] : m_Entries)
+        {
+            Writer.Write(PermutationKey);
+            Writer.Write(CacheEntry.Offset);
+            Writer.Write(CacheEntry.Size);
+
+            Writer.Write(uint32_t(CacheEntry.Includes.size()));
+            for (auto& Include : CacheEntry.Includes)
+            {
+                Writer.Write(Include.Path);
+                Writer.Write(Include.Hash);
+            }
+        }
+    }
+
+    void ShaderCache::ResetLocked()
+    {
+        m_Entries.clear();
+        m_DataSize = 0;
+        m_DeadSize = 0;
+
+        std::ofstream(m_DataPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        WriteIndex();
+    }
+
+    void ShaderCache::CompactLocked()
+    {
+        auto TempPath = std::filesystem::path(m_DataPath).replace_extension(".nsc.tmp");
+        {
+            std::ifstream SrcFile(m_DataPath, std::ios::in | std::ios::binary);
+            std::ofstream DstFile(TempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!SrcFile.is_open() || !DstFile.is_open())
+            {
+                NEON_WARNING_TAG("ShaderCache", "Failed to compact shader cache '{}'", m_DataPath.string());
+                return;
+            }
+
+            std::vector<char> Buffer;
+
+            uint64_t Offset = 0;
+            for (auto& CacheEntry : m_Entries | std::views::values)
+            {
+                Buffer.resize(CacheEntry.Size);
+                SrcFile.seekg(CacheEntry.Offset, std::ios::beg);
+                SrcFile.read(Buffer.data(), Buffer.size());
+                DstFile.write(Buffer.data(), Buffer.size());
+
+                CacheEntry.Offset = Offset;
+                Offset += CacheEntry.Size;
+            }
+
+            if (!SrcFile || !DstFile)
+            {
+                NEON_WARNING_TAG("ShaderCache", "Failed to compact shader cache '{}', resetting it", m_DataPath.string());
+                DstFile.close();
+                std::filesystem::remove(TempPath);
+                ResetLocked();
+                return;
+            }
+
+            NEON_TRACE_TAG("ShaderCache", "Compacted shader cache '{}' from {} to {} bytes", m_DataPath.string(), m_DataSize, Offset);
+            m_DataSize = Offset;
+            m_DeadSize = 0;
+        }
+
+        std::filesystem::rename(TempPath, m_DataPath);
+        WriteIndex();
+    }
+
+    Crypto::Hash128::Bytes ShaderCache::GetIncludeHash(
+        const StringU8& Path)
+    {
+        auto [Package, AssetGuid] = Storage::FindAsset(Path, true, true);
+
+        std::optional<std::filesystem::file_time_type> WriteTime;
+        if (Package)
+        {
+            WriteTime = Package->GetWriteTime(AssetGuid);
+        }
+
+        bool Changed = false;
+        {
+            std::scoped_lock Lock(m_IncludeMutex);
+            if (auto Iter = m_IncludeHashes.find(Path); Iter != m_IncludeHashes.end())
+            {
+                if (Iter->second.WriteTime == WriteTime)
+                {
+                    return Iter->second.Hash;
+                }
+                Changed = true;
+            }
+        }
+
+        // Missing includes get an empty hash, so entries that depended on them are recompiled
+        Crypto::Hash128::Bytes Hash{};
+
+        if (!AssetGuid.is_nil())
+        {
+            // The manager may still hold the old content, so a changed include must be reloaded
+            auto Asset = Changed ? Manager::Reload(AssetGuid) : Manager::Load(AssetGuid, true);
+            if (auto TextFile = std::dynamic_pointer_cast<TextFileAsset>(Asset))
+            {
+                auto& Text = TextFile->Get();
+                Hash       = Crypto::Hash128().Append(Text.data(), Text.size()).Digest();
+            }
+        }
+
+        std::scoped_lock Lock(m_IncludeMutex);
+        m_IncludeHashes.insert_or_assign(Path, IncludeStamp{ .WriteTime = WriteTime, .Hash = Hash });
+        return Hash;
+    }
+} // namespace Neon::Asset
\ No newline at end of file
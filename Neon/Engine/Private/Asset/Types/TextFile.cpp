@@ -27,6 +27,11 @@ namespace Neon::Asset
         m_Text = Text;
     }
 
+    size_t TextFileAsset::GetResidentSize() const noexcept
+    {
+        return IAsset::GetResidentSize() + m_Text.size();
+    }
+
     //
 
     bool TextFileAsset::Handler::CanHandle(
@@ -55,4 +60,9 @@ namespace Neon::Asset
     {
         Stream << static_cast<const TextFileAsset*>(Asset.get())->Get();
     }
+
+    bool TextFileAsset::Handler::IsPassthrough() const
+    {
+        return true;
+    }
 } // namespace Neon::Asset
@@ -51,6 +51,12 @@ namespace Neon::Asset
         return m_Texture;
     }
 
+    size_t TextureAsset::GetResidentSize() const noexcept
+    {
+        // The encoded image is kept alongside the texture, which is roughly as large once decoded
+        return IAsset::GetResidentSize() + m_ImageInfo.Size * 2;
+    }
+
     //
 
     bool TextureAsset::Handler::CanHandle(
@@ -120,4 +126,9 @@ namespace Neon::Asset
             std::bit_cast<const char*>(ImageInfo.Data),
             ImageInfo.Size);
     }
+
+    bool TextureAsset::Handler::IsPassthrough() const
+    {
+        return true;
+    }
 } // namespace Neon::Asset
\ No newline at end of file
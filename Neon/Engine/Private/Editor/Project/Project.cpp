@@ -28,7 +28,10 @@ namespace Neon::Editor
             std::filesystem::remove_all(ProjectPath);
         }
 
-        auto ContentPackage = std::make_unique<Asset::DirectoryAssetPackage>(GetContentDirectoryPath());
+        auto ContentPackage = std::make_unique<Asset::DirectoryAssetPackage>(
+            GetContentDirectoryPath(),
+            Asset::DirectoryAssetPackage::ScanMode::Cached,
+            GetIntermediateDirectoryPath() / StringUtils::Format("Content{}", Asset::DirectoryAssetPackage::s_IndexExtension));
         m_ContentPackage    = ContentPackage.get();
         Asset::Storage::Mount(std::move(ContentPackage));
     }
@@ -69,6 +72,11 @@ namespace Neon::Editor
         return GetProjectDirectoryPath() / "Content";
     }
 
+    std::filesystem::path Project::GetIntermediateDirectoryPath() const
+    {
+        return GetProjectDirectoryPath() / "Intermediate";
+    }
+
     //
 
     const ProjectConfig& Project::GetConfig() const noexcept
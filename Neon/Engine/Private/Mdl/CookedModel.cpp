@@ -0,0 +1,350 @@
+#include <EnginePCH.hpp>
+#include <Mdl/CookedModel.hpp>
+#include <RHI/Material/Shared.hpp>
+#include <Asio/JobSystem.hpp>
+#include <IO/BinaryFile.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::Mdl
+{
+    static_assert(std::is_trivially_copyable_v<MeshVertex>);
+    static_assert(std::is_trivially_copyable_v<SubMeshData>);
+
+    enum class CookedModelFlags : uint32_t
+    {
+        None         = 0,
+        SmallIndices = 1 << 0
+    };
+
+    //
+
+    bool CookedModel::IsCooked(
+        std::istream& Stream)
+    {
+        auto Position = Stream.tellg();
+
+        uint32_t FileMagic = 0;
+        Stream.read(std::bit_cast<char*>(&FileMagic), sizeof(FileMagic));
+        bool Result = Stream.gcount() == sizeof(FileMagic) && FileMagic == Magic;
+
+        Stream.clear();
+        Stream.seekg(Position);
+        return Result;
+    }
+
+    bool CookedModel::Read(
+        std::istream& Stream)
+    {
+        IO::BinaryStreamReader Reader(Stream);
+
+        if (Reader.Read<uint32_t>() != Magic)
+        {
+            return false;
+        }
+
+        if (auto FileVersion = Reader.Read<uint32_t>(); FileVersion != Version)
+        {
+            NEON_WARNING_TAG("Model", "Cooked model version mismatch, expected {} but got {}", Version, FileVersion);
+            return false;
+        }
+
+        auto Flags   = Reader.Read<uint32_t>();
+        SmallIndices = Flags & uint32_t(CookedModelFlags::SmallIndices);
+
+        //
+
+        Vertices.resize(Reader.Read<uint32_t>());
+        Reader.ReadBytes(Vertices.data(), Vertices.size() * sizeof(MeshVertex));
+
+        Indices.resize(size_t(Reader.Read<uint32_t>()) * GetIndexStride());
+        Reader.ReadBytes(Indices.data(), Indices.size());
+
+        Submeshes.resize(Reader.Read<uint32_t>());
+        Reader.ReadBytes(Submeshes.data(), Submeshes.size() * sizeof(SubMeshData));
+
+        //
+
+        Nodes.resize(Reader.Read<uint32_t>());
+        for (auto& Node : Nodes)
+        {
+            Reader.Read(Node.Parent);
+            Reader.Read(Node.Transform);
+            Reader.Read(Node.Name);
+
+            Node.Children.resize(Reader.Read<uint32_t>());
+            Reader.ReadBytes(Node.Children.data(), Node.Children.size() * sizeof(uint32_t));
+
+            Node.Submeshes.resize(Reader.Read<uint32_t>());
+            Reader.ReadBytes(Node.Submeshes.data(), Node.Submeshes.size() * sizeof(uint32_t));
+        }
+
+        //
+
+        Materials.resize(Reader.Read<uint32_t>());
+        for (auto& Material : Materials)
+        {
+            Reader.Read(Material.Name);
+
+            Material.Parameters.resize(Reader.Read<uint32_t>());
+            for (auto& Parameter : Material.Parameters)
+            {
+                Reader.Read(Parameter.Name);
+                Reader.Read(Parameter.Components);
+                Reader.Read(Parameter.Value);
+            }
+
+            Material.Textures.resize(Reader.Read<uint32_t>());
+            for (auto& Texture : Material.Textures)
+            {
+                Reader.Read(Texture.Name);
+                Reader.Read(Texture.Path);
+                Reader.Read(Texture.Width);
+                Reader.Read(Texture.Height);
+
+                Texture.Data.resize(Reader.Read<uint32_t>());
+                Reader.ReadBytes(Texture.Data.data(), Texture.Data.size());
+            }
+        }
+
+        return bool(Reader);
+    }
+
+    void CookedModel::Write(
+        std::ostream& Stream) const
+    {
+        IO::BinaryStreamWriter Writer(Stream);
+
+        uint32_t Flags = 0;
+        if (SmallIndices)
+        {
+            Flags |= uint32_t(CookedModelFlags::SmallIndices);
+        }
+
+        Writer.Write(Magic);
+        Writer.Write(Version);
+        Writer.Write(Flags);
+
+        //
+
+        Writer.Write(uint32_t(Vertices.size()));
+        Writer.WriteBytes(Vertices.data(), Vertices.size() * sizeof(MeshVertex));
+
+        Writer.Write(uint32_t(GetIndexCount()));
+        Writer.WriteBytes(Indices.data(), Indices.size());
+
+        Writer.Write(uint32_t(Submeshes.size()));
+        Writer.WriteBytes(Submeshes.data(), Submeshes.size() * sizeof(SubMeshData));
+
+        //
+
+        Writer.Write(uint32_t(Nodes.size()));
+        for (auto& Node : Nodes)
+        {
+            Writer.Write(Node.Parent);
+            Writer.Write(Node.Transform);
+            Writer.Write(Node.Name);
+
+            Writer.Write(uint32_t(Node.Children.size()));
+            Writer.WriteBytes(Node.Children.data(), Node.Children.size() * sizeof(uint32_t));
+
+            Writer.Write(uint32_t(Node.Submeshes.size()));
+            Writer.WriteBytes(Node.Submeshes.data(), Node.Submeshes.size() * sizeof(uint32_t));
+        }
+
+        //
+
+        Writer.Write(uint32_t(Materials.size()));
+        for (auto& Material : Materials)
+        {
+            Writer.Write(Material.Name);
+
+            Writer.Write(uint32_t(Material.Parameters.size()));
+            for (auto& Parameter : Material.Parameters)
+            {
+                Writer.Write(Parameter.Name);
+                Writer.Write(Parameter.Components);
+                Writer.Write(Parameter.Value);
+            }
+
+            Writer.Write(uint32_t(Material.Textures.size()));
+            for (auto& Texture : Material.Textures)
+            {
+                Writer.Write(Texture.Name);
+                Writer.Write(Texture.Path);
+                Writer.Write(Texture.Width);
+                Writer.Write(Texture.Height);
+
+                Writer.Write(uint32_t(Texture.Data.size()));
+                Writer.WriteBytes(Texture.Data.data(), Texture.Data.size());
+            }
+        }
+    }
+
+    void CookedModel::CompactIndices()
+    {
+        if (SmallIndices)
+        {
+            return;
+        }
+
+        // Indices are relative to the submesh's vertex offset, so we only need to check the submesh's vertex count
+        for (auto& Submesh : Submeshes)
+        {
+            if (Submesh.VertexCount > std::numeric_limits<uint16_t>::max())
+            {
+                return;
+            }
+        }
+
+        size_t               IndexCount = GetIndexCount();
+        std::vector<uint8_t> SmallIndicesData(IndexCount * sizeof(uint16_t));
+
+        auto Src = std::bit_cast<const uint32_t*>(Indices.data());
+        auto Dst = std::bit_cast<uint16_t*>(SmallIndicesData.data());
+        for (size_t i = 0; i < IndexCount; i++)
+        {
+            Dst[i] = uint16_t(Src[i]);
+        }
+
+        Indices      = std::move(SmallIndicesData);
+        SmallIndices = true;
+    }
+
+    Ptr<Model> CookedModel::CreateModel(
+        const StringU8& Name) const
+    {
+        Model::MaterialsTable ModelMaterials;
+
+        // Load materials in parallel with uploading the buffers
+        std::future<void> LoadMaterialTask;
+        if (!Materials.empty())
+        {
+            LoadMaterialTask = Asio::JobSystem::Async(
+                [this, &ModelMaterials]
+                {
+                    ModelMaterials.reserve(Materials.size());
+                    auto LitMaterial = RHI::SharedMaterials::Get(RHI::SharedMaterials::Type::Lit);
+
+                    for (auto& CookedMat : Materials)
+                    {
+                        auto& Material = ModelMaterials.emplace_back(LitMaterial->CreateInstance());
+
+                        for (auto& Parameter : CookedMat.Parameters)
+                        {
+                            switch (Parameter.Components)
+                            {
+                            case 3:
+                                Material->Set(Parameter.Name, Vector3(Parameter.Value));
+                                break;
+                            case 4:
+                                Material->Set(Parameter.Name, Parameter.Value);
+                                break;
+                            default:
+                                NEON_WARNING_TAG("Model", "Unsupported parameter size: {}", Parameter.Components);
+                                break;
+                            }
+                        }
+
+                        for (auto& CookedTex : CookedMat.Textures)
+                        {
+#ifndef NEON_DIST
+                            auto TextureName    = StringUtils::Format(STR("Cooked_Texture::{}"), StringUtils::Transform<String>(CookedTex.Path));
+                            auto TextureNamePtr = TextureName.c_str();
+#else
+                            const wchar_t* TextureNamePtr = nullptr;
+#endif
+
+                            if (!CookedTex.Data.empty())
+                            {
+                                std::array Subresources{
+                                    RHI::ComputeSubresource(
+                                        RHI::EResourceFormat::R8G8B8A8_UNorm,
+                                        CookedTex.Data.data(),
+                                        CookedTex.Width,
+                                        CookedTex.Height)
+                                };
+                                auto Texture = RHI::SSyncGpuResource(
+                                    RHI::ResourceDesc::Tex2D(
+                                        RHI::EResourceFormat::R8G8B8A8_UNorm,
+                                        CookedTex.Width,
+                                        CookedTex.Height,
+                                        1),
+                                    Subresources,
+                                    TextureNamePtr);
+                                Material->SetTexture(CookedTex.Name, Texture.Get());
+                            }
+                            else
+                            {
+                                std::fstream File(CookedTex.Path, std::ios::in | std::ios::binary);
+                                if (!File.is_open())
+                                {
+                                    NEON_WARNING_TAG("Model", "Failed to load texture '{}'", CookedTex.Path);
+                                    continue;
+                                }
+
+                                std::vector<uint8_t> Data((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+                                RHI::TextureRawImage ImageInfo{
+                                    .Data = Data.data(),
+                                    .Size = Data.size(),
+                                    .Type = RHI::TextureRawImage::Format::Png
+                                };
+
+                                auto Texture = RHI::SSyncGpuResource(ImageInfo, TextureNamePtr, RHI::MResourceState_AllShaderResource);
+                                Material->SetTexture(CookedTex.Name, Texture.Get());
+                            }
+                        }
+                    }
+                });
+        }
+
+        //
+
+#ifndef NEON_DIST
+        auto ModelName     = StringUtils::Transform<String>(Name);
+        auto VtxBufferName = StringUtils::Format(STR("Model_VertexBuffer::{}"), ModelName);
+        auto IdxBufferName = StringUtils::Format(STR("Model_IndexBuffer::{}"), ModelName);
+
+        auto VtxBufferNamePtr = VtxBufferName.c_str();
+        auto IdxBufferNamePtr = IdxBufferName.c_str();
+#else
+        const wchar_t* VtxBufferNamePtr = nullptr;
+        const wchar_t* IdxBufferNamePtr = nullptr;
+#endif
+
+        RHI::USyncGpuResource VertexBuffer, IndexBuffer;
+        if (!Vertices.empty())
+        {
+            VertexBuffer = RHI::USyncGpuResource::Buffer(
+                sizeof(MeshVertex),
+                Vertices.size(),
+                Vertices.data(),
+                VtxBufferNamePtr,
+                {},
+                RHI::MResourceState_AllShaderResource);
+
+            IndexBuffer = RHI::USyncGpuResource::Buffer(
+                GetIndexStride(),
+                GetIndexCount(),
+                Indices.data(),
+                IdxBufferNamePtr,
+                {},
+                RHI::MResourceState_AllShaderResource);
+        }
+
+        if (LoadMaterialTask.valid())
+        {
+            Asio::JobSystem::Wait(LoadMaterialTask);
+            LoadMaterialTask.get();
+        }
+
+        return std::make_shared<Model>(
+            std::move(VertexBuffer),
+            std::move(IndexBuffer),
+            SmallIndices,
+            Model::SubmeshList(Submeshes),
+            Model::MeshNodeList(Nodes),
+            std::move(ModelMaterials));
+    }
+} // namespace Neon::Mdl
\ No newline at end of file
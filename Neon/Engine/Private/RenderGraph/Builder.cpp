@@ -27,84 +27,81 @@ namespace Neon::RG
             auto& Builder = Builders[i];
             m_Passes[i]->ResolveResources(Builder.Resources);
         }
-        m_Context.Build(BuildPasses(Builders));
+
+        auto Levels = BuildPasses(Builders);
+        m_Context.Build(std::move(Levels), std::move(m_Compiled));
     }
 
     auto GraphBuilder::BuildPasses(
         BuildersListType& Builders) -> std::vector<GraphDepdencyLevel>
     {
-        BuildAdjacencyLists(Builders);
-        TopologicalSort();
-        return BuildDependencyLevels(Builders);
-    }
+        Declare(Builders);
 
-    //
+        auto& Cache     = m_Context.m_Cache;
+        auto  Structure = GraphCompiler::GetStructure(m_Declaration);
 
-    void GraphBuilder::BuildAdjacencyLists(
-        const BuildersListType& Builders)
-    {
-        m_AdjacencyList.resize(m_Passes.size());
-        for (size_t i = 0; i < m_Passes.size(); i++)
+        if (auto Compiled = Cache.Find(Structure))
         {
-            auto& Adjacencies = m_AdjacencyList[i];
-            auto& PassBuilder = Builders[i].Resources;
+            m_Compiled = *Compiled;
 
-            for (size_t j = i + 1; j < m_Passes.size(); j++)
-            {
-                auto& OtherPassBuilder = Builders[j].Resources;
-                bool  Depends          = false;
+#if NEON_DEBUG
+            NEON_ASSERT(m_Compiler.Compile(m_Declaration).HasSameLayout(m_Compiled), "Cached graph doesn't match its structure");
+#endif
+        }
+        else
+        {
+            NEON_TRACE_TAG("RenderGraph", "Compiling graph of {} passes, no cached graph matches its structure", m_Passes.size());
 
-                for (auto& OtherPassRead : OtherPassBuilder.m_ResourcesRead)
-                {
-                    if (PassBuilder.m_ResourcesWritten.contains(OtherPassRead))
-                    {
-                        Adjacencies.push_back(j);
-                        Depends = true;
-                        break;
-                    }
-                }
-            }
+            m_Compiled = m_Compiler.Compile(m_Declaration);
+            Cache.Insert(std::move(Structure), m_Compiled);
         }
-    }
 
-    //
+        return BuildDependencyLevels(Builders);
+    }
 
-    void GraphBuilder::TopologicalSort()
+    void GraphBuilder::Declare(
+        BuildersListType& Builders)
     {
-        std::stack<size_t> Stack{};
-        std::vector<bool>  Visited(m_Passes.size(), false);
-        for (size_t i = 0; i < m_Passes.size(); i++)
+        auto& Storage = m_Context.GetStorage();
+
+        m_Declaration.Passes.resize(m_Passes.size());
+        m_Declaration.Imported.clear();
+
+        auto AddImported = [&](const std::set<ResourceId>& Resources)
         {
-            if (!Visited[i])
+            for (auto& Id : Resources)
             {
-                DepthFirstSearch(i, Visited, Stack);
+                if (Storage.ContainsResource(Id) && Storage.GetResource(Id).IsImported())
+                {
+                    m_Declaration.Imported.emplace(Id);
+                }
             }
-        }
+        };
 
-        m_TopologicallySortedList.reserve(Stack.size());
-        while (!Stack.empty())
+        for (size_t i = 0; i < m_Passes.size(); i++)
         {
-            m_TopologicallySortedList.push_back(Stack.top());
-            Stack.pop();
-        }
-    }
+            auto& RenderPass  = *m_Passes[i];
+            auto& Pass        = m_Declaration.Passes[i];
+            auto& PassBuilder = Builders[i].Resources;
 
-    //
+            Pass.Type    = typeid(RenderPass).hash_code();
+            Pass.Name    = RenderPass.GetPassName();
+            Pass.Created = std::move(PassBuilder.m_ResourcesCreated);
+            Pass.Written = std::move(PassBuilder.m_ResourcesWritten);
+            Pass.Read    = std::move(PassBuilder.m_ResourcesRead);
 
-    void GraphBuilder::DepthFirstSearch(
-        size_t              Index,
-        std::vector<bool>&  Visited,
-        std::stack<size_t>& Stack)
-    {
-        Visited[Index] = true;
-        for (size_t AdjIndex : m_AdjacencyList[Index])
-        {
-            if (!Visited[AdjIndex])
+            AddImported(Pass.Created);
+            AddImported(Pass.Written);
+            AddImported(Pass.Read);
+
+            Pass.States.clear();
+            for (auto& [ViewId, State] : PassBuilder.m_ResourceStates)
             {
-                DepthFirstSearch(AdjIndex, Visited, Stack);
+                uint32_t SubresourceIndex;
+                Storage.GetResourceView(ViewId, nullptr, &SubresourceIndex);
+                Pass.States.emplace_back(ViewId.GetResource(), SubresourceIndex, State);
             }
         }
-        Stack.push(Index);
     }
 
     //
@@ -112,39 +109,27 @@ namespace Neon::RG
     auto GraphBuilder::BuildDependencyLevels(
         BuildersListType& Builders) -> std::vector<GraphDepdencyLevel>
     {
-        std::vector<size_t> Distances(m_TopologicallySortedList.size());
-        for (size_t d = 0; d < Distances.size(); d++)
-        {
-            size_t i = m_TopologicallySortedList[d];
-            for (size_t AdjIndex : m_AdjacencyList[i])
-            {
-                if (Distances[AdjIndex] < (Distances[i] + 1))
-                {
-                    Distances[AdjIndex] = Distances[i] + 1;
-                }
-            }
-        }
-
-        size_t Size = std::ranges::max(Distances) + 1;
-
         std::vector<GraphDepdencyLevel> Dependencies;
-        Dependencies.reserve(Size);
+        Dependencies.reserve(m_Compiled.GetLevelCount());
 
-        for (size_t i = 0; i < Size; i++)
+        for (size_t i = 0; i < m_Compiled.GetLevelCount(); i++)
         {
             Dependencies.emplace_back(m_Context);
         }
 
         for (size_t i = 0; i < m_Passes.size(); ++i)
         {
-            size_t Level = Distances[i];
+            uint32_t Level = m_Compiled.GetPassLevels()[i];
+            if (Level == CompiledGraph::s_CulledPass)
+            {
+                continue;
+            }
 
             Dependencies[Level].AddPass(
                 std::move(m_Passes[i]),
                 std::move(Builders[i].Resources.m_RenderTargets),
                 std::move(Builders[i].Resources.m_DepthStencil),
-                std::move(Builders[i].Resources.m_ResourcesCreated),
-                std::move(Builders[i].Resources.m_ResourceStates));
+                std::move(m_Declaration.Passes[i].Created));
         }
 
         return Dependencies;
@@ -0,0 +1,42 @@
+#include <EnginePCH.hpp>
+#include <RenderGraph/Cache.hpp>
+
+namespace Neon::RG
+{
+    const CompiledGraph* GraphCache::Find(
+        const Structure& Key)
+    {
+        auto Iter = std::ranges::find(m_Entries, Key, &Entry::Key);
+        if (Iter == m_Entries.end())
+        {
+            m_MissCount++;
+            return nullptr;
+        }
+
+        m_HitCount++;
+        m_Entries.splice(m_Entries.begin(), m_Entries, Iter);
+        return &m_Entries.front().Compiled;
+    }
+
+    const CompiledGraph& GraphCache::Insert(
+        Structure     Key,
+        CompiledGraph Compiled)
+    {
+        auto Iter = std::ranges::find(m_Entries, Key, &Entry::Key);
+        if (Iter != m_Entries.end())
+        {
+            m_Entries.erase(Iter);
+        }
+        else if (m_MaxEntries && m_Entries.size() >= m_MaxEntries)
+        {
+            m_Entries.pop_back();
+        }
+
+        return m_Entries.emplace_front(std::move(Key), std::move(Compiled)).Compiled;
+    }
+
+    void GraphCache::Clear() noexcept
+    {
+        m_Entries.clear();
+    }
+} // namespace Neon::RG
\ No newline at end of file
@@ -0,0 +1,357 @@
+#include <EnginePCH.hpp>
+#include <RenderGraph/Compiler.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RG
+{
+    GraphCache::Structure GraphCompiler::GetStructure(
+        const GraphDeclaration& Graph)
+    {
+        GraphCache::Structure Key;
+
+        auto AddResources = [&](const std::set<ResourceId>& Resources)
+        {
+            Key.Add(Resources.size());
+            for (auto& Id : Resources)
+            {
+                Key.Add(Id.Get());
+                Key.Add(Graph.Imported.contains(Id));
+            }
+        };
+
+        Key.Add(Graph.Passes.size());
+        for (auto& Pass : Graph.Passes)
+        {
+            Key.Add(Pass.Type);
+            Key.Add(std::hash<StringU8View>{}(Pass.Name));
+
+            AddResources(Pass.Created);
+            AddResources(Pass.Written);
+            AddResources(Pass.Read);
+
+            Key.Add(Pass.States.size());
+            for (auto& Request : Pass.States)
+            {
+                Key.Add(Request.Resource.Get());
+                Key.Add(Request.Subresource);
+                Key.Add(Request.State.ToUllong());
+            }
+        }
+
+        return Key;
+    }
+
+    CompiledGraph GraphCompiler::Compile(
+        const GraphDeclaration& Graph)
+    {
+        m_Compiled = {};
+        m_TopologicallySortedList.clear();
+
+        BuildResourceUsages(Graph);
+        CullPasses(Graph);
+        BuildAdjacencyLists(Graph);
+        TopologicalSort();
+        BuildPassLevels();
+        BuildLifetimes(Graph);
+        BuildTransitions(Graph);
+
+        return std::move(m_Compiled);
+    }
+
+    //
+
+    void GraphCompiler::BuildResourceUsages(
+        const GraphDeclaration& Graph)
+    {
+        auto GetUsage = [this](const ResourceId& Id) -> ResourceUsage&
+        {
+            auto [Iter, Inserted] = m_ResourceUsages.try_emplace(Id.Get());
+            if (Inserted)
+            {
+                Iter->second.Id = Id;
+            }
+            return Iter->second;
+        };
+
+        m_ResourceUsages.clear();
+        for (size_t i = 0; i < Graph.Passes.size(); i++)
+        {
+            auto& Pass = Graph.Passes[i];
+            for (auto& Id : Pass.Created)
+            {
+                GetUsage(Id).Creators.push_back(i);
+            }
+            for (auto& Id : Pass.Written)
+            {
+                GetUsage(Id).Producers.push_back(i);
+            }
+            for (auto& Id : Pass.Read)
+            {
+                GetUsage(Id).Consumers.push_back(i);
+            }
+        }
+    }
+
+    void GraphCompiler::CullPasses(
+        const GraphDeclaration& Graph)
+    {
+        size_t PassCount = Graph.Passes.size();
+
+        std::vector<size_t> PassesToVisit;
+        m_CulledPasses.assign(PassCount, true);
+
+        auto KeepPass = [&](size_t Index)
+        {
+            if (m_CulledPasses[Index])
+            {
+                m_CulledPasses[Index] = false;
+                PassesToVisit.push_back(Index);
+            }
+        };
+
+        for (size_t i = 0; i < PassCount; i++)
+        {
+            auto& Written = Graph.Passes[i].Written;
+            bool  IsOutput =
+                Written.empty() ||
+                std::ranges::any_of(
+                    Written,
+                    [&Graph](const ResourceId& Id)
+                    { return Graph.Imported.contains(Id); });
+
+            if (IsOutput)
+            {
+                KeepPass(i);
+            }
+        }
+
+        // Walk back from the outputs, a pass needs the passes that created the resources it uses and the last pass
+        // that wrote them before it. That pass writes them too, so the previous writers are reached through it.
+        while (!PassesToVisit.empty())
+        {
+            size_t Index = PassesToVisit.back();
+            PassesToVisit.pop_back();
+
+            auto KeepProducers = [&](const ResourceId& Id)
+            {
+                auto& Usage = m_ResourceUsages.at(Id.Get());
+                for (size_t Creator : Usage.Creators)
+                {
+                    KeepPass(Creator);
+                }
+
+                auto Producer = std::ranges::lower_bound(Usage.Producers, Index);
+                if (Producer != Usage.Producers.begin())
+                {
+                    KeepPass(*std::prev(Producer));
+                }
+            };
+
+            auto& Pass = Graph.Passes[Index];
+            for (auto& Id : Pass.Read)
+            {
+                KeepProducers(Id);
+            }
+            for (auto& Id : Pass.Written)
+            {
+                KeepProducers(Id);
+            }
+        }
+
+        m_Compiled.m_CulledPasses.clear();
+        for (size_t i = 0; i < PassCount; i++)
+        {
+            if (m_CulledPasses[i])
+            {
+                NEON_TRACE_TAG("RenderGraph", "Culling pass '{}', no output depends on it", Graph.Passes[i].Name);
+                m_Compiled.m_CulledPasses.emplace_back(Graph.Passes[i].Name);
+            }
+        }
+    }
+
+    //
+
+    void GraphCompiler::BuildAdjacencyLists(
+        const GraphDeclaration& Graph)
+    {
+        // A pass depends on the passes before it that write the resources it reads
+        m_AdjacencyList.assign(Graph.Passes.size(), {});
+        for (auto& Usage : m_ResourceUsages | std::views::values)
+        {
+            for (size_t Consumer : Usage.Consumers)
+            {
+                if (m_CulledPasses[Consumer])
+                {
+                    continue;
+                }
+
+                for (size_t Producer : Usage.Producers)
+                {
+                    if (Producer >= Consumer)
+                    {
+                        break;
+                    }
+                    m_AdjacencyList[Producer].push_back(Consumer);
+                }
+            }
+        }
+
+        for (auto& Adjacencies : m_AdjacencyList)
+        {
+            std::ranges::sort(Adjacencies);
+            auto Duplicates = std::ranges::unique(Adjacencies);
+            Adjacencies.erase(Duplicates.begin(), Duplicates.end());
+        }
+    }
+
+    //
+
+    void GraphCompiler::TopologicalSort()
+    {
+        size_t PassCount = m_AdjacencyList.size();
+
+        std::stack<size_t> Stack{};
+        std::vector<bool>  Visited(PassCount, false);
+        for (size_t i = 0; i < PassCount; i++)
+        {
+            if (!Visited[i] && !m_CulledPasses[i])
+            {
+                DepthFirstSearch(i, Visited, Stack);
+            }
+        }
+
+        m_TopologicallySortedList.reserve(Stack.size());
+        while (!Stack.empty())
+        {
+            m_TopologicallySortedList.push_back(Stack.top());
+            Stack.pop();
+        }
+    }
+
+    //
+
+    void GraphCompiler::DepthFirstSearch(
+        size_t              Index,
+        std::vector<bool>&  Visited,
+        std::stack<size_t>& Stack)
+    {
+        Visited[Index] = true;
+        for (size_t AdjIndex : m_AdjacencyList[Index])
+        {
+            if (!Visited[AdjIndex])
+            {
+                DepthFirstSearch(AdjIndex, Visited, Stack);
+            }
+        }
+        Stack.push(Index);
+    }
+
+    //
+
+    void GraphCompiler::BuildPassLevels()
+    {
+        size_t PassCount = m_AdjacencyList.size();
+
+        std::vector<size_t> Distances(PassCount);
+        for (size_t i : m_TopologicallySortedList)
+        {
+            for (size_t AdjIndex : m_AdjacencyList[i])
+            {
+                if (Distances[AdjIndex] < (Distances[i] + 1))
+                {
+                    Distances[AdjIndex] = Distances[i] + 1;
+                }
+            }
+        }
+
+        size_t Size = 0;
+        for (size_t i : m_TopologicallySortedList)
+        {
+            Size = std::max(Size, Distances[i] + 1);
+        }
+
+        auto& PassLevels = m_Compiled.m_PassLevels;
+        PassLevels.assign(PassCount, CompiledGraph::s_CulledPass);
+        for (size_t i = 0; i < PassCount; i++)
+        {
+            if (!m_CulledPasses[i])
+            {
+                PassLevels[i] = uint32_t(Distances[i]);
+            }
+        }
+
+        m_Compiled.m_LevelCount = uint32_t(Size);
+        m_Compiled.m_PassCount  = uint32_t(std::ranges::count(m_CulledPasses, false));
+    }
+
+    void GraphCompiler::BuildLifetimes(
+        const GraphDeclaration& Graph)
+    {
+        auto& Lifetimes = m_Compiled.m_Lifetimes;
+        auto& Levels    = m_Compiled.m_PassLevels;
+
+        Lifetimes.clear();
+        for (auto& Usage : m_ResourceUsages | std::views::values)
+        {
+            CompiledGraph::ResourceLifetime Lifetime;
+
+            auto AddUses = [&](const std::vector<size_t>& Passes, uint32_t* Count)
+            {
+                for (size_t Index : Passes)
+                {
+                    if (Levels[Index] == CompiledGraph::s_CulledPass)
+                    {
+                        continue;
+                    }
+
+                    Lifetime.FirstLevel = std::min(Lifetime.FirstLevel, Levels[Index]);
+                    Lifetime.LastLevel  = std::max(Lifetime.LastLevel, Levels[Index]);
+                    if (Count)
+                    {
+                        ++*Count;
+                    }
+                }
+            };
+
+            AddUses(Usage.Creators, nullptr);
+            AddUses(Usage.Producers, &Lifetime.ProducerCount);
+            AddUses(Usage.Consumers, &Lifetime.ConsumerCount);
+
+            // Only used by culled passes
+            if (Lifetime.FirstLevel > Lifetime.LastLevel)
+            {
+                continue;
+            }
+
+            Lifetime.Imported = Graph.Imported.contains(Usage.Id);
+            Lifetimes.emplace(Usage.Id, Lifetime);
+        }
+    }
+
+    void GraphCompiler::BuildTransitions(
+        const GraphDeclaration& Graph)
+    {
+        auto& Transitions = m_Compiled.m_Transitions;
+
+        Transitions.Reset(m_Compiled.m_LevelCount);
+        for (size_t i = 0; i < Graph.Passes.size(); i++)
+        {
+            uint32_t Level = m_Compiled.m_PassLevels[i];
+            if (Level == CompiledGraph::s_CulledPass)
+            {
+                continue;
+            }
+
+            for (auto& Request : Graph.Passes[i].States)
+            {
+                Transitions.Add(Level, Request.Resource, Request.Subresource, Request.State);
+            }
+        }
+        Transitions.Build();
+
+#if NEON_DEBUG
+        NEON_ASSERT(Transitions.Validate(), "Planned transitions don't match the states requested by the passes");
+#endif
+    }
+} // namespace Neon::RG
@@ -0,0 +1,135 @@
+#include <EnginePCH.hpp>
+#include <RenderGraph/DrawQueue.hpp>
+#include <Utils/RadixSort.hpp>
+
+#include <bit>
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Fibonacci hash of a pointer, keeping the top Bits bits.
+    /// </summary>
+    [[nodiscard]] static uint64_t HashPointer(
+        const void* Pointer,
+        uint32_t    Bits) noexcept
+    {
+        return (uint64_t(std::bit_cast<uintptr_t>(Pointer)) * 0x9E3779B97F4A7C15ull) >> (64 - Bits);
+    }
+
+    /// <summary>
+    /// Keep the top 16 bits of a positive float, their order is the same as the float's.
+    /// </summary>
+    [[nodiscard]] static uint64_t QuantizeDepth(
+        float Dist) noexcept
+    {
+        return std::bit_cast<uint32_t>(std::max(Dist, 0.f)) >> 16;
+    }
+
+    //
+
+    void DrawQueue::Reset(
+        size_t ChunkCount)
+    {
+        if (m_Chunks.size() < ChunkCount)
+        {
+            m_Chunks.resize(ChunkCount);
+        }
+        for (auto& CurChunk : m_Chunks)
+        {
+            CurChunk.Items.clear();
+            CurChunk.Keys.clear();
+        }
+        m_ChunkCount = ChunkCount;
+
+        m_Items.clear();
+        m_Entries.clear();
+        m_Batches.clear();
+        m_InstanceIds.clear();
+    }
+
+    void DrawQueue::Add(
+        size_t                     ChunkIndex,
+        const DrawItem&            Item,
+        const RHI::IPipelineState* PipelineState,
+        bool                       Transparent,
+        float                      Dist)
+    {
+        auto& CurChunk = m_Chunks[ChunkIndex];
+        CurChunk.Items.push_back(Item);
+        CurChunk.Keys.push_back(MakeKey(Item, PipelineState, Transparent, Dist));
+    }
+
+    void DrawQueue::Build()
+    {
+        size_t Count = GetDrawCount();
+
+        m_Items.reserve(Count);
+        m_Entries.reserve(Count);
+        for (size_t i = 0; i < m_ChunkCount; i++)
+        {
+            auto& CurChunk = m_Chunks[i];
+            for (size_t j = 0; j < CurChunk.Items.size(); j++)
+            {
+                m_Entries.push_back({ .Key = CurChunk.Keys[j], .Item = uint32_t(m_Items.size()) });
+                m_Items.push_back(CurChunk.Items[j]);
+            }
+        }
+
+        m_Scratch.resize(Count);
+        Utils::RadixSort(
+            std::span(m_Entries),
+            std::span(m_Scratch),
+            [](const SortEntry& Entry)
+            { return Entry.Key; });
+
+        // Draws of the same submesh with the same material are adjacent unless their hashes collide
+        m_InstanceIds.reserve(Count);
+        for (auto& Entry : m_Entries)
+        {
+            auto& Item = m_Items[Entry.Item];
+            if (m_Batches.empty() ||
+                m_Batches.back().Material != Item.Material ||
+                m_Batches.back().Model != Item.Model ||
+                m_Batches.back().Data != Item.Data)
+            {
+                m_Batches.push_back({ .Material      = Item.Material,
+                                      .Model         = Item.Model,
+                                      .Data          = Item.Data,
+                                      .FirstInstance = uint32_t(m_InstanceIds.size()),
+                                      .InstanceCount = 0 });
+            }
+            m_Batches.back().InstanceCount++;
+            m_InstanceIds.push_back(Item.InstanceId);
+        }
+    }
+
+    size_t DrawQueue::GetDrawCount() const noexcept
+    {
+        size_t Count = 0;
+        for (size_t i = 0; i < m_ChunkCount; i++)
+        {
+            Count += m_Chunks[i].Items.size();
+        }
+        return Count;
+    }
+
+    //
+
+    uint64_t DrawQueue::MakeKey(
+        const DrawItem&            Item,
+        const RHI::IPipelineState* PipelineState,
+        bool                       Transparent,
+        float                      Dist) noexcept
+    {
+        uint64_t Pipeline = HashPointer(PipelineState, 15);
+        uint64_t Material = HashPointer(Item.Material, 16);
+        uint64_t Mesh     = HashPointer(Item.Data, 16);
+        uint64_t Depth    = QuantizeDepth(Dist);
+
+        if (Transparent)
+        {
+            return uint64_t(1) << 63 | Pipeline << 48 | (0xFFFF - Depth) << 32 | Material << 16 | Mesh;
+        }
+        return Pipeline << 48 | Material << 32 | Mesh << 16 | Depth;
+    }
+} // namespace Neon::RG
\ No newline at end of file
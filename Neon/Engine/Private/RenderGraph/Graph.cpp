@@ -7,6 +7,8 @@
 #include <RHI/Commands/Queue.hpp>
 #include <RHI/Fence.hpp>
 
+#include <Asio/JobSystem.hpp>
+#include <Allocator/Arena.hpp>
 #include <Runtime/GameEngine.hpp>
 #include <Scene/Component/Transform.hpp>
 #include <Scene/Component/Camera.hpp>
@@ -49,6 +51,16 @@ namespace Neon::RG
         return m_Storage;
     }
 
+    const CompiledGraph& RenderGraph::GetCompiledGraph() const noexcept
+    {
+        return m_Compiled;
+    }
+
+    const GraphCache& RenderGraph::GetCache() const noexcept
+    {
+        return m_Cache;
+    }
+
     void RenderGraph::Update(
         const Scene::Component::Camera&    Camera,
         const Scene::Component::Transform& Transform)
@@ -106,9 +118,16 @@ namespace Neon::RG
     }
 
     void RenderGraph::Build(
-        std::vector<GraphDepdencyLevel>&& Levels)
+        std::vector<GraphDepdencyLevel>&& Levels,
+        CompiledGraph&&                   Compiled)
     {
-        m_Levels = std::move(Levels);
+        m_Levels   = std::move(Levels);
+        m_Compiled = std::move(Compiled);
+
+        for (uint32_t i = 0; i < m_Levels.size(); i++)
+        {
+            m_Levels[i].SetTransitions(m_Compiled.GetTransitions().GetTransitions(i));
+        }
 
         uint32_t MaxGraphics = 0, MaxCompute = 0;
         uint32_t LastFlushedGraphics = 0, LastFlushedCompute = 0;
@@ -331,23 +350,25 @@ namespace Neon::RG
     }
 
     void GraphDepdencyLevel::AddPass(
-        UPtr<IRenderPass>                             Pass,
-        std::vector<ResourceViewId>                   RenderTargets,
-        std::optional<ResourceViewId>                 DepthStencil,
-        std::set<ResourceId>                          ResourceToCreate,
-        std::map<ResourceViewId, RHI::MResourceState> States)
+        UPtr<IRenderPass>             Pass,
+        std::vector<ResourceViewId>   RenderTargets,
+        std::optional<ResourceViewId> DepthStencil,
+        std::set<ResourceId>          ResourceToCreate)
     {
         m_Passes.emplace_back(std::move(Pass), std::move(RenderTargets), std::move(DepthStencil));
         m_ResourcesToCreate.merge(std::move(ResourceToCreate));
+    }
 
+    void GraphDepdencyLevel::SetTransitions(
+        std::span<const TransitionPlan::Transition> Transitions)
+    {
         auto& Storage = m_Context.GetStorage();
 
-        for (auto& [ViewId, State] : States)
+        m_Transitions.clear();
+        m_Transitions.reserve(Transitions.size());
+        for (auto& Transition : Transitions)
         {
-            uint32_t SubresourceIndex;
-            Storage.GetResourceView(ViewId, nullptr, &SubresourceIndex);
-            auto& States = m_StatesToTransition[ViewId.GetResource()][SubresourceIndex];
-            States |= State;
+            m_Transitions.emplace_back(&Storage.GetResource(Transition.Resource), Transition.Subresource, Transition.After);
         }
     }
 
@@ -426,19 +447,15 @@ namespace Neon::RG
 
     void GraphDepdencyLevel::ExecuteBarriers() const
     {
-        auto& Storage      = m_Context.GetStorage();
-        auto  StateManager = RHI::IResourceStateManager::Get();
+        auto StateManager = RHI::IResourceStateManager::Get();
 
-        for (auto& [Resource, StateMap] : m_StatesToTransition)
+        // Split barriers are not supported by the state manager, every transition begins and ends here
+        for (auto& Transition : m_Transitions)
         {
-            auto& Handle = Storage.GetResource(Resource);
-            for (auto& [SubresourceIndex, State] : StateMap)
-            {
-                StateManager->TransitionResource(
-                    Handle.Get().get(),
-                    State,
-                    SubresourceIndex);
-            }
+            StateManager->TransitionResource(
+                Transition.Handle->Get().get(),
+                Transition.State,
+                Transition.Subresource);
         }
     }
 
@@ -465,7 +482,7 @@ namespace Neon::RG
                 CommandList = RenderCommandList;
                 CommandList->BeginEvent(RenderPass->GetPassName());
 
-                std::vector<RHI::CpuDescriptorHandle> RtvHandles;
+                std::pmr::vector<RHI::CpuDescriptorHandle> RtvHandles(Allocator::FrameArena::GetResource());
                 RtvHandles.reserve(RenderTargets.size());
 
                 RHI::CpuDescriptorHandle  DsvHandle;
@@ -613,8 +630,7 @@ namespace Neon::RG
         };
 
 #ifdef NEON_RENDER_GRAPH_THREADED
-        std::vector<std::future<void>> Futures;
-        Futures.reserve(m_Passes.size());
+        Asio::JobGroup DispatchJobs;
 #endif
 
         uint32_t ComputeCommandIndex = 0, GraphicsCommandIndex = 0;
@@ -630,7 +646,10 @@ namespace Neon::RG
             uint32_t& CommandIndex = m_Passes[i].Pass->GetQueueType() == PassQueueType::Direct ? GraphicsCommandIndex : ComputeCommandIndex;
 
 #ifdef NEON_RENDER_GRAPH_THREADED
-            Futures.emplace_back(m_Context.m_ThreadPool.enqueue(DispatchTask, i, CommandIndex));
+            DispatchJobs.Run(
+                [&DispatchTask, i, CommandIndex]
+                { DispatchTask(i, CommandIndex); },
+                { .priority = Asio::JobPriority::critical });
 #else
             DispatchTask(i, CommandIndex);
 #endif
@@ -639,10 +658,7 @@ namespace Neon::RG
         }
 
 #ifdef NEON_RENDER_GRAPH_THREADED
-        for (auto& Future : Futures)
-        {
-            Future.get();
-        }
+        DispatchJobs.Wait();
 #endif
     }
 } // namespace Neon::RG
@@ -3,9 +3,11 @@
 #include <RenderGraph/Storage.hpp>
 #include <Runtime/GameLogic.hpp>
 
-#include <Geometry/Frustum.hpp>
+#include <Geometry/Culling.hpp>
+#include <Asio/JobSystem.hpp>
 
 #include <Scene/EntityWorld.hpp>
+#include <Scene/SpatialIndex.hpp>
 #include <Scene/Component/Camera.hpp>
 #include <Scene/Component/Transform.hpp>
 #include <Scene/Component/Mesh.hpp>
@@ -20,153 +22,10 @@ namespace Component = Neon::Scene::Component;
 
 namespace Neon::RG
 {
-    /// <summary>
-    /// Create rendering query for specific component
-    /// </summary>
-    template<typename _ComponentTy, typename _RenderHandleTag = _ComponentTy>
-    static auto CreateRenderingQuery()
-    {
-        return Scene::EntityWorld::Get()
-            .query_builder<
-                const Component::Transform,
-                const _ComponentTy>()
-            .with<Component::ActiveSceneEntity>()
-            .in()
-            .and_()
-            .with<Scene::GPUTransformManager::RenderableHandle, _RenderHandleTag>()
-            .in()
-            .build();
-    }
-
-    /// <summary>
-    /// Create rendering query for specific component
-    /// </summary>
-    template<typename _ComponentTy, typename _RenderHandleTag = _ComponentTy>
-    static auto CreateRenderingRule()
-    {
-        return Scene::EntityWorld::Get()
-            .rule_builder<
-                const Component::Transform,
-                const _ComponentTy>("Query")
-            .with<Component::ActiveSceneEntity>()
-            .in()
-            .and_()
-            .with<Scene::GPUTransformManager::RenderableHandle, _ComponentTy>()
-            .in()
-            .build();
-    }
-
-    //
-
-    bool SceneContext::EntityInfo::CanRender(
-        RenderType PassType,
-        uint32_t   PassIndex) const
-    {
-        flecs::entity       Entity = Scene::EntityHandle(Id);
-        Ptr<RHI::IMaterial> Material;
-
-        switch (Type)
-        {
-        case EntityType::Mesh:
-        case EntityType::CSG:
-        {
-            if (Type == EntityType::Mesh)
-            {
-                Material = Entity.get<Component::MeshInstance>()->Mesh.GetMaterial();
-            }
-            else
-            {
-                Material = Entity.get<Component::CSGBrush>()->Brush.GetMesh().GetMaterial();
-            }
-            break;
-        }
-
-        default:
-        {
-            std::unreachable();
-        }
-        }
-
-        if (Material->IsCompute())
-        {
-            if (PassType != RenderType::RenderPass || PassIndex == 1)
-            {
-                return false;
-            }
-        }
-
-        return true;
-    }
-
-    auto SceneContext::EntityInfo::GetRenderInfo(
-        RHI::Views::Vertex& VtxView,
-        RHI::Views::Index&  IdxView) const -> EntityRenderInfo
-    {
-        EntityRenderInfo RenderInfo;
-
-        flecs::entity Entity = Scene::EntityHandle(Id);
-        switch (Type)
-        {
-        case EntityType::Mesh:
-        case EntityType::CSG:
-        {
-            const Mdl::Mesh* Mesh = nullptr;
-
-            if (Type == EntityType::Mesh)
-            {
-                Mesh = &Entity.get<Component::MeshInstance>()->Mesh;
-
-                RenderInfo.InstanceId = Entity.get<Scene::GPUTransformManager::RenderableHandle, Component::MeshInstance>()->InstanceId;
-            }
-            else
-            {
-                Mesh = &Entity.get<Component::CSGBrush>()->Brush.GetMesh();
-
-                RenderInfo.InstanceId = Entity.get<Scene::GPUTransformManager::RenderableHandle, Component::CSGBrush>()->InstanceId;
-            }
-
-            auto& MeshModel = Mesh->GetModel();
-            auto& MeshData  = Mesh->GetData();
-
-            RenderInfo.Material = Mesh->GetMaterial();
-            RenderInfo.Topology = MeshData.Topology;
-
-            VtxView.Append<Mdl::MeshVertex>(MeshModel->GetVertexBuffer(), MeshData.VertexOffset, MeshData.VertexCount);
-
-            if (MeshModel->HasSmallIndices())
-            {
-                IdxView = RHI::Views::IndexU16{ MeshModel->GetIndexBuffer(), MeshData.IndexOffset, MeshData.IndexCount };
-            }
-            else
-            {
-                IdxView = RHI::Views::IndexU32{ MeshModel->GetIndexBuffer(), MeshData.IndexOffset, MeshData.IndexCount };
-            }
-
-            break;
-        }
-
-        default:
-        {
-            std::unreachable();
-        }
-        }
-
-        return RenderInfo;
-    }
-
-    //
-
     SceneContext::SceneContext(
         const GraphStorage& Storage) :
-        m_Storage(Storage),
-        m_MeshQuery(CreateRenderingQuery<Component::MeshInstance>()),
-        m_CSGQuery(CreateRenderingQuery<Component::CSGBrush>())
-    {
-    }
-
-    SceneContext::~SceneContext()
+        m_Storage(Storage)
     {
-        m_MeshQuery.destruct();
     }
 
     //
@@ -175,7 +34,8 @@ namespace Neon::RG
         const Component::Camera&    Camera,
         const Component::Transform& Transform)
     {
-        m_EntityLists.clear();
+        m_CullCandidates.clear();
+        m_DrawQueue.Reset(0);
 
         switch (Camera.Type)
         {
@@ -184,56 +44,137 @@ namespace Neon::RG
             Geometry::Frustum Frustum(glm::transpose(m_Storage.GetFrameData().ProjectionInverse));
             Frustum.Transform(Transform);
 
-            m_MeshQuery.iter(
-                [&](flecs::iter&                   Iter,
-                    const Component::Transform*    Transforms,
-                    const Component::MeshInstance* Meshes)
+            Geometry::FrustumCuller Culler(Frustum);
+
+            // Only the entities whose proxies aren't outside the frustum are visited, the ones fully inside it are
+            // visible and the others are tested with their exact box.
+            // Their components are read here on the main thread, the jobs below only read the resolved draws and
+            // transforms, which stay in place since nothing can modify the world while the main thread waits for them
+            auto SpatialIndex = Runtime::GameLogic::Get()->GetSpatialIndex();
+            SpatialIndex->GetTree().QueryFrustum(
+                Culler.GetPlanes(),
+                [this, SpatialIndex](Geometry::DynamicBVH::ProxyId ProxyId,
+                                     uint64_t                      EntityId,
+                                     bool                          Inside)
                 {
-                    // TODO: Add instancing
-                    for (size_t i : Iter)
+                    flecs::entity Entity = Scene::EntityHandle(EntityId);
+                    if (!Entity.has<Component::ActiveSceneEntity>())
                     {
-                        auto& CurTransform = Transforms[i];
-                        auto& CurMesh      = Meshes[i].Mesh;
-                        auto  Box          = CurMesh.GetData().AABB;
+                        return true;
+                    }
 
-                        Box.Transform(CurTransform);
-                        if (Frustum.Contains(Box) != Geometry::ContainmentType::Disjoint)
+                    const Mdl::Mesh*                                    CurMesh = nullptr;
+                    const Scene::GPUTransformManager::RenderableHandle* Handle  = nullptr;
+                    switch (SpatialIndex->GetEntityType(ProxyId))
+                    {
+                    case Scene::SpatialIndex::EntityType::Mesh:
+                    {
+                        Handle = Entity.get<Scene::GPUTransformManager::RenderableHandle, Component::MeshInstance>();
+                        if (Handle)
                         {
-                            auto& Material      = CurMesh.GetMaterial();
-                            auto  PipelineState = Material->GetPipelineState(RHI::IMaterial::PipelineVariant::RenderPass).get();
-
-                            float Dist = glm::distance2(Transform.GetPosition(), CurTransform.GetPosition());
-                            m_EntityLists[PipelineState].emplace(Iter.entity(i), Dist, EntityType::Mesh);
+                            CurMesh = &Entity.get<Component::MeshInstance>()->Mesh;
                         }
+                        break;
                     }
-                });
-
-            m_CSGQuery.iter(
-                [&](flecs::iter&                Iter,
-                    const Component::Transform* Transforms,
-                    const Component::CSGBrush*  Brushes)
-                {
-                    for (size_t i : Iter)
+                    case Scene::SpatialIndex::EntityType::CSG:
                     {
-                        auto& CurTransform = Transforms[i];
-                        auto& CurMesh      = Brushes[i].Brush.GetMesh();
-                        if (!CurMesh.GetModel())
+                        Handle = Entity.get<Scene::GPUTransformManager::RenderableHandle, Component::CSGBrush>();
+                        if (Handle)
                         {
-                            continue;
+                            CurMesh = &Entity.get<Component::CSGBrush>()->Brush.GetMesh();
+                            if (!CurMesh->GetModel())
+                            {
+                                CurMesh = nullptr;
+                            }
                         }
-                        auto Box = CurMesh.GetData().AABB;
+                        break;
+                    }
+                    default:
+                        std::unreachable();
+                    }
 
+                    if (!CurMesh)
+                    {
+                        return true;
+                    }
+
+                    DrawQueue::DrawItem Item{
+                        .Material   = CurMesh->GetMaterial().get(),
+                        .Model      = CurMesh->GetModel().get(),
+                        .Data       = &CurMesh->GetData(),
+                        .InstanceId = Handle->InstanceId
+                    };
+                    m_CullCandidates.emplace_back(Item, Entity.get<Component::Transform>(), Inside);
+                    return true;
+                });
+
+            size_t ChunkCount = (m_CullCandidates.size() + s_CullChunkSize - 1) / s_CullChunkSize;
+            if (m_CullChunks.size() < ChunkCount)
+            {
+                m_CullChunks.resize(ChunkCount);
+            }
+            m_DrawQueue.Reset(ChunkCount);
+
+            auto CullTask = [&](size_t ChunkIndex)
+            {
+                auto& Chunk = m_CullChunks[ChunkIndex];
+                Chunk.Boxes.Clear();
+                Chunk.Items.clear();
+                Chunk.Dists.clear();
+
+                auto AddDraw = [&](const DrawQueue::DrawItem& Item, float Dist)
+                {
+                    auto PipelineState = Item.Material->GetPipelineState(RHI::IMaterial::PipelineVariant::RenderPass).get();
+                    m_DrawQueue.Add(ChunkIndex, Item, PipelineState, Item.Material->IsTransparent(), Dist);
+                };
+
+                size_t First      = ChunkIndex * s_CullChunkSize;
+                auto   Candidates = std::span(m_CullCandidates).subspan(First, std::min(s_CullChunkSize, m_CullCandidates.size() - First));
+                for (auto& Candidate : Candidates)
+                {
+                    auto& CurTransform = *Candidate.Transform;
+
+                    float Dist = glm::distance2(Transform.GetPosition(), CurTransform.GetPosition());
+                    if (Candidate.Inside)
+                    {
+                        AddDraw(Candidate.Item, Dist);
+                    }
+                    else
+                    {
+                        auto Box = Candidate.Item.Data->AABB;
                         Box.Transform(CurTransform);
-                        if (Frustum.Contains(Box) != Geometry::ContainmentType::Disjoint)
-                        {
-                            auto& Material      = CurMesh.GetMaterial();
-                            auto  PipelineState = Material->GetPipelineState(RHI::IMaterial::PipelineVariant::RenderPass).get();
 
-                            float Dist = glm::distance2(Transform.GetPosition(), CurTransform.GetPosition());
-                            m_EntityLists[PipelineState].emplace(Iter.entity(i), Dist, EntityType::CSG);
-                        }
+                        Chunk.Boxes.Add(Box);
+                        Chunk.Items.push_back(Candidate.Item);
+                        Chunk.Dists.push_back(Dist);
                     }
-                });
+                }
+
+                // Test the remaining boxes of the chunk at once
+                Chunk.Visibility.resize(Geometry::FrustumCuller::GetMaskSize(Chunk.Boxes.GetSize()));
+                Culler.Cull(Chunk.Boxes, Chunk.Visibility);
+
+                for (size_t i = 0; i < Chunk.Items.size(); i++)
+                {
+                    if (Chunk.Visibility[i / 64] & (uint64_t(1) << (i % 64)))
+                    {
+                        AddDraw(Chunk.Items[i], Chunk.Dists[i]);
+                    }
+                }
+            };
+
+            // Box transforms and tests dominate, each chunk is culled by its own job
+            Asio::JobGroup CullJobs;
+            for (size_t i = 0; i < ChunkCount; i++)
+            {
+                CullJobs.Run(
+                    [&CullTask, i]
+                    { CullTask(i); },
+                    { .priority = Asio::JobPriority::critical });
+            }
+            CullJobs.Wait();
+
+            m_DrawQueue.Build();
             break;
         }
         case Component::CameraType::Orthographic:
@@ -252,11 +193,14 @@ namespace Neon::RG
         RHI::GpuDescriptorHandle OpaqueLightDataHandle,
         RHI::GpuDescriptorHandle TransparentLightDataHandle) const
     {
-        if (m_EntityLists.empty())
+        auto Batches = m_DrawQueue.GetBatches();
+        if (Batches.empty())
         {
             return;
         }
 
+        auto InstanceIds = m_DrawQueue.GetInstanceIds();
+
         auto& GpuTransformManager = Runtime::GameLogic::Get()->GetGPUScene()->GetTransformManager();
         auto& GpuLightManager     = Runtime::GameLogic::Get()->GetGPUScene()->GetLightManager();
 
@@ -344,67 +288,76 @@ namespace Neon::RG
             }
 #endif
 
-            for (auto& EntityList : m_EntityLists | std::views::values)
+            for (auto& Batch : Batches)
             {
+                auto Material = Batch.Material;
+
                 // Ignore compute pipeline state on transparent / depthprepass
-                if (!EntityList.begin()->CanRender(Type, Pass))
+                if (Material->IsCompute() && (Type != RenderType::RenderPass || Pass == 1))
                 {
                     continue;
                 }
 
-                for (auto& Info : EntityList)
+                // Pass == 0 opaque materials
+                // Pass == 1 transparent materials
+                if ((Material->IsTransparent() ? 1 : 0) != Pass)
                 {
-                    RHI::Views::Vertex VtxView;
-                    RHI::Views::Index  IdxView;
+                    continue;
+                }
 
-                    auto RenderInfo = Info.GetRenderInfo(VtxView, IdxView);
+                BindRootSignatureOnce(!Material->IsCompute());
+                BindLightOnce(Material->IsTransparent(), !Material->IsCompute());
+                BindPipelineStateOnce(Material->GetPipelineState(Passes[Pass]));
 
-                    // Pass == 0 opaque materials
-                    // Pass == 1 transparent materials
-                    if ((RenderInfo.Material->IsTransparent() ? 1 : 0) != Pass)
+                // Update shared params
+                {
+                    // Update PerInstanceData, the instances of the batch are next to each other
                     {
-                        continue;
+                        CommandList->SetResourceView(
+                            !Material->IsCompute(),
+                            RHI::CstResourceViewType::Srv,
+                            uint32_t(RHI::RSCommon::MaterialRS::InstanceData),
+                            GpuTransformManager.GetInstancesHandle(InstanceIds.subspan(Batch.FirstInstance, Batch.InstanceCount)));
                     }
 
-                    BindRootSignatureOnce(!RenderInfo.Material->IsCompute());
-                    BindLightOnce(RenderInfo.Material->IsTransparent(), !RenderInfo.Material->IsCompute());
-                    BindPipelineStateOnce(RenderInfo.Material->GetPipelineState(Passes[Pass]));
-
-                    // Update shared params
+                    // Update Local and shared data
                     {
-                        // Update PerInstanceData
-                        {
-                            CommandList->SetResourceView(
-                                !RenderInfo.Material->IsCompute(),
-                                RHI::CstResourceViewType::Srv,
-                                uint32_t(RHI::RSCommon::MaterialRS::InstanceData),
-                                GpuTransformManager.GetInstanceHandle(RenderInfo.InstanceId));
-                        }
-
-                        // Update Local and shared data
-                        {
-                            RenderInfo.Material->ReallocateShared();
-                            RenderInfo.Material->ReallocateLocal();
-
-                            CommandList->SetResourceView(
-                                !RenderInfo.Material->IsCompute(),
-                                RHI::CstResourceViewType::Cbv,
-                                uint32_t(RHI::RSCommon::MaterialRS::SharedData),
-                                RenderInfo.Material->GetSharedBlock());
-
-                            CommandList->SetResourceView(
-                                !RenderInfo.Material->IsCompute(),
-                                RHI::CstResourceViewType::Srv,
-                                uint32_t(RHI::RSCommon::MaterialRS::LocalData),
-                                RenderInfo.Material->GetLocalBlock());
-                        }
+                        Material->ReallocateShared();
+                        Material->ReallocateLocal();
+
+                        CommandList->SetResourceView(
+                            !Material->IsCompute(),
+                            RHI::CstResourceViewType::Cbv,
+                            uint32_t(RHI::RSCommon::MaterialRS::SharedData),
+                            Material->GetSharedBlock());
+
+                        CommandList->SetResourceView(
+                            !Material->IsCompute(),
+                            RHI::CstResourceViewType::Srv,
+                            uint32_t(RHI::RSCommon::MaterialRS::LocalData),
+                            Material->GetLocalBlock());
                     }
+                }
+
+                RHI::Views::Vertex VtxView;
+                RHI::Views::Index  IdxView;
 
-                    CommandList->SetPrimitiveTopology(RenderInfo.Topology);
-                    CommandList->SetIndexBuffer(IdxView);
-                    CommandList->SetVertexBuffer(0, VtxView);
-                    CommandList->Draw(RHI::DrawIndexArgs{ .IndexCountPerInstance = uint32_t(IdxView.Get().Size / (IdxView.Get().Is32Bit ? sizeof(uint32_t) : sizeof(uint16_t))) });
+                VtxView.Append<Mdl::MeshVertex>(Batch.Model->GetVertexBuffer(), Batch.Data->VertexOffset, Batch.Data->VertexCount);
+                if (Batch.Model->HasSmallIndices())
+                {
+                    IdxView = RHI::Views::IndexU16{ Batch.Model->GetIndexBuffer(), Batch.Data->IndexOffset, Batch.Data->IndexCount };
+                }
+                else
+                {
+                    IdxView = RHI::Views::IndexU32{ Batch.Model->GetIndexBuffer(), Batch.Data->IndexOffset, Batch.Data->IndexCount };
                 }
+
+                CommandList->SetPrimitiveTopology(Batch.Data->Topology);
+                CommandList->SetIndexBuffer(IdxView);
+                CommandList->SetVertexBuffer(0, VtxView);
+                CommandList->Draw(RHI::DrawIndexArgs{
+                    .IndexCountPerInstance = uint32_t(IdxView.Get().Size / (IdxView.Get().Is32Bit ? sizeof(uint32_t) : sizeof(uint16_t))),
+                    .InstanceCount         = Batch.InstanceCount });
             }
 
 #ifndef NEON_DIST
@@ -0,0 +1,207 @@
+#include <EnginePCH.hpp>
+#include <RenderGraph/Transitions.hpp>
+
+#include <map>
+#include <numeric>
+
+namespace Neon::RG
+{
+    namespace
+    {
+        /// <summary>
+        /// Last known value of every subresource, Resource_AllSubresources holds the value of the subresources that
+        /// weren't set on their own since the whole resource was.
+        /// </summary>
+        template<typename _Ty>
+        class SubresourceTracker
+        {
+        public:
+            /// <summary>
+            /// Find the value of a subresource, null if it is unknown.
+            /// The whole resource is only known if no subresource was set on its own since it was.
+            /// </summary>
+            [[nodiscard]] _Ty* Find(
+                const ResourceId& Resource,
+                uint32_t          Subresource)
+            {
+                auto Iter = m_Values.find(Resource);
+                if (Iter == m_Values.end())
+                {
+                    return nullptr;
+                }
+
+                auto& Subresources = Iter->second;
+                if (Subresource == RHI::Resource_AllSubresources)
+                {
+                    return Subresources.size() == 1 && Subresources.begin()->first == RHI::Resource_AllSubresources
+                               ? &Subresources.begin()->second
+                               : nullptr;
+                }
+
+                auto Value = Subresources.find(Subresource);
+                if (Value == Subresources.end())
+                {
+                    Value = Subresources.find(RHI::Resource_AllSubresources);
+                }
+                return Value != Subresources.end() ? &Value->second : nullptr;
+            }
+
+            /// <summary>
+            /// Set the value of a subresource, or of every subresource
+            /// </summary>
+            void Set(
+                const ResourceId& Resource,
+                uint32_t          Subresource,
+                const _Ty&        Value)
+            {
+                auto& Subresources = m_Values[Resource];
+                if (Subresource == RHI::Resource_AllSubresources)
+                {
+                    Subresources.clear();
+                }
+                Subresources.insert_or_assign(Subresource, Value);
+            }
+
+        private:
+            std::map<ResourceId, std::map<uint32_t, _Ty>> m_Values;
+        };
+    } // namespace
+
+    //
+
+    void TransitionPlan::Reset(
+        uint32_t LevelCount)
+    {
+        m_Requests.clear();
+        m_Transitions.clear();
+        m_LevelOffsets.assign(LevelCount + 1, 0);
+    }
+
+    void TransitionPlan::Add(
+        uint32_t                   Level,
+        const ResourceId&          Resource,
+        uint32_t                   Subresource,
+        const RHI::MResourceState& State)
+    {
+        NEON_ASSERT(Level < GetLevelCount(), "Level out of range");
+        m_Requests.emplace_back(Request{ .Level = Level, .Resource = Resource, .Subresource = Subresource, .State = State });
+    }
+
+    void TransitionPlan::Build()
+    {
+        struct TrackedState
+        {
+            RHI::MResourceState State;
+            uint32_t            LastLevel;
+        };
+
+        SubresourceTracker<TrackedState> Tracker;
+
+        m_Transitions.clear();
+        std::ranges::fill(m_LevelOffsets, 0);
+
+        for (auto& Req : MergeRequests())
+        {
+            auto Previous = Tracker.Find(Req.Resource, Req.Subresource);
+            if (Previous && IsRedundant(Previous->State, Req.State))
+            {
+                Previous->LastLevel = Req.Level;
+                continue;
+            }
+
+            m_Transitions.emplace_back(Transition{
+                .Resource    = Req.Resource,
+                .Subresource = Req.Subresource,
+                .Before      = Previous ? Previous->State : RHI::MResourceState{},
+                .After       = Req.State,
+                .BeginLevel  = Previous ? std::min(Previous->LastLevel + 1, Req.Level) : Req.Level,
+                .HasBefore   = Previous != nullptr });
+
+            Tracker.Set(Req.Resource, Req.Subresource, { .State = Req.State, .LastLevel = Req.Level });
+            m_LevelOffsets[Req.Level + 1]++;
+        }
+
+        std::partial_sum(m_LevelOffsets.begin(), m_LevelOffsets.end(), m_LevelOffsets.begin());
+    }
+
+    bool TransitionPlan::Validate() const
+    {
+        SubresourceTracker<RHI::MResourceState> Expected, Planned;
+
+        // Transitions are planned in the order of the merged requests, at most one per request
+        auto Trans = m_Transitions.begin();
+        for (auto& Req : MergeRequests())
+        {
+            if (Trans != m_Transitions.end() &&
+                Trans->Resource.Get() == Req.Resource.Get() &&
+                Trans->Subresource == Req.Subresource &&
+                Trans - m_Transitions.begin() < m_LevelOffsets[Req.Level + 1])
+            {
+                auto Before = Planned.Find(Trans->Resource, Trans->Subresource);
+                if (Trans->HasBefore ? (!Before || *Before != Trans->Before) : Before != nullptr)
+                {
+                    return false;
+                }
+                Planned.Set(Trans->Resource, Trans->Subresource, Trans->After);
+                ++Trans;
+            }
+
+            // The tracker sees every request, like the state manager did when each level transitioned all its states
+            auto Current = Expected.Find(Req.Resource, Req.Subresource);
+            if (!Current || !IsRedundant(*Current, Req.State))
+            {
+                Expected.Set(Req.Resource, Req.Subresource, Req.State);
+                Current = Expected.Find(Req.Resource, Req.Subresource);
+            }
+
+            auto State = Planned.Find(Req.Resource, Req.Subresource);
+            if (!State || *State != *Current)
+            {
+                return false;
+            }
+        }
+
+        return Trans == m_Transitions.end();
+    }
+
+    //
+
+    bool TransitionPlan::IsRedundant(
+        const RHI::MResourceState& Current,
+        const RHI::MResourceState& New)
+    {
+        static const RHI::MResourceState s_ReadOnlyStates =
+            RHI::MResourceState_GenericRead | RHI::MResourceState::FromEnum(RHI::EResourceState::DepthRead);
+
+        return Current == New || (Current.TestAny(s_ReadOnlyStates) && Current.TestAll(New));
+    }
+
+    auto TransitionPlan::MergeRequests() const -> std::vector<Request>
+    {
+        auto Requests = m_Requests;
+        std::ranges::stable_sort(
+            Requests,
+            [](const Request& A, const Request& B)
+            {
+                return std::tuple(A.Level, A.Resource.Get(), A.Subresource) < std::tuple(B.Level, B.Resource.Get(), B.Subresource);
+            });
+
+        std::vector<Request> Merged;
+        Merged.reserve(Requests.size());
+        for (auto& Req : Requests)
+        {
+            if (!Merged.empty() &&
+                Merged.back().Level == Req.Level &&
+                Merged.back().Resource.Get() == Req.Resource.Get() &&
+                Merged.back().Subresource == Req.Subresource)
+            {
+                Merged.back().State |= Req.State;
+            }
+            else
+            {
+                Merged.emplace_back(Req);
+            }
+        }
+        return Merged;
+    }
+} // namespace Neon::RG
\ No newline at end of file
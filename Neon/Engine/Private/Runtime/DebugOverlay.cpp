@@ -14,6 +14,7 @@
 #include <RHI/RootSignature.hpp>
 #include <RHI/PipelineState.hpp>
 
+#include <Allocator/MemoryResource.hpp>
 #include <Log/Logger.hpp>
 
 namespace Neon::Runtime
@@ -38,8 +39,9 @@ namespace Neon::Runtime
         {
             Ptr<RHI::IPipelineState> PipelineState;
 
-            std::multimap<float, std::pair<LineArgs, bool>> m_TimedLines;
-            std::vector<UPtr<RHI::IGpuResource>>            VertexBuffers;
+            Allocator::PoolResource                              m_TimedLineNodes{ 128 };
+            std::pmr::multimap<float, std::pair<LineArgs, bool>> m_TimedLines{ &m_TimedLineNodes };
+            std::vector<UPtr<RHI::IGpuResource>>                 VertexBuffers;
 
             Overlay_Debug_Line::Vertex* VertexBufferPtr = nullptr;
             uint32_t                    DrawCount       = 0;
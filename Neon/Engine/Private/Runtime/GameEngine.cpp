@@ -3,11 +3,14 @@
 #include <Runtime/GameLogic.hpp>
 #include <Runtime/DebugOverlay.hpp>
 #include <Script/Engine.hpp>
+#include <Asio/JobSystem.hpp>
+#include <Allocator/Arena.hpp>
 
 //
 
 #include <Asset/Manager.hpp>
 #include <Asset/Storage.hpp>
+#include <Asset/Residency.hpp>
 
 #include <Asset/Handlers/Json.hpp>
 #include <Asset/Handlers/Logger.hpp>
@@ -40,6 +43,9 @@ namespace Neon::Runtime
         NEON_ASSERT(!s_GameEngine);
         s_GameEngine = this;
 
+        // Initialize the job system
+        Asio::JobSystem::Initialize();
+
         // Initialize the asset system
         Asset::Storage::Initialize();
     }
@@ -70,6 +76,12 @@ namespace Neon::Runtime
         // Shutdown the window
         m_Window.reset();
 
+        // Shutdown the job system
+        Asio::JobSystem::Shutdown();
+
+        // Release the frame allocators, nothing can use them anymore
+        Allocator::FrameArena::Shutdown();
+
         NEON_ASSERT(s_GameEngine);
         s_GameEngine = nullptr;
     }
@@ -126,6 +138,7 @@ namespace Neon::Runtime
             m_Window->ProcessEvents();
             if (m_GameTimer.Tick())
             {
+                Allocator::FrameArena::NewFrame();
                 Runtime::DebugOverlay::Reset();
 
                 PreUpdate();
@@ -174,11 +187,6 @@ namespace Neon::Runtime
         return m_Logic.get();
     }
 
-    Asio::ThreadPool<>& GameEngine::GetThreadPool() noexcept
-    {
-        return m_ThreadPool;
-    }
-
     void GameEngine::LoadPacks(
         Config::EngineConfig& Config)
     {
@@ -203,6 +211,8 @@ namespace Neon::Runtime
 
         //
 
+        Asset::Residency::SetBudget(Config.Resource.ResidencyBudget);
+
         LoadPacks(Config);
         if (Config.Resource.LoggerAssetUid)
         {
@@ -201,5 +201,8 @@ namespace Neon::Runtime
     {
         float DeltaTime = float(Runtime::GameEngine::Get()->GetDeltaTime());
         EntityWorld::Get().progress(DeltaTime);
+
+        // Entities loaded this frame were inserted one by one, rebuild the tree if they make up most of it
+        m_SpatialIndex.Optimize();
     }
 } // namespace Neon::Runtime
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <EnginePCH.hpp>
 #include <Runtime/Pipeline.hpp>
 #include <Runtime/PipelineBuilder.hpp>
+#include <Asio/JobSystem.hpp>
 
 #include <queue>
 #include <execution>
@@ -13,9 +14,7 @@ namespace views  = std::views;
 namespace Neon::Runtime
 {
     EnginePipeline::EnginePipeline(
-        EnginePipelineBuilder Builder,
-        uint32_t              ThreadCount) :
-        m_ThreadPool(ThreadCount)
+        EnginePipelineBuilder Builder)
     {
         std::queue<EnginePipelineBuilder::PipelinePhase*> CurrentLevel;
 
@@ -62,6 +61,7 @@ namespace Neon::Runtime
     {
         for (auto& Passes : m_Levels)
         {
+            Asio::JobGroup AsyncPhases;
             for (size_t i = 0; i < Passes.size(); i++)
             {
                 auto Phase = Passes[i];
@@ -84,21 +84,17 @@ namespace Neon::Runtime
                     }
                     else
                     {
-                        auto Task = [](PipelinePhase* Phase)
-                        {
-                            std::scoped_lock Lock(Phase->Mutex);
-                            Phase->Signal.Broadcast();
-                        };
-                        m_AsyncPhases.emplace_back(m_ThreadPool.enqueue(Task, Phase));
+                        AsyncPhases.Run(
+                            [Phase]
+                            {
+                                std::scoped_lock Lock(Phase->Mutex);
+                                Phase->Signal.Broadcast();
+                            });
                     }
                 }
             }
 
-            for (auto& Task : m_AsyncPhases)
-            {
-                Task.get();
-            }
-            m_AsyncPhases.clear();
+            AsyncPhases.Wait();
 
             for (auto Phase : m_NonAsyncPhases)
             {
@@ -97,8 +97,20 @@ namespace Neon::Scene
     RHI::GpuResourceHandle GPUTransformManager::GetInstanceHandle(
         uint32_t InstanceId) const
     {
-        RHI::UBufferPoolHandle TempBuffer(SizeOfInstanceData, AlignOfInstanceData, RHI::IGlobalBufferPool::BufferType::ReadWriteGPUR);
-        TempBuffer.AsUpload().Write(TempBuffer.Offset, GetInstanceData(InstanceId), SizeOfInstanceData);
-        return TempBuffer.GetGpuHandle();
+        return RHI::IGlobalBufferPool::UploadFrame(GetInstanceData(InstanceId), SizeOfInstanceData, AlignOfInstanceData);
+    }
+
+    RHI::GpuResourceHandle GPUTransformManager::GetInstancesHandle(
+        std::span<const uint32_t> InstanceIds) const
+    {
+        auto Hndl = RHI::IGlobalBufferPool::AllocateFrame(SizeOfInstanceData * InstanceIds.size(), AlignOfInstanceData);
+        for (size_t i = 0; i < InstanceIds.size(); i++)
+        {
+            std::copy_n(
+                std::bit_cast<const uint8_t*>(GetInstanceData(InstanceIds[i])),
+                SizeOfInstanceData,
+                Hndl.CpuAddress + i * SizeOfInstanceData);
+        }
+        return Hndl.GpuHandle;
     }
 } // namespace Neon::Scene
\ No newline at end of file
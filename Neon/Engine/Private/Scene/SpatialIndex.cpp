@@ -0,0 +1,129 @@
+#include <EnginePCH.hpp>
+#include <Scene/SpatialIndex.hpp>
+
+#include <Scene/Component/Transform.hpp>
+#include <Scene/Component/Mesh.hpp>
+#include <Scene/Component/CSG.hpp>
+
+namespace Neon::Scene
+{
+    [[nodiscard]] static const Mdl::Mesh* GetRenderMesh(
+        const Component::MeshInstance& Instance)
+    {
+        return &Instance.Mesh;
+    }
+
+    [[nodiscard]] static const Mdl::Mesh* GetRenderMesh(
+        const Component::CSGBrush& Brush)
+    {
+        auto& Mesh = Brush.Brush.GetMesh();
+        return Mesh.GetModel() ? &Mesh : nullptr;
+    }
+
+    template<typename _ComponentTy, SpatialIndex::EntityType _Type>
+    static void HandleSpatialProxy(
+        SpatialIndex* Index)
+    {
+        using ProxyHandle = SpatialIndex::ProxyHandle;
+
+        auto HandleProxyCallback = [Index](flecs::iter& Iter, const Component::Transform* Transforms)
+        {
+            for (size_t i : Iter)
+            {
+                auto Entity = Iter.entity(i);
+                auto Handle = Entity.get_mut<ProxyHandle, _ComponentTy>();
+
+                if (Iter.event() == flecs::OnSet)
+                {
+                    auto Component = Entity.get<_ComponentTy>();
+                    auto Mesh      = Component ? GetRenderMesh(*Component) : nullptr;
+                    if (!Mesh)
+                    {
+                        Index->Update(Entity, *Handle, _Type, nullptr);
+                        continue;
+                    }
+
+                    auto Box = Mesh->GetData().AABB;
+                    Box.Transform(Transforms[i]);
+                    Index->Update(Entity, *Handle, _Type, &Box);
+                }
+                else
+                {
+                    Index->Remove(*Handle);
+                    Entity.remove<ProxyHandle, _ComponentTy>();
+                }
+            }
+        };
+
+        EntityWorld::Get()
+            .observer<const Component::Transform>()
+            .with<_ComponentTy>()
+            .in()
+            .event(flecs::OnSet)
+            .event(flecs::OnRemove)
+            .iter(HandleProxyCallback);
+    }
+
+    SpatialIndex::SpatialIndex()
+    {
+        // Register the proxy handle component.
+        EntityWorld::Get()
+            .component<ProxyHandle>("_SpatialProxyHandle");
+
+        // Create observer for the transform and renderable components.
+        HandleSpatialProxy<Component::MeshInstance, EntityType::Mesh>(this);
+        HandleSpatialProxy<Component::CSGBrush, EntityType::CSG>(this);
+    }
+
+    void SpatialIndex::Update(
+        flecs::entity         Entity,
+        ProxyHandle&          Handle,
+        EntityType            Type,
+        const Geometry::AABB* Box)
+    {
+        if (!Box)
+        {
+            Remove(Handle);
+            return;
+        }
+
+        if (Handle.Valid())
+        {
+            m_Tree.Move(Handle.ProxyId, *Box);
+            return;
+        }
+
+        Handle.ProxyId = m_Tree.Insert(*Box, Entity.id());
+        if (m_EntityTypes.size() <= Handle.ProxyId)
+        {
+            m_EntityTypes.resize(Handle.ProxyId + 1);
+        }
+        m_EntityTypes[Handle.ProxyId] = Type;
+        m_InsertsSinceRebuild++;
+    }
+
+    void SpatialIndex::Remove(
+        ProxyHandle& Handle)
+    {
+        if (Handle.Valid())
+        {
+            m_Tree.Remove(Handle.ProxyId);
+            Handle.ProxyId = Geometry::DynamicBVH::s_NullProxy;
+        }
+    }
+
+    void SpatialIndex::Rebuild()
+    {
+        m_Tree.Rebuild();
+        m_InsertsSinceRebuild = 0;
+    }
+
+    void SpatialIndex::Optimize()
+    {
+        if (m_InsertsSinceRebuild >= s_RebuildThreshold &&
+            m_InsertsSinceRebuild * 2 >= m_Tree.GetProxyCount())
+        {
+            Rebuild();
+        }
+    }
+} // namespace Neon::Scene
\ No newline at end of file
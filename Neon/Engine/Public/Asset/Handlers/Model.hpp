@@ -5,5 +5,45 @@
 
 namespace Neon::Asset
 {
-    NEON_STANDARD_ASSET_HANDLER(ModelAsset::Handler);
+    class ModelAsset::Handler : public IAssetHandler
+    {
+    public:
+        enum class LoadMode : uint8_t
+        {
+            /// <summary>
+            /// Create the gpu model, the cooked data is released once it is uploaded.
+            /// </summary>
+            Gpu,
+
+            /// <summary>
+            /// Create the gpu model and keep the cooked data to save the model back.
+            /// </summary>
+            GpuAndCooked,
+
+            /// <summary>
+            /// Only read the cooked data, for offline tools that run without a render device.
+            /// </summary>
+            CookedOnly
+        };
+
+        Handler(
+            LoadMode Mode = LoadMode::Gpu);
+
+        NEON_STANDARD_ASSET_HANDLER_BODY;
+
+        uint32_t GetVersion() const override;
+
+    public:
+        /// <summary>
+        /// Read a cooked model from a stream, or import it from its source file (not available in dist builds).
+        /// Imported models are cached by content in the temp directory, UseCache skips that cache altogether.
+        /// </summary>
+        [[nodiscard]] static Ptr<Mdl::CookedModel> LoadCooked(
+            std::istream&   Stream,
+            const StringU8& Path,
+            bool            UseCache = true);
+
+    private:
+        LoadMode m_Mode;
+    };
 } // namespace Neon::Asset
\ No newline at end of file
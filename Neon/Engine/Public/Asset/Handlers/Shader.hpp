@@ -5,5 +5,11 @@
 
 namespace Neon::Asset
 {
-    NEON_STANDARD_ASSET_HANDLER(ShaderAsset::Handler);
+    class ShaderAsset::Handler : public IAssetHandler
+    {
+    public:
+        NEON_STANDARD_ASSET_HANDLER_BODY;
+
+        bool IsPassthrough() const override;
+    };
 } // namespace Neon::Asset
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include <Asset/Asset.hpp>
 #include <Mdl/Model.hpp>
 
+namespace Neon::Mdl
+{
+    class CookedModel;
+} // namespace Neon::Mdl
+
 namespace Neon::Asset
 {
     class ModelAsset : public IAsset
@@ -10,24 +15,45 @@ namespace Neon::Asset
     public:
         class Handler;
 
+        /// <summary>
+        /// The cooked data is only needed to save the model back, and the model is not created by offline tools,
+        /// see ModelAsset::Handler::LoadMode.
+        /// </summary>
         ModelAsset(
-            Ptr<Mdl::Model> Model,
-            const Handle&        AssetGuid,
-            StringU8             Path) :
+            Ptr<Mdl::Model>             Model,
+            Ptr<const Mdl::CookedModel> CookedData,
+            size_t                      ModelSize,
+            const Handle&               AssetGuid,
+            StringU8                    Path) :
             IAsset(AssetGuid, Path),
-            m_Model(std::move(Model))
+            m_Model(std::move(Model)),
+            m_CookedData(std::move(CookedData)),
+            m_ModelSize(ModelSize)
         {
         }
 
         /// <summary>
-        /// Get the model from this asset.
+        /// Get the model from this asset, null if it was loaded with ModelAsset::Handler::LoadMode::CookedOnly.
         /// </summary>
         [[nodiscard]] const Ptr<Mdl::Model>& GetModel() const
         {
             return m_Model;
         }
 
+        /// <summary>
+        /// Get the cooked data the model was created from.
+        /// Null unless the handler was created to keep it, see ModelAsset::Handler::LoadMode.
+        /// </summary>
+        [[nodiscard]] const Ptr<const Mdl::CookedModel>& GetCookedData() const
+        {
+            return m_CookedData;
+        }
+
+        [[nodiscard]] size_t GetResidentSize() const noexcept override;
+
     private:
-        Ptr<Mdl::Model> m_Model;
+        Ptr<Mdl::Model>             m_Model;
+        Ptr<const Mdl::CookedModel> m_CookedData;
+        size_t                      m_ModelSize = 0;
     };
 } // namespace Neon::Asset
\ No newline at end of file
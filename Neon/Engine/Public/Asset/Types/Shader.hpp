@@ -2,6 +2,7 @@
 
 #include <Asset/Asset.hpp>
 #include <Asset/Handler.hpp>
+#include <Asset/Types/ShaderCache.hpp>
 #include <RHI/Shader.hpp>
 
 namespace Neon::Asset
@@ -28,16 +29,10 @@ namespace Neon::Asset
         /// </summary>
         void ClearCache();
 
-    private:
-        /// <summary>
-        /// Open the shader cache file
-        /// </summary>
-        void OpenCacheFile(
-            bool Reset = false);
+        [[nodiscard]] size_t GetResidentSize() const noexcept override;
 
     private:
-        std::fstream m_ShaderCacheFile;
-        size_t       m_ShaderCacheSize = 0;
-        StringU8     m_ShaderCode;
+        StringU8    m_ShaderCode;
+        ShaderCache m_Cache;
     };
 } // namespace Neon::Asset
\ No newline at end of file
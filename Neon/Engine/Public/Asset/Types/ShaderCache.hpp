@@ -0,0 +1,132 @@
+#pragma once
+
+#include <Asset/Handle.hpp>
+#include <Crypto/Hash128.hpp>
+#include <RHI/Shader.hpp>
+
+#include <filesystem>
+#include <shared_mutex>
+#include <optional>
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// On-disk cache of the compiled permutations of a shader.
+    /// Bytecode is appended to a data file, and an index file maps each permutation key to its bytecode and to the
+    /// files it included when it was compiled, an entry is stale once any of its includes changed.
+    /// </summary>
+    class ShaderCache
+    {
+    public:
+        static constexpr uint32_t s_Magic   = 0x4943534E; // 'NSCI'
+        static constexpr uint32_t s_Version = 1;
+
+        /// <summary>
+        /// Compact the data file once dead entries take more than this many bytes and half of the file.
+        /// </summary>
+        static constexpr uint64_t s_CompactThreshold = 1 << 20;
+
+        using Key = Crypto::Hash128::Bytes;
+
+        struct IncludeInfo
+        {
+            StringU8               Path;
+            Crypto::Hash128::Bytes Hash;
+        };
+
+        struct Entry
+        {
+            uint64_t                 Offset = 0;
+            uint64_t                 Size   = 0;
+            std::vector<IncludeInfo> Includes;
+        };
+
+    public:
+        ShaderCache(
+            const Handle&   AssetGuid,
+            const StringU8& SourceCode);
+
+        NEON_CLASS_NO_COPYMOVE(ShaderCache);
+
+        ~ShaderCache() = default;
+
+        /// <summary>
+        /// Get the key of a permutation, covering its stage, profile, flags, defines and include directory.
+        /// </summary>
+        [[nodiscard]] static Key GetKey(
+            const RHI::ShaderCompileDesc& Desc,
+            const StringU8&               IncludeDirectory);
+
+        /// <summary>
+        /// Load a permutation from the cache, returns null if it is missing or one of its includes changed.
+        /// Safe to call from multiple threads.
+        /// </summary>
+        [[nodiscard]] UPtr<RHI::IShader> Load(
+            const Key& PermutationKey);
+
+        /// <summary>
+        /// Store a permutation in the cache, replacing the previous one.
+        /// </summary>
+        void Store(
+            const Key&                    PermutationKey,
+            const RHI::IShader::ByteCode& ByteCode,
+            std::span<const StringU8>     Includes);
+
+        /// <summary>
+        /// Remove every permutation and forget the include hashes.
+        /// </summary>
+        void Reset();
+
+        /// <summary>
+        /// Rewrite the data file without the bytecode of replaced permutations.
+        /// </summary>
+        void Compact();
+
+    private:
+        /// <summary>
+        /// Read the index file, returns false if it is missing, corrupted or for another source.
+        /// </summary>
+        [[nodiscard]] bool ReadIndex();
+
+        /// <summary>
+        /// Write the index file.
+        /// </summary>
+        void WriteIndex() const;
+
+        /// <summary>
+        /// Clear the cache, the lock must be held.
+        /// </summary>
+        void ResetLocked();
+
+        /// <summary>
+        /// Compact the data file, the lock must be held.
+        /// </summary>
+        void CompactLocked();
+
+        /// <summary>
+        /// Get the hash of an included file's current content.
+        /// Hashes are memoized until the file's write time changes.
+        /// </summary>
+        [[nodiscard]] Crypto::Hash128::Bytes GetIncludeHash(
+            const StringU8& Path);
+
+    private:
+        std::filesystem::path  m_DataPath;
+        std::filesystem::path  m_IndexPath;
+        Crypto::Hash128::Bytes m_SourceHash;
+
+        mutable std::shared_mutex      m_Mutex;
+        std::unordered_map<Key, Entry> m_Entries;
+        uint64_t                       m_DataSize = 0;
+        uint64_t                       m_DeadSize = 0;
+
+        struct IncludeStamp
+        {
+            std::optional<std::filesystem::file_time_type> WriteTime;
+            Crypto::Hash128::Bytes                         Hash;
+        };
+
+        std::mutex                                 m_IncludeMutex;
+        std::unordered_map<StringU8, IncludeStamp> m_IncludeHashes;
+    };
+} // namespace Neon::Asset
\ No newline at end of file
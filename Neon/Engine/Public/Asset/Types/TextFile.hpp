@@ -28,6 +28,8 @@ namespace Neon::Asset
         [[nodiscard]] void Set(
             const StringU8& Text);
 
+        [[nodiscard]] size_t GetResidentSize() const noexcept override;
+
     private:
         StringU8 m_Text;
     };
@@ -33,6 +33,8 @@ namespace Neon::Asset
         /// </summary>
         [[nodiscard]] const RHI::SSyncGpuResource& GetTexture() const;
 
+        [[nodiscard]] size_t GetResidentSize() const noexcept override;
+
     private:
         RHI::TextureRawImage       m_ImageInfo;
         std::unique_ptr<uint8_t[]> m_ImageData;
@@ -2,6 +2,7 @@
 
 #include <Asset/Pack.hpp>
 #include <Asset/Handle.hpp>
+#include <Asset/Residency.hpp>
 #include <vector>
 
 namespace Neon::Config
@@ -10,6 +11,11 @@ namespace Neon::Config
     {
         std::vector<UPtr<Asset::IAssetPackage>> AssetPackages;
 
+        /// <summary>
+        /// Budget in bytes of the assets kept loaded by the packages, unreferenced assets over it are evicted.
+        /// </summary>
+        size_t ResidencyBudget = Asset::Residency::s_Unlimited;
+
         std::optional<Asset::Handle> LoggerAssetUid = Asset::Handle::FromString("896dc3ed-263d-4a0e-9f16-b127ecd87619");
     };
 } // namespace Neon::Config
\ No newline at end of file
@@ -84,6 +84,11 @@ namespace Neon::Editor
         /// </summary>
         [[nodiscard]] std::filesystem::path GetContentDirectoryPath() const;
 
+        /// <summary>
+        /// Gets the intermediate directory path, for files generated from the content. ("./Intermediate")
+        /// </summary>
+        [[nodiscard]] std::filesystem::path GetIntermediateDirectoryPath() const;
+
     public:
         /// <summary>
         /// Gets the project config.
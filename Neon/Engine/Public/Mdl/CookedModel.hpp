@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Mdl/Model.hpp>
+#include <iosfwd>
+
+namespace Neon::Mdl
+{
+    struct CookedMaterialParameter
+    {
+        StringU8 Name;
+        uint32_t Components = 4;
+        Vector4  Value{};
+    };
+
+    struct CookedMaterialTexture
+    {
+        /// <summary>
+        /// Name of the texture slot in the material.
+        /// </summary>
+        StringU8 Name;
+
+        /// <summary>
+        /// Path of the texture file, used if the texture is not embedded.
+        /// </summary>
+        StringU8 Path;
+
+        /// <summary>
+        /// Embedded texture data as R8G8B8A8.
+        /// </summary>
+        std::vector<uint8_t> Data;
+
+        uint32_t Width  = 0;
+        uint32_t Height = 0;
+    };
+
+    struct CookedMaterial
+    {
+        StringU8                             Name;
+        std::vector<CookedMaterialParameter> Parameters;
+        std::vector<CookedMaterialTexture>   Textures;
+    };
+
+    /// <summary>
+    /// CPU side representation of a model that can be written to and read from a binary stream.
+    /// Cooked models are produced once from the source file and loaded without going through assimp.
+    /// </summary>
+    class CookedModel
+    {
+    public:
+        static constexpr uint32_t Magic   = 0x4C444D4E; // 'NMDL'
+        static constexpr uint32_t Version = 1;
+
+        using MaterialList = std::vector<CookedMaterial>;
+
+    public:
+        /// <summary>
+        /// Check if the stream starts with a cooked model header.
+        /// The stream's position is left unchanged.
+        /// </summary>
+        [[nodiscard]] static bool IsCooked(
+            std::istream& Stream);
+
+        /// <summary>
+        /// Read a cooked model from a stream, returns false if the stream is not a valid cooked model.
+        /// </summary>
+        [[nodiscard]] bool Read(
+            std::istream& Stream);
+
+        /// <summary>
+        /// Write the cooked model to a stream.
+        /// </summary>
+        void Write(
+            std::ostream& Stream) const;
+
+        /// <summary>
+        /// Convert the 32 bits indices to 16 bits if all of submeshes can be addressed with 16 bits.
+        /// </summary>
+        void CompactIndices();
+
+        /// <summary>
+        /// Create the gpu model from the cooked data.
+        /// </summary>
+        [[nodiscard]] Ptr<Model> CreateModel(
+            const StringU8& Name) const;
+
+    public:
+        /// <summary>
+        /// Get the size of index in bytes.
+        /// </summary>
+        [[nodiscard]] size_t GetIndexStride() const noexcept
+        {
+            return SmallIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+        }
+
+        /// <summary>
+        /// Get the number of indices.
+        /// </summary>
+        [[nodiscard]] size_t GetIndexCount() const noexcept
+        {
+            return Indices.size() / GetIndexStride();
+        }
+
+    public:
+        std::vector<MeshVertex> Vertices;
+        std::vector<uint8_t>    Indices;
+        Model::SubmeshList      Submeshes;
+        Model::MeshNodeList     Nodes;
+        MaterialList            Materials;
+        bool                    SmallIndices = false;
+    };
+} // namespace Neon::Mdl
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/Neon.hpp>
+#include <Allocator/MemoryResource.hpp>
 #include <Physics/Bullet3.hpp>
 #include <Physics/Debug.hpp>
 
@@ -26,7 +27,7 @@ namespace Neon::Physics
                        std::hash<const btCollisionObject*>()(std::get<1>(Data));
             }
         };
-        using CollisionDataSet = std::unordered_set<CollisionData, CollisionDataHash>;
+        using CollisionDataSet = std::pmr::unordered_set<CollisionData, CollisionDataHash>;
 
     public:
         World();
@@ -133,7 +134,11 @@ namespace Neon::Physics
         btSoftRigidDynamicsWorld                  m_DynamicsWorld;
 
     private:
-        CollisionDataSet m_PreviousTickCollisions;
+        /// <summary>
+        /// Collisions start and end every tick, keep their nodes off the general heap.
+        /// </summary>
+        Allocator::PoolResource m_CollisionNodes{ 64 };
+        CollisionDataSet        m_PreviousTickCollisions{ &m_CollisionNodes };
 
         /// <summary>
         /// We will have to get the current world for the simulation world.
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <RenderGraph/Resolver.hpp>
+#include <RenderGraph/Compiler.hpp>
 #include <vector>
 #include <future>
-#include <stack>
 
 namespace Neon::RG
 {
@@ -20,8 +20,7 @@ namespace Neon::RG
                 GraphStorage& Storage);
         };
 
-        using BuildersListType  = std::vector<BuilderInfo>;
-        using AdjacencyListType = std::vector<std::vector<size_t>>;
+        using BuildersListType = std::vector<BuilderInfo>;
 
     public:
         /// <summary>
@@ -53,26 +52,13 @@ namespace Neon::RG
             BuildersListType& Builders) -> std::vector<GraphDepdencyLevel>;
 
         /// <summary>
-        /// Build adjacency lists for passes dependencies
+        /// Move the resources each pass declared to the graph's declaration
         /// </summary>
-        void BuildAdjacencyLists(
-            const BuildersListType& Builders);
+        void Declare(
+            BuildersListType& Builders);
 
         /// <summary>
-        /// Topological sort of the graph
-        /// </summary>
-        void TopologicalSort();
-
-        /// <summary>
-        /// Depth first search for topological sort
-        /// </summary>
-        void DepthFirstSearch(
-            size_t              Index,
-            std::vector<bool>&  Visited,
-            std::stack<size_t>& Stack);
-
-        /// <summary>
-        /// Build dependency levels
+        /// Build dependency levels from the compiled graph's pass levels
         /// </summary>
         [[nodiscard]] auto BuildDependencyLevels(
             BuildersListType& Builders) -> std::vector<GraphDepdencyLevel>;
@@ -86,7 +72,8 @@ namespace Neon::RG
 
         std::vector<UPtr<IRenderPass>> m_Passes;
 
-        AdjacencyListType   m_AdjacencyList;
-        std::vector<size_t> m_TopologicallySortedList;
+        GraphDeclaration m_Declaration;
+        GraphCompiler    m_Compiler;
+        CompiledGraph    m_Compiled;
     };
 } // namespace Neon::RG
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <RenderGraph/Compiled.hpp>
+
+#include <list>
+#include <vector>
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Compiled graphs of the last structures the render graph was built with.
+    /// The structure of a graph is the list of its passes and the resources each one creates, writes and reads, a
+    /// graph whose structure matches a cached one reuses its pass levels and resource lifetimes instead of compiling
+    /// again. Resource handles are not part of the structure, imported resources are resolved again on every build.
+    /// Entries are looked up by hash and the whole structure is compared, so a hash collision is only a miss.
+    /// </summary>
+    class GraphCache
+    {
+    public:
+        /// <summary>
+        /// Structure of a graph flattened to a list of values and their incremental hash, values must be added in the
+        /// same order for the same structure.
+        /// </summary>
+        class Structure
+        {
+        public:
+            /// <summary>
+            /// Add a value to the structure
+            /// </summary>
+            void Add(
+                size_t Value)
+            {
+                m_Values.push_back(Value);
+                m_Hash = (m_Hash ^ Value) * StringUtils::Impl::_Hash_Prime;
+                m_Hash ^= m_Hash >> 29;
+            }
+
+            /// <summary>
+            /// Get the hash of the structure
+            /// </summary>
+            [[nodiscard]] size_t GetHash() const noexcept
+            {
+                return m_Hash;
+            }
+
+            [[nodiscard]] bool operator==(
+                const Structure& Other) const noexcept
+            {
+                return m_Hash == Other.m_Hash && m_Values == Other.m_Values;
+            }
+
+        private:
+            std::vector<size_t> m_Values;
+            size_t              m_Hash = StringUtils::Impl::_Hash_Basis;
+        };
+
+    public:
+        explicit GraphCache(
+            size_t MaxEntries = 4) :
+            m_MaxEntries(MaxEntries)
+        {
+        }
+
+        /// <summary>
+        /// Find the compiled graph of a structure, null if it isn't cached
+        /// </summary>
+        [[nodiscard]] const CompiledGraph* Find(
+            const Structure& Key);
+
+        /// <summary>
+        /// Cache the compiled graph of a structure, evicting the least recently used one if the cache is full
+        /// </summary>
+        const CompiledGraph& Insert(
+            Structure     Key,
+            CompiledGraph Compiled);
+
+        /// <summary>
+        /// Remove every compiled graph, the hit and miss counts are kept
+        /// </summary>
+        void Clear() noexcept;
+
+    public:
+        /// <summary>
+        /// Get the number of builds that reused a compiled graph
+        /// </summary>
+        [[nodiscard]] size_t GetHitCount() const noexcept
+        {
+            return m_HitCount;
+        }
+
+        /// <summary>
+        /// Get the number of builds that had to compile the graph
+        /// </summary>
+        [[nodiscard]] size_t GetMissCount() const noexcept
+        {
+            return m_MissCount;
+        }
+
+        /// <summary>
+        /// Get the number of cached compiled graphs
+        /// </summary>
+        [[nodiscard]] size_t GetSize() const noexcept
+        {
+            return m_Entries.size();
+        }
+
+    private:
+        struct Entry
+        {
+            Structure     Key;
+            CompiledGraph Compiled;
+        };
+
+        /// <summary>
+        /// Entries from the most to the least recently used
+        /// </summary>
+        std::list<Entry> m_Entries;
+        size_t           m_MaxEntries;
+
+        size_t m_HitCount  = 0;
+        size_t m_MissCount = 0;
+    };
+} // namespace Neon::RG
\ No newline at end of file
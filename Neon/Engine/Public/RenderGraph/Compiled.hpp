@@ -0,0 +1,170 @@
+#pragma once
+
+#include <RenderGraph/Transitions.hpp>
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Result of the graph's compilation: which passes were culled, when each resource is used and the state
+    /// transitions of every level.
+    /// Passes are executed level by level and the passes of a level may run at the same time, so lifetimes are
+    /// expressed in levels.
+    /// </summary>
+    class CompiledGraph
+    {
+        friend class GraphCompiler;
+
+    public:
+        struct ResourceLifetime
+        {
+            /// <summary>
+            /// First and last levels that create, read or write the resource.
+            /// </summary>
+            uint32_t FirstLevel = std::numeric_limits<uint32_t>::max();
+            uint32_t LastLevel  = 0;
+
+            /// <summary>
+            /// Number of passes that write and read the resource.
+            /// </summary>
+            uint32_t ProducerCount = 0;
+            uint32_t ConsumerCount = 0;
+
+            /// <summary>
+            /// Imported resources are owned outside of the graph and live for the whole frame.
+            /// </summary>
+            bool Imported = false;
+
+            /// <summary>
+            /// Check if the resource is used during the level
+            /// </summary>
+            [[nodiscard]] bool IsAlive(
+                uint32_t Level) const noexcept
+            {
+                return Imported || (FirstLevel <= Level && Level <= LastLevel);
+            }
+
+            /// <summary>
+            /// Check if both resources are used during a same level
+            /// </summary>
+            [[nodiscard]] bool Overlaps(
+                const ResourceLifetime& Other) const noexcept
+            {
+                return Imported || Other.Imported || (FirstLevel <= Other.LastLevel && Other.FirstLevel <= LastLevel);
+            }
+
+            [[nodiscard]] bool operator==(
+                const ResourceLifetime& Other) const noexcept = default;
+        };
+
+        using LifetimeMapType = std::map<ResourceId, ResourceLifetime>;
+
+        /// <summary>
+        /// Level of the passes that were culled
+        /// </summary>
+        static constexpr uint32_t s_CulledPass = std::numeric_limits<uint32_t>::max();
+
+    public:
+        /// <summary>
+        /// Get the lifetime of a resource, null if no pass uses it
+        /// </summary>
+        [[nodiscard]] const ResourceLifetime* GetLifetime(
+            const ResourceId& Id) const
+        {
+            auto Iter = m_Lifetimes.find(Id);
+            return Iter != m_Lifetimes.end() ? &Iter->second : nullptr;
+        }
+
+        /// <summary>
+        /// Get the lifetimes of every resource used by the remaining passes
+        /// </summary>
+        [[nodiscard]] const LifetimeMapType& GetLifetimes() const noexcept
+        {
+            return m_Lifetimes;
+        }
+
+        /// <summary>
+        /// Get the resources used during the level
+        /// </summary>
+        [[nodiscard]] std::vector<ResourceId> GetResourcesAlive(
+            uint32_t Level) const
+        {
+            std::vector<ResourceId> Resources;
+            for (auto& [Id, Lifetime] : m_Lifetimes)
+            {
+                if (Lifetime.IsAlive(Level))
+                {
+                    Resources.emplace_back(Id);
+                }
+            }
+            return Resources;
+        }
+
+        /// <summary>
+        /// Get the number of dependency levels
+        /// </summary>
+        [[nodiscard]] uint32_t GetLevelCount() const noexcept
+        {
+            return m_LevelCount;
+        }
+
+        /// <summary>
+        /// Get the number of passes that will be executed
+        /// </summary>
+        [[nodiscard]] uint32_t GetPassCount() const noexcept
+        {
+            return m_PassCount;
+        }
+
+        /// <summary>
+        /// Get the level of every pass in the order they were added, s_CulledPass for the culled ones
+        /// </summary>
+        [[nodiscard]] const std::vector<uint32_t>& GetPassLevels() const noexcept
+        {
+            return m_PassLevels;
+        }
+
+        /// <summary>
+        /// Get the state transitions to execute before each level
+        /// </summary>
+        [[nodiscard]] const TransitionPlan& GetTransitions() const noexcept
+        {
+            return m_Transitions;
+        }
+
+        /// <summary>
+        /// Get the names of the passes that were culled because no output depends on them
+        /// </summary>
+        [[nodiscard]] const std::vector<StringU8>& GetCulledPasses() const noexcept
+        {
+            return m_CulledPasses;
+        }
+
+        /// <summary>
+        /// Check if both graphs put the passes in the same levels and the resources have the same lifetimes
+        /// </summary>
+        [[nodiscard]] bool HasSameLayout(
+            const CompiledGraph& Other) const
+        {
+            return m_LevelCount == Other.m_LevelCount &&
+                   m_PassLevels == Other.m_PassLevels &&
+                   std::ranges::equal(
+                       m_Lifetimes,
+                       Other.m_Lifetimes,
+                       [](const auto& Lhs, const auto& Rhs)
+                       { return Lhs.first.Get() == Rhs.first.Get() && Lhs.second == Rhs.second; });
+        }
+
+    private:
+        LifetimeMapType       m_Lifetimes;
+        std::vector<StringU8> m_CulledPasses;
+        std::vector<uint32_t> m_PassLevels;
+        TransitionPlan        m_Transitions;
+
+        uint32_t m_LevelCount = 0;
+        uint32_t m_PassCount  = 0;
+    };
+} // namespace Neon::RG
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <RenderGraph/Cache.hpp>
+
+#include <set>
+#include <stack>
+#include <unordered_map>
+#include <vector>
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Resources a pass declared in IRenderPass::ResolveResources, with the subresources of its views resolved.
+    /// </summary>
+    struct PassDeclaration
+    {
+        struct StateRequest
+        {
+            ResourceId          Resource;
+            uint32_t            Subresource;
+            RHI::MResourceState State;
+        };
+
+        /// <summary>
+        /// Hash of the pass's type.
+        /// </summary>
+        size_t       Type = 0;
+        StringU8View Name;
+
+        std::set<ResourceId>      Created;
+        std::set<ResourceId>      Written;
+        std::set<ResourceId>      Read;
+        std::vector<StateRequest> States;
+    };
+
+    /// <summary>
+    /// Passes of a graph in the order they were added, and the resources they use that are imported in the storage.
+    /// </summary>
+    struct GraphDeclaration
+    {
+        std::vector<PassDeclaration> Passes;
+        std::set<ResourceId>         Imported;
+    };
+
+    /// <summary>
+    /// Compile declared graphs: cull the passes no output depends on, sort the rest in dependency levels and compute
+    /// the resources' lifetimes and state transitions.
+    /// </summary>
+    class GraphCompiler
+    {
+        /// <summary>
+        /// Passes that create, write and read a resource, in the order they were added.
+        /// </summary>
+        struct ResourceUsage
+        {
+            ResourceId          Id;
+            std::vector<size_t> Creators;
+            std::vector<size_t> Producers;
+            std::vector<size_t> Consumers;
+        };
+
+        using AdjacencyListType    = std::vector<std::vector<size_t>>;
+        using ResourceUsageMapType = std::unordered_map<size_t, ResourceUsage>;
+
+    public:
+        /// <summary>
+        /// Get the structure of a declared graph, two graphs with the same structure compile to the same graph
+        /// </summary>
+        [[nodiscard]] static GraphCache::Structure GetStructure(
+            const GraphDeclaration& Graph);
+
+        /// <summary>
+        /// Compile a declared graph
+        /// </summary>
+        [[nodiscard]] CompiledGraph Compile(
+            const GraphDeclaration& Graph);
+
+    private:
+        /// <summary>
+        /// Build the producers and consumers of every resource
+        /// </summary>
+        void BuildResourceUsages(
+            const GraphDeclaration& Graph);
+
+        /// <summary>
+        /// Cull the passes that no imported resource (such as the output image) depends on.
+        /// Passes that don't write any resource are kept, they may have side effects the graph doesn't know about.
+        /// </summary>
+        void CullPasses(
+            const GraphDeclaration& Graph);
+
+        /// <summary>
+        /// Build adjacency lists for passes dependencies
+        /// </summary>
+        void BuildAdjacencyLists(
+            const GraphDeclaration& Graph);
+
+        /// <summary>
+        /// Topological sort of the graph
+        /// </summary>
+        void TopologicalSort();
+
+        /// <summary>
+        /// Depth first search for topological sort
+        /// </summary>
+        void DepthFirstSearch(
+            size_t              Index,
+            std::vector<bool>&  Visited,
+            std::stack<size_t>& Stack);
+
+        /// <summary>
+        /// Compute the dependency level of every pass
+        /// </summary>
+        void BuildPassLevels();
+
+        /// <summary>
+        /// Compute the levels where each resource is used
+        /// </summary>
+        void BuildLifetimes(
+            const GraphDeclaration& Graph);
+
+        /// <summary>
+        /// Plan the state transitions of every level from the states the passes need
+        /// </summary>
+        void BuildTransitions(
+            const GraphDeclaration& Graph);
+
+    private:
+        ResourceUsageMapType m_ResourceUsages;
+        std::vector<bool>    m_CulledPasses;
+
+        AdjacencyListType   m_AdjacencyList;
+        std::vector<size_t> m_TopologicallySortedList;
+
+        CompiledGraph m_Compiled;
+    };
+} // namespace Neon::RG
\ No newline at end of file
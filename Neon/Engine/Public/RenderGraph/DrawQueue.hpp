@@ -0,0 +1,135 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Neon
+{
+    namespace RHI
+    {
+        class IMaterial;
+        class IPipelineState;
+    } // namespace RHI
+
+    namespace Mdl
+    {
+        class Model;
+        struct SubMeshData;
+    } // namespace Mdl
+} // namespace Neon
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Visible draws of a frame, gathered from many threads and sorted into instanced batches.
+    /// Each thread fills its own chunk, the chunks are concatenated in order so the result doesn't depend on scheduling.
+    /// </summary>
+    class DrawQueue
+    {
+    public:
+        struct DrawItem
+        {
+            RHI::IMaterial*         Material;
+            const Mdl::Model*       Model;
+            const Mdl::SubMeshData* Data;
+            uint32_t                InstanceId;
+        };
+
+        /// <summary>
+        /// Consecutive draws of the same submesh with the same material, its instances are
+        /// GetInstanceIds()[FirstInstance, FirstInstance + InstanceCount).
+        /// </summary>
+        struct DrawBatch
+        {
+            RHI::IMaterial*         Material;
+            const Mdl::Model*       Model;
+            const Mdl::SubMeshData* Data;
+            uint32_t                FirstInstance;
+            uint32_t                InstanceCount;
+        };
+
+    private:
+        struct SortEntry
+        {
+            uint64_t Key;
+            uint32_t Item;
+        };
+
+        struct Chunk
+        {
+            std::vector<DrawItem> Items;
+            std::vector<uint64_t> Keys;
+        };
+
+    public:
+        /// <summary>
+        /// Remove every draw and prepare ChunkCount chunks, the memory is kept.
+        /// </summary>
+        void Reset(
+            size_t ChunkCount);
+
+        /// <summary>
+        /// Add a draw to a chunk, a chunk must only be filled by one thread at a time.
+        /// Dist is the squared distance to the camera, opaque draws are sorted front to back and transparent ones back to front.
+        /// </summary>
+        void Add(
+            size_t                     ChunkIndex,
+            const DrawItem&            Item,
+            const RHI::IPipelineState* PipelineState,
+            bool                       Transparent,
+            float                      Dist);
+
+        /// <summary>
+        /// Sort the draws of every chunk by key and merge the ones that can be instanced.
+        /// </summary>
+        void Build();
+
+    public:
+        /// <summary>
+        /// Get the sorted batches, valid after Build.
+        /// </summary>
+        [[nodiscard]] std::span<const DrawBatch> GetBatches() const noexcept
+        {
+            return m_Batches;
+        }
+
+        /// <summary>
+        /// Get the instance ids of the batches, valid after Build.
+        /// </summary>
+        [[nodiscard]] std::span<const uint32_t> GetInstanceIds() const noexcept
+        {
+            return m_InstanceIds;
+        }
+
+        /// <summary>
+        /// Get the number of draws added since the last reset.
+        /// </summary>
+        [[nodiscard]] size_t GetDrawCount() const noexcept;
+
+    public:
+        /// <summary>
+        /// Make the sort key of a draw, opaque draws come first.
+        /// Opaque:      0 | pipeline (15) | material (16) | mesh (16) | depth (16)
+        /// Transparent: 1 | pipeline (15) | inverted depth (16) | material (16) | mesh (16)
+        /// Pipelines, materials and meshes are hashed, so two of them may share an id: this only costs a batch split or a
+        /// state change, batches are merged by comparing the actual pointers.
+        /// </summary>
+        [[nodiscard]] static uint64_t MakeKey(
+            const DrawItem&            Item,
+            const RHI::IPipelineState* PipelineState,
+            bool                       Transparent,
+            float                      Dist) noexcept;
+
+    private:
+        std::vector<Chunk> m_Chunks;
+        size_t             m_ChunkCount = 0;
+
+        std::vector<DrawItem>  m_Items;
+        std::vector<SortEntry> m_Entries, m_Scratch;
+
+        std::vector<DrawBatch> m_Batches;
+        std::vector<uint32_t>  m_InstanceIds;
+    };
+} // namespace Neon::RG
\ No newline at end of file
@@ -2,9 +2,9 @@
 
 #include <RenderGraph/Storage.hpp>
 #include <RenderGraph/Pass.hpp>
+#include <RenderGraph/Cache.hpp>
 
 #include <RHI/Fence.hpp>
-#include <Asio/ThreadPool.hpp>
 
 namespace Neon::Scene::Component
 {
@@ -113,6 +113,16 @@ namespace Neon::RG
         /// </summary>
         [[nodiscard]] const GraphStorage& GetStorage() const noexcept;
 
+        /// <summary>
+        /// Get the culled passes and the resources' lifetimes of the last build
+        /// </summary>
+        [[nodiscard]] const CompiledGraph& GetCompiledGraph() const noexcept;
+
+        /// <summary>
+        /// Get the compiled graphs reused by the builds whose structure didn't change
+        /// </summary>
+        [[nodiscard]] const GraphCache& GetCache() const noexcept;
+
         /// <summary>
         /// Update camera buffer
         /// </summary>
@@ -130,16 +140,18 @@ namespace Neon::RG
         /// Build levels and imported resources
         /// </summary>
         void Build(
-            DepdencyLevelList&& Levels);
+            DepdencyLevelList&& Levels,
+            CompiledGraph&&     Compiled);
 
     private:
         GraphStorage      m_Storage;
         DepdencyLevelList m_Levels;
+        CompiledGraph     m_Compiled;
+        GraphCache        m_Cache;
 
         CommandListContext m_CommandListContext;
 
-        std::mutex         m_RenderMutex, m_ComputeMutex;
-        Asio::ThreadPool<> m_ThreadPool{ 3 };
+        std::mutex m_RenderMutex, m_ComputeMutex;
     };
 
     //
@@ -155,6 +167,13 @@ namespace Neon::RG
             std::optional<ResourceViewId> DepthStencil;
         };
 
+        struct TransitionInfo
+        {
+            const ResourceHandle* Handle;
+            uint32_t              Subresource;
+            RHI::MResourceState   State;
+        };
+
     public:
         GraphDepdencyLevel(
             RenderGraph& Context);
@@ -169,11 +188,10 @@ namespace Neon::RG
         /// Append render pass
         /// </summary>
         void AddPass(
-            UPtr<IRenderPass>                             Pass,
-            std::vector<ResourceViewId>                   RenderTargets,
-            std::optional<ResourceViewId>                 DepthStencil,
-            std::set<ResourceId>                          ResourceToCreate,
-            std::map<ResourceViewId, RHI::MResourceState> States);
+            UPtr<IRenderPass>             Pass,
+            std::vector<ResourceViewId>   RenderTargets,
+            std::optional<ResourceViewId> DepthStencil,
+            std::set<ResourceId>          ResourceToCreate);
 
         /// <summary>
         /// Execute render passes
@@ -186,6 +204,12 @@ namespace Neon::RG
         [[nodiscard]] std::pair<uint32_t, uint32_t> GetCommandListCount() const;
 
     private:
+        /// <summary>
+        /// Set the planned transitions of this level, the resources are looked up once here instead of every frame
+        /// </summary>
+        void SetTransitions(
+            std::span<const TransitionPlan::Transition> Transitions);
+
         /// <summary>
         /// Execute pending resource barriers before render passes
         /// </summary>
@@ -217,7 +241,7 @@ namespace Neon::RG
 
         std::set<ResourceId> m_ResourcesToCreate;
 
-        std::map<ResourceId, std::map<uint32_t, RHI::MResourceState>> m_StatesToTransition;
+        std::vector<TransitionInfo> m_Transitions;
 
         bool m_ResetBarriers : 1 = false;
         bool m_ResetCommands : 1 = false;
@@ -1,20 +1,12 @@
 #pragma once
 
 #include <RenderGraph/Common.hpp>
+#include <RenderGraph/DrawQueue.hpp>
 #include <Math/Common.hpp>
+#include <Geometry/Culling.hpp>
 
 namespace Neon
 {
-    namespace RHI
-    {
-        class IMaterial;
-        namespace Views
-        {
-            class Vertex;
-            class Index;
-        } // namespace Views
-    }     // namespace RHI
-
     namespace Scene::Component
     {
         struct Camera;
@@ -38,61 +30,28 @@ namespace Neon::RG
         };
 
     private:
-        using MeshQuery = flecs::query<
-            const Scene::Component::Transform,
-            const Scene::Component::MeshInstance>;
-
-        using CSGQuery = flecs::query<
-            const Scene::Component::Transform,
-            const Scene::Component::CSGBrush>;
-
-    private:
-        struct EntityRenderInfo
-        {
-            Ptr<RHI::IMaterial> Material;
-
-            RHI::GpuResourceHandle VertexBuffer;
-
-            uint32_t               InstanceId;
-            RHI::PrimitiveTopology Topology;
-        };
-
-    private:
-        enum class EntityType : uint8_t
+        /// <summary>
+        /// Draw of an entity whose proxy intersects the frustum, the ones fully inside it don't need their box tested.
+        /// </summary>
+        struct CullCandidate
         {
-            Mesh,
-            CSG
+            DrawQueue::DrawItem                Item;
+            const Scene::Component::Transform* Transform;
+            bool                               Inside;
         };
 
-        struct EntityInfo
+        /// <summary>
+        /// Candidates handled by a single job, the boxes of the ones that aren't fully inside are tested at once.
+        /// </summary>
+        struct CullChunk
         {
-            flecs::entity_t Id;
-            float           Dist;
-            EntityType      Type;
-
-        public:
-            /// <summary>
-            /// Check to see if the entity can be rendered (used for compute materials)
-            /// </summary>
-            [[nodiscard]] bool CanRender(
-                RenderType PassType,
-                uint32_t   PassIndex) const;
-
-            /// <summary>
-            /// Get data needed for rendering
-            /// </summary>
-            [[nodiscard]] EntityRenderInfo GetRenderInfo(
-                RHI::Views::Vertex& VtxView,
-                RHI::Views::Index&  IdxView) const;
-
-            auto operator<=>(const EntityInfo& Other) const noexcept
-            {
-                return Dist <=> Other.Dist;
-            }
+            Geometry::AABBList               Boxes;
+            std::vector<DrawQueue::DrawItem> Items;
+            std::vector<float>               Dists;
+            std::vector<uint64_t>            Visibility;
         };
 
-        using EntityList      = std::set<EntityInfo>;
-        using EntityListGroup = std::map<RHI::IPipelineState*, EntityList>;
+        static constexpr size_t s_CullChunkSize = 1024;
 
     public:
         SceneContext(
@@ -100,7 +59,7 @@ namespace Neon::RG
 
         NEON_CLASS_NO_COPYMOVE(SceneContext);
 
-        ~SceneContext();
+        ~SceneContext() = default;
 
     public:
         /// <summary>
@@ -133,9 +92,15 @@ namespace Neon::RG
     private:
         const GraphStorage& m_Storage;
 
-        MeshQuery m_MeshQuery;
-        CSGQuery  m_CSGQuery;
+        /// <summary>
+        /// Visible draws sorted into instanced batches, rebuilt every update.
+        /// </summary>
+        DrawQueue m_DrawQueue;
 
-        EntityListGroup m_EntityLists;
+        /// <summary>
+        /// Culling state kept between updates to reuse its memory.
+        /// </summary>
+        std::vector<CullCandidate> m_CullCandidates;
+        std::vector<CullChunk>     m_CullChunks;
     };
 } // namespace Neon::RG
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <RenderGraph/Common.hpp>
+
+#include <span>
+#include <vector>
+
+namespace Neon::RG
+{
+    /// <summary>
+    /// Resource state transitions of every dependency level, planned when the graph is compiled.
+    /// The states needed by the passes of a level are merged per subresource, then the levels are walked in order and
+    /// only the transitions that change a subresource's state are kept, executing a level replays a flat array.
+    /// Transitions follow the state manager's rules: a read state that already contains the new state is kept.
+    /// </summary>
+    class TransitionPlan
+    {
+    public:
+        struct Transition
+        {
+            ResourceId Resource;
+            uint32_t   Subresource;
+
+            /// <summary>
+            /// State planned by the previous transition, only valid if HasBefore is set.
+            /// </summary>
+            RHI::MResourceState Before;
+            RHI::MResourceState After;
+
+            /// <summary>
+            /// Level after the last use of the Before state, a split barrier could begin there and end at the level
+            /// of the transition. Equal to the level of the transition if the state before is unknown.
+            /// </summary>
+            uint32_t BeginLevel;
+
+            /// <summary>
+            /// Set if the state before is known. It isn't on the subresource's first use of the frame, since it was
+            /// left by the previous frame or by code outside of the graph, nor when the subresources of the resource
+            /// may be in different states.
+            /// </summary>
+            bool HasBefore;
+        };
+
+    private:
+        struct Request
+        {
+            uint32_t            Level;
+            ResourceId          Resource;
+            uint32_t            Subresource;
+            RHI::MResourceState State;
+        };
+
+    public:
+        /// <summary>
+        /// Remove every request and transition
+        /// </summary>
+        void Reset(
+            uint32_t LevelCount);
+
+        /// <summary>
+        /// Request a state for a subresource during a level, requests of a same level are merged
+        /// </summary>
+        void Add(
+            uint32_t                   Level,
+            const ResourceId&          Resource,
+            uint32_t                   Subresource,
+            const RHI::MResourceState& State);
+
+        /// <summary>
+        /// Merge the requests and plan the transitions of every level
+        /// </summary>
+        void Build();
+
+        /// <summary>
+        /// Replay the planned transitions and check that every request sees the state a tracker fed with every
+        /// request would have, and that every transition starts from the state planned before it
+        /// </summary>
+        [[nodiscard]] bool Validate() const;
+
+    public:
+        /// <summary>
+        /// Get the transitions to execute before the passes of a level, sorted by resource and subresource
+        /// </summary>
+        [[nodiscard]] std::span<const Transition> GetTransitions(
+            uint32_t Level) const noexcept
+        {
+            return std::span(m_Transitions).subspan(m_LevelOffsets[Level], m_LevelOffsets[Level + 1] - m_LevelOffsets[Level]);
+        }
+
+        /// <summary>
+        /// Get the transitions of every level
+        /// </summary>
+        [[nodiscard]] std::span<const Transition> GetTransitions() const noexcept
+        {
+            return m_Transitions;
+        }
+
+        /// <summary>
+        /// Get the number of levels
+        /// </summary>
+        [[nodiscard]] uint32_t GetLevelCount() const noexcept
+        {
+            return uint32_t(m_LevelOffsets.size() - 1);
+        }
+
+        /// <summary>
+        /// Check if the new state doesn't need a transition from the current one
+        /// </summary>
+        [[nodiscard]] static bool IsRedundant(
+            const RHI::MResourceState& Current,
+            const RHI::MResourceState& New);
+
+    private:
+        /// <summary>
+        /// Sort the requests by level, resource and subresource and merge the ones of a same subresource
+        /// </summary>
+        [[nodiscard]] std::vector<Request> MergeRequests() const;
+
+    private:
+        std::vector<Request>    m_Requests;
+        std::vector<Transition> m_Transitions;
+        std::vector<uint32_t>   m_LevelOffsets{ 0 };
+    };
+} // namespace Neon::RG
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <Core/Neon.hpp>
 #include <Scene/EntityWorld.hpp>
 #include <Scene/GPU/Scene.hpp>
+#include <Scene/SpatialIndex.hpp>
 #include <RHI/Commands/Context.hpp>
 
 namespace Neon
@@ -63,10 +64,19 @@ namespace Neon::Runtime
             return &m_GpuScene;
         }
 
+        /// <summary>
+        /// Get the spatial index of the renderable entities.
+        /// </summary>
+        [[nodiscard]] Scene::SpatialIndex* GetSpatialIndex()
+        {
+            return &m_SpatialIndex;
+        }
+
     private:
         UPtr<Physics::World> m_PhysicsWorld;
 
-        Scene::GPUScene m_GpuScene;
+        Scene::GPUScene     m_GpuScene;
+        Scene::SpatialIndex m_SpatialIndex;
 
         flecs::query<
             Scene::Component::Camera>
@@ -3,7 +3,6 @@
 #include <Utils/Signal.hpp>
 #include <Core/BitMask.hpp>
 #include <Runtime/PipelineBuilder.hpp>
-#include <Asio/ThreadPool.hpp>
 
 namespace Neon::Runtime
 {
@@ -27,8 +26,7 @@ namespace Neon::Runtime
     {
     public:
         EnginePipeline(
-            EnginePipelineBuilder Builder,
-            uint32_t              ThreadCount = 2);
+            EnginePipelineBuilder Builder);
 
         /// <summary>
         /// Execute the phases in the pipeline
@@ -110,8 +108,6 @@ namespace Neon::Runtime
         PhaseMapType       m_Phases;
         PhaseLevelListType m_Levels;
 
-        Asio::ThreadPool<>             m_ThreadPool;
-        std::vector<PipelinePhase*>    m_NonAsyncPhases;
-        std::vector<std::future<void>> m_AsyncPhases;
+        std::vector<PipelinePhase*> m_NonAsyncPhases;
     };
 } // namespace Neon::Runtime
\ No newline at end of file
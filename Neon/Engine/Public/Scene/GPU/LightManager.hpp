@@ -6,7 +6,7 @@
 
 #include <RHI/Resource/Descriptor.hpp>
 #include <RHI/Resource/Resource.hpp>
-#include <Allocator/Buddy.hpp>
+#include <Allocator/TLSF.hpp>
 #include <vector>
 
 namespace Neon::Scene
@@ -110,7 +110,7 @@ namespace Neon::Scene
 
     private:
         Ptr<RHI::IGpuResource>    m_LightsBuffer;
-        Allocator::BuddyAllocator m_LightsInScene;
+        Allocator::TLSFAllocator  m_LightsInScene;
         RHI::DescriptorHeapHandle m_LightsView;
         uint32_t                  m_InstancesCount = 0;
         uint8_t*                  m_LightsBufferPtr;
@@ -5,7 +5,7 @@
 #include <Math/Common.hpp>
 
 #include <RHI/Resource/Resource.hpp>
-#include <Allocator/Buddy.hpp>
+#include <Allocator/TLSF.hpp>
 #include <vector>
 
 namespace Neon::Scene
@@ -29,9 +29,9 @@ namespace Neon::Scene
         using InstanceDataBuffer = Ptr<RHI::IGpuResource>;
         struct InstanceBufferPage
         {
-            InstanceDataBuffer        Instances;
-            Allocator::BuddyAllocator Allocator;
-            uint8_t*                  MappedInstances;
+            InstanceDataBuffer       Instances;
+            Allocator::TLSFAllocator Allocator;
+            uint8_t*                 MappedInstances;
 
             InstanceBufferPage(
                 size_t PageIndex) :
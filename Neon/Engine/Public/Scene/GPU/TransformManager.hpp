@@ -7,7 +7,8 @@
 #include <Math/Common.hpp>
 
 #include <RHI/Resource/Resource.hpp>
-#include <Allocator/Buddy.hpp>
+#include <Allocator/TLSF.hpp>
+#include <span>
 #include <vector>
 
 namespace Neon::Scene::Component
@@ -77,6 +78,12 @@ namespace Neon::Scene
         [[nodiscard]] RHI::GpuResourceHandle GetInstanceHandle(
             uint32_t InstanceId) const;
 
+        /// <summary>
+        /// Copy the data of many instances next to each other in frame memory and get its handle, used for instanced draws
+        /// </summary>
+        [[nodiscard]] RHI::GpuResourceHandle GetInstancesHandle(
+            std::span<const uint32_t> InstanceIds) const;
+
     private:
         GPUPagedInstance<InstanceData> m_PagesInstances;
     };
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Geometry/BVH.hpp>
+#include <Scene/EntityWorld.hpp>
+#include <vector>
+
+namespace Neon::Scene
+{
+    /// <summary>
+    /// Bounding volume hierarchy over the world boxes of the renderable entities (meshes and CSG brushes).
+    /// The tree is kept in sync with the entities' transforms by observers, so scene queries only visit the entities
+    /// near the queried volume.
+    /// </summary>
+    class SpatialIndex
+    {
+    public:
+        enum class EntityType : uint8_t
+        {
+            Mesh,
+            CSG
+        };
+
+        struct ProxyHandle
+        {
+            constexpr bool Valid() const noexcept
+            {
+                return ProxyId != Geometry::DynamicBVH::s_NullProxy;
+            }
+
+            /// <summary>
+            /// Proxy of the entity in SpatialIndex.
+            /// </summary>
+            Geometry::DynamicBVH::ProxyId ProxyId = Geometry::DynamicBVH::s_NullProxy;
+        };
+
+    public:
+        SpatialIndex();
+
+    public:
+        /// <summary>
+        /// Add or update the entity's proxy, the proxy is removed if the entity has no box.
+        /// </summary>
+        void Update(
+            flecs::entity         Entity,
+            ProxyHandle&          Handle,
+            EntityType            Type,
+            const Geometry::AABB* Box);
+
+        /// <summary>
+        /// Remove the entity's proxy.
+        /// </summary>
+        void Remove(
+            ProxyHandle& Handle);
+
+        /// <summary>
+        /// Rebuild the tree from scratch, should be called after loading a large number of entities.
+        /// </summary>
+        void Rebuild();
+
+        /// <summary>
+        /// Rebuild the tree if at least half of the proxies were inserted one by one since the last rebuild, such as
+        /// after loading a scene.
+        /// </summary>
+        void Optimize();
+
+    public:
+        /// <summary>
+        /// Get the tree, the proxies' user data are the entities' ids.
+        /// </summary>
+        [[nodiscard]] const Geometry::DynamicBVH& GetTree() const noexcept
+        {
+            return m_Tree;
+        }
+
+        /// <summary>
+        /// Get the type of the entity behind the proxy.
+        /// </summary>
+        [[nodiscard]] EntityType GetEntityType(
+            Geometry::DynamicBVH::ProxyId ProxyId) const noexcept
+        {
+            return m_EntityTypes[ProxyId];
+        }
+
+    private:
+        /// <summary>
+        /// Minimum number of inserts before Optimize rebuilds the tree.
+        /// </summary>
+        static constexpr size_t s_RebuildThreshold = 256;
+
+    private:
+        Geometry::DynamicBVH    m_Tree;
+        std::vector<EntityType> m_EntityTypes;
+
+        size_t m_InsertsSinceRebuild = 0;
+    };
+} // namespace Neon::Scene
\ No newline at end of file
@@ -25,4 +25,6 @@
 #include <Private/RHI/Dx12/Device.hpp>
 #include <Private/RHI/Dx12/DirectXHeaders.hpp>
 #include <Private/RHI/Dx12/D3D12MemAlloc.hpp>
+#elif defined(NEON_GRAPHICS_NULL)
+#include <Private/RHI/Null/Device.hpp>
 #endif
\ No newline at end of file
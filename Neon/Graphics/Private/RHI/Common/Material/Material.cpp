@@ -1,7 +1,7 @@
 #include <GraphicsPCH.hpp>
-#include <Private/RHI/Dx12/Material/Material.hpp>
-#include <Private/RHI/Dx12/RootSignature.hpp>
-#include <Private/RHI/Dx12/PipelineState.hpp>
+#include <Private/RHI/Common/Material/Material.hpp>
+#include <RHI/RootSignature.hpp>
+#include <RHI/PipelineState.hpp>
 #include <RHI/Material/Builder.hpp>
 
 #include <RHI/GlobalDescriptors.hpp>
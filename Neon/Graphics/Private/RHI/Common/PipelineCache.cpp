@@ -0,0 +1,340 @@
+#include <GraphicsPCH.hpp>
+#include <RHI/PipelineCache.hpp>
+#include <IO/BinaryFile.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    PipelineCache::PipelineCache(
+        std::filesystem::path Path,
+        const Key&            DeviceKey) :
+        m_Path(std::move(Path)),
+        m_DeviceKey(DeviceKey)
+    {
+        if (!Read())
+        {
+            // Either there is no cache yet or it was written for another adapter or driver, start from scratch
+            for (auto& CurShard : m_Shards)
+            {
+                CurShard.Blobs.clear();
+            }
+            m_Dirty = std::filesystem::exists(m_Path);
+        }
+    }
+
+    PipelineCache::~PipelineCache()
+    {
+        if (m_Dirty)
+        {
+            Save();
+        }
+    }
+
+    //
+
+    PipelineCache::Key PipelineCache::MakeKey(
+        const PipelineStateBuilderG& Builder,
+        const Key&                   RootSignatureKey,
+        const GraphicsShaderKeys&    ShaderKeys)
+    {
+        Crypto::Hash128 Hash;
+
+        Hash.Append(RootSignatureKey.data(), RootSignatureKey.size());
+        for (auto ShaderKey : ShaderKeys)
+        {
+            Hash << bool(ShaderKey);
+            if (ShaderKey)
+            {
+                Hash.Append(ShaderKey->data(), ShaderKey->size());
+            }
+        }
+
+        // Hash field by field, the states contain bit fields and padding
+        Hash << Builder.Blend.AlphaToCoverageEnable
+             << Builder.Blend.IndependentBlendEnable;
+        for (auto& RenderTarget : Builder.Blend.RenderTargets)
+        {
+            Hash << bool(RenderTarget.BlendEnable)
+                 << bool(RenderTarget.LogicEnable)
+                 << RenderTarget.OpLogic
+                 << RenderTarget.Src
+                 << RenderTarget.Dest
+                 << RenderTarget.OpSrc
+                 << RenderTarget.SrcAlpha
+                 << RenderTarget.DestAlpha
+                 << RenderTarget.OpAlpha
+                 << RenderTarget.WriteMask;
+        }
+
+        auto& Rasterizer = Builder.Rasterizer;
+        Hash << Rasterizer.FillMode
+             << Rasterizer.CullMode
+             << Rasterizer.FrontCounterClockwise
+             << Rasterizer.DepthBias
+             << Rasterizer.DepthBiasClamp
+             << Rasterizer.SlopeScaledDepthBias
+             << Rasterizer.DepthClipEnable
+             << Rasterizer.MultisampleEnable
+             << Rasterizer.AntialiasedLineEnable
+             << Rasterizer.ForcedSampleCount
+             << Rasterizer.ConservativeRaster;
+
+        auto& DepthStencil = Builder.DepthStencil;
+        Hash << DepthStencil.DepthEnable
+             << DepthStencil.DepthCmpFunc
+             << DepthStencil.DepthWriteEnable
+             << DepthStencil.StencilEnable
+             << DepthStencil.StencilReadMask
+             << DepthStencil.StencilWriteMask;
+        for (auto& Face : { DepthStencil.StencilFrontFace, DepthStencil.StencilBackFace })
+        {
+            Hash << Face.FailOp
+                 << Face.DepthFailOp
+                 << Face.PassOp
+                 << Face.CmpOp;
+        }
+
+        // Sizes are hashed too, so elements or names can't shift into each other
+        Hash << Builder.Input.size();
+        for (auto& [Name, Format] : Builder.Input)
+        {
+            Hash << Name.size() << Name << Format;
+        }
+
+        Hash << Builder.RTFormats.size();
+        for (auto Format : Builder.RTFormats)
+        {
+            Hash << Format;
+        }
+
+        Hash << Builder.SampleMask
+             << Builder.SampleCount
+             << Builder.SampleQuality
+             << Builder.Topology
+             << Builder.StripCut
+             << Builder.DSFormat;
+
+        return Hash.Digest();
+    }
+
+    PipelineCache::Key PipelineCache::MakeKey(
+        const PipelineStateBuilderC&,
+        const Key&                   RootSignatureKey,
+        const Key&                   ShaderKey)
+    {
+        Crypto::Hash128 Hash;
+        Hash.Append(RootSignatureKey.data(), RootSignatureKey.size());
+        Hash.Append(ShaderKey.data(), ShaderKey.size());
+        return Hash.Digest();
+    }
+
+    //
+
+    Ptr<IPipelineState> PipelineCache::Find(
+        const Key& PipelineKey) const
+    {
+        auto& CurShard = GetShard(PipelineKey);
+
+        std::shared_lock Lock(CurShard.Mutex);
+
+        auto Iter = CurShard.States.find(PipelineKey);
+        return Iter != CurShard.States.end() ? Iter->second : nullptr;
+    }
+
+    Ptr<IPipelineState> PipelineCache::Insert(
+        const Key&          PipelineKey,
+        Ptr<IPipelineState> PipelineState)
+    {
+        auto& CurShard = GetShard(PipelineKey);
+
+        std::unique_lock Lock(CurShard.Mutex);
+
+        auto& Cache = CurShard.States[PipelineKey];
+        if (!Cache)
+        {
+            Cache = std::move(PipelineState);
+        }
+        return Cache;
+    }
+
+    //
+
+    auto PipelineCache::FindBlob(
+        const Key& PipelineKey) const -> Ptr<const Blob>
+    {
+        auto& CurShard = GetShard(PipelineKey);
+
+        std::shared_lock Lock(CurShard.Mutex);
+
+        auto Iter = CurShard.Blobs.find(PipelineKey);
+        return Iter != CurShard.Blobs.end() ? Iter->second : nullptr;
+    }
+
+    void PipelineCache::StoreBlob(
+        const Key& PipelineKey,
+        Blob       Data)
+    {
+        auto  BlobPtr  = std::make_shared<const Blob>(std::move(Data));
+        auto& CurShard = GetShard(PipelineKey);
+
+        std::unique_lock Lock(CurShard.Mutex);
+        CurShard.Blobs.insert_or_assign(PipelineKey, std::move(BlobPtr));
+        m_Dirty = true;
+    }
+
+    void PipelineCache::RemoveBlob(
+        const Key& PipelineKey)
+    {
+        auto& CurShard = GetShard(PipelineKey);
+
+        std::unique_lock Lock(CurShard.Mutex);
+        if (CurShard.Blobs.erase(PipelineKey))
+        {
+            m_Dirty = true;
+        }
+    }
+
+    void PipelineCache::Clear()
+    {
+        for (auto& CurShard : m_Shards)
+        {
+            std::unique_lock Lock(CurShard.Mutex);
+            CurShard.States.clear();
+        }
+    }
+
+    std::pair<size_t, size_t> PipelineCache::GetSize() const
+    {
+        std::pair<size_t, size_t> Size{};
+        for (auto& CurShard : m_Shards)
+        {
+            std::shared_lock Lock(CurShard.Mutex);
+            Size.first += CurShard.States.size();
+            Size.second += CurShard.Blobs.size();
+        }
+        return Size;
+    }
+
+    //
+
+    bool PipelineCache::Save()
+    {
+        // Write to a temporary file first, so a crash while saving never leaves a truncated cache behind
+        auto TempPath = std::filesystem::path(m_Path).concat(".tmp");
+        {
+            std::ofstream File(TempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (!File.is_open())
+            {
+                NEON_WARNING_TAG("Graphics", "Failed to write pipeline cache '{}'", m_Path.string());
+                return false;
+            }
+
+            IO::BinaryStreamWriter Writer(File);
+            Writer.Write(s_Magic);
+            Writer.Write(s_Version);
+            Writer.Write(m_DeviceKey);
+
+            auto CountPosition = File.tellp();
+            Writer.Write(uint32_t(0));
+
+            uint32_t Count = 0;
+            for (auto& CurShard : m_Shards)
+            {
+                std::shared_lock Lock(CurShard.Mutex);
+                for (auto& [PipelineKey, Data] : CurShard.Blobs)
+                {
+                    Writer.Write(PipelineKey);
+                    Writer.Write(uint64_t(Data->size()));
+                    Writer.WriteBytes(Data->data(), Data->size());
+                    Count++;
+                }
+            }
+
+            File.seekp(CountPosition);
+            Writer.Write(Count);
+
+            if (!File)
+            {
+                NEON_WARNING_TAG("Graphics", "Failed to write pipeline cache '{}'", m_Path.string());
+                File.close();
+                std::filesystem::remove(TempPath);
+                return false;
+            }
+
+            NEON_TRACE_TAG("Graphics", "Saved {} pipeline states to '{}'", Count, m_Path.string());
+        }
+
+        std::error_code Error;
+        std::filesystem::rename(TempPath, m_Path, Error);
+        if (Error)
+        {
+            NEON_WARNING_TAG("Graphics", "Failed to write pipeline cache '{}': {}", m_Path.string(), Error.message());
+            return false;
+        }
+
+        m_Dirty = false;
+        return true;
+    }
+
+    //
+
+    auto PipelineCache::GetShard(
+        const Key& PipelineKey) const -> Shard&
+    {
+        // Low bits are used by the maps' buckets, pick the shard from the high bits
+        return m_Shards[PipelineKey.High() % s_ShardCount];
+    }
+
+    bool PipelineCache::Read()
+    {
+        std::ifstream File(m_Path, std::ios::in | std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        IO::BinaryStreamReader Reader(File);
+        if (Reader.Read<uint32_t>() != s_Magic ||
+            Reader.Read<uint32_t>() != s_Version)
+        {
+            NEON_WARNING_TAG("Graphics", "Pipeline cache '{}' is invalid, discarding it", m_Path.string());
+            return false;
+        }
+
+        if (Reader.Read<Key>() != m_DeviceKey)
+        {
+            NEON_INFO_TAG("Graphics", "Adapter or driver changed, discarding pipeline cache '{}'", m_Path.string());
+            return false;
+        }
+
+        std::error_code Error;
+        auto            FileSize = std::filesystem::file_size(m_Path, Error);
+
+        auto Count = Reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < Count && Reader; i++)
+        {
+            auto PipelineKey = Reader.Read<Key>();
+            auto BlobSize    = Reader.Read<uint64_t>();
+            if (BlobSize > FileSize)
+            {
+                File.setstate(std::ios::failbit);
+                break;
+            }
+
+            Blob Data(BlobSize);
+            Reader.ReadBytes(Data.data(), Data.size());
+
+            GetShard(PipelineKey).Blobs.emplace(PipelineKey, std::make_shared<const Blob>(std::move(Data)));
+        }
+
+        if (!Reader)
+        {
+            NEON_WARNING_TAG("Graphics", "Pipeline cache '{}' is truncated, discarding it", m_Path.string());
+            return false;
+        }
+
+        NEON_TRACE_TAG("Graphics", "Loaded {} pipeline states from '{}'", Count, m_Path.string());
+        return true;
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -365,22 +365,21 @@ namespace Neon::RHI
         const uint32_t Alignment =
             Type == CstResourceViewType::Cbv ? D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT : 1;
 
-        IGlobalBufferPool::BufferType BufferType;
-        switch (Type)
+        // Read only views are written once and consumed by this frame, so they come from the frame ring
+        if (Type != CstResourceViewType::Uav)
         {
-        case CstResourceViewType::Cbv:
-        case CstResourceViewType::Srv:
-            BufferType = IGlobalBufferPool::BufferType::ReadWriteGPUR;
-            break;
-        case CstResourceViewType::Uav:
-            BufferType = IGlobalBufferPool::BufferType::ReadWriteGPURW;
-            break;
+            SetResourceView(
+                IsDirect,
+                Type,
+                RootIndex,
+                IGlobalBufferPool::UploadFrame(Data, Size, Alignment));
+            return;
         }
 
         UBufferPoolHandle Buffer(
             Size,
             Alignment,
-            BufferType);
+            IGlobalBufferPool::BufferType::ReadWriteGPURW);
 
         Buffer.AsUpload().Write(Buffer.Offset, Data, Size);
 
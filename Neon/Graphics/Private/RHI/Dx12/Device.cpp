@@ -133,6 +133,7 @@ namespace Neon::RHI
         const SwapchainCreateDesc& SwapchainDesc)
     {
         Dx12RootSignatureCache::Load();
+        Dx12PipelineStateCache::Load();
         m_MemoryAllocator.reset(NEON_NEW GraphicsMemoryAllocator);
         m_Swapchain.reset(NEON_NEW Dx12Swapchain(Window, SwapchainDesc));
         m_Swapchain->PostInitialize(SwapchainDesc);
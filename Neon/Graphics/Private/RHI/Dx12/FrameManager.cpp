@@ -122,6 +122,11 @@ namespace Neon::RHI
         m_DirectFence.WaitCPU(m_FenceValue);
         auto& Frame = *m_FrameResources[m_FrameIndex];
         Frame.Reset();
+
+        // This frame's commands will signal the next fence value
+        Dx12RenderDevice::Get()->GetAllocator()->BeginFrame(
+            m_FenceValue + 1,
+            m_DirectFence.GetCompletedValue());
     }
 
     void FrameManager::EndFrame()
@@ -25,6 +25,25 @@ namespace Neon::RHI
         return Hndl;
     }
 
+    auto IGlobalBufferPool::AllocateFrame(
+        size_t Size,
+        size_t Alignement) -> FrameHandle
+    {
+        FrameHandle Hndl{};
+        if (Size) [[likely]]
+        {
+            auto Allocator  = Dx12RenderDevice::Get()->GetAllocator();
+            auto Allocation = Allocator->AllocateFrame(Size, Alignement);
+
+            Hndl.Buffer     = static_cast<Dx12GpuResource*>(Allocation.Context);
+            Hndl.Offset     = Allocation.Offset;
+            Hndl.Size       = Allocation.Size;
+            Hndl.CpuAddress = Allocation.CpuAddress;
+            Hndl.GpuHandle  = { Allocation.GpuAddress };
+        }
+        return Hndl;
+    }
+
     void IGlobalBufferPool::Free(
         std::span<const Handle> Handles)
     {
@@ -29,14 +29,12 @@ namespace Neon::RHI
     DescriptorHeapHandle Dx12DFrameDescriptorHeapBuddyAllocator::Allocate(
         uint32_t DescriptorSize)
     {
-        std::scoped_lock HeapLock(m_HeapBlockMutex);
-
         if (auto Hndl = m_HeapBlock.Allocator.Allocate(DescriptorSize)) [[likely]]
         {
             return {
                 .Heap   = &m_HeapBlock.Heap,
-                .Offset = uint32_t(Hndl.Offset),
-                .Size   = uint32_t(Hndl.Size)
+                .Offset = Hndl.Offset,
+                .Size   = Hndl.Size
             };
         }
 
@@ -57,7 +55,7 @@ namespace Neon::RHI
 
     void Dx12DFrameDescriptorHeapBuddyAllocator::FreeAll()
     {
-        m_HeapBlock.Allocator = Allocator::BuddyAllocator(m_HeapBlock.Heap.GetSize());
+        m_HeapBlock.Allocator.FreeAll();
     }
 
     Dx12DescriptorHeap* Dx12DFrameDescriptorHeapBuddyAllocator::GetHeap()
@@ -9,8 +9,8 @@ namespace Neon::RHI
     {
         struct BuddyBlock
         {
-            Dx12DescriptorHeap        Heap;
-            Allocator::BuddyAllocator Allocator;
+            Dx12DescriptorHeap              Heap;
+            Allocator::CachedRangeAllocator Allocator;
 
             BuddyBlock(
                 D3D12_DESCRIPTOR_HEAP_TYPE DescriptorType,
@@ -37,7 +37,6 @@ namespace Neon::RHI
         [[nodiscard]] Dx12DescriptorHeap* GetHeap();
 
     private:
-        std::mutex m_HeapBlockMutex;
         BuddyBlock m_HeapBlock;
     };
 
@@ -173,96 +173,4 @@ namespace Neon::RHI::ImGuiRHI
             ImGui::RenderPlatformWindowsDefault(nullptr, nullptr);
         }
     }
-
-    //
-
-    void SetDefaultTheme()
-    {
-        ImGuiStyle& Style = ImGui::GetStyle();
-
-        Style.Alpha                     = 1.0f;
-        Style.DisabledAlpha             = 1.0f;
-        Style.WindowPadding             = ImVec2(4.0f, 12.0f);
-        Style.WindowBorderSize          = 0.0f;
-        Style.WindowMinSize             = ImVec2(20.0f, 20.0f);
-        Style.WindowTitleAlign          = ImVec2(0.5f, 0.5f);
-        Style.WindowMenuButtonPosition  = ImGuiDir_None;
-        Style.WindowRounding            = 3.f;
-        Style.ChildRounding             = 2.f;
-        Style.ChildBorderSize           = 1.0f;
-        Style.PopupRounding             = 4.f;
-        Style.PopupBorderSize           = 1.0f;
-        Style.FramePadding              = ImVec2(6.0f, 6.0f);
-        Style.FrameRounding             = 2.f;
-        Style.FrameBorderSize           = 0.0f;
-        Style.ItemSpacing               = ImVec2(12.0f, 6.0f);
-        Style.ItemInnerSpacing          = ImVec2(6.0f, 3.0f);
-        Style.CellPadding               = ImVec2(12.0f, 6.0f);
-        Style.IndentSpacing             = 20.0f;
-        Style.ColumnsMinSpacing         = 6.0f;
-        Style.ScrollbarSize             = 12.0f;
-        Style.ScrollbarRounding         = 0.0f;
-        Style.GrabMinSize               = 12.0f;
-        Style.GrabRounding              = 0.0f;
-        Style.TabRounding               = 0.0f;
-        Style.TabBorderSize             = 0.0f;
-        Style.TabMinWidthForCloseButton = 0.0f;
-        Style.ColorButtonPosition       = ImGuiDir_Right;
-        Style.ButtonTextAlign           = ImVec2(0.5f, 0.5f);
-        Style.SelectableTextAlign       = ImVec2(0.0f, 0.0f);
-
-        Style.Colors[ImGuiCol_Text]                  = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_TextDisabled]          = ImVec4(0.2745098173618317f, 0.3176470696926117f, 0.4509803950786591f, 1.0f);
-        Style.Colors[ImGuiCol_WindowBg]              = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_ChildBg]               = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_PopupBg]               = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_Border]                = ImVec4(0.1568627506494522f, 0.168627455830574f, 0.1921568661928177f, 1.0f);
-        Style.Colors[ImGuiCol_BorderShadow]          = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_FrameBg]               = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_FrameBgHovered]        = ImVec4(0.1568627506494522f, 0.168627455830574f, 0.1921568661928177f, 1.0f);
-        Style.Colors[ImGuiCol_FrameBgActive]         = ImVec4(0.2352941185235977f, 0.2156862765550613f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_TitleBg]               = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TitleBgActive]         = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TitleBgCollapsed]      = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_MenuBarBg]             = ImVec4(0.09803921729326248f, 0.105882354080677f, 0.1215686276555061f, 1.0f);
-        Style.Colors[ImGuiCol_ScrollbarBg]           = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_ScrollbarGrab]         = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_ScrollbarGrabHovered]  = ImVec4(0.1568627506494522f, 0.168627455830574f, 0.1921568661928177f, 1.0f);
-        Style.Colors[ImGuiCol_ScrollbarGrabActive]   = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_CheckMark]             = ImVec4(0.4980392158031464f, 0.5137255191802979f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_SliderGrab]            = ImVec4(0.4980392158031464f, 0.5137255191802979f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_SliderGrabActive]      = ImVec4(0.5372549295425415f, 0.5529412031173706f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_Button]                = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_ButtonHovered]         = ImVec4(0.196078434586525f, 0.1764705926179886f, 0.5450980663299561f, 1.0f);
-        Style.Colors[ImGuiCol_ButtonActive]          = ImVec4(0.2352941185235977f, 0.2156862765550613f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_Header]                = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_HeaderHovered]         = ImVec4(0.196078434586525f, 0.1764705926179886f, 0.5450980663299561f, 1.0f);
-        Style.Colors[ImGuiCol_HeaderActive]          = ImVec4(0.2352941185235977f, 0.2156862765550613f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_Separator]             = ImVec4(0.1568627506494522f, 0.1843137294054031f, 0.250980406999588f, 1.0f);
-        Style.Colors[ImGuiCol_SeparatorHovered]      = ImVec4(0.1568627506494522f, 0.1843137294054031f, 0.250980406999588f, 1.0f);
-        Style.Colors[ImGuiCol_SeparatorActive]       = ImVec4(0.1568627506494522f, 0.1843137294054031f, 0.250980406999588f, 1.0f);
-        Style.Colors[ImGuiCol_ResizeGrip]            = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_ResizeGripHovered]     = ImVec4(0.196078434586525f, 0.1764705926179886f, 0.5450980663299561f, 1.0f);
-        Style.Colors[ImGuiCol_ResizeGripActive]      = ImVec4(0.2352941185235977f, 0.2156862765550613f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_Tab]                   = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TabHovered]            = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_TabActive]             = ImVec4(0.09803921729326248f, 0.105882354080677f, 0.1215686276555061f, 1.0f);
-        Style.Colors[ImGuiCol_TabUnfocused]          = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TabUnfocusedActive]    = ImVec4(0.0784313753247261f, 0.08627451211214066f, 0.1019607856869698f, 1.0f);
-        Style.Colors[ImGuiCol_PlotLines]             = ImVec4(0.5215686559677124f, 0.6000000238418579f, 0.7019608020782471f, 1.0f);
-        Style.Colors[ImGuiCol_PlotLinesHovered]      = ImVec4(0.03921568766236305f, 0.9803921580314636f, 0.9803921580314636f, 1.0f);
-        Style.Colors[ImGuiCol_PlotHistogram]         = ImVec4(1.0f, 0.2901960909366608f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_PlotHistogramHovered]  = ImVec4(0.9960784316062927f, 0.4745098054409027f, 0.6980392336845398f, 1.0f);
-        Style.Colors[ImGuiCol_TableHeaderBg]         = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TableBorderStrong]     = ImVec4(0.0470588244497776f, 0.05490196123719215f, 0.07058823853731155f, 1.0f);
-        Style.Colors[ImGuiCol_TableBorderLight]      = ImVec4(0.0f, 0.0f, 0.0f, 1.0f);
-        Style.Colors[ImGuiCol_TableRowBg]            = ImVec4(0.1176470592617989f, 0.1333333402872086f, 0.1490196138620377f, 1.0f);
-        Style.Colors[ImGuiCol_TableRowBgAlt]         = ImVec4(0.09803921729326248f, 0.105882354080677f, 0.1215686276555061f, 1.0f);
-        Style.Colors[ImGuiCol_TextSelectedBg]        = ImVec4(0.2352941185235977f, 0.2156862765550613f, 0.5960784554481506f, 1.0f);
-        Style.Colors[ImGuiCol_DragDropTarget]        = ImVec4(0.4980392158031464f, 0.5137255191802979f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_NavHighlight]          = ImVec4(0.4980392158031464f, 0.5137255191802979f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_NavWindowingHighlight] = ImVec4(0.4980392158031464f, 0.5137255191802979f, 1.0f, 1.0f);
-        Style.Colors[ImGuiCol_NavWindowingDimBg]     = ImVec4(0.196078434586525f, 0.1764705926179886f, 0.5450980663299561f, 0.501960813999176f);
-        Style.Colors[ImGuiCol_ModalWindowDimBg]      = ImVec4(0.196078434586525f, 0.1764705926179886f, 0.5450980663299561f, 0.501960813999176f);
-    }
 } // namespace Neon::RHI::ImGuiRHI
\ No newline at end of file
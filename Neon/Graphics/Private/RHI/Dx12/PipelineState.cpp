@@ -8,13 +8,14 @@
 
 #include <RHI/Shader.hpp>
 
+#include <Log/Logger.hpp>
+
 namespace views  = std::views;
 namespace ranges = std::ranges;
 
 namespace Neon::RHI
 {
-    std::mutex                                           s_PipelineStateCacheMutex;
-    std::map<Crypto::Sha256::Bytes, Ptr<IPipelineState>> s_PipelineStateCache;
+    static UPtr<PipelineCache> s_PipelineStateCache;
 
     //
 
@@ -215,28 +216,68 @@ namespace Neon::RHI
     //
 
     Dx12PipelineState::Dx12PipelineState(
-        const PipelineStateBuilderG&              Builder,
-        const D3D12_GRAPHICS_PIPELINE_STATE_DESC& GraphicsDesc)
+        const PipelineStateBuilderG&       Builder,
+        D3D12_GRAPHICS_PIPELINE_STATE_DESC GraphicsDesc,
+        const PipelineCache::Blob*         CachedBlob)
     {
         auto Dx12Device = Dx12RenderDevice::Get()->GetDevice();
-        ThrowIfFailed(Dx12Device->CreateGraphicsPipelineState(
-            &GraphicsDesc,
-            IID_PPV_ARGS(&m_PipelineState)));
+        CreateWithCache(
+            GraphicsDesc,
+            CachedBlob,
+            [&]
+            {
+                return Dx12Device->CreateGraphicsPipelineState(
+                    &GraphicsDesc,
+                    IID_PPV_ARGS(&m_PipelineState));
+            });
     }
 
     Dx12PipelineState::Dx12PipelineState(
-        const PipelineStateBuilderC&             Builder,
-        const D3D12_COMPUTE_PIPELINE_STATE_DESC& ComputeDesc)
+        const PipelineStateBuilderC&      Builder,
+        D3D12_COMPUTE_PIPELINE_STATE_DESC ComputeDesc,
+        const PipelineCache::Blob*        CachedBlob)
     {
         auto Dx12Device = Dx12RenderDevice::Get()->GetDevice();
-        ThrowIfFailed(Dx12Device->CreateComputePipelineState(
-            &ComputeDesc,
-            IID_PPV_ARGS(&m_PipelineState)));
+        CreateWithCache(
+            ComputeDesc,
+            CachedBlob,
+            [&]
+            {
+                return Dx12Device->CreateComputePipelineState(
+                    &ComputeDesc,
+                    IID_PPV_ARGS(&m_PipelineState));
+            });
 
         auto DxShader      = static_cast<Dx12Shader*>(Builder.ComputeShader.get());
         m_ComputeGroupSize = DxShader->GetComputeGroupSize();
     }
 
+    template<typename _DescTy, typename _FnTy>
+    void Dx12PipelineState::CreateWithCache(
+        _DescTy&                   Desc,
+        const PipelineCache::Blob* CachedBlob,
+        _FnTy&&                    Create)
+    {
+        if (CachedBlob && !CachedBlob->empty())
+        {
+            Desc.CachedPSO = {
+                .pCachedBlob           = CachedBlob->data(),
+                .CachedBlobSizeInBytes = CachedBlob->size()
+            };
+
+            // The driver rejects blobs made by another driver version or adapter, or that are corrupted
+            if (SUCCEEDED(Create()))
+            {
+                m_FromCache = true;
+                return;
+            }
+
+            Desc.CachedPSO = {};
+        }
+
+        ThrowIfFailed(Create());
+    }
+
     ID3D12PipelineState* Dx12PipelineState::Get()
     {
         return m_PipelineState.Get();
@@ -247,44 +288,106 @@ namespace Neon::RHI
         return m_ComputeGroupSize;
     }
 
+    bool Dx12PipelineState::IsFromCache() const
+    {
+        return m_FromCache;
+    }
+
+    PipelineCache::Blob Dx12PipelineState::GetCachedBlob() const
+    {
+        WinAPI::ComPtr<ID3DBlob> Blob;
+        if (FAILED(m_PipelineState->GetCachedBlob(&Blob)))
+        {
+            return {};
+        }
+
+        auto Data = std::bit_cast<const uint8_t*>(Blob->GetBufferPointer());
+        return PipelineCache::Blob(Data, Data + Blob->GetBufferSize());
+    }
+
     //
 
+    /// <summary>
+    /// Find the pipeline state in the cache, or create it from its cached blob or from scratch.
+    /// </summary>
+    template<typename _BuilderTy, typename _DescTy>
+    [[nodiscard]] static Ptr<IPipelineState> LoadFromCache(
+        const _BuilderTy&             Builder,
+        const Crypto::Hash128::Bytes& Digest,
+        const _DescTy&                Desc)
+    {
+        NEON_ASSERT(s_PipelineStateCache, "Pipeline state cache is not loaded");
+        return s_PipelineStateCache->FindOrCreate(
+            Digest,
+            [&]
+            {
+                auto CachedBlob    = s_PipelineStateCache->FindBlob(Digest);
+                auto PipelineState = std::make_shared<Dx12PipelineState>(Builder, Desc, CachedBlob.get());
+
+                if (!PipelineState->IsFromCache())
+                {
+                    if (auto Blob = PipelineState->GetCachedBlob(); !Blob.empty())
+                    {
+                        s_PipelineStateCache->StoreBlob(Digest, std::move(Blob));
+                    }
+                    else if (CachedBlob)
+                    {
+                        s_PipelineStateCache->RemoveBlob(Digest);
+                    }
+                }
+                return PipelineState;
+            });
+    }
+
+    //
+
+    void Dx12PipelineStateCache::Load()
+    {
+        s_PipelineStateCache = std::make_unique<PipelineCache>(
+            std::filesystem::temp_directory_path() / "Neon.psocache",
+            GetDeviceKey());
+    }
+
     void Dx12PipelineStateCache::Flush()
     {
-        std::scoped_lock Lock(s_PipelineStateCacheMutex);
-        s_PipelineStateCache.clear();
+        // Destroying the cache saves any new blobs to disk
+        s_PipelineStateCache = nullptr;
     }
 
     Ptr<IPipelineState> Dx12PipelineStateCache::Load(
         const PipelineStateBuilderG& Builder)
     {
         auto Result = Dx12PipelineStateCache::Build(Builder);
-
-        std::scoped_lock Lock(s_PipelineStateCacheMutex);
-
-        auto& Cache = s_PipelineStateCache[Result.Digest];
-        if (!Cache)
-        {
-            Cache = std::make_shared<Dx12PipelineState>(Builder, Result.Desc);
-        }
-
-        return Cache;
+        return LoadFromCache(Builder, Result.Digest, Result.Desc);
     }
 
     Ptr<IPipelineState> Dx12PipelineStateCache::Load(
         const PipelineStateBuilderC& Builder)
     {
         auto Result = Dx12PipelineStateCache::Build(Builder);
+        return LoadFromCache(Builder, Result.Digest, Result.Desc);
+    }
+
+    PipelineCache::Key Dx12PipelineStateCache::GetDeviceKey()
+    {
+        auto Adapter = Dx12RenderDevice::Get()->GetAdapter();
 
-        std::scoped_lock Lock(s_PipelineStateCacheMutex);
+        DXGI_ADAPTER_DESC AdapterDesc{};
+        ThrowIfFailed(Adapter->GetDesc(&AdapterDesc));
 
-        auto& Cache = s_PipelineStateCache[Result.Digest];
-        if (!Cache)
+        LARGE_INTEGER DriverVersion{};
+        if (FAILED(Adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &DriverVersion)))
         {
-            Cache = std::make_shared<Dx12PipelineState>(Builder, Result.Desc);
+            DriverVersion.QuadPart = 0;
         }
 
-        return Cache;
+        Crypto::Hash128 Hash;
+        Hash << AdapterDesc.VendorId
+             << AdapterDesc.DeviceId
+             << AdapterDesc.SubSysId
+             << AdapterDesc.Revision
+             << DriverVersion.QuadPart;
+        return Hash.Digest();
     }
 
     //
@@ -294,19 +397,18 @@ namespace Neon::RHI
     {
         GraphicsBuildResult Result;
 
-        Crypto::Sha256 Hash;
+        auto RootSignature = static_cast<Dx12RootSignature*>(Builder.RootSignature.get());
+
+        PipelineCache::GraphicsShaderKeys ShaderKeys{};
 
         // Root signature
         {
-            auto  RootSignature     = static_cast<Dx12RootSignature*>(Builder.RootSignature.get());
-            auto& RootSignatureHash = RootSignature->GetHash();
-            Hash.Append(RootSignatureHash.data(), RootSignatureHash.size());
-
             Result.Desc.pRootSignature = RootSignature->Get();
         }
 
         // Shaders
         {
+            size_t ShaderIndex = 0;
             for (auto [TargetShader, SrcShader] : {
                      std::pair{ &Result.Desc.VS, Builder.VertexShader.get() },
                      std::pair{ &Result.Desc.PS, Builder.PixelShader.get() },
@@ -320,14 +422,13 @@ namespace Neon::RHI
                     *TargetShader = {
                         ByteCode.Data, ByteCode.Size
                     };
-                    Hash.Append(ByteCode.Data, ByteCode.Size);
+                    ShaderKeys[ShaderIndex] = &static_cast<Dx12Shader*>(SrcShader)->GetHash();
                 }
                 else
                 {
                     *TargetShader = {};
                 }
-
-                Hash << 0xCC0139;
+                ++ShaderIndex;
             }
         }
 
@@ -359,14 +460,11 @@ namespace Neon::RHI
 
                 Dst.RenderTargetWriteMask = Src.WriteMask;
             }
-
-            Hash.Append(std::bit_cast<const uint8_t*>(&BlendState), sizeof(BlendState));
         }
 
         // Sample mask
         {
             Result.Desc.SampleMask = Builder.SampleMask;
-            Hash << Builder.SampleMask;
         }
 
         // Rasterizer state
@@ -386,8 +484,6 @@ namespace Neon::RHI
                 Builder.Rasterizer.ConservativeRaster ? D3D12_CONSERVATIVE_RASTERIZATION_MODE_ON : D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF
 
             );
-
-            Hash.Append(std::bit_cast<const uint8_t*>(&RasterizerState), sizeof(RasterizerState));
         }
 
         {
@@ -408,8 +504,6 @@ namespace Neon::RHI
                 CastStencilOp(Builder.DepthStencil.StencilBackFace.DepthFailOp),
                 CastStencilOp(Builder.DepthStencil.StencilBackFace.PassOp),
                 CastComparisonFunc(Builder.DepthStencil.StencilBackFace.CmpOp));
-
-            Hash.Append(std::bit_cast<const uint8_t*>(&DepthStencilState), sizeof(DepthStencilState));
         }
 
         // Input layout
@@ -437,8 +531,6 @@ namespace Neon::RHI
                 Dst.AlignedByteOffset    = D3D12_APPEND_ALIGNED_ELEMENT;
                 Dst.InputSlotClass       = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA;
                 Dst.InstanceDataStepRate = 0;
-
-                Hash << Name << Element;
             }
 
             if (!Result.InputElements.empty())
@@ -462,8 +554,6 @@ namespace Neon::RHI
                 Result.Desc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFFFFFF;
                 break;
             }
-
-            Hash << Result.Desc.IBStripCutValue;
         }
 
         // Primitive topology
@@ -486,8 +576,6 @@ namespace Neon::RHI
                 Result.Desc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_PATCH;
                 break;
             }
-
-            Hash << Result.Desc.PrimitiveTopologyType;
         }
 
         // Render target formats + depth stencil format
@@ -495,27 +583,20 @@ namespace Neon::RHI
             Result.Desc.NumRenderTargets = UINT(Builder.RTFormats.size());
             ranges::transform(Builder.RTFormats, Result.Desc.RTVFormats, [](auto&& Format)
                               { return CastFormat(Format); });
-            Hash.Append(
-                std::bit_cast<const uint8_t*>(&Result.Desc.RTVFormats[0]),
-                Result.Desc.NumRenderTargets * sizeof(Result.Desc.RTVFormats[0]));
 
             Result.Desc.DSVFormat = CastFormat(Builder.DSFormat);
-            Hash << Result.Desc.DSVFormat;
         }
 
         {
             Result.Desc.SampleDesc.Count   = Builder.SampleCount;
             Result.Desc.SampleDesc.Quality = Builder.SampleQuality;
-            Hash.Append(
-                std::bit_cast<const uint8_t*>(&Result.Desc.SampleDesc),
-                sizeof(Result.Desc.SampleDesc));
         }
 
         Result.Desc.NodeMask  = 0;
         Result.Desc.CachedPSO = {};
         Result.Desc.Flags     = D3D12_PIPELINE_STATE_FLAG_NONE;
 
-        Result.Digest = Hash.Digest();
+        Result.Digest = PipelineCache::MakeKey(Builder, RootSignature->GetHash(), ShaderKeys);
         return Result;
     }
 
@@ -524,31 +605,27 @@ namespace Neon::RHI
     {
         ComputeBuildResult Result;
 
-        Crypto::Sha256 Hash;
+        auto RootSignature = static_cast<Dx12RootSignature*>(Builder.RootSignature.get());
+        auto Shader        = static_cast<Dx12Shader*>(Builder.ComputeShader.get());
 
         // Root signature
         {
-            auto  RootSignature     = static_cast<Dx12RootSignature*>(Builder.RootSignature.get());
-            auto& RootSignatureHash = RootSignature->GetHash();
-            Hash.Append(RootSignatureHash.data(), RootSignatureHash.size());
-
             Result.Desc.pRootSignature = RootSignature->Get();
         }
 
         // Shader
         {
-            auto ByteCode  = Builder.ComputeShader->GetByteCode();
+            auto ByteCode  = Shader->GetByteCode();
             Result.Desc.CS = {
                 ByteCode.Data, ByteCode.Size
             };
-            Hash.Append(ByteCode.Data, ByteCode.Size);
         }
 
         Result.Desc.NodeMask  = 0;
         Result.Desc.CachedPSO = {};
         Result.Desc.Flags     = D3D12_PIPELINE_STATE_FLAG_NONE;
 
-        Result.Digest = Hash.Digest();
+        Result.Digest = PipelineCache::MakeKey(Builder, RootSignature->GetHash(), Shader->GetHash());
         return Result;
     }
 } // namespace Neon::RHI
\ No newline at end of file
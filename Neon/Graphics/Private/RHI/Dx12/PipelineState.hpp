@@ -1,7 +1,8 @@
 #pragma once
 #include <Private/RHI/Dx12/DirectXHeaders.hpp>
 #include <RHI/PipelineState.hpp>
-#include <Crypto/Sha256.hpp>
+#include <RHI/PipelineCache.hpp>
+#include <Crypto/Hash128.hpp>
 
 namespace Neon::RHI
 {
@@ -9,12 +10,14 @@ namespace Neon::RHI
     {
     public:
         Dx12PipelineState(
-            const PipelineStateBuilderG&              Builder,
-            const D3D12_GRAPHICS_PIPELINE_STATE_DESC& GraphicsDesc);
+            const PipelineStateBuilderG&       Builder,
+            D3D12_GRAPHICS_PIPELINE_STATE_DESC GraphicsDesc,
+            const PipelineCache::Blob*         CachedBlob = nullptr);
 
         Dx12PipelineState(
-            const PipelineStateBuilderC&             Builder,
-            const D3D12_COMPUTE_PIPELINE_STATE_DESC& ComputeDesc);
+            const PipelineStateBuilderC&      Builder,
+            D3D12_COMPUTE_PIPELINE_STATE_DESC ComputeDesc,
+            const PipelineCache::Blob*        CachedBlob = nullptr);
 
         /// <summary>
         /// Get underlying D3D12 pipeline state.
@@ -26,17 +29,44 @@ namespace Neon::RHI
         /// </summary>
         [[nodiscard]] const Vector3U& GetComputeGroupSize() const override;
 
+        /// <summary>
+        /// Check if the pipeline state was created from the cached blob it was given.
+        /// </summary>
+        [[nodiscard]] bool IsFromCache() const;
+
+        /// <summary>
+        /// Serialize the pipeline state so it can be recreated faster on the next run.
+        /// </summary>
+        [[nodiscard]] PipelineCache::Blob GetCachedBlob() const;
+
+    private:
+        /// <summary>
+        /// Create the pipeline state from the cached blob if possible, falling back to a full creation
+        /// if the driver rejects it.
+        /// </summary>
+        template<typename _DescTy, typename _FnTy>
+        void CreateWithCache(
+            _DescTy&                   Desc,
+            const PipelineCache::Blob* CachedBlob,
+            _FnTy&&                    Create);
+
     private:
         WinAPI::ComPtr<ID3D12PipelineState> m_PipelineState;
 
         Vector3U m_ComputeGroupSize{};
+        bool     m_FromCache = false;
     };
 
     class Dx12PipelineStateCache
     {
     public:
         /// <summary>
-        /// Clear the pipeline state cache and release all cached pipeline states
+        /// Open the persistent pipeline state cache for the current adapter and driver
+        /// </summary>
+        static void Load();
+
+        /// <summary>
+        /// Save the persistent pipeline state cache and release all cached pipeline states
         /// </summary>
         static void Flush();
 
@@ -55,7 +85,7 @@ namespace Neon::RHI
     private:
         struct GraphicsBuildResult
         {
-            Crypto::Sha256::Bytes                 Digest;
+            Crypto::Hash128::Bytes                Digest;
             D3D12_GRAPHICS_PIPELINE_STATE_DESC    Desc{};
             std::vector<D3D12_INPUT_ELEMENT_DESC> InputElements;
             ShaderInputLayout                     InputLayout;
@@ -67,7 +97,7 @@ namespace Neon::RHI
         };
         struct ComputeBuildResult
         {
-            Crypto::Sha256::Bytes             Digest;
+            Crypto::Hash128::Bytes            Digest;
             D3D12_COMPUTE_PIPELINE_STATE_DESC Desc{};
 
             ComputeBuildResult() = default;
@@ -87,5 +117,10 @@ namespace Neon::RHI
         /// </summary>
         [[nodiscard]] static ComputeBuildResult Build(
             const PipelineStateBuilderC& Builder);
+
+        /// <summary>
+        /// Get the key identifying the adapter and driver the cached blobs are valid for
+        /// </summary>
+        [[nodiscard]] static PipelineCache::Key GetDeviceKey();
     };
 } // namespace Neon::RHI
\ No newline at end of file
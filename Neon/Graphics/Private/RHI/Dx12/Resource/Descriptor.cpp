@@ -698,19 +698,23 @@ namespace Neon::RHI
     DescriptorHeapHandle Dx12RingDescriptorHeapAllocator::Allocate(
         uint32_t DescriptorSize)
     {
-        std::scoped_lock DescLock(m_DescriptorLock);
+        uint32_t HeapSize   = m_HeapDescriptor.GetSize();
+        uint32_t HeapOffset = m_CurrentDescriptorOffset.load(std::memory_order_relaxed);
+        uint32_t NextOffset;
 
-        uint32_t HeapOffset = m_CurrentDescriptorOffset;
-        m_CurrentDescriptorOffset += DescriptorSize;
-        if (m_CurrentDescriptorOffset >= m_HeapDescriptor.GetSize())
+        do
         {
-            m_CurrentDescriptorOffset %= m_HeapDescriptor.GetSize();
-            HeapOffset = 0;
-        }
+            // Wrap around to the start of the heap when the descriptors don't fit at the end
+            NextOffset = HeapOffset + DescriptorSize;
+            if (NextOffset >= HeapSize)
+            {
+                NextOffset = DescriptorSize;
+            }
+        } while (!m_CurrentDescriptorOffset.compare_exchange_weak(HeapOffset, NextOffset, std::memory_order_relaxed));
 
         return {
             .Heap   = &m_HeapDescriptor,
-            .Offset = HeapOffset,
+            .Offset = NextOffset - DescriptorSize,
             .Size   = DescriptorSize
         };
     }
@@ -747,22 +751,40 @@ namespace Neon::RHI
     DescriptorHeapHandle Dx12DescriptorHeapBuddyAllocator::Allocate(
         uint32_t DescriptorSize)
     {
-        std::scoped_lock HeapLock(m_HeapBlocksMutex);
-
-        for (auto Iter = m_HeapBlocks.begin(); Iter != m_HeapBlocks.end(); Iter++)
+        auto TryAllocate = [this, DescriptorSize](uint32_t First, uint32_t Last) -> DescriptorHeapHandle
         {
-            if (auto Hndl = Iter->Allocator.Allocate(DescriptorSize))
+            for (uint32_t i = First; i < Last; i++)
             {
-                return {
-                    .Heap   = &Iter->Heap,
-                    .Offset = uint32_t(Hndl.Offset),
-                    .Size   = uint32_t(Hndl.Size)
-                };
+                auto& Block = GetBlock(i);
+                if (auto Hndl = Block.Allocator.Allocate(DescriptorSize))
+                {
+                    return {
+                        .Heap   = &Block.Heap,
+                        .Offset = Hndl.Offset,
+                        .Size   = Hndl.Size
+                    };
+                }
             }
+            return {};
+        };
+
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        if (auto Hndl = TryAllocate(0, BlockCount)) [[likely]]
+        {
+            return Hndl;
+        }
+
+        std::scoped_lock HeapLock(m_HeapBlocksMutex);
+
+        // Another thread may have added a block while we were waiting
+        uint32_t NewBlockCount = m_HeapBlockCount.load(std::memory_order_relaxed);
+        if (auto Hndl = TryAllocate(BlockCount, NewBlockCount))
+        {
+            return Hndl;
         }
 
         // Grow the heap for each new allocation
-        if (!m_HeapBlocks.empty()) [[likely]]
+        if (NewBlockCount) [[likely]]
         {
             m_HeapBlockAllocInfo.SizeOfHeap *= 2;
         }
@@ -773,56 +795,101 @@ namespace Neon::RHI
         }
         m_HeapBlockAllocInfo.SizeOfHeap = LimitDescriptorHeapSize(m_HeapBlockAllocInfo.DescriptorType == D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, m_HeapBlockAllocInfo.SizeOfHeap);
 
-        auto& Block = m_HeapBlocks.emplace_back(m_HeapBlockAllocInfo);
+        if (m_HeapBlockAllocInfo.SizeOfHeap < DescriptorSize)
+        {
+            NEON_ERROR_TAG("Graphics", "Can't allocate {} descriptors, a descriptor heap holds at most {}", DescriptorSize, m_HeapBlockAllocInfo.SizeOfHeap);
+            return {};
+        }
+
+        auto [ChunkIndex, Slot] = GetBlockSlot(NewBlockCount);
+
+        auto& Chunk = m_HeapBlocks[ChunkIndex];
+        if (!Chunk)
+        {
+            Chunk = std::make_unique<UPtr<BuddyBlock>[]>(s_FirstChunkSize << ChunkIndex);
+        }
+
+        auto& Block = *(Chunk[Slot] = std::make_unique<BuddyBlock>(m_HeapBlockAllocInfo));
         auto  Hndl  = Block.Allocator.Allocate(DescriptorSize);
 
+        m_HeapBlockCount.store(NewBlockCount + 1, std::memory_order_release);
+
+        if (!Hndl)
+        {
+            NEON_ERROR_TAG("Graphics", "Failed to allocate {} descriptors from a new descriptor heap of {}", DescriptorSize, m_HeapBlockAllocInfo.SizeOfHeap);
+            return {};
+        }
+
         return {
             .Heap   = &Block.Heap,
-            .Offset = uint32_t(Hndl.Offset),
-            .Size   = uint32_t(Hndl.Size)
+            .Offset = Hndl.Offset,
+            .Size   = Hndl.Size
         };
     }
 
     void Dx12DescriptorHeapBuddyAllocator::Free(
         std::span<const DescriptorHeapHandle> Handles)
     {
-        std::scoped_lock HeapLock(m_HeapBlocksMutex);
+        std::vector<Allocator::CachedRangeAllocator::Handle> Batch;
+        Batch.reserve(Handles.size());
 
-        for (auto& Data : Handles)
+        size_t   FreeCount  = 0;
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < BlockCount; i++)
         {
-            bool Exists = false;
-            for (auto& Block : m_HeapBlocks)
+            auto& Block = GetBlock(i);
+
+            Batch.clear();
+            for (auto& Data : Handles)
             {
                 if (Data.Heap == &Block.Heap)
                 {
-                    Block.Allocator.Free({ .Offset = Data.Offset, .Size = Data.Size });
-                    Exists = true;
-                    break;
+                    Batch.push_back({ .Offset = Data.Offset, .Size = Data.Size });
                 }
             }
-            NEON_ASSERT(Exists, "Tried to free a non-existant heap");
+
+            if (!Batch.empty())
+            {
+                Block.Allocator.Free(Batch);
+                FreeCount += Batch.size();
+            }
         }
+        NEON_ASSERT(FreeCount == Handles.size(), "Tried to free a non-existant heap");
     }
 
     void Dx12DescriptorHeapBuddyAllocator::FreeAll()
     {
-        std::scoped_lock HeapLock(m_HeapBlocksMutex);
-
-        for (auto& Block : m_HeapBlocks)
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < BlockCount; i++)
         {
-            Block.Allocator = Allocator::BuddyAllocator(Block.Heap.GetSize());
+            GetBlock(i).Allocator.FreeAll();
         }
     }
 
     IDescriptorHeap* Dx12DescriptorHeapBuddyAllocator::GetHeap(
         uint32_t Index)
     {
-        NEON_ASSERT(Index < m_HeapBlocks.size());
-        return &std::next(m_HeapBlocks.begin(), Index)->Heap;
+        NEON_ASSERT(Index < m_HeapBlockCount.load(std::memory_order_acquire));
+        return &GetBlock(Index).Heap;
     }
 
     uint32_t Dx12DescriptorHeapBuddyAllocator::GetHeapsCount()
     {
-        return uint32_t(m_HeapBlocks.size());
+        return m_HeapBlockCount.load(std::memory_order_acquire);
+    }
+
+    auto Dx12DescriptorHeapBuddyAllocator::GetBlock(
+        uint32_t Index) noexcept -> BuddyBlock&
+    {
+        auto [ChunkIndex, Slot] = GetBlockSlot(Index);
+        return *m_HeapBlocks[ChunkIndex][Slot];
+    }
+
+    std::pair<uint32_t, uint32_t> Dx12DescriptorHeapBuddyAllocator::GetBlockSlot(
+        uint32_t Index) noexcept
+    {
+        // Chunk N holds s_FirstChunkSize << N blocks, and starts after s_FirstChunkSize * (2^N - 1) blocks
+        uint32_t ChunkIndex = uint32_t(std::bit_width(Index / s_FirstChunkSize + 1) - 1);
+        return { ChunkIndex, Index - s_FirstChunkSize * ((1u << ChunkIndex) - 1) };
     }
 } // namespace Neon::RHI
\ No newline at end of file
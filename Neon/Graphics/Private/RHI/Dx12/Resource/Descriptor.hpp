@@ -3,7 +3,7 @@
 #include <GraphicsPCH.hpp>
 #include <RHI/Resource/Descriptor.hpp>
 #include <Private/RHI/Dx12/DirectXHeaders.hpp>
-#include <Allocator/Buddy.hpp>
+#include <Allocator/CachedRange.hpp>
 
 namespace Neon::RHI
 {
@@ -194,24 +194,32 @@ namespace Neon::RHI
         uint32_t GetHeapsCount() override;
 
     private:
-        std::mutex         m_DescriptorLock;
-        Dx12DescriptorHeap m_HeapDescriptor;
-        uint32_t           m_CurrentDescriptorOffset = 0;
+        Dx12DescriptorHeap    m_HeapDescriptor;
+        std::atomic<uint32_t> m_CurrentDescriptorOffset = 0;
     };
 
     //
 
     class Dx12DescriptorHeapBuddyAllocator final : public IDescriptorHeapAllocator
     {
+        /// <summary>
+        /// Blocks are stored in chunks that double in size, so the list grows without moving the published blocks.
+        /// </summary>
+        static constexpr uint32_t s_FirstChunkSize = 8;
+        static constexpr uint32_t s_ChunkCount     = 29;
+
         struct BuddyBlock
         {
-            Dx12DescriptorHeap        Heap;
-            Allocator::BuddyAllocator Allocator;
+            Dx12DescriptorHeap              Heap;
+            Allocator::CachedRangeAllocator Allocator;
 
             BuddyBlock(
                 const HeapDescriptorAllocInfo& Info);
         };
 
+        using BuddyBlockChunk = std::unique_ptr<UPtr<BuddyBlock>[]>;
+        using BuddyBlockList  = std::array<BuddyBlockChunk, s_ChunkCount>;
+
     public:
         Dx12DescriptorHeapBuddyAllocator(
             D3D12_DESCRIPTOR_HEAP_TYPE DescriptorType,
@@ -237,17 +245,35 @@ namespace Neon::RHI
         /// </summary>
         auto GetAllHeaps() noexcept
         {
-            return m_HeapBlocks |
+            return std::views::iota(0u, m_HeapBlockCount.load(std::memory_order_acquire)) |
                    std::views::transform(
-                       [](auto& Block) -> Dx12DescriptorHeap*
+                       [this](uint32_t Index) -> Dx12DescriptorHeap*
                        {
-                           return &Block.Heap;
+                           return &GetBlock(Index).Heap;
                        });
         }
 
     private:
+        /// <summary>
+        /// Get a block by its index, it must be published.
+        /// </summary>
+        [[nodiscard]] BuddyBlock& GetBlock(
+            uint32_t Index) noexcept;
+
+        /// <summary>
+        /// Get the chunk a block is stored in and its index in that chunk.
+        /// </summary>
+        [[nodiscard]] static std::pair<uint32_t, uint32_t> GetBlockSlot(
+            uint32_t Index) noexcept;
+
+    private:
+        /// <summary>
+        /// Blocks are only appended, so allocations can walk the published ones without locking.
+        /// The mutex is only taken to add a new block, and a chunk before its first block is published.
+        /// </summary>
         std::mutex              m_HeapBlocksMutex;
         HeapDescriptorAllocInfo m_HeapBlockAllocInfo;
-        std::list<BuddyBlock>   m_HeapBlocks;
+        BuddyBlockList          m_HeapBlocks;
+        std::atomic<uint32_t>   m_HeapBlockCount = 0;
     };
 } // namespace Neon::RHI
\ No newline at end of file
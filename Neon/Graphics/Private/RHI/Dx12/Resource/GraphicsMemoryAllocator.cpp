@@ -63,7 +63,37 @@ namespace Neon::RHI
         Buffer->SilentRelease();
     }
 
-    RHI::GraphicsMemoryAllocator::GraphicsMemoryAllocator()
+    RHI::GraphicsMemoryAllocator::GraphicsMemoryAllocator() :
+        m_FrameRing(
+            [](size_t PageSize)
+            {
+                IGpuResource::InitDesc InitDesc;
+                InitDesc.InitialState.Set(EResourceState::CopySource);
+                InitDesc.Name = STR("GraphicsMemoryAllocator::FrameUploadBuffer");
+
+                auto Buffer = static_cast<Dx12GpuResource*>(
+                    IGpuResource::Create(
+                        ResourceDesc::Buffer(
+                            Math::AlignUp(PageSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT),
+                            {},
+                            GraphicsBufferType::Upload),
+                        InitDesc));
+
+                // Upload heaps can stay mapped for the lifetime of the resource
+                return Allocator::FrameRingAllocator::PageMemory{
+                    .Context    = Buffer,
+                    .CpuAddress = Buffer->Map(),
+                    .GpuAddress = Buffer->GetHandle(0).Value,
+                    .Size       = Buffer->GetSize()
+                };
+            },
+            [](const Allocator::FrameRingAllocator::PageMemory& Page)
+            {
+                auto Buffer = static_cast<Dx12GpuResource*>(Page.Context);
+                Buffer->Unmap();
+                Buffer->SilentRelease();
+                delete Buffer;
+            })
     {
         auto Dx12Device  = Dx12RenderDevice::Get()->GetDevice();
         auto Dx12Adapter = Dx12RenderDevice::Get()->GetAdapter();
@@ -77,6 +107,8 @@ namespace Neon::RHI
 
     void GraphicsMemoryAllocator::Shutdown()
     {
+        m_FrameRing.Shutdown();
+
         std::scoped_lock BufferLock(m_PoolMutex);
         for (auto& Allocator : m_BufferAllocators)
         {
@@ -156,6 +188,21 @@ namespace Neon::RHI
         }
     }
 
+    Allocator::FrameRingAllocator::Allocation GraphicsMemoryAllocator::AllocateFrame(
+        size_t BufferSize,
+        size_t Alignement)
+    {
+        NEON_ASSERT(Alignement > 0);
+        return m_FrameRing.Allocate(BufferSize, Alignement);
+    }
+
+    void GraphicsMemoryAllocator::BeginFrame(
+        uint64_t FrameId,
+        uint64_t CompletedFrameId)
+    {
+        m_FrameRing.BeginFrame(FrameId, CompletedFrameId);
+    }
+
     Dx12ResourceStateManager* RHI::GraphicsMemoryAllocator::GetStateManager()
     {
         return &m_StateManager;
@@ -5,7 +5,8 @@
 #include <Private/RHI/Dx12/Resource/Resource.hpp>
 #include <RHI/GlobalBuffer.hpp>
 
-#include <Allocator/Buddy.hpp>
+#include <Allocator/TLSF.hpp>
+#include <Allocator/FrameRing.hpp>
 #include <Private/Windows/API/WinPtr.hpp>
 
 #include <mutex>
@@ -32,7 +33,7 @@ namespace Neon::RHI
             Dx12ResourceStateManager& StateManager;
             UPtr<Dx12GpuResource>     Buffer;
 
-            Allocator::BuddyAllocator Allocator;
+            Allocator::TLSFAllocator  Allocator;
 
             BuddyBlock(
                 Dx12ResourceStateManager&     StateManager,
@@ -78,6 +79,21 @@ namespace Neon::RHI
         void FreeBuffers(
             std::span<Handle> Hndl);
 
+    public:
+        /// <summary>
+        /// Allocate upload memory from the frame ring
+        /// </summary>
+        [[nodiscard]] Allocator::FrameRingAllocator::Allocation AllocateFrame(
+            size_t BufferSize,
+            size_t Alignement);
+
+        /// <summary>
+        /// Start a new frame in the frame ring, recycling the pages of completed frames
+        /// </summary>
+        void BeginFrame(
+            uint64_t FrameId,
+            uint64_t CompletedFrameId);
+
     public:
         /// <summary>
         /// Get state manager for this allocator
@@ -89,5 +105,6 @@ namespace Neon::RHI
         std::mutex                         m_PoolMutex;
         WinAPI::ComPtr<D3D12MA::Allocator> m_Allocator;
         BufferAllocatorByFlags             m_BufferAllocators;
+        Allocator::FrameRingAllocator      m_FrameRing;
     };
 } // namespace Neon::RHI
\ No newline at end of file
@@ -8,9 +8,9 @@
 
 namespace Neon::RHI
 {
-    std::mutex                                           s_RootSignatureCacheMutex;
-    std::map<Crypto::Sha256::Bytes, Ptr<IRootSignature>> s_RootSignatureCache;
-    IRootSignature::CommonRootsignatureList              s_CommonRootSignatureCache;
+    std::mutex                                            s_RootSignatureCacheMutex;
+    std::map<Crypto::Hash128::Bytes, Ptr<IRootSignature>> s_RootSignatureCache;
+    IRootSignature::CommonRootsignatureList               s_CommonRootSignatureCache;
 
     //
 
@@ -197,7 +197,7 @@ namespace Neon::RHI
         const RootSignatureBuilder& Builder,
         const void*                 BlobData,
         size_t                      BlobSize,
-        Crypto::Sha256::Bytes&&     Hash) :
+        Crypto::Hash128::Bytes&&    Hash) :
         m_Hash(std::move(Hash))
     {
         auto Dx12Device = Dx12RenderDevice::Get()->GetDevice();
@@ -220,7 +220,7 @@ namespace Neon::RHI
         return m_RootSignature.Get();
     }
 
-    const Crypto::Sha256::Bytes& Dx12RootSignature::GetHash() const
+    const Crypto::Hash128::Bytes& Dx12RootSignature::GetHash() const
     {
         return m_Hash;
     }
@@ -270,7 +270,7 @@ namespace Neon::RHI
         const void* BlobData = SignatureBlob->GetBufferPointer();
         size_t      BlobSize = SignatureBlob->GetBufferSize();
 
-        auto Digest = Crypto::Sha256().Append(BlobData, BlobSize).Digest();
+        auto Digest = Crypto::Hash128().Append(BlobData, BlobSize).Digest();
 
         std::scoped_lock Lock(s_RootSignatureCacheMutex);
 
@@ -59,7 +59,7 @@ namespace Neon::RHI
             const RootSignatureBuilder& Builder,
             const void*                 BlobData,
             size_t                      BlobSize,
-            Crypto::Sha256::Bytes&&     Hash);
+            Crypto::Hash128::Bytes&&    Hash);
 
         /// <summary>
         /// Get the underlying D3D12 root signature
@@ -69,11 +69,11 @@ namespace Neon::RHI
         /// <summary>
         /// Get the root signature hash digest
         /// </summary>
-        [[nodiscard]] const Crypto::Sha256::Bytes& GetHash() const;
+        [[nodiscard]] const Crypto::Hash128::Bytes& GetHash() const;
 
     private:
         WinAPI::ComPtr<ID3D12RootSignature> m_RootSignature;
-        Crypto::Sha256::Bytes               m_Hash;
+        Crypto::Hash128::Bytes              m_Hash;
     };
 
     class Dx12RootSignatureCache
@@ -16,11 +16,12 @@ namespace Neon::RHI
     UPtr<IShader> IShader::Create(
         StringU8View             SourceCode,
         const ShaderCompileDesc& Desc,
-        StringU8View             IncludeDirectory)
+        StringU8View             IncludeDirectory,
+        std::vector<StringU8>*   Includes)
     {
         auto   ShaderCompiler = Dx12RenderDevice::Get()->GetShaderCompiler();
         size_t DataSize;
-        auto   Data = ShaderCompiler->Compile(IncludeDirectory, SourceCode, Desc, DataSize);
+        auto   Data = ShaderCompiler->Compile(IncludeDirectory, SourceCode, Desc, DataSize, Includes);
         return IShader::Create(std::move(Data), DataSize);
     }
 
@@ -34,6 +35,9 @@ namespace Neon::RHI
     {
         NEON_ASSERT(m_ShaderData != nullptr, "Shader data is null.");
         NEON_ASSERT(DataSize, "Shader data size is zero.");
+
+        // The bytecode never changes, hash it once instead of on every pipeline state lookup
+        m_Hash = Crypto::Hash128().Append(m_ShaderData.get(), m_DataSize).Digest();
     }
 
     void Dx12Shader::CreateInputLayout(
@@ -57,6 +61,11 @@ namespace Neon::RHI
         return { m_ShaderData.get(), m_DataSize };
     }
 
+    const Crypto::Hash128::Bytes& Dx12Shader::GetHash() const noexcept
+    {
+        return m_Hash;
+    }
+
     Vector3U Dx12Shader::GetComputeGroupSize() const
     {
         auto     Reflection = GetReflection();
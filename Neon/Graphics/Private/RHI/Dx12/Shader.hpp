@@ -1,6 +1,7 @@
 #pragma once
 
 #include <RHI/Shader.hpp>
+#include <Crypto/Hash128.hpp>
 
 namespace Neon::RHI
 {
@@ -39,8 +40,14 @@ namespace Neon::RHI
         /// </summary>
         [[nodiscard]] WinAPI::ComPtr<ID3D12ShaderReflection> GetReflection() const;
 
+        /// <summary>
+        /// Get the hash of the shader's bytecode
+        /// </summary>
+        [[nodiscard]] const Crypto::Hash128::Bytes& GetHash() const noexcept;
+
     private:
         std::unique_ptr<uint8_t[]> m_ShaderData;
         size_t                     m_DataSize;
+        Crypto::Hash128::Bytes     m_Hash;
     };
 } // namespace Neon::RHI
@@ -87,12 +87,14 @@ namespace Neon::RHI
     {
     public:
         IncludeHandler(
-            IDxcUtils*          Utils,
-            IDxcIncludeHandler* DefaultIncludeHandler,
-            StringU8View        IncludeDirectory) :
+            IDxcUtils*             Utils,
+            IDxcIncludeHandler*    DefaultIncludeHandler,
+            StringU8View           IncludeDirectory,
+            std::vector<StringU8>* Includes) :
             m_Utils(Utils),
             m_DefaultIncludeHandler(DefaultIncludeHandler),
-            m_IncludeDirectory(IncludeDirectory)
+            m_IncludeDirectory(IncludeDirectory),
+            m_Includes(Includes)
         {
         }
 
@@ -135,9 +137,9 @@ namespace Neon::RHI
             // At first, we will find all shaders in Engine/Shaders/*, and GoBackCount could be 0 or 1 (depends if the user use ../)
             uint32_t GoBackStart = 1;
 
-            for (std::filesystem::path Path : {
+            for (std::filesystem::path Path : std::initializer_list<StringU8View>{
                      "Engine/Shaders",
-                     m_IncludeDirectory.empty() ? m_IncludeDirectory.data() : nullptr })
+                     m_IncludeDirectory })
             {
                 if (Path.empty()) [[unlikely]]
                 {
@@ -171,7 +173,6 @@ namespace Neon::RHI
                 auto Handle = Asset::Storage::FindAsset(PathToAsset, true, true).second;
                 if (Handle.is_nil()) [[unlikely]]
                 {
-                    m_TextFiles.pop_back();
                     continue;
                 }
 
@@ -196,6 +197,10 @@ namespace Neon::RHI
                     *IncludeSourceBlob = ShaderCodeBlob.Get();
                     (*IncludeSourceBlob)->AddRef();
                     m_LoadedFiles.emplace(FileName, std::move(ShaderCodeBlob));
+                    if (m_Includes)
+                    {
+                        m_Includes->emplace_back(std::move(PathToAsset));
+                    }
                     return S_OK;
                 }
                 else
@@ -225,9 +230,10 @@ namespace Neon::RHI
         }
 
     private:
-        IDxcUtils*          m_Utils;
-        IDxcIncludeHandler* m_DefaultIncludeHandler;
-        StringU8View        m_IncludeDirectory;
+        IDxcUtils*             m_Utils;
+        IDxcIncludeHandler*    m_DefaultIncludeHandler;
+        StringU8View           m_IncludeDirectory;
+        std::vector<StringU8>* m_Includes;
 
         std::vector<Ptr<Asset::TextFileAsset>>             m_TextFiles;
         std::map<String, WinAPI::ComPtr<IDxcBlobEncoding>> m_LoadedFiles;
@@ -239,7 +245,8 @@ namespace Neon::RHI
         StringU8View             IncludeDirectory,
         StringU8View             SourceCode,
         const ShaderCompileDesc& Desc,
-        size_t&                  DataSize)
+        size_t&                  DataSize,
+        std::vector<StringU8>*   Includes)
     {
         WinAPI::ComPtr<IDxcBlobEncoding> ShaderCodeBlob;
         ThrowIfFailed(m_Utils->CreateBlobFromPinned(
@@ -320,7 +327,8 @@ namespace Neon::RHI
             IncludeHandler Handler(
                 m_Utils.Get(),
                 m_DefaultIncludeHandler.Get(),
-                IncludeDirectory);
+                IncludeDirectory,
+                Includes);
 
             ThrowIfFailed(m_Compiler->Compile(
                 &Buffer,
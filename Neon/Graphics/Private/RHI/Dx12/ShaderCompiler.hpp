@@ -17,12 +17,14 @@ namespace Neon::RHI
 
         /// <summary>
         /// Compile shader from source code
+        /// If Includes is not null, the asset paths of every included file are appended to it
         /// </summary>
         std::unique_ptr<uint8_t[]> Compile(
             StringU8View             IncludeDirectory,
             StringU8View             SourceCode,
             const ShaderCompileDesc& Desc,
-            size_t&                  DataSize);
+            size_t&                  DataSize,
+            std::vector<StringU8>*   Includes = nullptr);
 
         /// <summary>
         /// Reflect shader layout from shader bytecode
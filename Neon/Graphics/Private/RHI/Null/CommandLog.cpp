@@ -0,0 +1,57 @@
+#include <GraphicsPCH.hpp>
+#include <RHI/Null/CommandLog.hpp>
+
+namespace Neon::RHI
+{
+    static NullCommandLog s_CommandLog;
+
+    //
+
+    NullCommandLog* NullCommandLog::Get()
+    {
+        return &s_CommandLog;
+    }
+
+    void NullCommandLog::Submit(
+        CommandQueueType                   Queue,
+        std::vector<NullCommands::Command> Commands)
+    {
+        if (!IsRecording())
+        {
+            return;
+        }
+
+        std::scoped_lock Lock(m_Mutex);
+        m_Submissions.emplace_back(Submission{ .Queue = Queue, .FrameId = GetFrameId(), .Commands = std::move(Commands) });
+    }
+
+    auto NullCommandLog::Take() -> std::vector<Submission>
+    {
+        std::scoped_lock Lock(m_Mutex);
+        return std::exchange(m_Submissions, {});
+    }
+
+    void NullCommandLog::Clear()
+    {
+        std::scoped_lock Lock(m_Mutex);
+        m_Submissions.clear();
+    }
+
+    size_t NullCommandLog::GetSubmissionCount() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+        return m_Submissions.size();
+    }
+
+    size_t NullCommandLog::GetCommandCount() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+
+        size_t Count = 0;
+        for (auto& Submitted : m_Submissions)
+        {
+            Count += Submitted.Commands.size();
+        }
+        return Count;
+    }
+} // namespace Neon::RHI
\ No newline at end of file
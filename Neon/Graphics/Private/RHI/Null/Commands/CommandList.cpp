@@ -0,0 +1,473 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Commands/CommandList.hpp>
+#include <Private/RHI/Null/Resource/Resource.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+#include <Private/RHI/Null/RootSignature.hpp>
+#include <Private/RHI/Null/PipelineState.hpp>
+#include <RHI/Resource/Views/Shader.hpp>
+#include <Private/RHI/Null/GlobalDescriptors.hpp>
+#include <RHI/GlobalBuffer.hpp>
+
+#include <Math/Colors.hpp>
+#include <Math/Rect.hpp>
+#include <Math/Viewport.hpp>
+
+#include <algorithm>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    void NullCommandList::BeginEvent(
+        const StringU8& Text,
+        const Color4&   Color)
+    {
+        m_Commands.emplace_back(NullCommands::BeginEvent{ .Text = Text, .Color = Color });
+    }
+
+    void NullCommandList::MarkEvent(
+        const StringU8& Text,
+        const Color4&   Color)
+    {
+        m_Commands.emplace_back(NullCommands::MarkEvent{ .Text = Text, .Color = Color });
+    }
+
+    void NullCommandList::EndEvent()
+    {
+        m_Commands.emplace_back(NullCommands::EndEvent{});
+    }
+
+    //
+
+    void NullCommandList::CopySubresources(
+        IGpuResource*                    DstResource,
+        IGpuResource*                    Intermediate,
+        size_t                           IntOffset,
+        uint32_t                         FirstSubresource,
+        std::span<const SubresourceDesc> SubResources)
+    {
+        uint32_t SubresourceCount = uint32_t(SubResources.size());
+
+        std::vector<SubresourceFootprint> Footprints(SubresourceCount);
+        std::vector<uint32_t>             NumRows(SubresourceCount);
+        std::vector<size_t>               RowSizes(SubresourceCount);
+
+        size_t TotalBytes;
+        DstResource->QueryFootprint(
+            FirstSubresource,
+            SubresourceCount,
+            IntOffset,
+            Footprints.data(),
+            NumRows.data(),
+            RowSizes.data(),
+            &TotalBytes);
+
+        NEON_ASSERT(IntOffset + TotalBytes <= Intermediate->GetSize(), "Intermediate buffer is too small");
+
+        // Like the device would, the data is written to the intermediate buffer while recording
+        auto IntermediateData = Intermediate->Map();
+        for (uint32_t i = 0; i < SubresourceCount; i++)
+        {
+            auto& Footprint   = Footprints[i];
+            auto& Subresource = SubResources[i];
+            auto  SrcData     = static_cast<const uint8_t*>(Subresource.Data);
+            auto  RowSize     = std::min(RowSizes[i], Subresource.RowPitch);
+
+            for (uint32_t z = 0; z < Footprint.Depth; z++)
+            {
+                for (uint32_t Row = 0; Row < NumRows[i]; Row++)
+                {
+                    std::copy_n(
+                        SrcData + z * Subresource.SlicePitch + Row * Subresource.RowPitch,
+                        RowSize,
+                        IntermediateData + Footprint.Offset + (size_t(z) * NumRows[i] + Row) * Footprint.RowPitch);
+                }
+            }
+        }
+        Intermediate->Unmap();
+
+        m_Commands.emplace_back(NullCommands::CopySubresources{
+            .Dst              = DstResource,
+            .Intermediate     = Intermediate,
+            .IntOffset        = IntOffset,
+            .FirstSubresource = FirstSubresource,
+            .SubresourceCount = SubresourceCount });
+    }
+
+    void NullCommandList::CopyResource(
+        IGpuResource* DstResource,
+        IGpuResource* SrcResource)
+    {
+        m_Commands.emplace_back(NullCommands::CopyResource{
+            .Dst = DstResource,
+            .Src = SrcResource });
+    }
+
+    void NullCommandList::CopyBufferRegion(
+        IGpuResource* DstBuffer,
+        size_t        DstOffset,
+        IGpuResource* SrcBuffer,
+        size_t        SrcOffset,
+        size_t        NumBytes)
+    {
+        m_Commands.emplace_back(NullCommands::CopyBufferRegion{
+            .Dst       = DstBuffer,
+            .DstOffset = DstOffset,
+            .Src       = SrcBuffer,
+            .SrcOffset = SrcOffset,
+            .NumBytes  = NumBytes });
+    }
+
+    void NullCommandList::CopyTextureRegion(
+        const TextureCopyLocation& Dst,
+        const Vector3I&            DstPosition,
+        const TextureCopyLocation& Src,
+        const CopyBox*             SrcBox)
+    {
+        m_Commands.emplace_back(NullCommands::CopyTextureRegion{
+            .Dst         = Dst,
+            .DstPosition = DstPosition,
+            .Src         = Src,
+            .SrcBox      = SrcBox ? std::optional(*SrcBox) : std::nullopt });
+    }
+
+    void NullCommandList::InsertUAVBarrier(
+        std::span<RHI::IGpuResource*> Resources)
+    {
+        m_Commands.emplace_back(NullCommands::UavBarrier{
+            .Resources = { Resources.begin(), Resources.end() } });
+    }
+
+    //
+
+    void NullCommandList::SetRootSignature(
+        bool                       IsDirect,
+        const Ptr<IRootSignature>& RootSig)
+    {
+        if (m_RootSignature != RootSig)
+        {
+            m_Commands.emplace_back(NullCommands::SetRootSignature{
+                .IsDirect      = IsDirect,
+                .RootSignature = RootSig.get() });
+            m_RootSignature = RootSig;
+        }
+    }
+
+    void NullCommandList::SetPipelineState(
+        const Ptr<IPipelineState>& State)
+    {
+        if (m_PipelineState != State)
+        {
+            m_Commands.emplace_back(NullCommands::SetPipelineState{
+                .PipelineState = State.get() });
+            m_PipelineState = State;
+        }
+    }
+
+    //
+
+    void NullCommandList::BindMaterialParameters(
+        bool              IsDirect,
+        GpuResourceHandle FrameData)
+    {
+        auto RootSig = IRootSignature::Get(RSCommon::Type::Material);
+        if (m_RootSignature == RootSig)
+        {
+            return;
+        }
+        SetRootSignature(IsDirect, RootSig);
+
+        SetResourceView(IsDirect, CstResourceViewType::Cbv, uint32_t(RSCommon::MaterialRS::FrameData), FrameData);
+
+        // Set sampler descriptor
+        {
+            auto Descriptor = static_cast<NullFrameDescriptorHeap*>(IFrameDescriptorHeap::Get(DescriptorType::Sampler));
+            auto Handle     = Descriptor->GetHeap()->GetGPUAddress();
+            for (uint32_t i : std::views::iota(uint32_t(RSCommon::MaterialRS::_SamplersStart),
+                                               uint32_t(RSCommon::MaterialRS::_SamplersEnd) + 1))
+            {
+                SetDescriptorTable(IsDirect, i, Handle);
+            }
+        }
+
+        // Set resource descriptor
+        {
+            auto Descriptor = static_cast<NullFrameDescriptorHeap*>(IFrameDescriptorHeap::Get(DescriptorType::ResourceView));
+            auto Handle     = Descriptor->GetHeap()->GetGPUAddress();
+            for (uint32_t i : std::views::iota(uint32_t(RSCommon::MaterialRS::_ResourcesStart),
+                                               uint32_t(RSCommon::MaterialRS::_ResourcesEnd) + 1))
+            {
+                SetDescriptorTable(IsDirect, i, Handle);
+            }
+        }
+    }
+
+    //
+
+    void NullCommandList::SetConstants(
+        bool        IsDirect,
+        uint32_t    RootIndex,
+        const void* Constants,
+        size_t      NumConstants32Bit,
+        size_t      DestOffset)
+    {
+        auto Data = static_cast<const uint32_t*>(Constants);
+        m_Commands.emplace_back(NullCommands::SetConstants{
+            .IsDirect   = IsDirect,
+            .RootIndex  = RootIndex,
+            .DestOffset = DestOffset,
+            .Constants  = { Data, Data + NumConstants32Bit } });
+    }
+
+    void NullCommandList::SetResourceView(
+        bool                IsDirect,
+        CstResourceViewType Type,
+        uint32_t            RootIndex,
+        GpuResourceHandle   Handle)
+    {
+        m_Commands.emplace_back(NullCommands::SetResourceView{
+            .IsDirect  = IsDirect,
+            .Type      = Type,
+            .RootIndex = RootIndex,
+            .Handle    = Handle });
+    }
+
+    void NullCommandList::SetDynamicResourceView(
+        bool                IsDirect,
+        CstResourceViewType Type,
+        uint32_t            RootIndex,
+        const void*         Data,
+        size_t              Size)
+    {
+        const uint32_t Alignment =
+            Type == CstResourceViewType::Cbv ? uint32_t(ConstantBufferAlignement) : 1;
+
+        // Read only views are written once and consumed by this frame, so they come from the frame ring
+        if (Type != CstResourceViewType::Uav)
+        {
+            SetResourceView(
+                IsDirect,
+                Type,
+                RootIndex,
+                IGlobalBufferPool::UploadFrame(Data, Size, Alignment));
+            return;
+        }
+
+        UBufferPoolHandle Buffer(
+            Size,
+            Alignment,
+            IGlobalBufferPool::BufferType::ReadWriteGPURW);
+
+        Buffer.AsUpload().Write(Buffer.Offset, Data, Size);
+
+        SetResourceView(
+            IsDirect,
+            Type,
+            RootIndex,
+            Buffer.GetGpuHandle());
+    }
+
+    void NullCommandList::SetDescriptorTable(
+        bool                IsDirect,
+        uint32_t            RootIndex,
+        GpuDescriptorHandle Handle)
+    {
+        m_Commands.emplace_back(NullCommands::SetDescriptorTable{
+            .IsDirect  = IsDirect,
+            .RootIndex = RootIndex,
+            .Handle    = Handle });
+    }
+
+    void NullCommandList::SetDynamicDescriptorTable(
+        bool                IsDirect,
+        uint32_t            RootIndex,
+        CpuDescriptorHandle Handle,
+        uint32_t            Size,
+        bool                IsSampler)
+    {
+        auto Descriptor = IFrameDescriptorHeap::Get(IsSampler ? DescriptorType::Sampler : DescriptorType::ResourceView)->Allocate(Size);
+        Descriptor.Heap->Copy(
+            Descriptor.Offset,
+            { .Descriptor = Handle,
+              .CopySize   = Size });
+        SetDescriptorTable(
+            IsDirect,
+            RootIndex,
+            Descriptor.GetGpuHandle());
+    }
+
+    //
+
+    void NullCommandList::ClearUavFloat(
+        IGpuResource*       Resource,
+        GpuDescriptorHandle GpuUavHandle,
+        CpuDescriptorHandle CpuUavHandle,
+        const Vector4&      Value)
+    {
+        m_Commands.emplace_back(NullCommands::ClearUavFloat{
+            .Resource     = Resource,
+            .GpuUavHandle = GpuUavHandle,
+            .CpuUavHandle = CpuUavHandle,
+            .Value        = Value });
+    }
+
+    void NullCommandList::ClearUavUInt(
+        IGpuResource*       Resource,
+        GpuDescriptorHandle GpuUavHandle,
+        CpuDescriptorHandle CpuUavHandle,
+        const Vector4U&     Value)
+    {
+        m_Commands.emplace_back(NullCommands::ClearUavUInt{
+            .Resource     = Resource,
+            .GpuUavHandle = GpuUavHandle,
+            .CpuUavHandle = CpuUavHandle,
+            .Value        = Value });
+    }
+
+    //
+
+    void NullCommandList::ClearRtv(
+        CpuDescriptorHandle RtvHandle,
+        const Color4&       Color)
+    {
+        m_Commands.emplace_back(NullCommands::ClearRtv{
+            .RtvHandle = RtvHandle,
+            .Color     = Color });
+    }
+
+    void NullCommandList::ClearDsv(
+        CpuDescriptorHandle    RtvHandle,
+        std::optional<float>   Depth,
+        std::optional<uint8_t> Stencil)
+    {
+        m_Commands.emplace_back(NullCommands::ClearDsv{
+            .DsvHandle = RtvHandle,
+            .Depth     = Depth,
+            .Stencil   = Stencil });
+    }
+
+    void NullCommandList::SetRenderTargets(
+        CpuDescriptorHandle        ContiguousRtvs,
+        size_t                     RenderTargetCount,
+        const CpuDescriptorHandle* DepthStencil)
+    {
+        NullCommands::SetRenderTargets Command;
+        Command.RenderTargets.reserve(RenderTargetCount);
+        for (size_t i = 0; i < RenderTargetCount; i++)
+        {
+            Command.RenderTargets.emplace_back(ContiguousRtvs.Value + i * sizeof(NullDescriptor));
+        }
+        if (DepthStencil)
+        {
+            Command.DepthStencil = *DepthStencil;
+        }
+        m_Commands.emplace_back(std::move(Command));
+    }
+
+    void NullCommandList::SetRenderTargets(
+        const CpuDescriptorHandle* Rtvs,
+        size_t                     RenderTargetCount,
+        const CpuDescriptorHandle* DepthStencil)
+    {
+        NullCommands::SetRenderTargets Command{
+            .RenderTargets = { Rtvs, Rtvs + RenderTargetCount }
+        };
+        if (DepthStencil)
+        {
+            Command.DepthStencil = *DepthStencil;
+        }
+        m_Commands.emplace_back(std::move(Command));
+    }
+
+    //
+
+    void NullCommandList::SetScissorRect(
+        std::span<RectT<Vector2>> Scissors)
+    {
+        m_Commands.emplace_back(NullCommands::SetScissorRects{
+            .Scissors = { Scissors.begin(), Scissors.end() } });
+    }
+
+    void NullCommandList::SetViewport(
+        std::span<ViewportF> Views)
+    {
+        m_Commands.emplace_back(NullCommands::SetViewports{
+            .Viewports = { Views.begin(), Views.end() } });
+    }
+
+    void NullCommandList::SetPrimitiveTopology(
+        PrimitiveTopology Topology)
+    {
+        m_Commands.emplace_back(NullCommands::SetPrimitiveTopology{
+            .Topology = Topology });
+    }
+
+    void NullCommandList::SetIndexBuffer(
+        const Views::Index& View)
+    {
+        m_Commands.emplace_back(NullCommands::SetIndexBuffer{
+            .View = View.Get() });
+    }
+
+    void NullCommandList::SetVertexBuffer(
+        size_t               StartSlot,
+        const Views::Vertex& Views)
+    {
+        m_Commands.emplace_back(NullCommands::SetVertexBuffers{
+            .StartSlot = StartSlot,
+            .Views     = { Views.GetViews().begin(), Views.GetViews().end() } });
+    }
+
+    //
+
+    void NullCommandList::Draw(
+        const DrawIndexArgs& Args)
+    {
+        m_Commands.emplace_back(NullCommands::DrawIndexed{ .Args = Args });
+    }
+
+    void NullCommandList::Draw(
+        const DrawArgs& Args)
+    {
+        m_Commands.emplace_back(NullCommands::Draw{ .Args = Args });
+    }
+
+    //
+
+    void NullCommandList::Dispatch(
+        size_t GroupCountX,
+        size_t GroupCountY,
+        size_t GroupCountZ)
+    {
+        NEON_ASSERT(m_PipelineState, "Dispatch without a pipeline state");
+        auto& GroupSize = m_PipelineState->GetComputeGroupSize();
+        m_Commands.emplace_back(NullCommands::Dispatch{
+            .GroupCountX = uint32_t(Math::DivideByMultiple(GroupCountX, GroupSize.x)),
+            .GroupCountY = uint32_t(Math::DivideByMultiple(GroupCountY, GroupSize.y)),
+            .GroupCountZ = uint32_t(Math::DivideByMultiple(GroupCountZ, GroupSize.z)) });
+    }
+
+    //
+
+    void NullCommandList::Reset()
+    {
+        m_Commands.clear();
+        m_PipelineState = nullptr;
+        m_RootSignature = nullptr;
+    }
+
+    //
+
+    void NullCommandList::RecordBarriers(
+        std::span<const NullCommands::Barrier> Barriers)
+    {
+        m_Commands.insert(m_Commands.end(), Barriers.begin(), Barriers.end());
+    }
+
+    std::vector<NullCommands::Command> NullCommandList::TakeCommands()
+    {
+        return std::exchange(m_Commands, {});
+    }
+} // namespace Neon::RHI
\ No newline at end of file
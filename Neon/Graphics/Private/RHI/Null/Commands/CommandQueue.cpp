@@ -0,0 +1,211 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Commands/CommandQueue.hpp>
+#include <Private/RHI/Null/Commands/CommandList.hpp>
+#include <Private/RHI/Null/Resource/Resource.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    namespace
+    {
+        /// <summary>
+        /// Memory of a copy location, rows are rows of blocks for block compressed formats.
+        /// </summary>
+        struct CopyRegion
+        {
+            uint8_t*             Data;
+            SubresourceFootprint Footprint;
+            uint32_t             NumRows;
+        };
+
+        [[nodiscard]] CopyRegion GetCopyRegion(
+            const TextureCopyLocation& Location)
+        {
+            auto Resource = static_cast<NullGpuResource*>(Location.Resource);
+            if (auto Index = std::get_if<uint32_t>(&Location.Subresource))
+            {
+                auto& Footprint = Resource->GetFootprint(*Index);
+                return {
+                    .Data      = Resource->GetData() + Footprint.Offset,
+                    .Footprint = Footprint,
+                    .NumRows   = Resource->GetNumRows(*Index)
+                };
+            }
+
+            auto& Footprint   = std::get<SubresourceFootprint>(Location.Subresource);
+            auto  Subresource = ComputeSubresource(Footprint.Format, nullptr, Footprint.Width, Footprint.Height);
+            return {
+                .Data      = Resource->GetData() + Footprint.Offset,
+                .Footprint = Footprint,
+                .NumRows   = Subresource.RowPitch ? uint32_t(Subresource.SlicePitch / Subresource.RowPitch) : Footprint.Height
+            };
+        }
+    } // namespace
+
+    //
+
+    ICommandQueue* ICommandQueue::Create(
+        CommandQueueType Type)
+    {
+        return NEON_NEW NullCommandQueue(Type);
+    }
+
+    NullCommandQueue::NullCommandQueue(
+        CommandQueueType Type) :
+        m_Type(Type)
+    {
+    }
+
+    std::vector<ICommandList*> NullCommandQueue::AllocateCommandLists(
+        CommandQueueType Type,
+        size_t           Count)
+    {
+        return NullSwapchain::Get()->AllocateCommandLists(Type, Count);
+    }
+
+    void NullCommandQueue::FreeCommandLists(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        NullSwapchain::Get()->FreeCommandLists(Type, Commands);
+    }
+
+    void NullCommandQueue::Upload(
+        std::span<ICommandList*> Commands)
+    {
+        auto CommandLog = NullCommandLog::Get();
+        for (auto Command : Commands)
+        {
+            auto Recorded = static_cast<NullCommandList*>(Command)->TakeCommands();
+            for (auto& Entry : Recorded)
+            {
+                std::visit(
+                    VariantVisitor{
+                        [](const NullCommands::CopySubresources& Copy)
+                        { Execute(Copy); },
+                        [](const NullCommands::CopyResource& Copy)
+                        { Execute(Copy); },
+                        [](const NullCommands::CopyBufferRegion& Copy)
+                        { Execute(Copy); },
+                        [](const NullCommands::CopyTextureRegion& Copy)
+                        { Execute(Copy); },
+                        [](const auto&) {} },
+                    Entry);
+            }
+            CommandLog->Submit(m_Type, std::move(Recorded));
+        }
+    }
+
+    void NullCommandQueue::Reset(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        NullSwapchain::Get()->ResetCommandLists(Type, Commands);
+    }
+
+    CommandQueueType NullCommandQueue::GetType() const noexcept
+    {
+        return m_Type;
+    }
+
+    //
+
+    void NullCommandQueue::Execute(
+        const NullCommands::CopySubresources& Command)
+    {
+        auto Dst          = static_cast<NullGpuResource*>(Command.Dst);
+        auto Intermediate = static_cast<NullGpuResource*>(Command.Intermediate);
+
+        std::vector<SubresourceFootprint> Footprints(Command.SubresourceCount);
+        Dst->QueryFootprint(
+            Command.FirstSubresource,
+            Command.SubresourceCount,
+            Command.IntOffset,
+            Footprints.data(),
+            nullptr,
+            nullptr,
+            nullptr);
+
+        // The intermediate buffer holds the subresources with the layout of the destination
+        for (uint32_t i = 0; i < Command.SubresourceCount; i++)
+        {
+            uint32_t Subresource = Command.FirstSubresource + i;
+
+            auto&  DstFootprint = Dst->GetFootprint(Subresource);
+            size_t Size         = size_t(DstFootprint.RowPitch) * Dst->GetNumRows(Subresource) * DstFootprint.Depth;
+
+            std::copy_n(
+                Intermediate->GetData() + Footprints[i].Offset,
+                Size,
+                Dst->GetData() + DstFootprint.Offset);
+        }
+    }
+
+    void NullCommandQueue::Execute(
+        const NullCommands::CopyResource& Command)
+    {
+        auto Dst = static_cast<NullGpuResource*>(Command.Dst);
+        auto Src = static_cast<NullGpuResource*>(Command.Src);
+
+        NEON_ASSERT(Dst->GetDataSize() == Src->GetDataSize(), "Copied resources must have the same size");
+        std::copy_n(Src->GetData(), Src->GetDataSize(), Dst->GetData());
+    }
+
+    void NullCommandQueue::Execute(
+        const NullCommands::CopyBufferRegion& Command)
+    {
+        auto Dst = static_cast<NullGpuResource*>(Command.Dst);
+        auto Src = static_cast<NullGpuResource*>(Command.Src);
+
+        NEON_ASSERT(Command.DstOffset + Command.NumBytes <= Dst->GetDataSize(), "Copy out of range");
+        NEON_ASSERT(Command.SrcOffset + Command.NumBytes <= Src->GetDataSize(), "Copy out of range");
+        std::copy_n(Src->GetData() + Command.SrcOffset, Command.NumBytes, Dst->GetData() + Command.DstOffset);
+    }
+
+    void NullCommandQueue::Execute(
+        const NullCommands::CopyTextureRegion& Command)
+    {
+        auto Dst = GetCopyRegion(Command.Dst);
+        auto Src = GetCopyRegion(Command.Src);
+
+        auto Box = Command.SrcBox.value_or(ICommandList::CopyBox{
+            .Left   = 0,
+            .Top    = 0,
+            .Front  = 0,
+            .Right  = Src.Footprint.Width,
+            .Bottom = Src.Footprint.Height,
+            .Back   = Src.Footprint.Depth });
+
+        // Texels are copied by elements: a pixel, or a block of pixels for block compressed formats
+        uint32_t BlockSize    = std::max(Src.Footprint.Height / std::max(Src.NumRows, 1u), 1u);
+        size_t   ElementBytes = std::max<size_t>(BitsPerPixel(Src.Footprint.Format) * BlockSize * BlockSize / 8, 1);
+        if (!BitsPerPixel(Src.Footprint.Format))
+        {
+            ElementBytes = 4;
+        }
+
+        size_t   RowBytes  = size_t(Math::DivideByMultiple(Box.Right, BlockSize) - Box.Left / BlockSize) * ElementBytes;
+        uint32_t FirstRow  = Box.Top / BlockSize;
+        uint32_t LastRow   = Math::DivideByMultiple(Box.Bottom, BlockSize);
+        size_t   SrcSlice  = size_t(Src.Footprint.RowPitch) * Src.NumRows;
+        size_t   DstSlice  = size_t(Dst.Footprint.RowPitch) * Dst.NumRows;
+        size_t   SrcColumn = size_t(Box.Left / BlockSize) * ElementBytes;
+        size_t   DstColumn = size_t(Command.DstPosition.x / BlockSize) * ElementBytes;
+
+        for (uint32_t z = Box.Front; z < Box.Back; z++)
+        {
+            for (uint32_t Row = FirstRow; Row < LastRow; Row++)
+            {
+                size_t DstZ   = size_t(Command.DstPosition.z) + z - Box.Front;
+                size_t DstRow = size_t(Command.DstPosition.y) / BlockSize + Row - FirstRow;
+
+                std::copy_n(
+                    Src.Data + z * SrcSlice + Row * size_t(Src.Footprint.RowPitch) + SrcColumn,
+                    RowBytes,
+                    Dst.Data + DstZ * DstSlice + DstRow * Dst.Footprint.RowPitch + DstColumn);
+            }
+        }
+    }
+} // namespace Neon::RHI
\ No newline at end of file
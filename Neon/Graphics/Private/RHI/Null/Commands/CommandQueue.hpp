@@ -0,0 +1,59 @@
+#pragma once
+
+#include <RHI/Commands/Queue.hpp>
+#include <RHI/Null/CommandLog.hpp>
+
+namespace Neon::RHI
+{
+    class ISwapchain;
+
+    class NullCommandQueue final : public ICommandQueue
+    {
+    public:
+        NullCommandQueue(
+            CommandQueueType Type);
+
+        std::vector<ICommandList*> AllocateCommandLists(
+            CommandQueueType Type, size_t Count) override;
+
+        void FreeCommandLists(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands) override;
+
+        /// <summary>
+        /// Execute the copies of the command lists on the memory of the resources and append their commands to the
+        /// command log.
+        /// </summary>
+        void Upload(
+            std::span<ICommandList*> Commands) override;
+
+        void Reset(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands) override;
+
+    public:
+        /// <summary>
+        /// Get the type of the queue.
+        /// </summary>
+        [[nodiscard]] CommandQueueType GetType() const noexcept;
+
+    private:
+        /// <summary>
+        /// Execute a copy command on the memory of the resources.
+        /// </summary>
+        static void Execute(
+            const NullCommands::CopySubresources& Command);
+
+        static void Execute(
+            const NullCommands::CopyResource& Command);
+
+        static void Execute(
+            const NullCommands::CopyBufferRegion& Command);
+
+        static void Execute(
+            const NullCommands::CopyTextureRegion& Command);
+
+    private:
+        CommandQueueType m_Type;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Device.hpp>
+
+#include <Private/RHI/Null/RootSignature.hpp>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    static std::unique_ptr<NullRenderDevice> s_RenderDevice = nullptr;
+
+    //
+
+    void IRenderDevice::Create(
+        Windowing::WindowApp*      Window,
+        const DeviceCreateDesc&    DeviceDesc,
+        const SwapchainCreateDesc& SwapchainDesc)
+    {
+        NEON_ASSERT(!s_RenderDevice);
+        s_DescriptorSize = DeviceDesc.Descriptors;
+        s_RenderDevice.reset(NEON_NEW NullRenderDevice(DeviceDesc));
+        s_RenderDevice->PostInitialize(Window, SwapchainDesc);
+    }
+
+    IRenderDevice* IRenderDevice::Get()
+    {
+        return s_RenderDevice.get();
+    }
+
+    void IRenderDevice::Destroy()
+    {
+        NEON_ASSERT(s_RenderDevice);
+        s_RenderDevice->Shudown();
+        s_RenderDevice = nullptr;
+    }
+
+#if !NEON_DIST
+    // Objects of the null backend have no debug name
+
+    void RenameObject(IRootSignature*, const wchar_t*)
+    {
+    }
+
+    void RenameObject(IPipelineState*, const String&)
+    {
+    }
+
+    void RenameObject(IGpuResource*, const String&)
+    {
+    }
+
+    void RenameObject(IDescriptorHeap*, const String&)
+    {
+    }
+
+    void RenameObject(ICommandList*, const String&)
+    {
+    }
+#endif
+
+    //
+
+    NullRenderDevice::NullRenderDevice(
+        const DeviceCreateDesc&)
+    {
+        NEON_INFO_TAG("Graphics", "Creating Null Render Device");
+    }
+
+    NullRenderDevice::~NullRenderDevice()
+    {
+        NullRootSignatureCache::Flush();
+        NEON_INFO_TAG("Graphics", "Destroying Null Render Device");
+    }
+
+    RHI::ISwapchain* NullRenderDevice::GetSwapchain()
+    {
+        return m_Swapchain.get();
+    }
+
+    uint32_t NullRenderDevice::GetFrameCount() const
+    {
+        return m_Swapchain->GetFrameCount();
+    }
+
+    uint32_t NullRenderDevice::GetFrameIndex() const
+    {
+        return m_Swapchain->GetFrameIndex();
+    }
+
+    //
+
+    void NullRenderDevice::PostInitialize(
+        Windowing::WindowApp*      Window,
+        const SwapchainCreateDesc& SwapchainDesc)
+    {
+        NullRootSignatureCache::Load();
+        m_MemoryAllocator.reset(NEON_NEW NullMemoryAllocator);
+        m_Swapchain.reset(NEON_NEW NullSwapchain(Window, SwapchainDesc));
+        m_Swapchain->PostInitialize(SwapchainDesc);
+        CreateDefaultTextures();
+    }
+
+    void NullRenderDevice::Shudown()
+    {
+        m_DefaultTextures = {};
+        m_Swapchain->Shutdown();
+        m_MemoryAllocator->Shutdown();
+        m_Swapchain       = nullptr;
+        m_MemoryAllocator = nullptr;
+    }
+
+    NullRenderDevice* NullRenderDevice::Get()
+    {
+        return static_cast<NullRenderDevice*>(IRenderDevice::Get());
+    }
+
+    NullMemoryAllocator* NullRenderDevice::GetAllocator()
+    {
+        return m_MemoryAllocator.get();
+    }
+
+    IResourceStateManager* NullRenderDevice::GetStateManager()
+    {
+        return m_MemoryAllocator->GetStateManager();
+    }
+
+    const Ptr<IGpuResource>& NullRenderDevice::GetDefaultTexture(
+        DefaultTextures Type) const
+    {
+        return m_DefaultTextures[size_t(Type)];
+    }
+
+    //
+
+    void NullRenderDevice::CreateDefaultTextures()
+    {
+        auto Desc2D   = ResourceDesc::Tex2D(EResourceFormat::R8G8B8A8_UNorm, 1, 1, 1);
+        auto Desc3D   = ResourceDesc::Tex3D(EResourceFormat::R8G8B8A8_UNorm, 1, 1, 1);
+        auto DescCube = ResourceDesc::TexCube(EResourceFormat::R8G8B8A8_UNorm, 1, 1, 1);
+
+        SubresourceDesc Subresource{
+            RHI::ComputeSubresource(
+                RHI::EResourceFormat::R8G8B8A8_UNorm,
+                nullptr,
+                1,
+                1)
+        };
+        std::span<SubresourceDesc>     Subresource2D{};
+        std::span<SubresourceDesc>     Subresource3D{};
+        std::array<SubresourceDesc, 6> SubresourceCube{};
+
+        auto CreateSubresources = [&]
+        {
+            Subresource2D   = { &Subresource, 1 };
+            Subresource3D   = { &Subresource, 1 };
+            SubresourceCube = { Subresource, Subresource, Subresource,
+                                Subresource, Subresource, Subresource };
+        };
+
+        //
+
+        Color4U8 Color{ Colors::Magenta * 255.f };
+
+        Subresource.Data = glm::value_ptr(Color);
+        CreateSubresources();
+
+        SSyncGpuResource MagentaTexture2D(Desc2D, Subresource2D, STR("MagentaTexture2D"), MResourceState_AllShaderResource);
+        SSyncGpuResource MagentaTexture3D(Desc3D, Subresource3D, STR("MagentaTexture3D"), MResourceState_AllShaderResource);
+        SSyncGpuResource MagentaTextureCube(DescCube, SubresourceCube, STR("MagentaTextureCube"), MResourceState_AllShaderResource);
+
+        //
+
+        Color.r = Color.g = Color.b = Color.a = 255;
+
+        Subresource.Data = glm::value_ptr(Color);
+        CreateSubresources();
+
+        SSyncGpuResource WhiteTexture2D(Desc2D, Subresource2D, STR("WhiteTexture2D"), MResourceState_AllShaderResource);
+        SSyncGpuResource WhiteTexture3D(Desc3D, Subresource3D, STR("WhiteTexture3D"), MResourceState_AllShaderResource);
+        SSyncGpuResource WhiteTextureCube(DescCube, SubresourceCube, STR("WhiteTextureCube"), MResourceState_AllShaderResource);
+
+        //
+
+        Color.r = Color.g = Color.b = 0;
+
+        Subresource.Data = glm::value_ptr(Color);
+        CreateSubresources();
+
+        SSyncGpuResource BlackTexture2D(Desc2D, Subresource2D, STR("BlackTexture2D"), MResourceState_AllShaderResource);
+        SSyncGpuResource BlackTexture3D(Desc3D, Subresource3D, STR("BlackTexture3D"), MResourceState_AllShaderResource);
+        SSyncGpuResource BlackTextureCube(DescCube, SubresourceCube, STR("BlackTextureCube"), MResourceState_AllShaderResource);
+
+        //
+
+        auto LoadTexture = [this](SSyncGpuResource& Resource, DefaultTextures Type)
+        {
+            m_DefaultTextures[size_t(Type)] = Resource;
+        };
+
+        LoadTexture(MagentaTexture2D, DefaultTextures::Magenta_2D);
+        LoadTexture(MagentaTexture3D, DefaultTextures::Magenta_3D);
+        LoadTexture(MagentaTextureCube, DefaultTextures::Magenta_Cube);
+
+        LoadTexture(WhiteTexture2D, DefaultTextures::White_2D);
+        LoadTexture(WhiteTexture3D, DefaultTextures::White_3D);
+        LoadTexture(WhiteTextureCube, DefaultTextures::White_Cube);
+
+        LoadTexture(BlackTexture2D, DefaultTextures::Black_2D);
+        LoadTexture(BlackTexture3D, DefaultTextures::Black_3D);
+        LoadTexture(BlackTextureCube, DefaultTextures::Black_Cube);
+    }
+} // namespace Neon::RHI
\ No newline at end of file
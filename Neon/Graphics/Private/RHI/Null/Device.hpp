@@ -0,0 +1,72 @@
+#pragma once
+
+#include <RHI/Device.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Render device of the null backend, resources live in CPU memory and command lists are recorded in the command
+    /// log instead of being submitted, so frames can run without a GPU or a window.
+    /// </summary>
+    class NullRenderDevice final : public IRenderDevice
+    {
+    public:
+        NullRenderDevice(
+            const DeviceCreateDesc& DeviceDesc);
+        NEON_CLASS_NO_COPYMOVE(NullRenderDevice);
+        ~NullRenderDevice() override;
+
+        RHI::ISwapchain* GetSwapchain() override;
+
+        uint32_t GetFrameCount() const override;
+
+        uint32_t GetFrameIndex() const override;
+
+    public:
+        /// <summary>
+        /// Gets the global render device.
+        /// </summary>
+        [[nodiscard]] static NullRenderDevice* Get();
+
+        /// <summary>
+        /// Initialize render device.
+        /// </summary>
+        void PostInitialize(
+            Windowing::WindowApp*      Window,
+            const SwapchainCreateDesc& Swapchain);
+
+        /// <summary>
+        /// Shutdown render device.
+        /// </summary>
+        void Shudown();
+
+        /// <summary>
+        /// Get graphics memory allocator.
+        /// </summary>
+        [[nodiscard]] NullMemoryAllocator* GetAllocator();
+
+        /// <summary>
+        /// Get resource state manager.
+        /// </summary>
+        [[nodiscard]] IResourceStateManager* GetStateManager();
+
+        /// <summary>
+        /// Get default texture.
+        /// </summary>
+        [[nodiscard]] const Ptr<IGpuResource>& GetDefaultTexture(
+            DefaultTextures Type) const;
+
+    private:
+        /// <summary>
+        /// Create default textures.
+        /// </summary>
+        void CreateDefaultTextures();
+
+    private:
+        UPtr<NullMemoryAllocator> m_MemoryAllocator;
+        UPtr<NullSwapchain>       m_Swapchain;
+
+        std::array<Ptr<IGpuResource>, size_t(DefaultTextures::Count)> m_DefaultTextures;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Fence.hpp>
+
+namespace Neon::RHI
+{
+    IFence* IFence::Create(
+        uint64_t InitialValue)
+    {
+        return NEON_NEW NullFence(InitialValue);
+    }
+
+    IMultiFence* IMultiFence::Create(
+        uint64_t InitialValue)
+    {
+        return NEON_NEW NullMultiFence(InitialValue);
+    }
+
+    //
+
+    NullFence::NullFence(
+        uint64_t InitialValue) :
+        m_Value(InitialValue)
+    {
+    }
+
+    void NullFence::WaitCPU(
+        uint64_t Value,
+        uint32_t MsWaitTime)
+    {
+        std::unique_lock Lock(m_Mutex);
+        auto             IsCompleted = [this, Value]
+        { return m_Value >= Value; };
+
+        if (MsWaitTime == uint32_t(-1))
+        {
+            m_Waiter.wait(Lock, IsCompleted);
+        }
+        else
+        {
+            m_Waiter.wait_for(Lock, std::chrono::milliseconds(MsWaitTime), IsCompleted);
+        }
+    }
+
+    void NullFence::WaitGPU(
+        ICommandQueue*,
+        uint64_t)
+    {
+        // Queues don't run ahead of the CPU, there is nothing to wait for
+    }
+
+    uint64_t NullFence::GetCompletedValue()
+    {
+        std::scoped_lock Lock(m_Mutex);
+        return m_Value;
+    }
+
+    void NullFence::SignalCPU(
+        uint64_t Value)
+    {
+        {
+            std::scoped_lock Lock(m_Mutex);
+            m_Value = Value;
+        }
+        m_Waiter.notify_all();
+    }
+
+    void NullFence::SignalGPU(
+        ICommandQueue*,
+        uint64_t Value)
+    {
+        SignalCPU(Value);
+    }
+
+    //
+
+    NullMultiFence::NullMultiFence(
+        uint64_t InitialValue) :
+        NullFence(InitialValue)
+    {
+    }
+
+    void NullMultiFence::WaitCPU(
+        uint64_t Value,
+        uint32_t MsWaitTime)
+    {
+        NullFence::WaitCPU(Value, MsWaitTime);
+    }
+
+    void NullMultiFence::WaitGPU(
+        ICommandQueue* CommandQueue,
+        uint64_t       Value)
+    {
+        NullFence::WaitGPU(CommandQueue, Value);
+    }
+
+    uint64_t NullMultiFence::GetCompletedValue()
+    {
+        return NullFence::GetCompletedValue();
+    }
+
+    void NullMultiFence::SignalCPU(
+        uint64_t Value)
+    {
+        NullFence::SignalCPU(Value);
+    }
+
+    void NullMultiFence::SignalGPU(
+        ICommandQueue* CommandQueue,
+        uint64_t       Value)
+    {
+        NullFence::SignalGPU(CommandQueue, Value);
+    }
+} // namespace Neon::RHI
\ No newline at end of file
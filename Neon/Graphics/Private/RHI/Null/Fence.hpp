@@ -0,0 +1,69 @@
+#pragma once
+
+#include <RHI/Fence.hpp>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Fence of the null backend, queues execute their commands when they are uploaded so a signal from a queue
+    /// completes immediately.
+    /// </summary>
+    class NullFence : public virtual IFence
+    {
+    public:
+        NullFence() = default;
+
+        NullFence(
+            uint64_t InitialValue);
+
+        void WaitCPU(
+            uint64_t Value,
+            uint32_t MsWaitTime = uint32_t(-1)) override;
+
+        void WaitGPU(
+            ICommandQueue* CommandQueue,
+            uint64_t       Value) override;
+
+        uint64_t GetCompletedValue() override;
+
+        void SignalCPU(
+            uint64_t Value) override;
+
+        void SignalGPU(
+            ICommandQueue* CommandQueue,
+            uint64_t       Value) override;
+
+    private:
+        std::mutex              m_Mutex;
+        std::condition_variable m_Waiter;
+        uint64_t                m_Value = 0;
+    };
+
+    class NullMultiFence final : public virtual IMultiFence,
+                                 public NullFence
+    {
+    public:
+        NullMultiFence(
+            uint64_t InitialValue);
+
+        void WaitCPU(
+            uint64_t Value,
+            uint32_t MsWaitTime = uint32_t(-1)) override;
+
+        void WaitGPU(
+            ICommandQueue* CommandQueue,
+            uint64_t       Value) override;
+
+        uint64_t GetCompletedValue() override;
+
+        void SignalCPU(
+            uint64_t Value) override;
+
+        void SignalGPU(
+            ICommandQueue* CommandQueue,
+            uint64_t       Value) override;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Frame.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+namespace Neon::RHI
+{
+    void NullFrameResource::Reset()
+    {
+        for (auto& [HeapAllocators, Handles] : m_DescriptorHeapHandles)
+        {
+            HeapAllocators->Free(Handles);
+        }
+
+        auto Allocator = NullRenderDevice::Get()->GetAllocator();
+        Allocator->FreeBuffers(m_Buffers);
+
+        m_DescriptorHeapHandles.clear();
+        m_Buffers.clear();
+        m_Descriptors.clear();
+        m_Resources.clear();
+
+        for (auto& Pool : m_FrameDescriptors)
+        {
+            Pool.Reset();
+        }
+
+        for (auto& Pool : m_StagedDescriptors)
+        {
+            Pool.Reset();
+        }
+    }
+
+    void NullFrameResource::SafeRelease(
+        IDescriptorHeapAllocator*   Allocator,
+        const DescriptorHeapHandle& Handle)
+    {
+        m_DescriptorHeapHandles[Allocator].emplace_back(Handle);
+    }
+
+    void NullFrameResource::SafeRelease(
+        const NullMemoryAllocator::Handle& Handle)
+    {
+        m_Buffers.emplace_back(Handle);
+    }
+
+    void NullFrameResource::SafeRelease(
+        IDescriptorHeap*                  Heap,
+        std::unique_ptr<NullDescriptor[]> Descriptors)
+    {
+        // First we check if the incoming descriptor exists in the to be deleted handles.
+        // If it does, no need to remove the handle, just remove the descriptor instead.
+        for (auto Iter = m_DescriptorHeapHandles.begin(); Iter != m_DescriptorHeapHandles.end(); Iter++)
+        {
+            auto Contains = std::ranges::find_if(
+                                Iter->second,
+                                [Heap](const DescriptorHeapHandle& Handle)
+                                { return Handle.Heap == Heap; }) != Iter->second.end();
+
+            if (Contains)
+            {
+                m_DescriptorHeapHandles.erase(Iter);
+                break;
+            }
+        }
+        m_Descriptors.emplace_back(std::move(Descriptors));
+    }
+
+    void NullFrameResource::SafeRelease(
+        std::unique_ptr<uint8_t[]> Data)
+    {
+        m_Resources.emplace_back(std::move(Data));
+    }
+
+    NullFrameDescriptorHeap* NullFrameResource::GetFrameDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        return &m_FrameDescriptors[Type == DescriptorType::ResourceView ? 0 : 1];
+    }
+
+    NullStagedDescriptorHeap* NullFrameResource::GetStagedDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        return &m_StagedDescriptors[size_t(Type)];
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Private/RHI/Null/Resource/Resource.hpp>
+#include <Private/RHI/Null/Resource/GraphicsMemoryAllocator.hpp>
+#include <Private/RHI/Null/GlobalDescriptors.hpp>
+
+namespace Neon::RHI
+{
+    class NullFrameResource
+    {
+    public:
+        /// <summary>
+        /// Release all stale resources
+        /// </summary>
+        void Reset();
+
+        /// <summary>
+        /// Enqueue a descriptor handle to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            IDescriptorHeapAllocator*   Allocator,
+            const DescriptorHeapHandle& Handle);
+
+        /// <summary>
+        /// Enqueue buffer to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            const NullMemoryAllocator::Handle& Handle);
+
+        /// <summary>
+        /// Enqueue descriptor heap memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            IDescriptorHeap*                  Heap,
+            std::unique_ptr<NullDescriptor[]> Descriptors);
+
+        /// <summary>
+        /// Enqueue resource memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            std::unique_ptr<uint8_t[]> Data);
+
+    public:
+        /// <summary>
+        /// Get frame descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullFrameDescriptorHeap* GetFrameDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+        /// <summary>
+        /// Get staged descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullStagedDescriptorHeap* GetStagedDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+    private:
+        NullFrameDescriptorHeap m_FrameDescriptors[2]{
+            DescriptorType::ResourceView,
+            DescriptorType::Sampler
+        };
+        NullStagedDescriptorHeap m_StagedDescriptors[size_t(DescriptorType::Count)]{
+            DescriptorType::ResourceView,
+            DescriptorType::RenderTargetView,
+            DescriptorType::DepthStencilView,
+            DescriptorType::Sampler
+        };
+
+        std::map<IDescriptorHeapAllocator*, std::vector<DescriptorHeapHandle>> m_DescriptorHeapHandles;
+
+        std::vector<NullMemoryAllocator::Handle>        m_Buffers;
+        std::vector<std::unique_ptr<NullDescriptor[]>> m_Descriptors;
+        std::vector<std::unique_ptr<uint8_t[]>>        m_Resources;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/FrameManager.hpp>
+#include <Private/RHI/Null/Device.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    ICommandList* NullCommandContextManager::Request()
+    {
+        auto Iter = m_CommandListsPool.Allocate();
+        m_ToPoolMap.emplace(&*Iter, Iter);
+
+        Iter->Reset();
+        return &*Iter;
+    }
+
+    void NullCommandContextManager::Free(
+        ICommandList* CommandList)
+    {
+        auto Iter = m_ToPoolMap.find(CommandList);
+        m_CommandListsPool.Free(Iter->second);
+        m_ToPoolMap.erase(Iter);
+    }
+
+    void NullCommandContextManager::Reset(
+        ICommandList* CommandList)
+    {
+        m_ToPoolMap[CommandList]->Reset();
+    }
+
+    //
+
+    NullFrameManager::NullFrameManager() :
+        m_DirectQueue(CommandQueueType::Graphics),
+        m_DirectFence(0),
+        m_CopyQueue(CommandQueueType::Copy),
+        m_CopyFence(0)
+    {
+    }
+
+    NullFrameManager::~NullFrameManager()
+    {
+        IdleGPU();
+    }
+
+    NullCommandQueue* NullFrameManager::GetQueue(
+        bool IsDirect) noexcept
+    {
+        return IsDirect ? &m_DirectQueue : &m_CopyQueue;
+    }
+
+    NullFence* NullFrameManager::GetQueueFence(
+        bool IsDirect) noexcept
+    {
+        return IsDirect ? &m_DirectFence : &m_CopyFence;
+    }
+
+    //
+
+    void NullFrameManager::NewFrame()
+    {
+        m_DirectFence.WaitCPU(m_FenceValue);
+        auto& Frame = *m_FrameResources[m_FrameIndex];
+        Frame.Reset();
+
+        // This frame's commands will signal the next fence value
+        NullRenderDevice::Get()->GetAllocator()->BeginFrame(
+            m_FenceValue + 1,
+            m_DirectFence.GetCompletedValue());
+    }
+
+    void NullFrameManager::EndFrame()
+    {
+        ++m_FenceValue;
+        m_DirectFence.SignalGPU(&m_DirectQueue, m_FenceValue);
+        m_FrameIndex = (m_FrameIndex + 1) % uint32_t(m_FrameResources.size());
+    }
+
+    //
+
+    void NullFrameManager::ResizeFrames(
+        size_t FramesCount)
+    {
+        auto OldSize = m_FrameResources.size();
+        m_FrameResources.resize(FramesCount);
+        for (size_t i = OldSize; i < FramesCount; i++)
+        {
+            m_FrameResources[i] = std::make_unique<NullFrameResource>();
+        }
+        m_FrameIndex = 0;
+    }
+
+    uint32_t NullFrameManager::GetFrameCount() const
+    {
+        return uint32_t(m_FrameResources.size());
+    }
+
+    uint32_t NullFrameManager::GetFrameIndex() const
+    {
+        return m_FrameIndex;
+    }
+
+    void NullFrameManager::ResetFrameIndex()
+    {
+        m_FrameIndex = 0;
+    }
+
+    void NullFrameManager::IdleGPU()
+    {
+        m_DirectFence.SignalGPU(&m_DirectQueue, m_FenceValue);
+        m_DirectFence.WaitCPU(m_FenceValue);
+
+        for (auto& Frame : m_FrameResources)
+        {
+            Frame->Reset();
+        }
+    }
+
+    //
+
+    std::vector<ICommandList*> NullFrameManager::AllocateCommandLists(
+        CommandQueueType Type,
+        size_t           Count)
+    {
+        NEON_ASSERT(Type != CommandQueueType::Copy);
+        NEON_ASSERT(Count);
+
+        std::vector<ICommandList*> Result;
+        Result.reserve(Count);
+
+        auto& Context = m_ContextPool[GetCommandListIndex(Type)];
+
+        std::scoped_lock Lock(Context.Mutex);
+        for (size_t i = 0; i < Count; i++)
+        {
+            Result.emplace_back(Context.Pool.Request());
+        }
+        return Result;
+    }
+
+    void NullFrameManager::FreeCommandLists(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        NEON_ASSERT(Type != CommandQueueType::Copy);
+        NEON_ASSERT(!Commands.empty());
+
+        auto& Context = m_ContextPool[GetCommandListIndex(Type)];
+
+        std::scoped_lock Lock(Context.Mutex);
+        for (auto Command : Commands)
+        {
+            Context.Pool.Free(Command);
+        }
+    }
+
+    void NullFrameManager::ResetCommandLists(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        NEON_ASSERT(Type != CommandQueueType::Copy);
+        NEON_ASSERT(!Commands.empty());
+
+        auto& Context = m_ContextPool[GetCommandListIndex(Type)];
+
+        std::scoped_lock Lock(Context.Mutex);
+        for (auto Command : Commands)
+        {
+            Context.Pool.Reset(Command);
+        }
+    }
+
+    //
+
+    void NullFrameManager::SafeRelease(
+        IDescriptorHeapAllocator*   Allocator,
+        const DescriptorHeapHandle& Handle)
+    {
+        std::scoped_lock Lock(m_StaleResourcesMutex[0]);
+        auto&            Frame = *m_FrameResources[m_FrameIndex];
+        Frame.SafeRelease(Allocator, Handle);
+    }
+
+    void NullFrameManager::SafeRelease(
+        const NullMemoryAllocator::Handle& Handle)
+    {
+        std::scoped_lock Lock(m_StaleResourcesMutex[1]);
+        auto&            Frame = *m_FrameResources[m_FrameIndex];
+        Frame.SafeRelease(Handle);
+    }
+
+    void NullFrameManager::SafeRelease(
+        IDescriptorHeap*                  Heap,
+        std::unique_ptr<NullDescriptor[]> Descriptors)
+    {
+        std::scoped_lock Lock(m_StaleResourcesMutex[0], m_StaleResourcesMutex[2]);
+        auto&            Frame = *m_FrameResources[m_FrameIndex];
+        Frame.SafeRelease(Heap, std::move(Descriptors));
+    }
+
+    void NullFrameManager::SafeRelease(
+        std::unique_ptr<uint8_t[]> Data)
+    {
+        std::scoped_lock Lock(m_StaleResourcesMutex[3]);
+        auto&            Frame = *m_FrameResources[m_FrameIndex];
+        Frame.SafeRelease(std::move(Data));
+    }
+
+    std::future<void> NullFrameManager::RequestCopy(
+        std::move_only_function<void(ICommandList*)> CopyTask,
+        std::move_only_function<void()>              PostCopyTask)
+    {
+        std::promise<void> Promise;
+        try
+        {
+            std::scoped_lock Lock(m_CopyMutex);
+
+            NullCommandList CommandList;
+            CopyTask(&CommandList);
+
+            ICommandList* Commands[]{ &CommandList };
+            m_CopyQueue.Upload(Commands);
+            m_CopyFence.SignalGPU(&m_CopyQueue, ++m_CopyId);
+        }
+        catch (const std::exception& Exception)
+        {
+            NEON_FATAL("Exception in copy task: {}", Exception.what());
+        }
+
+        PostCopyTask();
+        Promise.set_value();
+        return Promise.get_future();
+    }
+
+    NullFrameDescriptorHeap* NullFrameManager::GetFrameDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        auto& Frame = *m_FrameResources[m_FrameIndex];
+        return Frame.GetFrameDescriptorAllocator(Type);
+    }
+
+    NullStagedDescriptorHeap* NullFrameManager::GetStagedDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        auto& Frame = *m_FrameResources[m_FrameIndex];
+        return Frame.GetStagedDescriptorAllocator(Type);
+    }
+
+    //
+
+    size_t NullFrameManager::GetCommandListIndex(
+        CommandQueueType Type)
+    {
+        switch (Type)
+        {
+        case CommandQueueType::Graphics:
+            return 0;
+        case CommandQueueType::Compute:
+            return 1;
+        default:
+            std::unreachable();
+        }
+    }
+} // namespace Neon::RHI
\ No newline at end of file
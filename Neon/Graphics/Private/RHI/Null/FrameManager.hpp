@@ -0,0 +1,202 @@
+#pragma once
+
+#include <Private/RHI/Null/Commands/CommandQueue.hpp>
+#include <Private/RHI/Null/Commands/CommandList.hpp>
+#include <Private/RHI/Null/Frame.hpp>
+#include <Private/RHI/Null/Fence.hpp>
+#include <Allocator/FreeList.hpp>
+#include <mutex>
+#include <future>
+
+namespace Neon::RHI
+{
+    class NullCommandContextManager
+    {
+        using NullCommandListPool = Allocator::FreeList<NullCommandList>;
+
+    public:
+        /// <summary>
+        /// Request command list from pool
+        /// </summary>
+        ICommandList* Request();
+
+        /// <summary>
+        /// Free command list to pool
+        /// </summary>
+        void Free(
+            ICommandList* CommandList);
+
+        /// <summary>
+        /// Reset command list
+        /// </summary>
+        void Reset(
+            ICommandList* CommandList);
+
+    private:
+        NullCommandListPool m_CommandListsPool;
+
+        std::map<ICommandList*, NullCommandListPool::Iterator> m_ToPoolMap;
+    };
+
+    //
+
+    class NullFrameManager
+    {
+    public:
+        struct CommandContextPool
+        {
+            NullCommandContextManager Pool;
+            std::mutex                Mutex;
+        };
+        using CommandContextPools = std::array<CommandContextPool, 2>;
+
+    public:
+        NullFrameManager();
+        NEON_CLASS_NO_COPYMOVE(NullFrameManager);
+        ~NullFrameManager();
+
+        /// <summary>
+        /// Get direct/copy command queue
+        /// </summary>
+        [[nodiscard]] NullCommandQueue* GetQueue(
+            bool IsDirect) noexcept;
+
+        /// <summary>
+        /// Get direct/copy fence
+        /// </summary>
+        [[nodiscard]] NullFence* GetQueueFence(
+            bool IsDirect) noexcept;
+
+    public:
+        /// <summary>
+        /// Mark the start of frame.
+        /// Wait for previous frame to finish.
+        /// </summary>
+        void NewFrame();
+
+        /// <summary>
+        /// Mark the end of frame.
+        /// </summary>
+        void EndFrame();
+
+        /// <summary>
+        /// Resize frame resources to match swapchain size.
+        /// </summary>
+        void ResizeFrames(
+            size_t FramesCount);
+
+        /// <summary>
+        /// Get current frame count
+        /// </summary>
+        [[nodiscard]] uint32_t GetFrameCount() const;
+
+        /// <summary>
+        /// Get current frame index
+        /// </summary>
+        [[nodiscard]] uint32_t GetFrameIndex() const;
+
+        /// <summary>
+        /// Reset frame index to 0
+        /// </summary>
+        void ResetFrameIndex();
+
+        /// <summary>
+        /// Release the stale resources of every frame.
+        /// </summary>
+        void IdleGPU();
+
+    public:
+        /// <summary>
+        /// Allocate or reuse command lists
+        /// </summary>
+        [[nodiscard]] std::vector<ICommandList*> AllocateCommandLists(
+            CommandQueueType Type,
+            size_t           Count);
+
+        /// <summary>
+        /// Free command lists.
+        /// </summary>
+        void FreeCommandLists(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands);
+
+        /// <summary>
+        /// Reset command lists.
+        /// </summary>
+        void ResetCommandLists(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands);
+
+    public:
+        /// <summary>
+        /// Enqueue a descriptor handle to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            IDescriptorHeapAllocator*   Allocator,
+            const DescriptorHeapHandle& Handle);
+
+        /// <summary>
+        /// Enqueue buffer to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            const NullMemoryAllocator::Handle& Handle);
+
+        /// <summary>
+        /// Enqueue descriptor heap memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            IDescriptorHeap*                  Heap,
+            std::unique_ptr<NullDescriptor[]> Descriptors);
+
+        /// <summary>
+        /// Enqueue resource memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            std::unique_ptr<uint8_t[]> Data);
+
+        /// <summary>
+        /// Execute a copy on the copy queue, the copy is done when the function returns.
+        /// </summary>
+        std::future<void> RequestCopy(
+            std::move_only_function<void(ICommandList*)> CopyTask,
+            std::move_only_function<void()>              PostCopyTask);
+
+    public:
+        /// <summary>
+        /// Get frame descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullFrameDescriptorHeap* GetFrameDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+        /// <summary>
+        /// Get staged descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullStagedDescriptorHeap* GetStagedDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+    private:
+        /// <summary>
+        /// Get the index of the command list pool of a queue type
+        /// </summary>
+        [[nodiscard]] static size_t GetCommandListIndex(
+            CommandQueueType Type);
+
+    private:
+        std::vector<UPtr<NullFrameResource>> m_FrameResources;
+
+        uint32_t m_FrameIndex = 0;
+
+        NullCommandQueue m_DirectQueue;
+        NullFence        m_DirectFence;
+
+        NullCommandQueue m_CopyQueue;
+        NullFence        m_CopyFence;
+        uint64_t         m_CopyId = 0;
+        std::mutex       m_CopyMutex;
+
+        CommandContextPools m_ContextPool;
+        uint64_t            m_FenceValue = 0;
+
+        std::mutex m_StaleResourcesMutex[4];
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+#include <RHI/GlobalBuffer.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    auto IGlobalBufferPool::Allocate(
+        size_t                        Size,
+        size_t                        Alignement,
+        IGlobalBufferPool::BufferType Type) -> Handle
+    {
+        Handle Hndl{};
+        if (Size) [[likely]]
+        {
+            auto Allocator    = NullRenderDevice::Get()->GetAllocator();
+            auto BufferHandle = Allocator->AllocateBuffer(Type, Size, Alignement);
+
+            Hndl.Buffer = BufferHandle.Resource;
+            Hndl.Offset = BufferHandle.Offset;
+            Hndl.Size   = BufferHandle.Size;
+            Hndl.Type   = Type;
+        }
+        return Hndl;
+    }
+
+    auto IGlobalBufferPool::AllocateFrame(
+        size_t Size,
+        size_t Alignement) -> FrameHandle
+    {
+        FrameHandle Hndl{};
+        if (Size) [[likely]]
+        {
+            auto Allocator  = NullRenderDevice::Get()->GetAllocator();
+            auto Allocation = Allocator->AllocateFrame(Size, Alignement);
+
+            Hndl.Buffer     = static_cast<NullGpuResource*>(Allocation.Context);
+            Hndl.Offset     = Allocation.Offset;
+            Hndl.Size       = Allocation.Size;
+            Hndl.CpuAddress = Allocation.CpuAddress;
+            Hndl.GpuHandle  = { Allocation.GpuAddress };
+        }
+        return Hndl;
+    }
+
+    void IGlobalBufferPool::Free(
+        std::span<const Handle> Handles)
+    {
+        for (auto& Hndl : Handles)
+        {
+            if (Hndl.Size) [[likely]]
+            {
+                NullSwapchain::Get()->SafeRelease(
+                    { .Resource = Hndl.Buffer.Get(),
+                      .Offset   = Hndl.Offset,
+                      .Size     = Hndl.Size,
+                      .Type     = Hndl.Type });
+            }
+        }
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/GlobalDescriptors.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    NullFrameDescriptorHeapBuddyAllocator::BuddyBlock::BuddyBlock(
+        DescriptorType Type,
+        uint32_t       SizeOfHeap) :
+        Heap(Type, SizeOfHeap, true),
+        Allocator(SizeOfHeap)
+    {
+    }
+
+    NullFrameDescriptorHeapBuddyAllocator::NullFrameDescriptorHeapBuddyAllocator(
+        DescriptorType Type,
+        uint32_t       SizeOfHeap) :
+        m_HeapBlock(Type, SizeOfHeap)
+    {
+    }
+
+    NullFrameDescriptorHeapBuddyAllocator::~NullFrameDescriptorHeapBuddyAllocator()
+    {
+        m_HeapBlock.Heap.SilentDelete();
+    }
+
+    DescriptorHeapHandle NullFrameDescriptorHeapBuddyAllocator::Allocate(
+        uint32_t DescriptorSize)
+    {
+        if (auto Hndl = m_HeapBlock.Allocator.Allocate(DescriptorSize)) [[likely]]
+        {
+            return {
+                .Heap   = &m_HeapBlock.Heap,
+                .Offset = Hndl.Offset,
+                .Size   = Hndl.Size
+            };
+        }
+
+        const char* Type = "???";
+        switch (m_HeapBlock.Heap.GetType())
+        {
+        case DescriptorType::ResourceView:
+            Type = "CBV_SRV_UAV";
+            break;
+        case DescriptorType::Sampler:
+            Type = "Sampler";
+            break;
+        default:
+            break;
+        }
+        NEON_FATAL("Descriptor Heap is full");
+        NEON_FATAL("Try to increase the size of the '{}' heap", Type);
+        std::unreachable();
+    }
+
+    void NullFrameDescriptorHeapBuddyAllocator::FreeAll()
+    {
+        m_HeapBlock.Allocator.FreeAll();
+    }
+
+    NullDescriptorHeap* NullFrameDescriptorHeapBuddyAllocator::GetHeap()
+    {
+        return &m_HeapBlock.Heap;
+    }
+
+    //
+
+    IStaticDescriptorHeap* IStaticDescriptorHeap::Get(
+        DescriptorType Type)
+    {
+        return NullSwapchain::Get()->GetStaticDescriptorAllocator(Type);
+    }
+
+    NullStaticDescriptorHeap::NullStaticDescriptorHeap(
+        DescriptorType Type) :
+        m_Allocator(
+            Type,
+            Type == DescriptorType::ResourceView       ? IRenderDevice::GetDescriptorSize().Static_Resource
+            : Type == DescriptorType::RenderTargetView ? IRenderDevice::GetDescriptorSize().Static_Rtv
+            : Type == DescriptorType::DepthStencilView ? IRenderDevice::GetDescriptorSize().Static_Dsv
+                                                       : IRenderDevice::GetDescriptorSize().Static_Sampler,
+            false)
+    {
+    }
+
+    NullStaticDescriptorHeap::~NullStaticDescriptorHeap()
+    {
+        for (auto Heap : m_Allocator.GetAllHeaps())
+        {
+            Heap->SilentDelete();
+        }
+    }
+
+    DescriptorHeapHandle NullStaticDescriptorHeap::Allocate(
+        uint32_t Count)
+    {
+        return m_Allocator.Allocate(Count);
+    }
+
+    void NullStaticDescriptorHeap::Free(
+        std::span<const DescriptorHeapHandle> Handles)
+    {
+        m_Allocator.Free(Handles);
+    }
+
+    //
+
+    IStagedDescriptorHeap* IStagedDescriptorHeap::Get(
+        DescriptorType Type)
+    {
+        return NullSwapchain::Get()->GetStagedDescriptorAllocator(Type);
+    }
+
+    NullStagedDescriptorHeap::NullStagedDescriptorHeap(
+        DescriptorType Type) :
+        m_Allocator(
+            Type,
+            Type == DescriptorType::ResourceView       ? IRenderDevice::GetDescriptorSize().Staged_Resource
+            : Type == DescriptorType::RenderTargetView ? IRenderDevice::GetDescriptorSize().Staged_Rtv
+            : Type == DescriptorType::DepthStencilView ? IRenderDevice::GetDescriptorSize().Staged_Dsv
+                                                       : IRenderDevice::GetDescriptorSize().Staged_Sampler,
+            false)
+    {
+    }
+
+    NullStagedDescriptorHeap::~NullStagedDescriptorHeap()
+    {
+        for (auto Heap : m_Allocator.GetAllHeaps())
+        {
+            Heap->SilentDelete();
+        }
+    }
+
+    DescriptorHeapHandle NullStagedDescriptorHeap::Allocate(
+        uint32_t Count)
+    {
+        return m_Allocator.Allocate(Count);
+    }
+
+    void NullStagedDescriptorHeap::Free(
+        std::span<const DescriptorHeapHandle> Handles)
+    {
+        m_Allocator.Free(Handles);
+    }
+
+    void NullStagedDescriptorHeap::Reset()
+    {
+        m_Allocator.FreeAll();
+    }
+
+    //
+
+    IFrameDescriptorHeap* IFrameDescriptorHeap::Get(
+        DescriptorType Type)
+    {
+        return NullSwapchain::Get()->GetFrameDescriptorAllocator(Type);
+    }
+
+    NullFrameDescriptorHeap::NullFrameDescriptorHeap(
+        DescriptorType Type) :
+        m_Allocator(
+            Type,
+            Type == DescriptorType::ResourceView ? IRenderDevice::GetDescriptorSize().Frame_Resource
+                                                 : IRenderDevice::GetDescriptorSize().Frame_Sampler)
+    {
+    }
+
+    DescriptorHeapHandle NullFrameDescriptorHeap::Allocate(
+        uint32_t Count)
+    {
+        return m_Allocator.Allocate(Count);
+    }
+
+    NullDescriptorHeap* NullFrameDescriptorHeap::GetHeap()
+    {
+        return m_Allocator.GetHeap();
+    }
+
+    void NullFrameDescriptorHeap::Reset()
+    {
+        m_Allocator.FreeAll();
+    }
+} // namespace Neon::RHI
\ No newline at end of file
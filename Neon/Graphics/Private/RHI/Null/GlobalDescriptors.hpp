@@ -0,0 +1,114 @@
+#pragma once
+
+#include <RHI/GlobalDescriptors.hpp>
+#include <Private/RHI/Null/Resource/Descriptor.hpp>
+
+namespace Neon::RHI
+{
+    class NullFrameDescriptorHeapBuddyAllocator
+    {
+        struct BuddyBlock
+        {
+            NullDescriptorHeap              Heap;
+            Allocator::CachedRangeAllocator Allocator;
+
+            BuddyBlock(
+                DescriptorType Type,
+                uint32_t       SizeOfHeap);
+        };
+
+    public:
+        NullFrameDescriptorHeapBuddyAllocator(
+            DescriptorType Type,
+            uint32_t       SizeOfHeap);
+
+        NEON_CLASS_NO_COPYMOVE(NullFrameDescriptorHeapBuddyAllocator);
+
+        ~NullFrameDescriptorHeapBuddyAllocator();
+
+        DescriptorHeapHandle Allocate(
+            uint32_t DescriptorSize);
+
+        void FreeAll();
+
+        /// <summary>
+        /// Returns the underlying heap.
+        /// </summary>
+        [[nodiscard]] NullDescriptorHeap* GetHeap();
+
+    private:
+        BuddyBlock m_HeapBlock;
+    };
+
+    //
+
+    class NullStaticDescriptorHeap : public IStaticDescriptorHeap
+    {
+    public:
+        NullStaticDescriptorHeap(
+            DescriptorType Type);
+        NEON_CLASS_NO_COPYMOVE(NullStaticDescriptorHeap);
+        ~NullStaticDescriptorHeap() override;
+
+        DescriptorHeapHandle Allocate(
+            uint32_t Count) override;
+
+        void Free(
+            std::span<const DescriptorHeapHandle> Handles) override;
+
+    private:
+        NullDescriptorHeapBuddyAllocator m_Allocator;
+    };
+
+    //
+
+    class NullStagedDescriptorHeap : public IStagedDescriptorHeap
+    {
+    public:
+        NullStagedDescriptorHeap(
+            DescriptorType Type);
+        NEON_CLASS_NO_COPYMOVE(NullStagedDescriptorHeap);
+        ~NullStagedDescriptorHeap() override;
+
+        DescriptorHeapHandle Allocate(
+            uint32_t Count) override;
+
+        void Free(
+            std::span<const DescriptorHeapHandle> Handles) override;
+
+        /// <summary>
+        /// Resets the allocator.
+        /// </summary>
+        void Reset();
+
+    private:
+        NullDescriptorHeapBuddyAllocator m_Allocator;
+    };
+
+    //
+
+    class NullFrameDescriptorHeap : public IFrameDescriptorHeap
+    {
+    public:
+        NullFrameDescriptorHeap(
+            DescriptorType Type);
+        NEON_CLASS_NO_COPYMOVE(NullFrameDescriptorHeap);
+        ~NullFrameDescriptorHeap() = default;
+
+        DescriptorHeapHandle Allocate(
+            uint32_t Count) override;
+
+        /// <summary>
+        /// Returns the underlying heap.
+        /// </summary>
+        [[nodiscard]] NullDescriptorHeap* GetHeap();
+
+        /// <summary>
+        /// Resets the allocator.
+        /// </summary>
+        void Reset();
+
+    private:
+        NullFrameDescriptorHeapBuddyAllocator m_Allocator;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include <GraphicsPCH.hpp>
+#include <RHI/ImGui.hpp>
+#include <RHI/Commands/Context.hpp>
+
+#include <Window/Window.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+#include <Private/RHI/Null/Device.hpp>
+
+#include <ImGui/imgui.h>
+#include <ImGui/backends/imgui_impl_glfw.h>
+
+#include <chrono>
+
+namespace Neon::RHI::ImGuiRHI
+{
+    static std::chrono::steady_clock::time_point s_LastFrameTime;
+
+    void InitializeImGui()
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+
+        // Viewports need a renderer backend to draw the platform windows, there is none in the null backend
+        ImGuiIO& IO = ImGui::GetIO();
+        IO.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+        IO.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+        IO.BackendRendererName = "imgui_impl_null";
+
+        if (auto Window = ISwapchain::Get()->GetWindow())
+        {
+            ImGui_ImplGlfw_InitForOther(Window->GetHandle(), true);
+        }
+
+        // The font atlas is built on the CPU and never uploaded
+        unsigned char* Pixels;
+        int            Width, Height;
+        IO.Fonts->GetTexDataAsRGBA32(&Pixels, &Width, &Height);
+        IO.Fonts->SetTexID(std::bit_cast<ImTextureID>(uintptr_t(1)));
+
+        s_LastFrameTime = std::chrono::steady_clock::now();
+
+        SetDefaultTheme();
+    }
+
+    void ShutdownImGui()
+    {
+        if (ISwapchain::Get()->GetWindow())
+        {
+            ImGui_ImplGlfw_Shutdown();
+        }
+        ImGui::DestroyContext();
+    }
+
+    void BeginImGuiFrame()
+    {
+        auto Swapchain = ISwapchain::Get();
+        if (Swapchain->GetWindow())
+        {
+            ImGui_ImplGlfw_NewFrame();
+        }
+        else
+        {
+            auto  Now  = std::chrono::steady_clock::now();
+            auto& Size = Swapchain->GetSize();
+
+            ImGuiIO& IO    = ImGui::GetIO();
+            IO.DisplaySize = ImVec2(float(Size.Width()), float(Size.Height()));
+            IO.DeltaTime   = std::max(std::chrono::duration<float>(Now - s_LastFrameTime).count(), 1.f / 1000.f);
+
+            s_LastFrameTime = Now;
+        }
+        ImGui::NewFrame();
+    }
+
+    void EndImGuiFrame()
+    {
+        ImGui::Render();
+
+        RHI::CommandContext GraphicsContext;
+
+        auto Swapchain    = RHI::ISwapchain::Get();
+        auto StateManager = RHI::IResourceStateManager::Get();
+        auto BackBuffer   = Swapchain->GetBackBuffer();
+        auto CommandList  = GraphicsContext.Append();
+
+        // Set viewport
+        auto View = Swapchain->GetBackBufferView();
+        CommandList->SetRenderTargets(View, 1);
+
+        // Record the draws the renderer backend would have issued
+        auto DrawData = ImGui::GetDrawData();
+        for (int i = 0; i < DrawData->CmdListsCount; i++)
+        {
+            auto DrawList = DrawData->CmdLists[i];
+            for (auto& DrawCmd : DrawList->CmdBuffer)
+            {
+                if (DrawCmd.UserCallback)
+                {
+                    continue;
+                }
+
+                CommandList->Draw(RHI::DrawIndexArgs{
+                    .StartIndex            = DrawCmd.IdxOffset,
+                    .StartVertex           = int32_t(DrawCmd.VtxOffset),
+                    .IndexCountPerInstance = DrawCmd.ElemCount });
+            }
+        }
+
+        // Transition the backbuffer to a present state.
+        StateManager->TransitionResource(
+            BackBuffer,
+            RHI::MResourceState_Present);
+
+        StateManager->FlushBarriers(CommandList);
+    }
+} // namespace Neon::RHI::ImGuiRHI
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/PipelineState.hpp>
+#include <Private/RHI/Null/Shader.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    Ptr<IPipelineState> IPipelineState::Create(
+        const PipelineStateBuilderG& Builder)
+    {
+        return std::make_shared<NullPipelineState>(Builder);
+    }
+
+    Ptr<IPipelineState> IPipelineState::Create(
+        const PipelineStateBuilderC& Builder)
+    {
+        return std::make_shared<NullPipelineState>(Builder);
+    }
+
+    //
+
+    NullPipelineState::NullPipelineState(
+        const PipelineStateBuilderG& Builder) :
+        m_RootSignature(Builder.RootSignature)
+    {
+        NEON_ASSERT(m_RootSignature, "Root signature is null.");
+    }
+
+    NullPipelineState::NullPipelineState(
+        const PipelineStateBuilderC& Builder) :
+        m_RootSignature(Builder.RootSignature)
+    {
+        NEON_ASSERT(m_RootSignature, "Root signature is null.");
+        NEON_ASSERT(Builder.ComputeShader, "Compute shader is null.");
+
+        auto Shader        = static_cast<NullShader*>(Builder.ComputeShader.get());
+        m_ComputeGroupSize = Shader->GetComputeGroupSize();
+    }
+
+    const Vector3U& NullPipelineState::GetComputeGroupSize() const
+    {
+        return m_ComputeGroupSize;
+    }
+
+    const Ptr<IRootSignature>& NullPipelineState::GetRootSignature() const noexcept
+    {
+        return m_RootSignature;
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <RHI/PipelineState.hpp>
+
+namespace Neon::RHI
+{
+    class NullPipelineState final : public IPipelineState
+    {
+    public:
+        NullPipelineState(
+            const PipelineStateBuilderG& Builder);
+
+        NullPipelineState(
+            const PipelineStateBuilderC& Builder);
+
+        /// <summary>
+        /// Get group size of compute shader
+        /// </summary>
+        [[nodiscard]] const Vector3U& GetComputeGroupSize() const override;
+
+        /// <summary>
+        /// Get the root signature the pipeline state was created with
+        /// </summary>
+        [[nodiscard]] const Ptr<IRootSignature>& GetRootSignature() const noexcept;
+
+    private:
+        Ptr<IRootSignature> m_RootSignature;
+        Vector3U            m_ComputeGroupSize{};
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,441 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Resource/Descriptor.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    IDescriptorHeap* IDescriptorHeap::Create(
+        DescriptorType Type,
+        uint32_t       MaxCount,
+        bool           ShaderVisible)
+    {
+        return NEON_NEW NullDescriptorHeap(
+            Type,
+            MaxCount,
+            ShaderVisible);
+    }
+
+    //
+
+    NullDescriptorHeap::NullDescriptorHeap(
+        DescriptorType Type,
+        uint32_t       MaxCount,
+        bool           ShaderVisible) :
+        m_Descriptors(std::make_unique<NullDescriptor[]>(MaxCount)),
+        m_HeapSize(MaxCount),
+        m_HeapType(Type),
+        m_ShaderVisible(ShaderVisible)
+    {
+    }
+
+    NullDescriptorHeap::~NullDescriptorHeap()
+    {
+        if (m_Descriptors)
+        {
+            NullSwapchain::Get()->SafeRelease(this, std::move(m_Descriptors));
+        }
+    }
+
+    void NullDescriptorHeap::Copy(
+        uint32_t                  DestIndex,
+        std::span<const CopyInfo> SrcDescriptors)
+    {
+        uint32_t CopySize = 0;
+        for (auto& Info : SrcDescriptors)
+        {
+            CopySize += Info.CopySize;
+        }
+
+        CopyInfo DestInfo{
+            .Descriptor = GetCPUAddress(DestIndex),
+            .CopySize   = CopySize
+        };
+        IDescriptorHeap::Copy(m_HeapType, SrcDescriptors, { &DestInfo, 1 });
+    }
+
+    void NullDescriptorHeap::Copy(
+        uint32_t        DestIndex,
+        const CopyInfo& SrcDescriptors)
+    {
+        std::copy_n(
+            GetDescriptor(SrcDescriptors.Descriptor),
+            SrcDescriptors.CopySize,
+            &GetDescriptor(DestIndex));
+    }
+
+    void IDescriptorHeap::Copy(
+        DescriptorType,
+        std::span<const CopyInfo> SrcDescriptors,
+        std::span<const CopyInfo> DstDescriptors)
+    {
+        // Ranges are flattened on both sides, like the device would copy them
+        auto     SrcIter   = SrcDescriptors.begin();
+        uint32_t SrcOffset = 0;
+
+        for (auto& Dst : DstDescriptors)
+        {
+            auto DstDescriptor = NullDescriptorHeap::GetDescriptor(Dst.Descriptor);
+            for (uint32_t i = 0; i < Dst.CopySize; i++)
+            {
+                while (SrcIter != SrcDescriptors.end() && SrcOffset == SrcIter->CopySize)
+                {
+                    ++SrcIter;
+                    SrcOffset = 0;
+                }
+                NEON_ASSERT(SrcIter != SrcDescriptors.end(), "Source descriptors are smaller than destination descriptors");
+                DstDescriptor[i] = NullDescriptorHeap::GetDescriptor(SrcIter->Descriptor)[SrcOffset++];
+            }
+        }
+    }
+
+    CpuDescriptorHandle NullDescriptorHeap::GetCPUAddress(
+        uint32_t Offset)
+    {
+        return CpuDescriptorHandle(std::bit_cast<uint64_t>(m_Descriptors.get() + Offset));
+    }
+
+    GpuDescriptorHandle NullDescriptorHeap::GetGPUAddress(
+        uint32_t Offset)
+    {
+        NEON_ASSERT(m_ShaderVisible, "Descriptor heap is not shader visible");
+        return GpuDescriptorHandle(std::bit_cast<uint64_t>(m_Descriptors.get() + Offset));
+    }
+
+    bool NullDescriptorHeap::IsDescriptorInRange(
+        CpuDescriptorHandle Handle)
+    {
+        auto First = GetCPUAddress(0).Value;
+        return Handle.Value >= First && Handle.Value < First + m_HeapSize * sizeof(NullDescriptor);
+    }
+
+    bool NullDescriptorHeap::IsDescriptorInRange(
+        GpuDescriptorHandle Handle)
+    {
+        auto First = GetGPUAddress(0).Value;
+        return Handle.Value >= First && Handle.Value < First + m_HeapSize * sizeof(NullDescriptor);
+    }
+
+    //
+
+    void NullDescriptorHeap::CreateConstantBufferView(
+        uint32_t       DescriptorIndex,
+        const CBVDesc& Desc)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type           = NullDescriptor::ViewType::Cbv,
+            .ConstantBuffer = Desc
+        };
+    }
+
+    void NullDescriptorHeap::CreateShaderResourceView(
+        uint32_t       DescriptorIndex,
+        IGpuResource*  Resource,
+        const SRVDesc* Desc)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type     = NullDescriptor::ViewType::Srv,
+            .Resource = Resource
+        };
+    }
+
+    void NullDescriptorHeap::CreateUnorderedAccessView(
+        uint32_t       DescriptorIndex,
+        IGpuResource*  Resource,
+        const UAVDesc* Desc,
+        IGpuResource*  CounterBuffer)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type          = NullDescriptor::ViewType::Uav,
+            .Resource      = Resource,
+            .CounterBuffer = CounterBuffer
+        };
+    }
+
+    void NullDescriptorHeap::CreateRenderTargetView(
+        uint32_t       DescriptorIndex,
+        IGpuResource*  Resource,
+        const RTVDesc* Desc)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type     = NullDescriptor::ViewType::Rtv,
+            .Resource = Resource
+        };
+    }
+
+    void NullDescriptorHeap::CreateDepthStencilView(
+        uint32_t       DescriptorIndex,
+        IGpuResource*  Resource,
+        const DSVDesc* Desc)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type     = NullDescriptor::ViewType::Dsv,
+            .Resource = Resource
+        };
+    }
+
+    void NullDescriptorHeap::CreateSampler(
+        uint32_t DescriptorIndex,
+        const SamplerDesc&)
+    {
+        GetDescriptor(DescriptorIndex) = {
+            .Type = NullDescriptor::ViewType::Sampler
+        };
+    }
+
+    //
+
+    NullDescriptor* NullDescriptorHeap::Get() const noexcept
+    {
+        return m_Descriptors.get();
+    }
+
+    uint32_t NullDescriptorHeap::GetSize() const noexcept
+    {
+        return m_HeapSize;
+    }
+
+    DescriptorType NullDescriptorHeap::GetType() const noexcept
+    {
+        return m_HeapType;
+    }
+
+    void NullDescriptorHeap::SilentDelete() noexcept
+    {
+        m_Descriptors = nullptr;
+    }
+
+    NullDescriptor* NullDescriptorHeap::GetDescriptor(
+        CpuDescriptorHandle Handle) noexcept
+    {
+        return std::bit_cast<NullDescriptor*>(Handle.Value);
+    }
+
+    NullDescriptor& NullDescriptorHeap::GetDescriptor(
+        uint32_t Index)
+    {
+        NEON_ASSERT(Index < m_HeapSize, "Descriptor index out of range");
+        return m_Descriptors[Index];
+    }
+
+    //
+
+    IDescriptorHeapAllocator* IDescriptorHeapAllocator::Create(
+        AllocationType Type,
+        DescriptorType DescType,
+        uint32_t       SizeOfHeap,
+        bool           ShaderVisible)
+    {
+        switch (Type)
+        {
+        case AllocationType::Ring:
+            return NEON_NEW NullRingDescriptorHeapAllocator(DescType, SizeOfHeap, ShaderVisible);
+        case AllocationType::Buddy:
+            return NEON_NEW NullDescriptorHeapBuddyAllocator(DescType, SizeOfHeap, ShaderVisible);
+        default:
+            std::unreachable();
+        }
+    }
+
+    //
+
+    NullRingDescriptorHeapAllocator::NullRingDescriptorHeapAllocator(
+        DescriptorType Type,
+        uint32_t       MaxCount,
+        bool           ShaderVisible) :
+        m_HeapDescriptor(Type, MaxCount, ShaderVisible)
+    {
+    }
+
+    DescriptorHeapHandle NullRingDescriptorHeapAllocator::Allocate(
+        uint32_t DescriptorSize)
+    {
+        uint32_t HeapSize   = m_HeapDescriptor.GetSize();
+        uint32_t HeapOffset = m_CurrentDescriptorOffset.load(std::memory_order_relaxed);
+        uint32_t NextOffset;
+
+        do
+        {
+            // Wrap around to the start of the heap when the descriptors don't fit at the end
+            NextOffset = HeapOffset + DescriptorSize;
+            if (NextOffset >= HeapSize)
+            {
+                NextOffset = DescriptorSize;
+            }
+        } while (!m_CurrentDescriptorOffset.compare_exchange_weak(HeapOffset, NextOffset, std::memory_order_relaxed));
+
+        return {
+            .Heap   = &m_HeapDescriptor,
+            .Offset = NextOffset - DescriptorSize,
+            .Size   = DescriptorSize
+        };
+    }
+
+    IDescriptorHeap* NullRingDescriptorHeapAllocator::GetHeap(
+        uint32_t Index)
+    {
+        NEON_ASSERT(Index == 0);
+        return &m_HeapDescriptor;
+    }
+
+    uint32_t NullRingDescriptorHeapAllocator::GetHeapsCount()
+    {
+        return 1;
+    }
+
+    //
+
+    NullDescriptorHeapBuddyAllocator::BuddyBlock::BuddyBlock(
+        const HeapDescriptorAllocInfo& Info) :
+        Heap(Info.Type, Info.SizeOfHeap, Info.ShaderVisible),
+        Allocator(Info.SizeOfHeap)
+    {
+    }
+
+    NullDescriptorHeapBuddyAllocator::NullDescriptorHeapBuddyAllocator(
+        DescriptorType Type,
+        uint32_t       SizeOfHeap,
+        bool           ShaderVisible) :
+        m_HeapBlockAllocInfo{ SizeOfHeap, Type, ShaderVisible }
+    {
+    }
+
+    DescriptorHeapHandle NullDescriptorHeapBuddyAllocator::Allocate(
+        uint32_t DescriptorSize)
+    {
+        auto TryAllocate = [this, DescriptorSize](uint32_t First, uint32_t Last) -> DescriptorHeapHandle
+        {
+            for (uint32_t i = First; i < Last; i++)
+            {
+                auto& Block = GetBlock(i);
+                if (auto Hndl = Block.Allocator.Allocate(DescriptorSize))
+                {
+                    return {
+                        .Heap   = &Block.Heap,
+                        .Offset = Hndl.Offset,
+                        .Size   = Hndl.Size
+                    };
+                }
+            }
+            return {};
+        };
+
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        if (auto Hndl = TryAllocate(0, BlockCount)) [[likely]]
+        {
+            return Hndl;
+        }
+
+        std::scoped_lock HeapLock(m_HeapBlocksMutex);
+
+        // Another thread may have added a block while we were waiting
+        uint32_t NewBlockCount = m_HeapBlockCount.load(std::memory_order_relaxed);
+        if (auto Hndl = TryAllocate(BlockCount, NewBlockCount))
+        {
+            return Hndl;
+        }
+
+        // Grow the heap for each new allocation
+        if (NewBlockCount) [[likely]]
+        {
+            m_HeapBlockAllocInfo.SizeOfHeap *= 2;
+        }
+
+        while (m_HeapBlockAllocInfo.SizeOfHeap < DescriptorSize)
+        {
+            m_HeapBlockAllocInfo.SizeOfHeap *= 2;
+        }
+
+        auto [ChunkIndex, Slot] = GetBlockSlot(NewBlockCount);
+
+        auto& Chunk = m_HeapBlocks[ChunkIndex];
+        if (!Chunk)
+        {
+            Chunk = std::make_unique<UPtr<BuddyBlock>[]>(s_FirstChunkSize << ChunkIndex);
+        }
+
+        auto& Block = *(Chunk[Slot] = std::make_unique<BuddyBlock>(m_HeapBlockAllocInfo));
+        auto  Hndl  = Block.Allocator.Allocate(DescriptorSize);
+
+        m_HeapBlockCount.store(NewBlockCount + 1, std::memory_order_release);
+
+        if (!Hndl)
+        {
+            NEON_ERROR_TAG("Graphics", "Failed to allocate {} descriptors from a new descriptor heap of {}", DescriptorSize, m_HeapBlockAllocInfo.SizeOfHeap);
+            return {};
+        }
+
+        return {
+            .Heap   = &Block.Heap,
+            .Offset = Hndl.Offset,
+            .Size   = Hndl.Size
+        };
+    }
+
+    void NullDescriptorHeapBuddyAllocator::Free(
+        std::span<const DescriptorHeapHandle> Handles)
+    {
+        std::vector<Allocator::CachedRangeAllocator::Handle> Batch;
+        Batch.reserve(Handles.size());
+
+        size_t   FreeCount  = 0;
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < BlockCount; i++)
+        {
+            auto& Block = GetBlock(i);
+
+            Batch.clear();
+            for (auto& Data : Handles)
+            {
+                if (Data.Heap == &Block.Heap)
+                {
+                    Batch.push_back({ .Offset = Data.Offset, .Size = Data.Size });
+                }
+            }
+
+            if (!Batch.empty())
+            {
+                Block.Allocator.Free(Batch);
+                FreeCount += Batch.size();
+            }
+        }
+        NEON_ASSERT(FreeCount == Handles.size(), "Tried to free a non-existant heap");
+    }
+
+    void NullDescriptorHeapBuddyAllocator::FreeAll()
+    {
+        uint32_t BlockCount = m_HeapBlockCount.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < BlockCount; i++)
+        {
+            GetBlock(i).Allocator.FreeAll();
+        }
+    }
+
+    IDescriptorHeap* NullDescriptorHeapBuddyAllocator::GetHeap(
+        uint32_t Index)
+    {
+        NEON_ASSERT(Index < m_HeapBlockCount.load(std::memory_order_acquire));
+        return &GetBlock(Index).Heap;
+    }
+
+    uint32_t NullDescriptorHeapBuddyAllocator::GetHeapsCount()
+    {
+        return m_HeapBlockCount.load(std::memory_order_acquire);
+    }
+
+    auto NullDescriptorHeapBuddyAllocator::GetBlock(
+        uint32_t Index) noexcept -> BuddyBlock&
+    {
+        auto [ChunkIndex, Slot] = GetBlockSlot(Index);
+        return *m_HeapBlocks[ChunkIndex][Slot];
+    }
+
+    std::pair<uint32_t, uint32_t> NullDescriptorHeapBuddyAllocator::GetBlockSlot(
+        uint32_t Index) noexcept
+    {
+        // Chunk N holds s_FirstChunkSize << N blocks, and starts after s_FirstChunkSize * (2^N - 1) blocks
+        uint32_t ChunkIndex = uint32_t(std::bit_width(Index / s_FirstChunkSize + 1) - 1);
+        return { ChunkIndex, Index - s_FirstChunkSize * ((1u << ChunkIndex) - 1) };
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <GraphicsPCH.hpp>
+#include <RHI/Resource/Descriptor.hpp>
+#include <Allocator/CachedRange.hpp>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Descriptor of the null backend, only the identity of the viewed resources is kept.
+    /// </summary>
+    struct NullDescriptor
+    {
+        enum class ViewType : uint8_t
+        {
+            None,
+            Cbv,
+            Srv,
+            Uav,
+            Rtv,
+            Dsv,
+            Sampler
+        };
+
+        ViewType      Type          = ViewType::None;
+        IGpuResource* Resource      = nullptr;
+        IGpuResource* CounterBuffer = nullptr;
+        CBVDesc       ConstantBuffer{};
+    };
+
+    //
+
+    class NullDescriptorHeap final : public IDescriptorHeap
+    {
+    public:
+        NullDescriptorHeap(
+            DescriptorType Type,
+            uint32_t       MaxCount,
+            bool           ShaderVisible);
+
+        NEON_CLASS_NO_COPY(NullDescriptorHeap);
+        NEON_CLASS_MOVE(NullDescriptorHeap);
+
+        ~NullDescriptorHeap() override;
+
+        /// <summary>
+        /// Copy to descriptors
+        /// </summary>
+        void Copy(
+            uint32_t                  DestIndex,
+            std::span<const CopyInfo> SrcDescriptors) override;
+
+        /// <summary>
+        /// Copy to descriptor
+        /// </summary>
+        void Copy(
+            uint32_t        DestIndex,
+            const CopyInfo& SrcDescriptors) override;
+
+        /// <summary>
+        /// Get cpu handle of offset
+        /// </summary>
+        [[nodiscard]] CpuDescriptorHandle GetCPUAddress(
+            uint32_t Offset = 0) override;
+
+        /// <summary>
+        /// Get heap descriptor
+        /// </summary>
+        [[nodiscard]] GpuDescriptorHandle GetGPUAddress(
+            uint32_t Offset = 0) override;
+
+        /// <summary>
+        /// Check to see if the descriptor is in range
+        /// </summary>
+        [[nodiscard]] bool IsDescriptorInRange(
+            CpuDescriptorHandle Handle) override;
+
+        /// <summary>
+        /// Check to see if the descriptor is in range
+        /// </summary>
+        [[nodiscard]] bool IsDescriptorInRange(
+            GpuDescriptorHandle Handle) override;
+
+    public:
+        /// <summary>
+        /// Create constant buffer view of target offset in current descriptor
+        /// </summary>
+        void CreateConstantBufferView(
+            uint32_t       DescriptorIndex,
+            const CBVDesc& Desc) override;
+
+        /// <summary>
+        /// Create shader resource view of target offset in current descriptor
+        /// </summary>
+        void CreateShaderResourceView(
+            uint32_t       DescriptorIndex,
+            IGpuResource*  Resource,
+            const SRVDesc* Desc) override;
+
+        /// <summary>
+        /// Create unordered access view of target offset in current descriptor
+        /// </summary>
+        void CreateUnorderedAccessView(
+            uint32_t       DescriptorIndex,
+            IGpuResource*  Resource,
+            const UAVDesc* Desc,
+            IGpuResource*  CounterBuffer = nullptr) override;
+
+        /// <summary>
+        /// Create render target view of target offset in current descriptor
+        /// </summary>
+        void CreateRenderTargetView(
+            uint32_t       DescriptorIndex,
+            IGpuResource*  Resource,
+            const RTVDesc* Desc) override;
+
+        /// <summary>
+        /// Create depth stencil view of target offset in current descriptor
+        /// </summary>
+        void CreateDepthStencilView(
+            uint32_t       DescriptorIndex,
+            IGpuResource*  Resource,
+            const DSVDesc* Desc) override;
+
+        /// <summary>
+        /// Create sampler of target offset in current descriptor
+        /// </summary>
+        void CreateSampler(
+            uint32_t           DescriptorIndex,
+            const SamplerDesc& Desc) override;
+
+    public:
+        /// <summary>
+        /// Get the descriptors of the heap
+        /// </summary>
+        [[nodiscard]] NullDescriptor* Get() const noexcept;
+
+        /// <summary>
+        /// Get heap descriptor size
+        /// </summary>
+        [[nodiscard]] uint32_t GetSize() const noexcept;
+
+        /// <summary>
+        /// Get heap descriptor type
+        /// </summary>
+        [[nodiscard]] DescriptorType GetType() const noexcept;
+
+        /// <summary>
+        /// Free descriptor without notifying swapchain to release
+        /// </summary>
+        void SilentDelete() noexcept;
+
+        /// <summary>
+        /// Get the descriptor of a cpu handle
+        /// </summary>
+        [[nodiscard]] static NullDescriptor* GetDescriptor(
+            CpuDescriptorHandle Handle) noexcept;
+
+    private:
+        /// <summary>
+        /// Get the descriptor at index
+        /// </summary>
+        [[nodiscard]] NullDescriptor& GetDescriptor(
+            uint32_t Index);
+
+    protected:
+        std::unique_ptr<NullDescriptor[]> m_Descriptors;
+
+        uint32_t       m_HeapSize;
+        DescriptorType m_HeapType;
+        bool           m_ShaderVisible;
+    };
+
+    //
+
+    struct HeapDescriptorAllocInfo
+    {
+        uint32_t       SizeOfHeap;
+        DescriptorType Type;
+        bool           ShaderVisible;
+    };
+
+    class NullRingDescriptorHeapAllocator final : public IDescriptorHeapAllocator
+    {
+    public:
+        NullRingDescriptorHeapAllocator(
+            DescriptorType Type,
+            uint32_t       MaxCount,
+            bool           ShaderVisible);
+
+        DescriptorHeapHandle Allocate(
+            uint32_t DescriptorSize) override;
+
+        void Free(
+            std::span<const DescriptorHeapHandle>) override
+        {
+        }
+
+        void FreeAll() override
+        {
+        }
+
+        IDescriptorHeap* GetHeap(
+            uint32_t) override;
+
+        uint32_t GetHeapsCount() override;
+
+    private:
+        NullDescriptorHeap    m_HeapDescriptor;
+        std::atomic<uint32_t> m_CurrentDescriptorOffset = 0;
+    };
+
+    //
+
+    class NullDescriptorHeapBuddyAllocator final : public IDescriptorHeapAllocator
+    {
+        /// <summary>
+        /// Blocks are stored in chunks that double in size, so the list grows without moving the published blocks.
+        /// </summary>
+        static constexpr uint32_t s_FirstChunkSize = 8;
+        static constexpr uint32_t s_ChunkCount     = 29;
+
+        struct BuddyBlock
+        {
+            NullDescriptorHeap              Heap;
+            Allocator::CachedRangeAllocator Allocator;
+
+            BuddyBlock(
+                const HeapDescriptorAllocInfo& Info);
+        };
+
+        using BuddyBlockChunk = std::unique_ptr<UPtr<BuddyBlock>[]>;
+        using BuddyBlockList  = std::array<BuddyBlockChunk, s_ChunkCount>;
+
+    public:
+        NullDescriptorHeapBuddyAllocator(
+            DescriptorType Type,
+            uint32_t       SizeOfHeap,
+            bool           ShaderVisible);
+
+        DescriptorHeapHandle Allocate(
+            uint32_t DescriptorSize) override;
+
+        void Free(
+            std::span<const DescriptorHeapHandle> Handles) override;
+
+        void FreeAll() override;
+
+        IDescriptorHeap* GetHeap(
+            uint32_t Index) override;
+
+        uint32_t GetHeapsCount() override;
+
+    public:
+        /// <summary>
+        /// Helper function to get all heaps in this allocator
+        /// </summary>
+        auto GetAllHeaps() noexcept
+        {
+            return std::views::iota(0u, m_HeapBlockCount.load(std::memory_order_acquire)) |
+                   std::views::transform(
+                       [this](uint32_t Index) -> NullDescriptorHeap*
+                       {
+                           return &GetBlock(Index).Heap;
+                       });
+        }
+
+    private:
+        /// <summary>
+        /// Get a block by its index, it must be published.
+        /// </summary>
+        [[nodiscard]] BuddyBlock& GetBlock(
+            uint32_t Index) noexcept;
+
+        /// <summary>
+        /// Get the chunk a block is stored in and its index in that chunk.
+        /// </summary>
+        [[nodiscard]] static std::pair<uint32_t, uint32_t> GetBlockSlot(
+            uint32_t Index) noexcept;
+
+    private:
+        /// <summary>
+        /// Blocks are only appended, so allocations can walk the published ones without locking.
+        /// The mutex is only taken to add a new block, and a chunk before its first block is published.
+        /// </summary>
+        std::mutex              m_HeapBlocksMutex;
+        HeapDescriptorAllocInfo m_HeapBlockAllocInfo;
+        BuddyBlockList          m_HeapBlocks;
+        std::atomic<uint32_t>   m_HeapBlockCount = 0;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Resource/GraphicsMemoryAllocator.hpp>
+#include <Private/RHI/Null/Device.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    NullMemoryAllocator::BuddyBlock::BuddyBlock(
+        IGlobalBufferPool::BufferType Type,
+        size_t                        SizeOfBuffer) :
+        Allocator(SizeOfBuffer)
+    {
+        IGpuResource::InitDesc InitDesc;
+        MResourceFlags         Flags;
+        GraphicsBufferType     BufferType;
+
+        switch (Type)
+        {
+        case IGlobalBufferPool::BufferType::ReadOnly:
+            Flags.Set(RHI::EResourceFlags::DenyShaderResource);
+            InitDesc.InitialState.Set(EResourceState::CopyDest);
+            InitDesc.Name = STR("NullMemoryAllocator::ReabackBuffer");
+            BufferType    = GraphicsBufferType::Readback;
+
+            break;
+        case IGlobalBufferPool::BufferType::ReadWrite:
+        case IGlobalBufferPool::BufferType::ReadWriteGPUR:
+        case IGlobalBufferPool::BufferType::ReadWriteGPURW:
+            InitDesc.InitialState.Set(EResourceState::CopySource);
+            BufferType = GraphicsBufferType::Upload;
+
+            if (Type == IGlobalBufferPool::BufferType::ReadWrite)
+            {
+                Flags.Set(RHI::EResourceFlags::DenyShaderResource);
+                InitDesc.Name = STR("NullMemoryAllocator::UploadBuffer");
+            }
+            else if (Type == IGlobalBufferPool::BufferType::ReadWriteGPURW)
+            {
+                Flags.Set(RHI::EResourceFlags::AllowUnorderedAccess);
+                InitDesc.Name = STR("NullMemoryAllocator::UploadBuffer_RW");
+            }
+            else
+            {
+                InitDesc.Name = STR("NullMemoryAllocator::UploadBuffer_R");
+            }
+            break;
+        default:
+            std::unreachable();
+        }
+
+        this->Buffer.reset(static_cast<NullGpuResource*>(
+            IGpuResource::Create(
+                ResourceDesc::Buffer(SizeOfBuffer, Flags, BufferType),
+                InitDesc)));
+    }
+
+    NullMemoryAllocator::BuddyBlock::~BuddyBlock()
+    {
+        Buffer->SilentRelease();
+    }
+
+    NullMemoryAllocator::NullMemoryAllocator() :
+        m_FrameRing(
+            [](size_t PageSize)
+            {
+                IGpuResource::InitDesc InitDesc;
+                InitDesc.InitialState.Set(EResourceState::CopySource);
+                InitDesc.Name = STR("NullMemoryAllocator::FrameUploadBuffer");
+
+                auto Buffer = static_cast<NullGpuResource*>(
+                    IGpuResource::Create(
+                        ResourceDesc::Buffer(
+                            PageSize,
+                            {},
+                            GraphicsBufferType::Upload),
+                        InitDesc));
+
+                return Allocator::FrameRingAllocator::PageMemory{
+                    .Context    = Buffer,
+                    .CpuAddress = Buffer->Map(),
+                    .GpuAddress = Buffer->GetHandle(0).Value,
+                    .Size       = Buffer->GetSize()
+                };
+            },
+            [](const Allocator::FrameRingAllocator::PageMemory& Page)
+            {
+                auto Buffer = static_cast<NullGpuResource*>(Page.Context);
+                Buffer->SilentRelease();
+                delete Buffer;
+            })
+    {
+    }
+
+    void NullMemoryAllocator::Shutdown()
+    {
+        m_FrameRing.Shutdown();
+
+        std::scoped_lock BufferLock(m_PoolMutex);
+        for (auto& Allocator : m_BufferAllocators)
+        {
+            Allocator.BufferPools.clear();
+        }
+    }
+
+    auto NullMemoryAllocator::AllocateBuffer(
+        IGlobalBufferPool::BufferType Type,
+        size_t                        BufferSize,
+        size_t                        Alignement) -> Handle
+    {
+        NEON_ASSERT(Alignement > 0);
+
+        auto& Allocator = m_BufferAllocators[int(Type)];
+        BufferSize      = Math::AlignUp(BufferSize, Alignement);
+
+        std::scoped_lock BufferLock(m_PoolMutex);
+
+        for (auto Iter = Allocator.BufferPools.begin(); Iter != Allocator.BufferPools.end(); Iter++)
+        {
+            if (auto Hndl = Iter->Allocator.Allocate(BufferSize, Alignement))
+            {
+                return {
+                    .Resource = Iter->Buffer.get(),
+                    .Offset   = Hndl.Offset,
+                    .Size     = Hndl.Size,
+                    .Type     = Type
+                };
+            }
+        }
+
+        while (Allocator.SizeOfBuffer < BufferSize)
+        {
+            Allocator.SizeOfBuffer *= 2;
+        }
+
+        auto& Block         = Allocator.BufferPools.emplace_back(Type, Allocator.SizeOfBuffer);
+        auto [Offset, Size] = Block.Allocator.Allocate(BufferSize, Alignement);
+
+        return {
+            .Resource = Block.Buffer.get(),
+            .Offset   = Offset,
+            .Size     = Size,
+            .Type     = Type
+        };
+    }
+
+    void NullMemoryAllocator::FreeBuffers(
+        std::span<Handle> Handles)
+    {
+        std::scoped_lock BufferLock(m_PoolMutex);
+        for (auto& Hndl : Handles)
+        {
+            bool  Exists    = false;
+            auto& Allocator = m_BufferAllocators[int(Hndl.Type)];
+
+            for (auto& Block : Allocator.BufferPools)
+            {
+                if (Hndl.Resource == Block.Buffer.get())
+                {
+                    Block.Allocator.Free({ .Offset = Hndl.Offset, .Size = Hndl.Size });
+                    Exists = true;
+                    break;
+                }
+            }
+            NEON_ASSERT(Exists, "Tried to free a non-existant buffer");
+        }
+    }
+
+    Allocator::FrameRingAllocator::Allocation NullMemoryAllocator::AllocateFrame(
+        size_t BufferSize,
+        size_t Alignement)
+    {
+        NEON_ASSERT(Alignement > 0);
+        return m_FrameRing.Allocate(BufferSize, Alignement);
+    }
+
+    void NullMemoryAllocator::BeginFrame(
+        uint64_t FrameId,
+        uint64_t CompletedFrameId)
+    {
+        m_FrameRing.BeginFrame(FrameId, CompletedFrameId);
+    }
+
+    NullResourceStateManager* NullMemoryAllocator::GetStateManager()
+    {
+        return &m_StateManager;
+    }
+} // namespace Neon::RHI
\ No newline at end of file
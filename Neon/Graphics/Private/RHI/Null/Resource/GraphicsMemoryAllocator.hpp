@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Private/RHI/Null/Resource/State.hpp>
+#include <Private/RHI/Null/Resource/Resource.hpp>
+#include <RHI/GlobalBuffer.hpp>
+
+#include <Allocator/TLSF.hpp>
+#include <Allocator/FrameRing.hpp>
+
+#include <mutex>
+#include <list>
+
+namespace Neon::RHI
+{
+    class NullMemoryAllocator
+    {
+    public:
+        struct Handle
+        {
+            IGpuResource*                 Resource;
+            size_t                        Offset;
+            size_t                        Size;
+            IGlobalBufferPool::BufferType Type;
+        };
+
+    private:
+        struct BuddyBlock
+        {
+            UPtr<NullGpuResource>    Buffer;
+            Allocator::TLSFAllocator Allocator;
+
+            BuddyBlock(
+                IGlobalBufferPool::BufferType Type,
+                size_t                        SizeOfBuffer);
+
+            ~BuddyBlock();
+        };
+
+        struct BufferAllocator
+        {
+            size_t                SizeOfBuffer = 65'536;
+            std::list<BuddyBlock> BufferPools;
+        };
+
+        using BufferAllocatorByFlags = std::array<BufferAllocator, size_t(IGlobalBufferPool::BufferType::Count)>;
+
+    public:
+        NullMemoryAllocator();
+
+        /// <summary>
+        /// Shutdown allocator and free all resources
+        /// </summary>
+        void Shutdown();
+
+        /// <summary>
+        /// Allocate buffer of size
+        /// </summary>
+        [[nodiscard]] Handle AllocateBuffer(
+            IGlobalBufferPool::BufferType Type,
+            size_t                        BufferSize,
+            size_t                        Alignement);
+
+        /// <summary>
+        /// Free current buffer handle
+        /// </summary>
+        void FreeBuffers(
+            std::span<Handle> Hndl);
+
+    public:
+        /// <summary>
+        /// Allocate upload memory from the frame ring
+        /// </summary>
+        [[nodiscard]] Allocator::FrameRingAllocator::Allocation AllocateFrame(
+            size_t BufferSize,
+            size_t Alignement);
+
+        /// <summary>
+        /// Start a new frame in the frame ring, recycling the pages of completed frames
+        /// </summary>
+        void BeginFrame(
+            uint64_t FrameId,
+            uint64_t CompletedFrameId);
+
+    public:
+        /// <summary>
+        /// Get state manager for this allocator
+        /// </summary>
+        [[nodiscard]] NullResourceStateManager* GetStateManager();
+
+    private:
+        NullResourceStateManager      m_StateManager;
+        std::mutex                    m_PoolMutex;
+        BufferAllocatorByFlags        m_BufferAllocators;
+        Allocator::FrameRingAllocator m_FrameRing;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,340 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Resource/Resource.hpp>
+#include <Private/RHI/Null/Resource/State.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <RHI/GlobalBuffer.hpp>
+
+#include <bit>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    IGpuResource* IGpuResource::Create(
+        const ResourceDesc& Desc,
+        const InitDesc&     Init)
+    {
+        return NEON_NEW NullGpuResource(Desc, Init);
+    }
+
+    IGpuResource* IGpuResource::Create(
+        const TextureRawImage& ImageData,
+        const InitDesc&        Init)
+    {
+        if (!ImageData.Data)
+        {
+            return nullptr;
+        }
+
+        // Images are not decoded, a magenta texel stands for the image
+        const uint8_t Magenta[]{ 0xFF, 0x00, 0xFF, 0xFF };
+
+        SubresourceDesc Subresource{
+            .Data       = Magenta,
+            .RowPitch   = sizeof(Magenta),
+            .SlicePitch = sizeof(Magenta)
+        };
+
+        InitDesc PlaceholderInit = Init;
+        PlaceholderInit.Subresources = { &Subresource, 1 };
+
+        return NEON_NEW NullGpuResource(
+            ResourceDesc::Tex2D(EResourceFormat::R8G8B8A8_UNorm, 1, 1, 1, 1),
+            PlaceholderInit);
+    }
+
+    //
+
+    NullGpuResource::NullGpuResource(
+        const ResourceDesc& Desc,
+        const InitDesc&     Init)
+    {
+        m_Desc = Desc;
+        if (!m_Desc.MipLevels)
+        {
+            size_t MaxDimension = std::max<size_t>(m_Desc.Width, m_Desc.Height);
+            if (m_Desc.Type == ResourceType::Texture3D)
+            {
+                MaxDimension = std::max<size_t>(MaxDimension, m_Desc.Depth);
+            }
+            m_Desc.MipLevels = uint16_t(std::bit_width(MaxDimension));
+        }
+
+        InitializeFootprints();
+        m_Data = std::make_unique<uint8_t[]>(m_DataSize);
+
+        MResourceState DefaultInitialState = MResourceState_Common;
+        switch (Desc.Type)
+        {
+        case ResourceType::Buffer:
+            switch (Desc.BufferType)
+            {
+            case GraphicsBufferType::Upload:
+                DefaultInitialState = MResourceState_GenericRead;
+                break;
+            case GraphicsBufferType::Readback:
+                DefaultInitialState = MResourceState::FromEnum(EResourceState::CopyDest);
+                break;
+            }
+            break;
+        case ResourceType::Texture1D:
+        case ResourceType::Texture2D:
+        case ResourceType::Texture3D:
+            DefaultInitialState = Init.InitialState;
+            break;
+        default:
+            NEON_ASSERT(false, "Invalid resource type");
+            break;
+        }
+
+        auto InitialState = (Init.Subresources.empty() || Desc.Type == ResourceType::Buffer) ? DefaultInitialState : MResourceState::FromEnum(EResourceState::CopyDest);
+
+        NullResourceStateManager::Get()->StartTrakingResource(this, InitialState);
+        if (!Init.Subresources.empty())
+        {
+            *Init.CopyTask = CopyFrom(0, Init.Subresources, Init.InitialState);
+        }
+        else if (InitialState != Init.InitialState)
+        {
+            NullResourceStateManager::Get()->TransitionResource(this, Init.InitialState);
+        }
+    }
+
+    NullGpuResource::~NullGpuResource()
+    {
+        if (m_Data)
+        {
+            NullResourceStateManager::Get()->StopTrakingResource(this);
+            NullSwapchain::Get()->SafeRelease(std::move(m_Data));
+        }
+    }
+
+    void NullGpuResource::QueryFootprint(
+        uint32_t              FirstSubresource,
+        uint32_t              SubresourceCount,
+        size_t                Offset,
+        SubresourceFootprint* OutFootprint,
+        uint32_t*             NumRows,
+        size_t*               RowSizeInBytes,
+        size_t*               LinearSize) const
+    {
+        NEON_ASSERT(FirstSubresource + SubresourceCount <= m_Footprints.size(), "Subresource out of range");
+
+        size_t BaseOffset = SubresourceCount ? m_Footprints[FirstSubresource].Offset : 0;
+        size_t TotalBytes = 0;
+
+        for (uint32_t i = 0; i < SubresourceCount; i++)
+        {
+            auto& Footprint = m_Footprints[FirstSubresource + i];
+            if (OutFootprint)
+            {
+                OutFootprint[i]        = Footprint;
+                OutFootprint[i].Offset = Footprint.Offset - BaseOffset + Offset;
+            }
+            if (NumRows)
+            {
+                NumRows[i] = m_NumRows[FirstSubresource + i];
+            }
+            if (RowSizeInBytes)
+            {
+                RowSizeInBytes[i] = Footprint.RowPitch;
+            }
+            TotalBytes = Footprint.Offset - BaseOffset + size_t(Footprint.RowPitch) * m_NumRows[FirstSubresource + i] * Footprint.Depth;
+        }
+
+        if (LinearSize)
+        {
+            *LinearSize = TotalBytes;
+        }
+    }
+
+    std::future<void> NullGpuResource::CopyFrom(
+        uint32_t                           FirstSubresource,
+        std::span<const SubresourceDesc>   Subresources,
+        std::optional<RHI::MResourceState> TransitionState)
+    {
+        struct SubresourceDescGuard
+        {
+            std::vector<SubresourceDesc>            Subresources;
+            std::vector<std::unique_ptr<uint8_t[]>> Datas;
+
+            SubresourceDescGuard() = default;
+            NEON_CLASS_NO_COPY(SubresourceDescGuard);
+            NEON_CLASS_MOVE(SubresourceDescGuard);
+            ~SubresourceDescGuard() = default;
+        };
+
+        auto Guard = std::make_unique<SubresourceDescGuard>();
+
+        Guard->Subresources = Subresources |
+                              std::ranges::to<std::vector<SubresourceDesc>>();
+        Guard->Datas.reserve(Subresources.size());
+        for (auto& Subresource : Guard->Subresources)
+        {
+            size_t Size    = Subresource.SlicePitch;
+            auto   NewData = Guard->Datas.emplace_back(std::make_unique<uint8_t[]>(Size)).get();
+            std::copy_n(std::bit_cast<uint8_t*>(Subresource.Data), Size, std::bit_cast<uint8_t*>(NewData));
+            Subresource.Data = NewData;
+        }
+
+        return ISwapchain::Get()->RequestCopy(
+            [FirstSubresource,
+             SubreourcesGuard = std::move(Guard)](ICommandList*    CommandList,
+                                                  NullGpuResource* Resource)
+            {
+                size_t TotalBytes;
+                Resource->QueryFootprint(
+                    FirstSubresource,
+                    uint32_t(SubreourcesGuard->Subresources.size()),
+                    0,
+                    nullptr,
+                    nullptr,
+                    nullptr,
+                    &TotalBytes);
+
+                UBufferPoolHandle Handle(
+                    TotalBytes,
+                    256,
+                    RHI::IGlobalBufferPool::BufferType::ReadWrite);
+
+                CommandList->CopySubresources(
+                    Resource,
+                    Handle.Buffer,
+                    Handle.Offset,
+                    FirstSubresource,
+                    SubreourcesGuard->Subresources);
+            },
+            [TransitionState = std::move(TransitionState)](NullGpuResource* Resource)
+            {
+                if (TransitionState)
+                {
+                    NullResourceStateManager::Get()->TransitionResource(Resource, *TransitionState);
+                }
+            },
+            this);
+    }
+
+    void NullGpuResource::SilentRelease()
+    {
+        if (m_Data)
+        {
+            NullResourceStateManager::Get()->StopTrakingResource(this);
+            m_Data = nullptr;
+        }
+    }
+
+    //
+
+    GpuResourceHandle NullGpuResource::GetHandle(
+        size_t Offset) const
+    {
+        return { std::bit_cast<uint64_t>(m_Data.get()) + Offset };
+    }
+
+    //
+
+    uint8_t* NullGpuResource::Map()
+    {
+        return m_Data.get();
+    }
+
+    void NullGpuResource::Unmap()
+    {
+    }
+
+    //
+
+    uint8_t* NullGpuResource::GetData() const noexcept
+    {
+        return m_Data.get();
+    }
+
+    size_t NullGpuResource::GetDataSize() const noexcept
+    {
+        return m_DataSize;
+    }
+
+    const SubresourceFootprint& NullGpuResource::GetFootprint(
+        uint32_t Subresource) const
+    {
+        NEON_ASSERT(Subresource < m_Footprints.size(), "Subresource out of range");
+        return m_Footprints[Subresource];
+    }
+
+    uint32_t NullGpuResource::GetNumRows(
+        uint32_t Subresource) const
+    {
+        NEON_ASSERT(Subresource < m_NumRows.size(), "Subresource out of range");
+        return m_NumRows[Subresource];
+    }
+
+    //
+
+    void NullGpuResource::InitializeFootprints()
+    {
+        constexpr size_t SubresourceAlignement = 16;
+
+        if (m_Desc.Type == ResourceType::Buffer)
+        {
+            m_Footprints.push_back(SubresourceFootprint{
+                { .Width    = uint32_t(m_Desc.Width),
+                  .Height   = 1,
+                  .Depth    = 1,
+                  .RowPitch = uint32_t(m_Desc.Width),
+                  .Format   = m_Desc.Format },
+                0 });
+            m_NumRows.emplace_back(1);
+            m_DataSize = m_Desc.Width;
+            return;
+        }
+
+        // A 3D texture has a single subresource per mip, holding every depth slice
+        bool     Is3D       = m_Desc.Type == ResourceType::Texture3D;
+        uint32_t ArraySize  = Is3D ? 1 : m_Desc.Depth;
+        uint32_t MipLevels  = m_Desc.MipLevels;
+        size_t   DataOffset = 0;
+
+        m_Footprints.reserve(size_t(ArraySize) * MipLevels);
+        m_NumRows.reserve(size_t(ArraySize) * MipLevels);
+
+        for (uint32_t i = 0; i < ArraySize; i++)
+        {
+            for (uint32_t Mip = 0; Mip < MipLevels; Mip++)
+            {
+                uint32_t Width  = std::max(uint32_t(m_Desc.Width >> Mip), 1u);
+                uint32_t Height = std::max(m_Desc.Height >> Mip, 1u);
+                uint32_t Depth  = Is3D ? std::max(uint32_t(m_Desc.Depth) >> Mip, 1u) : 1;
+
+                auto Subresource = ComputeSubresource(m_Desc.Format, nullptr, Width, Height);
+                if (!Subresource.RowPitch)
+                {
+                    Subresource.RowPitch   = size_t(Width) * 4;
+                    Subresource.SlicePitch = Subresource.RowPitch * Height;
+                }
+
+                DataOffset = Math::AlignUp(DataOffset, SubresourceAlignement);
+                m_Footprints.push_back(SubresourceFootprint{
+                    { .Width    = Width,
+                      .Height   = Height,
+                      .Depth    = Depth,
+                      .RowPitch = uint32_t(Subresource.RowPitch),
+                      .Format   = m_Desc.Format },
+                    DataOffset });
+                m_NumRows.emplace_back(uint32_t(Subresource.SlicePitch / Subresource.RowPitch));
+
+                DataOffset += Subresource.SlicePitch * Depth;
+            }
+        }
+
+        m_DataSize = DataOffset;
+    }
+
+    //
+
+    const Ptr<IGpuResource>& IGpuResource::GetDefaultTexture(
+        DefaultTextures Type)
+    {
+        return NullRenderDevice::Get()->GetDefaultTexture(Type);
+    }
+} // namespace Neon::RHI
\ No newline at end of file
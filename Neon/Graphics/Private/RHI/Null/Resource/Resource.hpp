@@ -0,0 +1,87 @@
+#pragma once
+
+#include <RHI/Resource/Resource.hpp>
+#include <Math/Vector.hpp>
+#include <future>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Resource of the null backend, backed by CPU memory.
+    /// Subresources are packed one after the other without any row or placement padding, the GPU handle of a
+    /// resource is the address of its memory.
+    /// </summary>
+    class NullGpuResource : public IGpuResource
+    {
+    public:
+        NullGpuResource(
+            const ResourceDesc& Desc,
+            const InitDesc&     Init);
+
+        NEON_CLASS_NO_COPYMOVE(NullGpuResource);
+
+        ~NullGpuResource() override;
+
+        void QueryFootprint(
+            uint32_t              FirstSubresource,
+            uint32_t              SubresourceCount,
+            size_t                Offset,
+            SubresourceFootprint* OutFootprint,
+            uint32_t*             NumRows,
+            size_t*               RowSizeInBytes,
+            size_t*               LinearSize) const override;
+
+        std::future<void> CopyFrom(
+            uint32_t                           FirstSubresource,
+            std::span<const SubresourceDesc>   Subresources,
+            std::optional<RHI::MResourceState> TransitionState) override;
+
+        /// <summary>
+        /// Release the memory of the resource without enqueueing a delete.
+        /// </summary>
+        void SilentRelease();
+
+    public:
+        GpuResourceHandle GetHandle(
+            size_t Offset) const override;
+
+        uint8_t* Map() override;
+
+        void Unmap() override;
+
+    public:
+        /// <summary>
+        /// Get the memory of the resource.
+        /// </summary>
+        [[nodiscard]] uint8_t* GetData() const noexcept;
+
+        /// <summary>
+        /// Get the size of the memory of the resource.
+        /// </summary>
+        [[nodiscard]] size_t GetDataSize() const noexcept;
+
+        /// <summary>
+        /// Get the footprint of a subresource, its offset is relative to the memory of the resource.
+        /// </summary>
+        [[nodiscard]] const SubresourceFootprint& GetFootprint(
+            uint32_t Subresource) const;
+
+        /// <summary>
+        /// Get the number of rows of a subresource's slice.
+        /// </summary>
+        [[nodiscard]] uint32_t GetNumRows(
+            uint32_t Subresource) const;
+
+    private:
+        /// <summary>
+        /// Compute the footprint of every subresource and the size of the resource's memory.
+        /// </summary>
+        void InitializeFootprints();
+
+    private:
+        std::unique_ptr<uint8_t[]>        m_Data;
+        size_t                            m_DataSize = 0;
+        std::vector<SubresourceFootprint> m_Footprints;
+        std::vector<uint32_t>             m_NumRows;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/Resource/State.hpp>
+#include <Private/RHI/Null/Commands/CommandList.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    IResourceStateManager* IResourceStateManager::Get()
+    {
+        return RHI::NullRenderDevice::Get()->GetStateManager();
+    }
+
+    NullResourceStateManager* NullResourceStateManager::Get()
+    {
+        return static_cast<NullResourceStateManager*>(IResourceStateManager::Get());
+    }
+
+    void NullResourceStateManager::TransitionResource(
+        IGpuResource*  Resource,
+        MResourceState NewState,
+        uint32_t       SubresourceIndex)
+    {
+        auto Lock = LockStates();
+
+        auto& PendingStates         = m_ResoureStates.PendingStates[Resource];
+        auto& CurrentResourceStates = GetCurrentStates_Internal(Resource);
+
+        if (SubresourceIndex == Resource_AllSubresources)
+        {
+            PendingStates.reserve(CurrentResourceStates.size());
+            for (size_t i = 0; i < CurrentResourceStates.size(); i++)
+            {
+                PendingStates.emplace_back(NewState, uint32_t(i));
+            }
+        }
+        else
+        {
+            PendingStates.emplace_back(NewState, SubresourceIndex);
+        }
+    }
+
+    void NullResourceStateManager::TransitionResource(
+        IGpuResource*            Resource,
+        const SubresourceStates& NewStates)
+    {
+        auto Lock = LockStates();
+
+        auto& PendingStates = m_ResoureStates.PendingStates[Resource];
+        PendingStates.reserve(PendingStates.size() + NewStates.size());
+
+        std::transform(
+            NewStates.begin(),
+            NewStates.end(),
+            std::back_inserter(PendingStates),
+            [](auto& Iter)
+            {
+                return NullSubresourceState{
+                    .State            = Iter.second,
+                    .SubresourceIndex = Iter.first
+                };
+            });
+    }
+
+    CommandContext NullResourceStateManager::FlushBarriers()
+    {
+        if (auto Barriers = Flush(); !Barriers.empty())
+        {
+            CommandContext CtxBatch;
+
+            auto CommandList = CtxBatch.Append();
+            static_cast<NullCommandList*>(CommandList)->RecordBarriers(Barriers);
+
+            return CtxBatch;
+        }
+        return {};
+    }
+
+    bool NullResourceStateManager::FlushBarriers(
+        ICommandList* CommandList)
+    {
+        if (auto Barriers = Flush(); !Barriers.empty())
+        {
+            static_cast<NullCommandList*>(CommandList)->RecordBarriers(Barriers);
+            return true;
+        }
+        return false;
+    }
+
+    auto NullResourceStateManager::GetCurrentStates(
+        IGpuResource* Resource) -> SubresourceStates
+    {
+        auto Lock = LockStates();
+
+        SubresourceStates Res;
+
+        auto& CurrentStates = GetCurrentStates_Internal(Resource);
+        for (auto& Iter : CurrentStates)
+        {
+            Res.emplace(Iter.SubresourceIndex, Iter.State);
+        }
+
+        return Res;
+    }
+
+    //
+
+    void NullResourceStateManager::StartTrakingResource(
+        IGpuResource*  Resource,
+        MResourceState InitialState)
+    {
+        uint32_t SubresourceCount = Resource->GetSubResourceCount();
+
+        auto  Lock          = LockStates();
+        auto& CurrentStates = m_ResoureStates.CurrentStates[Resource];
+        CurrentStates.reserve(SubresourceCount);
+        for (uint32_t i = 0; i < SubresourceCount; i++)
+        {
+            CurrentStates.emplace_back(InitialState, i);
+        }
+    }
+
+    void NullResourceStateManager::StopTrakingResource(
+        IGpuResource* Resource)
+    {
+        auto Lock = LockStates();
+        m_ResoureStates.CurrentStates.erase(Resource);
+        m_ResoureStates.PendingStates.erase(Resource);
+    }
+
+    //
+
+    auto NullResourceStateManager::Flush() -> NullResourceBarrierList
+    {
+        auto Lock = LockStates();
+
+        NullResourceBarrierList Barriers;
+        for (auto& [Resource, States] : m_ResoureStates.PendingStates)
+        {
+            auto TempBarriers = TransitionToStatesImmediately(Resource, States);
+            Barriers.insert(Barriers.end(), TempBarriers.begin(), TempBarriers.end());
+        }
+
+        m_ResoureStates.PendingStates.clear();
+        return Barriers;
+    }
+
+    auto NullResourceStateManager::TransitionToStatesImmediately(
+        IGpuResource*                   Resource,
+        const NullSubresourceStateList& NewStates) -> NullResourceBarrierList
+    {
+        auto  Lock                = LockStates();
+        auto& CurrentSubresources = GetCurrentStates_Internal(Resource);
+
+        NullResourceBarrierList NewStateBarriers;
+        if (NewStates.empty())
+        {
+            return NewStateBarriers;
+        }
+
+        bool StatesMatch = true;
+
+        auto FirstOldState = CurrentSubresources.front().State;
+        auto FirstNewState = NewStates.front().State;
+
+        for (auto& NewSubresources : NewStates)
+        {
+            auto& CurrentState = CurrentSubresources[NewSubresources.SubresourceIndex];
+            auto  OldState     = CurrentState.State;
+            auto  NewState     = NewSubresources.State;
+
+            if (IsNewStateRedundant(OldState, NewState))
+            {
+                continue;
+            }
+
+            CurrentState.State = NewSubresources.State;
+
+            NewStateBarriers.emplace_back(NullCommands::Barrier{
+                .Resource    = Resource,
+                .Subresource = NewSubresources.SubresourceIndex,
+                .Before      = OldState,
+                .After       = NewState });
+
+            // If any old subresource states do not match or any of the new states do not match
+            // then performing single transition barrier for all subresources is not possible
+            if (OldState != FirstOldState || NewState != FirstNewState)
+            {
+                StatesMatch = false;
+            }
+        }
+
+        // If multiple transitions were requested, but it's possible to make just one - do it
+        if (StatesMatch && NewStateBarriers.size() > 1)
+        {
+            NewStateBarriers.resize(1);
+            NewStateBarriers[0].Subresource = Resource_AllSubresources;
+        }
+
+        return NewStateBarriers;
+    }
+
+    //
+
+    auto NullResourceStateManager::GetCurrentStates_Internal(
+        IGpuResource* Resource) -> NullSubresourceStateList&
+    {
+        auto Iter = m_ResoureStates.CurrentStates.find(Resource);
+        NEON_ASSERT(
+            Iter != m_ResoureStates.CurrentStates.end(),
+            "Resource is not registered / not being tracked. It may have been deallocated before transitions were applied");
+        return Iter->second;
+    }
+
+    //
+
+    bool NullResourceStateManager::IsNewStateRedundant(
+        const MResourceState& CurrentState,
+        const MResourceState& NewState)
+    {
+        static const MResourceState s_ReadOnlyStates =
+            MResourceState_GenericRead | MResourceState::FromEnum(EResourceState::DepthRead);
+
+        return CurrentState == NewState || (CurrentState.TestAny(s_ReadOnlyStates) && CurrentState.TestAll(NewState));
+    }
+} // namespace Neon::RHI
\ No newline at end of file
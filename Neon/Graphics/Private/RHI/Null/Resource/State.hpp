@@ -0,0 +1,107 @@
+#pragma once
+
+#include <GraphicsPCH.hpp>
+#include <RHI/Resource/State.hpp>
+#include <RHI/Null/CommandLog.hpp>
+
+namespace Neon::RHI
+{
+    class NullResourceStateManager final : public IResourceStateManager
+    {
+    private:
+        struct NullSubresourceState
+        {
+            MResourceState State;
+            uint32_t       SubresourceIndex = 0;
+        };
+
+        using NullSubresourceStateList = std::vector<NullSubresourceState>;
+        using NullResourceBarrierList  = std::vector<NullCommands::Barrier>;
+
+        using ResourceStateMapType = std::unordered_map<IGpuResource*, NullSubresourceStateList>;
+
+        struct ResourceStateMapInfo
+        {
+            ResourceStateMapType CurrentStates;
+            ResourceStateMapType PendingStates;
+        };
+
+    public:
+        /// <summary>
+        /// Get resource state manager instance
+        /// </summary>
+        [[nodiscard]] static NullResourceStateManager* Get();
+
+        void TransitionResource(
+            IGpuResource*  Resource,
+            MResourceState NewState,
+            uint32_t       SubresourceIndex = Resource_AllSubresources) override;
+
+        void TransitionResource(
+            IGpuResource*            Resource,
+            const SubresourceStates& NewStates) override;
+
+        CommandContext FlushBarriers() override;
+
+        bool FlushBarriers(
+            ICommandList* CommandList) override;
+
+        virtual SubresourceStates GetCurrentStates(
+            IGpuResource* Resource) override;
+
+    public:
+        /// <summary>
+        /// Start tracking resource's state
+        /// </summary>
+        void StartTrakingResource(
+            IGpuResource*  Resource,
+            MResourceState InitialState);
+
+        /// <summary>
+        /// Stop tracking resource's state
+        /// </summary>
+        void StopTrakingResource(
+            IGpuResource* Resource);
+
+    private:
+        /// <summary>
+        /// Flush pending state transitions
+        /// </summary>
+        [[nodiscard]] NullResourceBarrierList Flush();
+
+        /// <summary>
+        /// Immediately record new state for a resource
+        /// </summary>
+        [[nodiscard]] NullResourceBarrierList TransitionToStatesImmediately(
+            IGpuResource*                   Resource,
+            const NullSubresourceStateList& NewStates);
+
+        /// <summary>
+        /// Get current resource's states
+        /// </summary>
+        NullSubresourceStateList& GetCurrentStates_Internal(
+            IGpuResource* Resource);
+
+    private:
+        /// <summary>
+        /// Transition is redundant if either states completely match
+        /// or current state is a read state and new state is a partial or complete subset of the current
+        /// (which implies that it is also a read state)
+        /// </summary>
+        [[nodiscard]] static bool IsNewStateRedundant(
+            const MResourceState& CurrentState,
+            const MResourceState& NewState);
+
+        /// <summary>
+        /// Lock resource states mutex
+        /// </summary>
+        [[nodiscard]] auto LockStates()
+        {
+            return std::scoped_lock{ m_StatesMutex };
+        }
+
+    private:
+        std::recursive_mutex m_StatesMutex;
+        ResourceStateMapInfo m_ResoureStates;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
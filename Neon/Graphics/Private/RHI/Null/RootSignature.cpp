@@ -0,0 +1,52 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/RootSignature.hpp>
+
+namespace Neon::RHI
+{
+    IRootSignature::CommonRootsignatureList s_CommonRootSignatureCache;
+
+    //
+
+    Ptr<IRootSignature> IRootSignature::Create(
+        const RootSignatureBuilder& Builder)
+    {
+        return NullRootSignatureCache::Load(Builder);
+    }
+
+    Ptr<IRootSignature> IRootSignature::Get(
+        RSCommon::Type Type)
+    {
+        return s_CommonRootSignatureCache[size_t(Type)];
+    }
+
+    //
+
+    NullRootSignature::NullRootSignature(
+        const RootSignatureBuilder& Builder) :
+        m_Builder(Builder)
+    {
+    }
+
+    const RootSignatureBuilder& NullRootSignature::GetBuilder() const noexcept
+    {
+        return m_Builder;
+    }
+
+    //
+
+    void NullRootSignatureCache::Load()
+    {
+        s_CommonRootSignatureCache = IRootSignature::Load();
+    }
+
+    void NullRootSignatureCache::Flush()
+    {
+        s_CommonRootSignatureCache = {};
+    }
+
+    Ptr<IRootSignature> NullRootSignatureCache::Load(
+        const RootSignatureBuilder& Builder)
+    {
+        return std::make_shared<NullRootSignature>(Builder);
+    }
+} // namespace Neon::RHI
\ No newline at end of file
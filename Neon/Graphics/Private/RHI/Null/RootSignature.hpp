@@ -0,0 +1,41 @@
+#pragma once
+
+#include <RHI/RootSignature.hpp>
+
+namespace Neon::RHI
+{
+    class NullRootSignature final : public IRootSignature
+    {
+    public:
+        NullRootSignature(
+            const RootSignatureBuilder& Builder);
+
+        /// <summary>
+        /// Get the builder the root signature was created with
+        /// </summary>
+        [[nodiscard]] const RootSignatureBuilder& GetBuilder() const noexcept;
+
+    private:
+        RootSignatureBuilder m_Builder;
+    };
+
+    class NullRootSignatureCache
+    {
+    public:
+        /// <summary>
+        /// Load common root signatures
+        /// </summary>
+        static void Load();
+
+        /// <summary>
+        /// Release all common root signatures
+        /// </summary>
+        static void Flush();
+
+        /// <summary>
+        /// Create a root signature, they are not serialized so there is nothing to share between equal builders
+        /// </summary>
+        [[nodiscard]] static Ptr<IRootSignature> Load(
+            const RootSignatureBuilder& Builder);
+    };
+} // namespace Neon::RHI
\ No newline at end of file
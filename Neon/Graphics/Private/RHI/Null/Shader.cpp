@@ -0,0 +1,121 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Shader.hpp>
+
+#include <charconv>
+#include <regex>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::RHI
+{
+    UPtr<IShader> IShader::Create(
+        std::unique_ptr<uint8_t[]> Data,
+        size_t                     DataSize)
+    {
+        auto GroupSize = NullShader::ParseComputeGroupSize(StringU8View(std::bit_cast<const char*>(Data.get()), DataSize));
+        return UPtr<IShader>{ NEON_NEW NullShader(std::move(Data), DataSize, GroupSize) };
+    }
+
+    UPtr<IShader> IShader::Create(
+        StringU8View             SourceCode,
+        const ShaderCompileDesc& Desc,
+        StringU8View             IncludeDirectory,
+        std::vector<StringU8>*   Includes)
+    {
+        // The source code stands for the bytecode, includes are not resolved
+        auto Data = std::make_unique<uint8_t[]>(SourceCode.size() + 1);
+        std::ranges::copy(SourceCode, std::bit_cast<char*>(Data.get()));
+
+        auto GroupSize = Desc.Stage == ShaderStage::Compute ? NullShader::ParseComputeGroupSize(SourceCode, Desc.Macros) : Vector3U{};
+        return UPtr<IShader>{ NEON_NEW NullShader(std::move(Data), SourceCode.size() + 1, GroupSize) };
+    }
+
+    //
+
+    NullShader::NullShader(
+        UPtr<uint8_t[]> ShaderData,
+        size_t          DataSize,
+        const Vector3U& ComputeGroupSize) :
+        m_ShaderData(std::move(ShaderData)),
+        m_DataSize(DataSize),
+        m_ComputeGroupSize(ComputeGroupSize)
+    {
+        NEON_ASSERT(m_ShaderData != nullptr, "Shader data is null.");
+        NEON_ASSERT(DataSize, "Shader data size is zero.");
+    }
+
+    void NullShader::CreateInputLayout(
+        ShaderInputLayout&)
+    {
+    }
+
+    void NullShader::CreateOuputLayout(
+        ShaderInputLayout&)
+    {
+    }
+
+    auto NullShader::GetByteCode() -> ByteCode
+    {
+        return { m_ShaderData.get(), m_DataSize };
+    }
+
+    const Vector3U& NullShader::GetComputeGroupSize() const noexcept
+    {
+        return m_ComputeGroupSize;
+    }
+
+    Vector3U NullShader::ParseComputeGroupSize(
+        StringU8View        SourceCode,
+        const ShaderMacros& Macros)
+    {
+        std::cmatch Match;
+        if (!std::regex_search(
+                SourceCode.data(),
+                SourceCode.data() + SourceCode.size(),
+                Match,
+                std::regex(R"(\[\s*numthreads\s*\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\)\s*\])")))
+        {
+            return { 1, 1, 1 };
+        }
+
+        auto Resolve = [&](StringU8 Token) -> uint32_t
+        {
+            // Follow the identifiers until a number is found
+            for (size_t Depth = 0; Depth < 16; Depth++)
+            {
+                uint32_t Value;
+                auto [End, Error] = std::from_chars(Token.data(), Token.data() + Token.size(), Value);
+                if (Error == std::errc{} && End == Token.data() + Token.size())
+                {
+                    return std::max(Value, 1u);
+                }
+
+                auto Name  = StringUtils::Transform<String>(Token);
+                auto Macro = std::ranges::find(Macros.Get(), Name, [](auto& Define)
+                                               { return Define.first; });
+                if (Macro != Macros.Get().end())
+                {
+                    Token = StringUtils::Transform<StringU8>(Macro->second);
+                    continue;
+                }
+
+                std::cmatch Define;
+                if (std::regex_search(
+                        SourceCode.data(),
+                        SourceCode.data() + SourceCode.size(),
+                        Define,
+                        std::regex("#define\\s+" + Token + "\\s+(\\w+)")))
+                {
+                    Token = Define[1].str();
+                    continue;
+                }
+                break;
+            }
+
+            NEON_WARNING_TAG("Graphics", "Unknown compute group size '{}', 1 is used", Token);
+            return 1;
+        };
+
+        return { Resolve(Match[1].str()), Resolve(Match[2].str()), Resolve(Match[3].str()) };
+    }
+} // namespace Neon::RHI
\ No newline at end of file
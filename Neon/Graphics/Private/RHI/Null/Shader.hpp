@@ -0,0 +1,55 @@
+#pragma once
+
+#include <RHI/Shader.hpp>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Shader of the null backend, nothing is compiled: the shader holds the source code or the bytecode it was created
+    /// with, and a compute shader's group size is read from its numthreads attribute.
+    /// </summary>
+    class NullShader final : public IShader
+    {
+    public:
+        NullShader(
+            UPtr<uint8_t[]> ShaderData,
+            size_t          DataSize,
+            const Vector3U& ComputeGroupSize);
+
+        /// <summary>
+        /// Nothing is reflected, the layout is left as is
+        /// </summary>
+        void CreateInputLayout(
+            ShaderInputLayout& Layout) override;
+
+        /// <summary>
+        /// Nothing is reflected, the layout is left as is
+        /// </summary>
+        void CreateOuputLayout(
+            ShaderInputLayout& Layout) override;
+
+        /// <summary>
+        /// Get shader bytecode
+        /// </summary>
+        [[nodiscard]] ByteCode GetByteCode() override;
+
+    public:
+        /// <summary>
+        /// Get group size of compute shader
+        /// </summary>
+        [[nodiscard]] const Vector3U& GetComputeGroupSize() const noexcept;
+
+        /// <summary>
+        /// Read the group size of a compute shader from its numthreads attribute.
+        /// Identifiers are resolved from the macros then from the source's defines, unknown or missing sizes are 1.
+        /// </summary>
+        [[nodiscard]] static Vector3U ParseComputeGroupSize(
+            StringU8View        SourceCode,
+            const ShaderMacros& Macros = {});
+
+    private:
+        std::unique_ptr<uint8_t[]> m_ShaderData;
+        size_t                     m_DataSize;
+        Vector3U                   m_ComputeGroupSize;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include <GraphicsPCH.hpp>
+#include <RHI/ImGui.hpp>
+#include <Core/Neon.hpp>
+
+#include <Private/RHI/Null/Device.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+#include <Math/Colors.hpp>
+#include <RHI/Commands/Context.hpp>
+
+#include <Window/Window.hpp>
+
+namespace Neon::RHI
+{
+    ISwapchain* ISwapchain::Get()
+    {
+        return IRenderDevice::Get()->GetSwapchain();
+    }
+
+    //
+
+    void NullSwapchain::PostInitialize(
+        const SwapchainCreateDesc& Desc)
+    {
+        m_FrameManager->ResizeFrames(Desc.FramesInFlight);
+        CreateBackbuffers(Desc.FramesInFlight);
+        ImGuiRHI::InitializeImGui();
+    }
+
+    void NullSwapchain::Shutdown()
+    {
+        m_BackBuffers.clear();
+        m_FrameManager = nullptr;
+
+        ImGuiRHI::ShutdownImGui();
+    }
+
+    //
+
+    NullSwapchain::NullSwapchain(
+        Windowing::WindowApp*      Window,
+        const SwapchainCreateDesc& Desc) :
+        m_WindowApp(Window),
+        m_Size(Window ? Window->GetSize() : Size2I(1280, 720)),
+        m_BackbufferFormat(Desc.BackbufferFormat)
+    {
+        m_IsVSyncEnabled = Desc.VSync;
+
+        m_FrameManager = std::make_unique<NullFrameManager>();
+    }
+
+    //
+
+    void NullSwapchain::PrepareFrame()
+    {
+        m_FrameManager->NewFrame();
+
+        auto StateManager = RHI::IResourceStateManager::Get();
+        auto BackBuffer   = GetBackBuffer();
+
+        // Set Render target view and viewport to the backbuffer.
+        StateManager->TransitionResource(
+            BackBuffer,
+            RHI::MResourceState::FromEnum(RHI::EResourceState::RenderTarget));
+
+        CommandContext CommandContext;
+
+        auto CommandList = CommandContext.Append();
+        StateManager->FlushBarriers(CommandList);
+
+        auto View = RHI::ISwapchain::Get()->GetBackBufferView();
+        CommandList->ClearRtv(
+            View,
+            Colors::White);
+    }
+
+    void NullSwapchain::Present(
+        float)
+    {
+        // There is nothing to present, the frame only ends
+        m_FrameManager->EndFrame();
+        NullCommandLog::Get()->EndFrame();
+    }
+
+    Windowing::WindowApp* NullSwapchain::GetWindow()
+    {
+        return m_WindowApp;
+    }
+
+    const Size2I& NullSwapchain::GetSize()
+    {
+        return m_Size;
+    }
+
+    EResourceFormat NullSwapchain::GetFormat()
+    {
+        return m_BackbufferFormat;
+    }
+
+    IGpuResource* NullSwapchain::GetBackBuffer()
+    {
+        return m_BackBuffers[m_FrameManager->GetFrameIndex()].get();
+    }
+
+    CpuDescriptorHandle NullSwapchain::GetBackBufferView()
+    {
+        return m_RenderTargets.GetCpuHandle(m_FrameManager->GetFrameIndex());
+    }
+
+    uint32_t NullSwapchain::GetFrameCount() const
+    {
+        return m_FrameManager->GetFrameCount();
+    }
+
+    uint32_t NullSwapchain::GetFrameIndex() const
+    {
+        return m_FrameManager->GetFrameIndex();
+    }
+
+    void NullSwapchain::Resize(
+        const Size2I&   Size,
+        EResourceFormat NewFormat)
+    {
+        if (NewFormat == EResourceFormat::Unknown)
+        {
+            NewFormat = m_BackbufferFormat;
+        }
+
+        m_Size             = Size;
+        m_BackbufferFormat = NewFormat;
+
+        uint32_t BackbufferCount = uint32_t(m_BackBuffers.size());
+        // Clearing the backbuffer vector will release the resources into the 'garbage collector' for current frame
+        // and will be released after the frame is finished or the call to IdleGPU()
+        m_BackBuffers.clear();
+        m_FrameManager->IdleGPU();
+
+        CreateBackbuffers(BackbufferCount);
+
+        m_FrameManager->ResetFrameIndex();
+        m_FrameManager->IdleGPU();
+    }
+
+    //
+
+    void NullSwapchain::CreateBackbuffers(
+        uint32_t Count)
+    {
+        m_BackBuffers.clear();
+        m_BackBuffers.reserve(Count);
+
+        auto Allocator = IStaticDescriptorHeap::Get(DescriptorType::RenderTargetView);
+        if (m_RenderTargets)
+        {
+            Allocator->Free(m_RenderTargets.GetHandle());
+        }
+        m_RenderTargets = Allocator->Allocate(Count);
+
+        auto Desc = ResourceDesc::Tex2D(
+            m_BackbufferFormat,
+            m_Size.Width(),
+            m_Size.Height(),
+            1,
+            1,
+            1,
+            0,
+            MResourceFlags::FromEnum(EResourceFlags::AllowRenderTarget));
+
+        for (uint32_t i = 0; i < Count; ++i)
+        {
+            auto& Buffer = m_BackBuffers.emplace_back(std::make_unique<NullGpuResource>(
+                Desc,
+                IGpuResource::InitDesc{
+                    .Name         = STR("Swapchain Backbuffer"),
+                    .InitialState = MResourceState_Common }));
+
+            m_RenderTargets.Bind(
+                Buffer.get(),
+                nullptr,
+                i);
+        }
+    }
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <RHI/Swapchain.hpp>
+#include <RHI/Fence.hpp>
+
+#include <Private/RHI/Null/Resource/GraphicsMemoryAllocator.hpp>
+#include <Private/RHI/Null/Commands/CommandQueue.hpp>
+#include <Private/RHI/Null/FrameManager.hpp>
+
+#include <RHI/Resource/Views/RenderTarget.hpp>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Swapchain of the null backend, the back buffers are CPU memory textures and presenting only ends the frame.
+    /// The window is optional, without one the swapchain keeps the size it was created or resized with.
+    /// </summary>
+    class NullSwapchain final : public ISwapchain
+    {
+    public:
+        NullSwapchain(
+            Windowing::WindowApp*      Window,
+            const SwapchainCreateDesc& Desc);
+
+        void PrepareFrame() override;
+
+        void Present(
+            float FrameTime) override;
+
+        Windowing::WindowApp* GetWindow() override;
+
+        const Size2I& GetSize() override;
+
+        EResourceFormat GetFormat() override;
+
+    public:
+        IGpuResource* GetBackBuffer() override;
+
+        CpuDescriptorHandle GetBackBufferView() override;
+
+        uint32_t GetFrameCount() const override;
+
+        uint32_t GetFrameIndex() const override;
+
+    public:
+        void Resize(
+            const Size2I&   Size,
+            EResourceFormat NewFormat) override;
+
+        [[nodiscard]] ICommandQueue* GetQueue(
+            bool IsDirect) override;
+
+        [[nodiscard]] IFence* GetQueueFence(
+            bool IsDirect) override;
+
+    public:
+        /// <summary>
+        /// Get the singleton instance.
+        /// </summary>
+        [[nodiscard]] static NullSwapchain* Get();
+
+        /// <summary>
+        /// Initialize the swapchain.
+        /// </summary>
+        void PostInitialize(
+            const SwapchainCreateDesc& Desc);
+
+        /// <summary>
+        /// Shutdown the swapchain.
+        /// </summary>
+        void Shutdown();
+
+        /// <summary>
+        /// Allocate or reuse command lists
+        /// </summary>
+        [[nodiscard]] std::vector<ICommandList*> AllocateCommandLists(
+            CommandQueueType Type,
+            size_t           Count);
+
+        /// <summary>
+        /// Free command lists.
+        /// </summary>
+        void FreeCommandLists(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands);
+
+        /// <summary>
+        /// Reset command lists.
+        /// </summary>
+        void ResetCommandLists(
+            CommandQueueType         Type,
+            std::span<ICommandList*> Commands);
+
+        /// <summary>
+        /// Enqueue buffer to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            const NullMemoryAllocator::Handle& Handle);
+
+        /// <summary>
+        /// Enqueue descriptor heap memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            IDescriptorHeap*                  Heap,
+            std::unique_ptr<NullDescriptor[]> Descriptors);
+
+        /// <summary>
+        /// Enqueue resource memory to be released at the end of the frame.
+        /// </summary>
+        void SafeRelease(
+            std::unique_ptr<uint8_t[]> Data);
+
+        /// <summary>
+        /// Execute a copy command list.
+        /// </summary>
+        std::future<void> EnqueueRequestCopy(
+            std::move_only_function<void(ICommandList*)> CopyTask,
+            std::move_only_function<void()>              PostCopyTask) override;
+
+    public:
+        /// <summary>
+        /// Get frame descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullFrameDescriptorHeap* GetFrameDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+        /// <summary>
+        /// Get staged descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullStagedDescriptorHeap* GetStagedDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+        /// <summary>
+        /// Get frame descriptor heap allocator
+        /// </summary>
+        [[nodiscard]] NullStaticDescriptorHeap* GetStaticDescriptorAllocator(
+            DescriptorType Type) noexcept;
+
+    private:
+        /// <summary>
+        /// Create the back buffers and their views.
+        /// </summary>
+        void CreateBackbuffers(
+            uint32_t Count);
+
+    private:
+        Windowing::WindowApp* m_WindowApp;
+        Size2I                m_Size;
+
+        NullStaticDescriptorHeap m_StaticDescriptors[size_t(DescriptorType::Count)]{
+            DescriptorType::ResourceView,
+            DescriptorType::RenderTargetView,
+            DescriptorType::DepthStencilView,
+            DescriptorType::Sampler
+        };
+
+        UPtr<NullFrameManager> m_FrameManager;
+
+        std::vector<UPtr<NullGpuResource>> m_BackBuffers;
+        Views::RenderTarget                m_RenderTargets;
+
+        EResourceFormat m_BackbufferFormat = EResourceFormat::Unknown;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include <GraphicsPCH.hpp>
+#include <Private/RHI/Null/Swapchain.hpp>
+
+namespace Neon::RHI
+{
+    std::vector<ICommandList*> NullSwapchain::AllocateCommandLists(
+        CommandQueueType Type,
+        size_t           Count)
+    {
+        return m_FrameManager->AllocateCommandLists(Type, Count);
+    }
+
+    void NullSwapchain::FreeCommandLists(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        m_FrameManager->FreeCommandLists(Type, Commands);
+    }
+
+    void NullSwapchain::ResetCommandLists(
+        CommandQueueType         Type,
+        std::span<ICommandList*> Commands)
+    {
+        m_FrameManager->ResetCommandLists(Type, Commands);
+    }
+
+    ICommandQueue* NullSwapchain::GetQueue(
+        bool IsDirect)
+    {
+        return m_FrameManager->GetQueue(IsDirect);
+    }
+
+    IFence* NullSwapchain::GetQueueFence(
+        bool IsDirect)
+    {
+        return m_FrameManager->GetQueueFence(IsDirect);
+    }
+
+    NullSwapchain* NullSwapchain::Get()
+    {
+        return static_cast<NullSwapchain*>(IRenderDevice::Get()->GetSwapchain());
+    }
+
+    void NullSwapchain::SafeRelease(
+        const NullMemoryAllocator::Handle& Handle)
+    {
+        m_FrameManager->SafeRelease(Handle);
+    }
+
+    void NullSwapchain::SafeRelease(
+        IDescriptorHeap*                  Heap,
+        std::unique_ptr<NullDescriptor[]> Descriptors)
+    {
+        m_FrameManager->SafeRelease(Heap, std::move(Descriptors));
+    }
+
+    void NullSwapchain::SafeRelease(
+        std::unique_ptr<uint8_t[]> Data)
+    {
+        m_FrameManager->SafeRelease(std::move(Data));
+    }
+
+    std::future<void> NullSwapchain::EnqueueRequestCopy(
+        std::move_only_function<void(ICommandList*)> CopyTask,
+        std::move_only_function<void()>              PostCopyTask)
+    {
+        return m_FrameManager->RequestCopy(std::move(CopyTask), std::move(PostCopyTask));
+    }
+
+    NullFrameDescriptorHeap* NullSwapchain::GetFrameDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        return m_FrameManager->GetFrameDescriptorAllocator(Type);
+    }
+
+    NullStagedDescriptorHeap* NullSwapchain::GetStagedDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        return m_FrameManager->GetStagedDescriptorAllocator(Type);
+    }
+
+    NullStaticDescriptorHeap* NullSwapchain::GetStaticDescriptorAllocator(
+        DescriptorType Type) noexcept
+    {
+        return &m_StaticDescriptors[size_t(Type)];
+    }
+} // namespace Neon::RHI
\ No newline at end of file
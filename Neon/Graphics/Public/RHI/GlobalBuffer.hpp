@@ -70,6 +70,22 @@ namespace Neon::RHI
             }
         };
 
+        struct FrameHandle
+        {
+            GpuBuffer Buffer{};
+
+            size_t Offset = 0;
+            size_t Size   = 0;
+
+            uint8_t*          CpuAddress = nullptr;
+            GpuResourceHandle GpuHandle;
+
+            [[nodiscard]] operator bool() const noexcept
+            {
+                return CpuAddress != nullptr;
+            }
+        };
+
         /// <summary>
         /// Allocate a buffer
         /// </summary>
@@ -92,6 +108,28 @@ namespace Neon::RHI
         {
             Free({ &Handle, 1 });
         }
+
+    public:
+        /// <summary>
+        /// Allocate upload memory readable by the GPU that is only valid for the current frame.
+        /// The memory is persistently mapped and reclaimed once the GPU is done with the frame, it must not be freed.
+        /// </summary>
+        [[nodiscard]] static FrameHandle AllocateFrame(
+            size_t Size,
+            size_t Alignement);
+
+        /// <summary>
+        /// Allocate frame memory, copy the data into it and return its GPU address.
+        /// </summary>
+        [[nodiscard]] static GpuResourceHandle UploadFrame(
+            const void* Data,
+            size_t      Size,
+            size_t      Alignement)
+        {
+            auto Hndl = AllocateFrame(Size, Alignement);
+            std::copy_n(static_cast<const uint8_t*>(Data), Size, Hndl.CpuAddress);
+            return Hndl.GpuHandle;
+        }
     };
 
     using BufferPoolHandle = IGlobalBufferPool::Handle;
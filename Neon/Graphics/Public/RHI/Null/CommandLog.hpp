@@ -0,0 +1,352 @@
+#pragma once
+
+#include <RHI/Commands/List.hpp>
+#include <RHI/Resource/Resource.hpp>
+#include <RHI/Resource/Views/Shader.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <variant>
+#include <vector>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Commands recorded by the command lists of the null backend.
+    /// Resources, root signatures and pipeline states are only kept as identities, they may already be destroyed when
+    /// the log is inspected.
+    /// </summary>
+    namespace NullCommands
+    {
+        struct BeginEvent
+        {
+            StringU8 Text;
+            Color4   Color;
+        };
+
+        struct MarkEvent
+        {
+            StringU8 Text;
+            Color4   Color;
+        };
+
+        struct EndEvent
+        {
+        };
+
+        //
+
+        struct CopySubresources
+        {
+            IGpuResource* Dst;
+            IGpuResource* Intermediate;
+            size_t        IntOffset;
+            uint32_t      FirstSubresource;
+            uint32_t      SubresourceCount;
+        };
+
+        struct CopyResource
+        {
+            IGpuResource* Dst;
+            IGpuResource* Src;
+        };
+
+        struct CopyBufferRegion
+        {
+            IGpuResource* Dst;
+            size_t        DstOffset;
+            IGpuResource* Src;
+            size_t        SrcOffset;
+            size_t        NumBytes;
+        };
+
+        struct CopyTextureRegion
+        {
+            TextureCopyLocation                  Dst;
+            Vector3I                             DstPosition;
+            TextureCopyLocation                  Src;
+            std::optional<ICommandList::CopyBox> SrcBox;
+        };
+
+        //
+
+        struct Barrier
+        {
+            IGpuResource*  Resource;
+            uint32_t       Subresource;
+            MResourceState Before;
+            MResourceState After;
+        };
+
+        struct UavBarrier
+        {
+            std::vector<IGpuResource*> Resources;
+        };
+
+        //
+
+        struct SetRootSignature
+        {
+            bool            IsDirect;
+            IRootSignature* RootSignature;
+        };
+
+        struct SetPipelineState
+        {
+            IPipelineState* PipelineState;
+        };
+
+        struct SetConstants
+        {
+            bool                  IsDirect;
+            uint32_t              RootIndex;
+            size_t                DestOffset;
+            std::vector<uint32_t> Constants;
+        };
+
+        struct SetResourceView
+        {
+            bool                IsDirect;
+            CstResourceViewType Type;
+            uint32_t            RootIndex;
+            GpuResourceHandle   Handle;
+        };
+
+        struct SetDescriptorTable
+        {
+            bool                IsDirect;
+            uint32_t            RootIndex;
+            GpuDescriptorHandle Handle;
+        };
+
+        //
+
+        struct ClearUavFloat
+        {
+            IGpuResource*       Resource;
+            GpuDescriptorHandle GpuUavHandle;
+            CpuDescriptorHandle CpuUavHandle;
+            Vector4             Value;
+        };
+
+        struct ClearUavUInt
+        {
+            IGpuResource*       Resource;
+            GpuDescriptorHandle GpuUavHandle;
+            CpuDescriptorHandle CpuUavHandle;
+            Vector4U            Value;
+        };
+
+        struct ClearRtv
+        {
+            CpuDescriptorHandle RtvHandle;
+            Color4              Color;
+        };
+
+        struct ClearDsv
+        {
+            CpuDescriptorHandle    DsvHandle;
+            std::optional<float>   Depth;
+            std::optional<uint8_t> Stencil;
+        };
+
+        struct SetRenderTargets
+        {
+            std::vector<CpuDescriptorHandle>   RenderTargets;
+            std::optional<CpuDescriptorHandle> DepthStencil;
+        };
+
+        //
+
+        struct SetScissorRects
+        {
+            std::vector<RectT<Vector2>> Scissors;
+        };
+
+        struct SetViewports
+        {
+            std::vector<ViewportF> Viewports;
+        };
+
+        struct SetPrimitiveTopology
+        {
+            PrimitiveTopology Topology;
+        };
+
+        struct SetIndexBuffer
+        {
+            Views::Index::View View;
+        };
+
+        struct SetVertexBuffers
+        {
+            size_t                           StartSlot;
+            std::vector<Views::Vertex::View> Views;
+        };
+
+        //
+
+        struct DrawIndexed
+        {
+            DrawIndexArgs Args;
+        };
+
+        struct Draw
+        {
+            DrawArgs Args;
+        };
+
+        /// <summary>
+        /// Group counts are the ones the backend would dispatch, after dividing by the group size of the pipeline state.
+        /// </summary>
+        struct Dispatch
+        {
+            uint32_t GroupCountX;
+            uint32_t GroupCountY;
+            uint32_t GroupCountZ;
+        };
+
+        //
+
+        using Command = std::variant<
+            BeginEvent,
+            MarkEvent,
+            EndEvent,
+            CopySubresources,
+            CopyResource,
+            CopyBufferRegion,
+            CopyTextureRegion,
+            Barrier,
+            UavBarrier,
+            SetRootSignature,
+            SetPipelineState,
+            SetConstants,
+            SetResourceView,
+            SetDescriptorTable,
+            ClearUavFloat,
+            ClearUavUInt,
+            ClearRtv,
+            ClearDsv,
+            SetRenderTargets,
+            SetScissorRects,
+            SetViewports,
+            SetPrimitiveTopology,
+            SetIndexBuffer,
+            SetVertexBuffers,
+            DrawIndexed,
+            Draw,
+            Dispatch>;
+    } // namespace NullCommands
+
+    //
+
+    /// <summary>
+    /// Log of the command lists uploaded to the queues of the null backend, in the order they were uploaded.
+    /// Nothing is submitted to a GPU: copies are executed on the CPU backed memory of the resources when uploaded and
+    /// every other command is only recorded, so a frame can be inspected or counted without a device.
+    /// Submissions are kept until they are taken or cleared, a run of many frames should do so every frame.
+    /// </summary>
+    class NullCommandLog
+    {
+    public:
+        struct Submission
+        {
+            CommandQueueType                   Queue;
+            uint64_t                           FrameId;
+            std::vector<NullCommands::Command> Commands;
+        };
+
+    public:
+        /// <summary>
+        /// Get the command log of the null backend
+        /// </summary>
+        [[nodiscard]] static NullCommandLog* Get();
+
+        /// <summary>
+        /// Append the commands of an uploaded command list, dropped if the log isn't recording
+        /// </summary>
+        void Submit(
+            CommandQueueType                   Queue,
+            std::vector<NullCommands::Command> Commands);
+
+        /// <summary>
+        /// Mark the end of a frame, following submissions belong to the next frame
+        /// </summary>
+        void EndFrame() noexcept
+        {
+            m_FrameId.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Take every submission out of the log
+        /// </summary>
+        [[nodiscard]] std::vector<Submission> Take();
+
+        /// <summary>
+        /// Remove every submission
+        /// </summary>
+        void Clear();
+
+    public:
+        /// <summary>
+        /// Enable or disable recording, the commands are still executed while disabled
+        /// </summary>
+        void SetRecording(
+            bool IsRecording) noexcept
+        {
+            m_IsRecording.store(IsRecording, std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Check if submissions are recorded
+        /// </summary>
+        [[nodiscard]] bool IsRecording() const noexcept
+        {
+            return m_IsRecording.load(std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Get the current frame id
+        /// </summary>
+        [[nodiscard]] uint64_t GetFrameId() const noexcept
+        {
+            return m_FrameId.load(std::memory_order_relaxed);
+        }
+
+        /// <summary>
+        /// Get the number of recorded submissions
+        /// </summary>
+        [[nodiscard]] size_t GetSubmissionCount() const;
+
+        /// <summary>
+        /// Get the number of recorded commands
+        /// </summary>
+        [[nodiscard]] size_t GetCommandCount() const;
+
+        /// <summary>
+        /// Get the number of recorded commands of a type
+        /// </summary>
+        template<typename _Ty>
+        [[nodiscard]] size_t GetCommandCount() const
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            size_t Count = 0;
+            for (auto& Submitted : m_Submissions)
+            {
+                Count += std::ranges::count_if(
+                    Submitted.Commands,
+                    [](const NullCommands::Command& Command)
+                    { return std::holds_alternative<_Ty>(Command); });
+            }
+            return Count;
+        }
+
+    private:
+        mutable std::mutex      m_Mutex;
+        std::vector<Submission> m_Submissions;
+
+        std::atomic<uint64_t> m_FrameId     = 0;
+        std::atomic_bool      m_IsRecording = true;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <RHI/PipelineState.hpp>
+#include <Crypto/Hash128.hpp>
+
+#include <filesystem>
+#include <shared_mutex>
+#include <atomic>
+
+namespace Neon::RHI
+{
+    /// <summary>
+    /// Backend independent pipeline state cache.
+    /// Live pipeline states are kept in a sharded map so threads creating different pipelines rarely contend,
+    /// and the backend's serialized pipeline blobs are persisted to disk between runs.
+    /// The whole store is discarded when the device key (adapter and driver) changes.
+    /// </summary>
+    class PipelineCache
+    {
+    public:
+        static constexpr uint32_t s_Magic      = 0x4353504E; // 'NPSC'
+        static constexpr uint32_t s_Version    = 1;
+        static constexpr size_t   s_ShardCount = 16;
+
+        using Key  = Crypto::Hash128::Bytes;
+        using Blob = std::vector<uint8_t>;
+
+        /// <summary>
+        /// Hashes of the vertex, pixel, geometry, hull and domain shaders, null for a missing shader.
+        /// </summary>
+        using GraphicsShaderKeys = std::array<const Key*, 5>;
+
+    public:
+        /// <summary>
+        /// Make the key of a graphics pipeline state from its description.
+        /// Root signatures and shaders are backend objects, so the backend passes their hashes.
+        /// </summary>
+        [[nodiscard]] static Key MakeKey(
+            const PipelineStateBuilderG& Builder,
+            const Key&                   RootSignatureKey,
+            const GraphicsShaderKeys&    ShaderKeys);
+
+        /// <summary>
+        /// Make the key of a compute pipeline state from its description.
+        /// </summary>
+        [[nodiscard]] static Key MakeKey(
+            const PipelineStateBuilderC& Builder,
+            const Key&                   RootSignatureKey,
+            const Key&                   ShaderKey);
+
+    public:
+        /// <summary>
+        /// Create the cache and read the blobs stored at Path if they were written for the same device key.
+        /// </summary>
+        PipelineCache(
+            std::filesystem::path Path,
+            const Key&            DeviceKey);
+
+        NEON_CLASS_NO_COPYMOVE(PipelineCache);
+
+        /// <summary>
+        /// Save the blobs to disk if any were added.
+        /// </summary>
+        ~PipelineCache();
+
+        /// <summary>
+        /// Find a live pipeline state.
+        /// </summary>
+        [[nodiscard]] Ptr<IPipelineState> Find(
+            const Key& PipelineKey) const;
+
+        /// <summary>
+        /// Insert a live pipeline state, if another thread inserted one first, that one is returned instead.
+        /// </summary>
+        Ptr<IPipelineState> Insert(
+            const Key&          PipelineKey,
+            Ptr<IPipelineState> PipelineState);
+
+        /// <summary>
+        /// Find a live pipeline state or create it, the creation runs without holding any lock.
+        /// </summary>
+        template<typename _FnTy>
+        Ptr<IPipelineState> FindOrCreate(
+            const Key& PipelineKey,
+            _FnTy&&    Create)
+        {
+            if (auto PipelineState = Find(PipelineKey))
+            {
+                return PipelineState;
+            }
+            return Insert(PipelineKey, Create());
+        }
+
+        /// <summary>
+        /// Find the serialized blob of a pipeline state.
+        /// </summary>
+        [[nodiscard]] Ptr<const Blob> FindBlob(
+            const Key& PipelineKey) const;
+
+        /// <summary>
+        /// Store the serialized blob of a pipeline state.
+        /// </summary>
+        void StoreBlob(
+            const Key& PipelineKey,
+            Blob       Data);
+
+        /// <summary>
+        /// Remove the serialized blob of a pipeline state, for example after the driver rejected it.
+        /// </summary>
+        void RemoveBlob(
+            const Key& PipelineKey);
+
+        /// <summary>
+        /// Release every live pipeline state, the blobs are kept.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Write the blobs to disk.
+        /// </summary>
+        bool Save();
+
+        /// <summary>
+        /// Get the number of live pipeline states and stored blobs.
+        /// </summary>
+        [[nodiscard]] std::pair<size_t, size_t> GetSize() const;
+
+    private:
+        struct Shard
+        {
+            std::shared_mutex                            Mutex;
+            std::unordered_map<Key, Ptr<IPipelineState>> States;
+            std::unordered_map<Key, Ptr<const Blob>>     Blobs;
+        };
+
+        /// <summary>
+        /// Get the shard that owns a key.
+        /// </summary>
+        [[nodiscard]] Shard& GetShard(
+            const Key& PipelineKey) const;
+
+        /// <summary>
+        /// Read the blobs from disk, returns false if the file is missing, corrupted or for another device.
+        /// </summary>
+        bool Read();
+
+    private:
+        std::filesystem::path m_Path;
+        Key                   m_DeviceKey;
+
+        mutable std::array<Shard, s_ShardCount> m_Shards;
+        std::atomic_bool                        m_Dirty = false;
+    };
+} // namespace Neon::RHI
\ No newline at end of file
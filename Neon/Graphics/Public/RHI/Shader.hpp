@@ -111,10 +111,15 @@ namespace Neon::RHI
             std::unique_ptr<uint8_t[]> Data,
             size_t                     DataSize);
 
+        /// <summary>
+        /// Compile a shader from source code.
+        /// If Includes is not null, the asset paths of every file included while compiling are appended to it.
+        /// </summary>
         [[nodiscard]] static UPtr<IShader> Create(
             StringU8View             SourceCode,
             const ShaderCompileDesc& Desc,
-            StringU8View             IncludeDirectory = "");
+            StringU8View             IncludeDirectory = "",
+            std::vector<StringU8>*   Includes         = nullptr);
 
         virtual ~IShader() = default;
 
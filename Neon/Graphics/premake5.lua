@@ -26,4 +26,19 @@ project "NeonGraphics"
 		{
             "%{CommonDir.Deps.Libs}/DxC/lib/x64/dxcompiler.lib"
 		}
+		removefiles
+		{
+			"Private/RHI/Null/**"
+		}
+    filter {}
+
+    filter { "options:GraphicsAPI=Null" }
+		defines
+		{
+			"NEON_GRAPHICS_NULL"
+		}
+		removefiles
+		{
+			"Private/RHI/Dx12/**"
+		}
     filter {}
\ No newline at end of file
@@ -38,4 +38,9 @@ namespace Neon::Asset
     {
         return m_IsDirty;
     }
+
+    size_t IAsset::GetResidentSize() const noexcept
+    {
+        return sizeof(IAsset) + m_AssetPath.size();
+    }
 } // namespace Neon::Asset
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include <ResourcePCH.hpp>
+#include <Asset/Cancellation.hpp>
+
+#include <atomic>
+#include <mutex>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::Asset
+{
+    struct CancellationToken::State
+    {
+        std::mutex       Mutex;
+        std::atomic_bool Cancelled = false;
+
+        /// <summary>
+        /// Number of linked sources that were not cancelled yet.
+        /// </summary>
+        uint32_t PendingSources = 0;
+
+        /// <summary>
+        /// Set once an uncancellable requester is linked.
+        /// </summary>
+        bool Pinned = false;
+
+        std::vector<std::weak_ptr<State>> Dependents;
+    };
+
+    //
+
+    CancellationToken CancellationToken::Create()
+    {
+        CancellationToken Token;
+        Token.m_State = std::make_shared<State>();
+        return Token;
+    }
+
+    void CancellationToken::Cancel() const
+    {
+        if (!m_State)
+        {
+            return;
+        }
+
+        std::vector<std::weak_ptr<State>> Dependents;
+        {
+            std::scoped_lock Lock(m_State->Mutex);
+            if (m_State->Cancelled.exchange(true))
+            {
+                return;
+            }
+            Dependents = std::move(m_State->Dependents);
+        }
+
+        for (auto& WeakDependent : Dependents)
+        {
+            auto Dependent = WeakDependent.lock();
+            if (!Dependent)
+            {
+                continue;
+            }
+
+            bool CancelDependent = false;
+            {
+                std::scoped_lock Lock(Dependent->Mutex);
+                CancelDependent = --Dependent->PendingSources == 0 && !Dependent->Pinned;
+            }
+
+            if (CancelDependent)
+            {
+                CancellationToken Token;
+                Token.m_State = std::move(Dependent);
+                Token.Cancel();
+            }
+        }
+    }
+
+    bool CancellationToken::IsCancelled() const noexcept
+    {
+        return m_State && m_State->Cancelled.load(std::memory_order_relaxed);
+    }
+
+    void CancellationToken::Link(
+        const CancellationToken& Dependent) const
+    {
+        NEON_ASSERT(Dependent.m_State, "Cannot link to an empty token");
+
+        if (!m_State)
+        {
+            std::scoped_lock Lock(Dependent.m_State->Mutex);
+            Dependent.m_State->Pinned = true;
+            return;
+        }
+
+        // Lock order is always source then dependent, the same as in Cancel
+        std::scoped_lock Lock(m_State->Mutex);
+        if (m_State->Cancelled)
+        {
+            return;
+        }
+
+        {
+            std::scoped_lock DependentLock(Dependent.m_State->Mutex);
+            Dependent.m_State->PendingSources++;
+        }
+        m_State->Dependents.emplace_back(Dependent.m_State);
+    }
+} // namespace Neon::Asset
\ No newline at end of file
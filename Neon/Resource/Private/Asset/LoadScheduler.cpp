@@ -0,0 +1,185 @@
+#include <ResourcePCH.hpp>
+#include <Private/Asset/LoadScheduler.hpp>
+#include <Private/Asset/Storage.hpp>
+#include <Asset/Pack.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::Asset
+{
+    static thread_local const CancellationToken* s_CurrentToken = nullptr;
+
+    //
+
+    AssetFuture LoadScheduler::Enqueue(
+        IAssetPackage*           Package,
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token)
+    {
+        return Acquire(Package, AssetGuid, LoadTemp, Priority, Token).first->Future;
+    }
+
+    Ptr<IAsset> LoadScheduler::Load(
+        IAssetPackage*           Package,
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        const CancellationToken& Token)
+    {
+        // Acquire with the highest priority, so if a worker beats us to it, the load was at least not delayed
+        auto LoadRequest = Acquire(Package, AssetGuid, LoadTemp, LoadPriority::Critical, Token).first;
+        if (!LoadRequest->Started.exchange(true))
+        {
+            Run(LoadRequest);
+        }
+        else
+        {
+            // Another thread is loading it, help with other jobs meanwhile
+            Asio::JobSystem::Wait(LoadRequest->Future);
+        }
+        return LoadRequest->Future.get();
+    }
+
+    const CancellationToken& LoadScheduler::GetCurrentToken()
+    {
+        static const CancellationToken s_EmptyToken;
+        return s_CurrentToken ? *s_CurrentToken : s_EmptyToken;
+    }
+
+    //
+
+    auto LoadScheduler::Acquire(
+        IAssetPackage*           Package,
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token) -> std::pair<Ptr<Request>, bool>
+    {
+        if (Token.IsCancelled())
+        {
+            auto Cancelled     = std::make_shared<Request>(Package, AssetGuid, LoadTemp, Priority);
+            Cancelled->Started = true;
+            Cancelled->Promise.set_value(nullptr);
+            return { std::move(Cancelled), false };
+        }
+
+        std::scoped_lock Lock(m_Mutex);
+
+        auto& InFlight = m_InFlight[LoadTemp];
+        auto& Cache    = InFlight[AssetGuid];
+
+        // A cancelled request still resolves to null for its own requesters, new ones get a fresh load
+        if (Cache && Cache->Package == Package && !Cache->Token.IsCancelled())
+        {
+            Token.Link(Cache->Token);
+
+            // Requeue at the higher priority, the stale queue entry is skipped once the request started
+            if (Priority < Cache->Priority && !Cache->Started)
+            {
+                Cache->Priority = Priority;
+                Schedule(Cache);
+            }
+            return { Cache, false };
+        }
+
+        Cache = std::make_shared<Request>(Package, AssetGuid, LoadTemp, Priority);
+        Token.Link(Cache->Token);
+        Schedule(Cache);
+
+        return { Cache, true };
+    }
+
+    void LoadScheduler::Schedule(
+        const Ptr<Request>& LoadRequest)
+    {
+        m_Queues[size_t(LoadRequest->Priority)].emplace_back(LoadRequest);
+
+        // Asset loads yield to frame critical jobs, so even critical loads only run at normal job priority
+        Asio::JobOptions Options{
+            .priority = LoadRequest->Priority == LoadPriority::Critical ? Asio::JobPriority::normal : Asio::JobPriority::background
+        };
+
+        // Each queue entry gets its own worker wake up, workers pick the most urgent entry rather than this one
+        StorageImpl::Get()->GetJobs().Run(
+            [this]
+            {
+                Dispatch();
+            },
+            Options);
+    }
+
+    void LoadScheduler::Dispatch()
+    {
+        Ptr<Request> LoadRequest;
+        {
+            std::scoped_lock Lock(m_Mutex);
+            for (auto& Queue : m_Queues)
+            {
+                while (!Queue.empty() && !LoadRequest)
+                {
+                    auto Front = std::move(Queue.front());
+                    Queue.pop_front();
+
+                    if (!Front->Started.exchange(true))
+                    {
+                        LoadRequest = std::move(Front);
+                    }
+                }
+                if (LoadRequest)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (LoadRequest)
+        {
+            Run(LoadRequest);
+        }
+    }
+
+    void LoadScheduler::Run(
+        const Ptr<Request>& LoadRequest)
+    {
+        Ptr<IAsset>        Asset;
+        std::exception_ptr Exception;
+
+        if (!LoadRequest->Token.IsCancelled())
+        {
+            auto PreviousToken = std::exchange(s_CurrentToken, &LoadRequest->Token);
+            try
+            {
+                Asset = LoadRequest->Package->LoadAsset(LoadRequest->AssetGuid, LoadRequest->LoadTemp, LoadRequest->Token);
+            }
+            catch (...)
+            {
+                Exception = std::current_exception();
+            }
+            s_CurrentToken = PreviousToken;
+        }
+        else
+        {
+            NEON_TRACE_TAG("Asset", "Loading '{}' was cancelled before it started", LoadRequest->AssetGuid.ToString());
+        }
+
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            auto& InFlight = m_InFlight[LoadRequest->LoadTemp];
+            if (auto Iter = InFlight.find(LoadRequest->AssetGuid); Iter != InFlight.end() && Iter->second == LoadRequest)
+            {
+                InFlight.erase(Iter);
+            }
+        }
+
+        if (Exception)
+        {
+            LoadRequest->Promise.set_exception(std::move(Exception));
+        }
+        else
+        {
+            LoadRequest->Promise.set_value(std::move(Asset));
+        }
+    }
+} // namespace Neon::Asset
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <Asset/Manager.hpp>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// Runs asset loads on the storage thread pool.
+    /// There is at most one load in flight per asset, shared by every requester, and queued loads run by priority.
+    /// </summary>
+    class LoadScheduler
+    {
+        struct Request
+        {
+            IAssetPackage*            Package;
+            Handle                    AssetGuid;
+            bool                      LoadTemp;
+            LoadPriority              Priority;
+            CancellationToken         Token = CancellationToken::Create();
+            std::promise<Ptr<IAsset>> Promise;
+            AssetFuture               Future  = Promise.get_future().share();
+            std::atomic_bool          Started = false;
+        };
+
+        using RequestMap = std::unordered_map<Handle, Ptr<Request>>;
+
+    public:
+        LoadScheduler() = default;
+        NEON_CLASS_NO_COPYMOVE(LoadScheduler);
+        ~LoadScheduler() = default;
+
+        /// <summary>
+        /// Queue the load of an asset, or join the load already in flight.
+        /// </summary>
+        [[nodiscard]] AssetFuture Enqueue(
+            IAssetPackage*           Package,
+            const Handle&            AssetGuid,
+            bool                     LoadTemp,
+            LoadPriority             Priority,
+            const CancellationToken& Token);
+
+        /// <summary>
+        /// Load an asset on the calling thread.
+        /// A queued load of the same asset runs inline, a started one is waited for.
+        /// </summary>
+        [[nodiscard]] Ptr<IAsset> Load(
+            IAssetPackage*           Package,
+            const Handle&            AssetGuid,
+            bool                     LoadTemp,
+            const CancellationToken& Token);
+
+        /// <summary>
+        /// Get the token of the load running on the calling thread.
+        /// Loads started from inside another load inherit it, so cancellation reaches their dependencies.
+        /// </summary>
+        [[nodiscard]] static const CancellationToken& GetCurrentToken();
+
+    private:
+        /// <summary>
+        /// Get the load in flight for an asset, or create it.
+        /// Returns the request and whether it was created.
+        /// </summary>
+        [[nodiscard]] std::pair<Ptr<Request>, bool> Acquire(
+            IAssetPackage*           Package,
+            const Handle&            AssetGuid,
+            bool                     LoadTemp,
+            LoadPriority             Priority,
+            const CancellationToken& Token);
+
+        /// <summary>
+        /// Push a request to its priority queue and wake a worker for it.
+        /// The lock must be held.
+        /// </summary>
+        void Schedule(
+            const Ptr<Request>& LoadRequest);
+
+        /// <summary>
+        /// Run the most urgent queued request, called on the thread pool.
+        /// </summary>
+        void Dispatch();
+
+        /// <summary>
+        /// Load the asset of a request and resolve its future.
+        /// </summary>
+        void Run(
+            const Ptr<Request>& LoadRequest);
+
+    private:
+        std::mutex m_Mutex;
+
+        std::array<std::deque<Ptr<Request>>, size_t(LoadPriority::Count)> m_Queues;
+
+        /// <summary>
+        /// Loads in flight, indexed by whether they are temporary loads.
+        /// </summary>
+        std::array<RequestMap, 2> m_InFlight;
+    };
+} // namespace Neon::Asset
\ No newline at end of file
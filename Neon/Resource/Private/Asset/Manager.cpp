@@ -14,19 +14,23 @@ namespace Neon::Asset
 
     //
 
-    std::future<Ptr<IAsset>> Manager::LoadAsync(
-        const Handle& AssetGuid,
-        bool          LoadTemp)
+    AssetFuture Manager::LoadAsync(
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token)
     {
-        return ManagerImpl::Get()->LoadAsync(AssetGuid, LoadTemp);
+        return ManagerImpl::Get()->LoadAsync(AssetGuid, LoadTemp, Priority, Token);
     }
 
-    std::future<Ptr<IAsset>> Manager::LoadAsync(
-        IAssetPackage* Package,
-        const Handle&  AssetGuid,
-        bool           LoadTemp)
+    AssetFuture Manager::LoadAsync(
+        IAssetPackage*           Package,
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token)
     {
-        return ManagerImpl::Get()->LoadAsync(Package, AssetGuid, LoadTemp);
+        return ManagerImpl::Get()->LoadAsync(Package, AssetGuid, LoadTemp, Priority, Token);
     }
 
     Ptr<IAsset> Manager::Load(
@@ -44,10 +48,11 @@ namespace Neon::Asset
         return ManagerImpl::Get()->Load(Package, AssetGuid, LoadTemp);
     }
 
-    std::future<Ptr<IAsset>> Manager::ReloadAsync(
-        const Handle& AssetGuid)
+    AssetFuture Manager::ReloadAsync(
+        const Handle& AssetGuid,
+        LoadPriority  Priority)
     {
-        return ManagerImpl::Get()->ReloadAsync(AssetGuid);
+        return ManagerImpl::Get()->ReloadAsync(AssetGuid, Priority);
     }
 
     Ptr<IAsset> Manager::Reload(
@@ -70,38 +75,33 @@ namespace Neon::Asset
 
     //
 
-    std::future<Ptr<IAsset>> ManagerImpl::LoadAsync(
-        const Handle& AssetGuid,
-        bool          LoadTemp)
+    AssetFuture ManagerImpl::LoadAsync(
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token)
     {
-        for (auto Package : Storage::GetPackages(true, true))
+        if (auto Package = StorageImpl::Get()->FindPackage(AssetGuid, true, true))
         {
-            if (Package->ContainsAsset(AssetGuid))
-            {
-                return StorageImpl::Get()->GetThreadPool().enqueue(
-                    [Package, AssetGuid, LoadTemp]
-                    {
-                        return Package->LoadAsset(AssetGuid, LoadTemp);
-                    });
-            }
+            return LoadAsync(Package, AssetGuid, LoadTemp, Priority, Token);
         }
 
         NEON_ERROR_TAG("Asset", "Asset not found: {}", AssetGuid.ToString());
         return {};
     }
 
-    std::future<Ptr<IAsset>> ManagerImpl::LoadAsync(
-        IAssetPackage* Package,
-        const Handle&  AssetGuid,
-        bool           LoadTemp)
+    AssetFuture ManagerImpl::LoadAsync(
+        IAssetPackage*           Package,
+        const Handle&            AssetGuid,
+        bool                     LoadTemp,
+        LoadPriority             Priority,
+        const CancellationToken& Token)
     {
         if (Package->ContainsAsset(AssetGuid))
         {
-            return StorageImpl::Get()->GetThreadPool().enqueue(
-                [Package, AssetGuid, LoadTemp]
-                {
-                    return Package->LoadAsset(AssetGuid, LoadTemp);
-                });
+            // Loads requested while loading another asset are cancelled along with it
+            auto& LoadToken = Token ? Token : LoadScheduler::GetCurrentToken();
+            return m_Scheduler.Enqueue(Package, AssetGuid, LoadTemp, Priority, LoadToken);
         }
 
         return {};
@@ -111,12 +111,9 @@ namespace Neon::Asset
         const Handle& AssetGuid,
         bool          LoadTemp)
     {
-        for (auto Package : Storage::GetPackages(true, true))
+        if (auto Package = StorageImpl::Get()->FindPackage(AssetGuid, true, true))
         {
-            if (Package->ContainsAsset(AssetGuid))
-            {
-                return Package->LoadAsset(AssetGuid, LoadTemp);
-            }
+            return Load(Package, AssetGuid, LoadTemp);
         }
 
         NEON_ERROR_TAG("Asset", "Asset not found: {}", AssetGuid.ToString());
@@ -130,14 +127,15 @@ namespace Neon::Asset
     {
         if (Package->ContainsAsset(AssetGuid))
         {
-            return Package->LoadAsset(AssetGuid, LoadTemp);
+            return m_Scheduler.Load(Package, AssetGuid, LoadTemp, LoadScheduler::GetCurrentToken());
         }
 
         return {};
     }
 
-    std::future<Ptr<IAsset>> ManagerImpl::ReloadAsync(
-        const Handle& AssetGuid)
+    AssetFuture ManagerImpl::ReloadAsync(
+        const Handle& AssetGuid,
+        LoadPriority  Priority)
     {
         for (auto Package : Storage::GetPackages(true, true))
         {
@@ -146,7 +144,7 @@ namespace Neon::Asset
                 break;
             }
         }
-        return LoadAsync(AssetGuid);
+        return LoadAsync(AssetGuid, false, Priority);
     }
 
     Ptr<IAsset> ManagerImpl::Reload(
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Asset/Manager.hpp>
+#include <Private/Asset/LoadScheduler.hpp>
 
 namespace Neon::Asset
 {
@@ -16,17 +16,21 @@ namespace Neon::Asset
         /// <summary>
         /// Load asynchronously an asset from the storage system.
         /// </summary>
-        std::future<Ptr<IAsset>> LoadAsync(
-            const Handle& AssetGuid,
-            bool          LoadTemp = false);
+        AssetFuture LoadAsync(
+            const Handle&            AssetGuid,
+            bool                     LoadTemp = false,
+            LoadPriority             Priority = LoadPriority::Normal,
+            const CancellationToken& Token    = {});
 
         /// <summary>
         /// Load asynchronously an asset from the storage system.
         /// </summary>
-        std::future<Ptr<IAsset>> LoadAsync(
-            IAssetPackage* Package,
-            const Handle&  AssetGuid,
-            bool           LoadTemp = false);
+        AssetFuture LoadAsync(
+            IAssetPackage*           Package,
+            const Handle&            AssetGuid,
+            bool                     LoadTemp = false,
+            LoadPriority             Priority = LoadPriority::Normal,
+            const CancellationToken& Token    = {});
 
         /// <summary>
         /// Load an asset from the storage system.
@@ -46,8 +50,9 @@ namespace Neon::Asset
         /// <summary>
         /// Load or reload asynchronously an asset from the storage system.
         /// </summary>
-        std::future<Ptr<IAsset>> ReloadAsync(
-            const Handle& AssetGuid);
+        AssetFuture ReloadAsync(
+            const Handle& AssetGuid,
+            LoadPriority  Priority = LoadPriority::Normal);
 
         /// <summary>
         /// Load or reload an asset from the storage system.
@@ -66,5 +71,8 @@ namespace Neon::Asset
         /// </summary>
         bool RequestUnload(
             const Handle& AssetGuid);
+
+    private:
+        LoadScheduler m_Scheduler;
     };
 } // namespace Neon::Asset
\ No newline at end of file
@@ -31,6 +31,20 @@ namespace Neon::Asset
         m_MetaData.add_child("Dependencies", boost::property_tree::ptree());
     }
 
+    AssetMetaDataDef::AssetMetaDataDef(
+        AssetMetaData MetaData) :
+        m_MetaData(std::move(MetaData))
+    {
+        if (m_MetaData.find("Loader") == m_MetaData.not_found())
+        {
+            m_MetaData.put_child("Loader", boost::property_tree::ptree());
+        }
+        if (m_MetaData.find("Dependencies") == m_MetaData.not_found())
+        {
+            m_MetaData.put_child("Dependencies", boost::property_tree::ptree());
+        }
+    }
+
     void AssetMetaDataDef::Export(
         std::ofstream& Stream)
     {
@@ -39,6 +53,11 @@ namespace Neon::Asset
 
     //
 
+    const AssetMetaData& AssetMetaDataDef::GetMetaData() const noexcept
+    {
+        return m_MetaData;
+    }
+
     Handle AssetMetaDataDef::GetGuid() const noexcept
     {
         auto Iter = m_MetaData.find("Guid");
@@ -0,0 +1,26 @@
+#include <ResourcePCH.hpp>
+#include <Private/Asset/Storage.hpp>
+#include <Asset/Pack.hpp>
+
+namespace Neon::Asset
+{
+    void IAssetPackage::OnCacheHit(
+        const Asset::Handle& AssetGuid)
+    {
+        if (auto Storage = StorageImpl::Get())
+        {
+            Storage->GetResidency().Touch(this, AssetGuid);
+        }
+    }
+
+    void IAssetPackage::OnCacheInsert(
+        const Asset::Handle& AssetGuid,
+        const Ptr<IAsset>&   Asset,
+        size_t               LoaderId)
+    {
+        if (auto Storage = StorageImpl::Get())
+        {
+            Storage->GetResidency().Track(this, AssetGuid, Asset.get(), Asset->GetResidentSize(), LoaderId);
+        }
+    }
+} // namespace Neon::Asset
\ No newline at end of file
@@ -0,0 +1,454 @@
+#include <ResourcePCH.hpp>
+#include <Private/Asset/Storage.hpp>
+#include <Asset/Packs/Archive.hpp>
+#include <Asset/Handler.hpp>
+
+#include <IO/MemoryStream.hpp>
+#include <IO/BinaryFile.hpp>
+#include <Math/Common.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include <stack>
+#include <regex>
+#include <sstream>
+
+#include <Log/Logger.hpp>
+
+namespace bip = boost::interprocess;
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// Get the guid of an archive entry as an asset handle.
+    /// </summary>
+    [[nodiscard]] static const Asset::Handle& GetEntryGuid(
+        const ArchiveAssetPackage::ArchiveEntry& Entry)
+    {
+        static_assert(sizeof(Asset::Handle) == sizeof(Entry.Guid));
+        return *std::bit_cast<const Asset::Handle*>(&Entry.Guid[0]);
+    }
+
+    //
+
+    ArchiveAssetPackage::ArchiveAssetPackage(
+        std::filesystem::path Path) :
+        m_Path(std::move(Path))
+    {
+        if (!std::filesystem::is_regular_file(m_Path))
+        {
+            NEON_ERROR_TAG("Asset", "Archive '{}' does not exist", m_Path.string());
+            return;
+        }
+
+        try
+        {
+            m_File   = std::make_unique<bip::file_mapping>(m_Path.string().c_str(), bip::read_only);
+            m_Region = std::make_unique<bip::mapped_region>(*m_File, bip::read_only);
+        }
+        catch (const bip::interprocess_exception& Exception)
+        {
+            NEON_ERROR_TAG("Asset", "Failed to map archive '{}': {}", m_Path.string(), Exception.what());
+            m_Region.reset();
+            m_File.reset();
+            return;
+        }
+
+        m_Data = { static_cast<const uint8_t*>(m_Region->get_address()), m_Region->get_size() };
+        if (m_Data.size() < sizeof(ArchiveHeader))
+        {
+            NEON_ERROR_TAG("Asset", "Archive '{}' is too small", m_Path.string());
+            m_Data = {};
+            return;
+        }
+
+        auto Header = std::bit_cast<const ArchiveHeader*>(m_Data.data());
+        if (Header->Magic != s_Magic || Header->Version != s_Version)
+        {
+            NEON_ERROR_TAG("Asset", "Archive '{}' has an invalid header or an unsupported version", m_Path.string());
+            m_Data = {};
+            return;
+        }
+
+        size_t EntriesOffset      = sizeof(ArchiveHeader);
+        size_t DependenciesOffset = EntriesOffset + Header->AssetCount * sizeof(ArchiveEntry);
+        size_t DependenciesEnd    = DependenciesOffset + Header->DependencyCount * sizeof(Asset::Handle);
+
+        if (DependenciesEnd > Header->StringsOffset || Header->StringsOffset + Header->StringsSize > m_Data.size())
+        {
+            NEON_ERROR_TAG("Asset", "Archive '{}' has a corrupted table of contents", m_Path.string());
+            m_Data = {};
+            return;
+        }
+
+        m_Entries      = { std::bit_cast<const ArchiveEntry*>(m_Data.data() + EntriesOffset), Header->AssetCount };
+        m_Dependencies = { std::bit_cast<const Asset::Handle*>(m_Data.data() + DependenciesOffset), Header->DependencyCount };
+
+        // Only the path lookup table needs to be built, the rest of the table of contents is used in place
+        auto Strings = StringU8View(std::bit_cast<const char*>(m_Data.data() + Header->StringsOffset), Header->StringsSize);
+        m_AssetPath.reserve(m_Entries.size());
+        for (uint32_t i = 0; i < m_Entries.size(); i++)
+        {
+            auto& Entry = m_Entries[i];
+            if (size_t(Entry.PathOffset) + Entry.PathSize > Strings.size() ||
+                size_t(Entry.LoaderDataOffset) + Entry.LoaderDataSize > Strings.size() ||
+                size_t(Entry.DependencyIndex) + Entry.DependencyCount > m_Dependencies.size() ||
+                Entry.Offset + Entry.Size > m_Data.size())
+            {
+                NEON_ERROR_TAG("Asset", "Archive '{}' has a corrupted entry for '{}'", m_Path.string(), GetEntryGuid(Entry).ToString());
+                m_Entries = {};
+                m_AssetPath.clear();
+                return;
+            }
+            m_AssetPath.emplace(Strings.substr(Entry.PathOffset, Entry.PathSize), i);
+        }
+
+        NEON_TRACE_TAG("Asset", "Mounted archive '{}' with {} assets", m_Path.string(), m_Entries.size());
+    }
+
+    ArchiveAssetPackage::~ArchiveAssetPackage() = default;
+
+    Asio::CoGenerator<const Asset::Handle&> ArchiveAssetPackage::GetAssets()
+    {
+        for (auto& Entry : m_Entries)
+        {
+            co_yield GetEntryGuid(Entry);
+        }
+    }
+
+    bool ArchiveAssetPackage::ContainsAsset(
+        const Asset::Handle& AssetGuid) const
+    {
+        return FindEntry(AssetGuid) != nullptr;
+    }
+
+    Asset::Handle ArchiveAssetPackage::FindAsset(
+        const StringU8& Path) const
+    {
+        auto Iter = m_AssetPath.find(Path);
+        return Iter != m_AssetPath.end() ? GetEntryGuid(m_Entries[Iter->second]) : Asset::Handle::Null;
+    }
+
+    Asio::CoGenerator<Asset::Handle> ArchiveAssetPackage::FindAssets(
+        const StringU8& PathRegex) const
+    {
+        std::regex Regex(PathRegex);
+
+        for (auto& [Path, Index] : m_AssetPath)
+        {
+            if (std::regex_match(Path.begin(), Path.end(), Regex))
+            {
+                co_yield Asset::Handle{ GetEntryGuid(m_Entries[Index]) };
+            }
+        }
+    }
+
+    //
+
+    std::future<void> ArchiveAssetPackage::Export()
+    {
+        return std::async(std::launch::deferred, [] {});
+    }
+
+    std::future<void> ArchiveAssetPackage::SaveAsset(
+        Ptr<IAsset> Asset)
+    {
+        NEON_ERROR_TAG("Asset", "Trying to save asset '{}' to read only archive '{}'", Asset->GetGuid().ToString(), m_Path.string());
+        return std::async(std::launch::deferred, [] {});
+    }
+
+    bool ArchiveAssetPackage::RemoveAsset(
+        const Asset::Handle& AssetGuid)
+    {
+        if (ContainsAsset(AssetGuid))
+        {
+            NEON_ERROR_TAG("Asset", "Trying to remove asset '{}' from read only archive '{}'", AssetGuid.ToString(), m_Path.string());
+        }
+        return false;
+    }
+
+    //
+
+    Ptr<IAsset> ArchiveAssetPackage::LoadAsset(
+        const Asset::Handle&     AssetGuid,
+        bool                     LoadTemp,
+        const CancellationToken& Token)
+    {
+        auto LoadFromCache =
+            [this](const Asset::Handle& AssetGuid) -> Ptr<IAsset>
+        {
+            RLock Lock(m_CacheMutex);
+            if (auto Iter = m_Cache.find(AssetGuid); Iter != m_Cache.end())
+            {
+                return Iter->second;
+            }
+            return nullptr;
+        };
+
+        if (auto CacheAsset = LoadFromCache(AssetGuid))
+        {
+            OnCacheHit(AssetGuid);
+            return CacheAsset;
+        }
+
+        std::stack<Handle> ToLoad;
+        ToLoad.push(AssetGuid);
+
+        Asset::DependencyReader DepReader;
+
+        // Temporary assets never enter the cache, the dependencies loaded by this call are looked up here instead
+        std::unordered_map<Handle, Ptr<IAsset>> TempAssets;
+
+        while (!ToLoad.empty())
+        {
+            auto CurrentGuid = ToLoad.top();
+
+            if (Token.IsCancelled())
+            {
+                NEON_TRACE_TAG("Asset", "Loading '{}' was cancelled", AssetGuid.ToString());
+                return nullptr;
+            }
+
+            auto Entry = FindEntry(CurrentGuid);
+            if (!Entry)
+            {
+                NEON_ERROR_TAG("Asset", "Loading '{}' that depends on '{}' failed: Asset does not exist", AssetGuid.ToString(), CurrentGuid.ToString());
+                return nullptr;
+            }
+
+            // If we need to load dependencies first, skip this asset and load the dependencies
+            bool NeedsDependenciesFirst = false;
+            for (auto& DepGuid : GetDependencies(*Entry))
+            {
+                if (auto CacheAsset = LoadFromCache(DepGuid))
+                {
+                    OnCacheHit(DepGuid);
+                    DepReader.Link(DepGuid, CacheAsset);
+                }
+                else if (auto TempIter = TempAssets.find(DepGuid); TempIter != TempAssets.end())
+                {
+                    DepReader.Link(DepGuid, TempIter->second);
+                }
+                else
+                {
+                    ToLoad.push(DepGuid);
+                    NeedsDependenciesFirst = true;
+                }
+            }
+            if (NeedsDependenciesFirst)
+            {
+                continue;
+            }
+
+            IAssetHandler* Handler = Storage::GetHandler(Entry->LoaderId);
+            if (!Handler)
+            {
+                NEON_ERROR_TAG("Asset", "Loading '{}' -- Failed to get handler for asset '{}'", AssetGuid.ToString(), CurrentGuid.ToString());
+                return nullptr;
+            }
+
+            AssetMetaData LoaderData;
+            if (Entry->LoaderDataSize)
+            {
+                auto LoaderDataStr = GetString(Entry->LoaderDataOffset, Entry->LoaderDataSize);
+
+                IO::MemoryInputStream LoaderDataStream(LoaderDataStr.data(), LoaderDataStr.size());
+                boost::property_tree::read_json(LoaderDataStream, LoaderData);
+            }
+
+            IO::MemoryInputStream AssetStream(m_Data.data() + Entry->Offset, Entry->Size);
+
+            auto Asset = Handler->Load(AssetStream, DepReader, CurrentGuid, StringU8(GetString(Entry->PathOffset, Entry->PathSize)), LoaderData);
+            if (!Asset)
+            {
+                NEON_ERROR_TAG("Asset", "Loading '{}' -- Failed to load asset '{}'", AssetGuid.ToString(), CurrentGuid.ToString());
+                return nullptr;
+            }
+
+            Asset->MarkDirty(false);
+            DepReader.Link(CurrentGuid, Asset);
+
+            ToLoad.pop();
+
+            if (!LoadTemp) [[likely]]
+            {
+                {
+                    RWLock Lock(m_CacheMutex);
+                    m_Cache.emplace(CurrentGuid, Asset);
+                }
+                OnCacheInsert(CurrentGuid, Asset, Entry->LoaderId);
+            }
+            else
+            {
+                TempAssets.emplace(CurrentGuid, std::move(Asset));
+            }
+        }
+
+        if (!LoadTemp) [[likely]]
+        {
+            return LoadFromCache(AssetGuid);
+        }
+        else
+        {
+            return TempAssets[AssetGuid];
+        }
+    }
+
+    bool ArchiveAssetPackage::UnloadAsset(
+        const Asset::Handle& AssetGuid,
+        bool                 Force)
+    {
+        RWLock Lock(m_CacheMutex);
+
+        auto Iter = m_Cache.find(AssetGuid);
+        if (Iter == m_Cache.end())
+        {
+            return false;
+        }
+
+        if (Force || Iter->second.use_count() == 1)
+        {
+            m_Cache.erase(Iter);
+        }
+        return true;
+    }
+
+    //
+
+    auto ArchiveAssetPackage::FindEntry(
+        const Asset::Handle& AssetGuid) const -> const ArchiveEntry*
+    {
+        auto Iter = std::ranges::lower_bound(
+            m_Entries, AssetGuid, std::less{},
+            [](const ArchiveEntry& Entry) -> const Asset::Handle&
+            { return GetEntryGuid(Entry); });
+
+        return Iter != m_Entries.end() && GetEntryGuid(*Iter) == AssetGuid ? &*Iter : nullptr;
+    }
+
+    std::span<const Asset::Handle> ArchiveAssetPackage::GetDependencies(
+        const ArchiveEntry& Entry) const
+    {
+        return m_Dependencies.subspan(Entry.DependencyIndex, Entry.DependencyCount);
+    }
+
+    StringU8View ArchiveAssetPackage::GetString(
+        uint32_t Offset,
+        uint32_t Size) const
+    {
+        auto Header = std::bit_cast<const ArchiveHeader*>(m_Data.data());
+        return StringU8View(std::bit_cast<const char*>(m_Data.data() + Header->StringsOffset + Offset), Size);
+    }
+
+    //
+
+    void ArchiveAssetPackage::Writer::AddAsset(
+        Entry AssetEntry)
+    {
+        m_Entries.emplace_back(std::move(AssetEntry));
+    }
+
+    bool ArchiveAssetPackage::Writer::Write(
+        const std::filesystem::path& Path) const
+    {
+        // The table of contents must be sorted by guid for binary search
+        std::vector<const Entry*> SortedEntries;
+        SortedEntries.reserve(m_Entries.size());
+        for (auto& CurEntry : m_Entries)
+        {
+            SortedEntries.emplace_back(&CurEntry);
+        }
+        std::ranges::sort(
+            SortedEntries, std::less{},
+            [](const Entry* CurEntry) -> const Asset::Handle&
+            { return CurEntry->Guid; });
+
+        if (auto Iter = std::ranges::adjacent_find(
+                SortedEntries, [](const Entry* A, const Entry* B)
+                { return A->Guid == B->Guid; });
+            Iter != SortedEntries.end())
+        {
+            NEON_ERROR_TAG("Asset", "Archive '{}' has duplicate asset '{}'", Path.string(), (*Iter)->Guid.ToString());
+            return false;
+        }
+
+        std::vector<ArchiveEntry>  Entries(SortedEntries.size());
+        std::vector<Asset::Handle> Dependencies;
+        StringU8                   Strings;
+
+        for (size_t i = 0; i < SortedEntries.size(); i++)
+        {
+            auto& Src = *SortedEntries[i];
+            auto& Dst = Entries[i];
+
+            std::copy_n(Src.Guid.begin(), sizeof(Dst.Guid), Dst.Guid);
+            Dst.LoaderId = Src.LoaderId;
+            Dst.Size     = Src.Data.size();
+
+            std::fill_n(Dst.Hash, s_HashLength, '\0');
+            std::copy_n(Src.Hash.data(), std::min(Src.Hash.size(), s_HashLength), Dst.Hash);
+
+            Dst.DependencyIndex = uint32_t(Dependencies.size());
+            Dst.DependencyCount = uint32_t(Src.Dependencies.size());
+            Dependencies.insert(Dependencies.end(), Src.Dependencies.begin(), Src.Dependencies.end());
+
+            Dst.PathOffset = uint32_t(Strings.size());
+            Dst.PathSize   = uint32_t(Src.Path.size());
+            Strings.append(Src.Path);
+
+            StringU8 LoaderData;
+            if (!Src.LoaderData.empty())
+            {
+                std::ostringstream LoaderDataStream;
+                boost::property_tree::write_json(LoaderDataStream, Src.LoaderData, false);
+                LoaderData = LoaderDataStream.str();
+            }
+
+            Dst.LoaderDataOffset = uint32_t(Strings.size());
+            Dst.LoaderDataSize   = uint32_t(LoaderData.size());
+            Strings.append(LoaderData);
+        }
+
+        ArchiveHeader Header{
+            .Magic           = s_Magic,
+            .Version         = s_Version,
+            .AssetCount      = uint32_t(Entries.size()),
+            .DependencyCount = uint32_t(Dependencies.size()),
+            .StringsOffset   = sizeof(ArchiveHeader) + Entries.size() * sizeof(ArchiveEntry) + Dependencies.size() * sizeof(Asset::Handle),
+            .StringsSize     = Strings.size()
+        };
+
+        // Place the assets' data after the table of contents
+        uint64_t DataOffset = Math::AlignUp(Header.StringsOffset + Header.StringsSize, s_DataAlign);
+        for (size_t i = 0; i < SortedEntries.size(); i++)
+        {
+            Entries[i].Offset = DataOffset;
+            DataOffset        = Math::AlignUp(DataOffset + Entries[i].Size, s_DataAlign);
+        }
+
+        std::ofstream File(Path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            NEON_ERROR_TAG("Asset", "Failed to open archive '{}' for writing", Path.string());
+            return false;
+        }
+
+        IO::BinaryStreamWriter Writer(File);
+        Writer.WriteBytes(&Header, sizeof(Header));
+        Writer.WriteBytes(Entries.data(), Entries.size() * sizeof(ArchiveEntry));
+        Writer.WriteBytes(Dependencies.data(), Dependencies.size() * sizeof(Asset::Handle));
+        Writer.WriteBytes(Strings.data(), Strings.size());
+
+        std::array<char, s_DataAlign> Padding{};
+        for (size_t i = 0; i < SortedEntries.size(); i++)
+        {
+            size_t Position = File.tellp();
+            Writer.WriteBytes(Padding.data(), Entries[i].Offset - Position);
+            Writer.WriteBytes(SortedEntries[i]->Data.data(), SortedEntries[i]->Data.size());
+        }
+
+        return bool(Writer);
+    }
+} // namespace Neon::Asset
\ No newline at end of file
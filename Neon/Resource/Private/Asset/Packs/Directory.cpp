@@ -4,6 +4,8 @@
 #include <Asset/Handler.hpp>
 
 #include <Crypto/Sha256.hpp>
+#include <Crypto/Hash128.hpp>
+#include <IO/BinaryFile.hpp>
 #include <queue>
 #include <stack>
 #include <fstream>
@@ -14,8 +16,11 @@
 namespace Neon::Asset
 {
     DirectoryAssetPackage::DirectoryAssetPackage(
-        std::filesystem::path Path) :
-        m_RootPath(std::move(Path))
+        std::filesystem::path Path,
+        ScanMode              Mode,
+        std::filesystem::path IndexPath) :
+        m_RootPath(std::move(Path)),
+        m_IndexPath(std::move(IndexPath))
     {
         if (m_RootPath.empty() || m_RootPath.native().starts_with(STR("..")))
         {
@@ -37,83 +42,98 @@ namespace Neon::Asset
         }
 
         NEON_TRACE_TAG("Asset", "Loading assets from directory '{}'", m_RootPath.string());
+        auto StartTime = std::chrono::high_resolution_clock::now();
 
-        // First load all the meta files
-        for (auto& MetafilePath : GetFiles(m_RootPath))
+        std::vector<std::filesystem::path> MetafilePaths;
+        for (auto& FilePath : GetFiles(m_RootPath))
         {
-            if (!MetafilePath.native().ends_with(AssetMetaDataDef::s_MetaFileExtensionW))
+            if (FilePath.native().ends_with(AssetMetaDataDef::s_MetaFileExtensionW))
             {
-                continue;
+                MetafilePaths.emplace_back(FilePath);
             }
+        }
 
-            std::ifstream File(MetafilePath);
-            if (!File.is_open())
-            {
-                NEON_ERROR_TAG("Asset", "Failed to open meta file '{}'", MetafilePath.string());
-                continue;
-            }
+        // Sort the files so duplicate guids are always resolved the same way
+        std::ranges::sort(MetafilePaths);
 
-            {
-                AssetMetaDataDef Metadata(File);
-                File.close();
+        if (m_IndexPath.empty())
+        {
+            Crypto::Hash128 Hash;
+            Hash << std::filesystem::absolute(m_RootPath).lexically_normal().string();
+            m_IndexPath = std::filesystem::temp_directory_path() / (Hash.Digest().ToString() + s_IndexExtension);
+        }
 
-                if ((m_RootPath / Metadata.GetPath()) != MetafilePath)
-                {
-                    NEON_ERROR_TAG("Asset", "Meta file '{}' has a different path than the one in meta file", MetafilePath.string());
-                    continue;
-                }
+        IndexMap Index;
+        if (Mode == ScanMode::Cached)
+        {
+            Index = ReadIndex();
+        }
 
-                auto Guid = Metadata.GetGuid();
-                if (Guid == Handle::Null)
-                {
-                    NEON_ERROR_TAG("Asset", "Meta file '{}' does not have a Guid", MetafilePath.string());
-                    continue;
-                }
+        //
+        // Scan the meta files in parallel, each task takes a batch of files
+        //
 
-                if (m_AssetMeta.contains(Guid))
-                {
-                    NEON_ERROR_TAG("Asset", "Meta file '{}' has a Guid that is already in use", MetafilePath.string());
-                    continue;
-                }
+        static constexpr size_t BatchSize = 64;
 
-                auto AssetFile = m_RootPath / Metadata.GetAssetPath();
-                File.open(AssetFile, std::ios::ate | std::ios::binary);
+        std::vector<std::optional<IndexEntry>> Entries(MetafilePaths.size());
+        std::atomic_size_t                     IndexHits = 0;
 
-                if (!File.is_open())
+        auto ScanBatch = [&](size_t Begin)
+        {
+            size_t End = std::min(Begin + BatchSize, MetafilePaths.size());
+            for (size_t i = Begin; i < End; i++)
+            {
+                bool FromIndex = false;
+                Entries[i]     = ScanMetaFile(MetafilePaths[i], Index, FromIndex);
+                if (FromIndex)
                 {
-                    NEON_ERROR_TAG("Asset", "Failed to open asset file '{}'", AssetFile.string());
-                    continue;
+                    IndexHits.fetch_add(1, std::memory_order_relaxed);
                 }
+            }
+        };
 
-                size_t FileSize = File.tellg();
-                File.seekg(std::ios::beg);
+        {
+            Asio::JobGroup ScanJobs;
+            for (size_t Begin = 0; Begin < MetafilePaths.size(); Begin += BatchSize)
+            {
+                ScanJobs.Run(
+                    [&ScanBatch, Begin]
+                    { ScanBatch(Begin); });
+            }
+            ScanJobs.Wait();
+        }
 
-                Crypto::Sha256 Hash;
-                Hash.Append(File, FileSize);
+        //
+        // Merge the results
+        //
 
-                auto ExpectedHash = Metadata.GetHash();
-                if (ExpectedHash.empty())
-                {
-                    NEON_ERROR_TAG("Asset", "Meta file '{}' does not have a hash", MetafilePath.string());
-                    continue;
-                }
-                else if (auto CurrentHash = Hash.Digest().ToString(); CurrentHash != ExpectedHash)
-                {
-#ifndef NEON_ASSET_MGR_DISABLE_HASH_VALIDATION
-                    NEON_ERROR_TAG("Asset", "Asset file '{}' has a different hash than the one in meta file", AssetFile.string());
-                    continue;
-#else
-                    // Try to correct the hash
-                    NEON_WARNING_TAG("Asset", "Asset file '{}' has a different hash than the one in meta file", AssetFile.string());
-                    Metadata.SetHash(CurrentHash);
-                    Metadata.SetDirty();
-#endif
-                }
+        IndexMap NewIndex;
+        for (size_t i = 0; i < MetafilePaths.size(); i++)
+        {
+            auto& Entry = Entries[i];
+            if (!Entry)
+            {
+                continue;
+            }
 
-                m_AssetPath.emplace(Metadata.GetAssetPath().string(), Guid);
-                m_AssetMeta.emplace(Guid, std::move(Metadata));
+            auto Guid = Entry->Metadata.GetGuid();
+            if (m_AssetMeta.contains(Guid))
+            {
+                NEON_ERROR_TAG("Asset", "Meta file '{}' has a Guid that is already in use", MetafilePaths[i].string());
+                continue;
             }
+
+            m_AssetPath.emplace(Entry->Metadata.GetAssetPath().string(), Guid);
+            m_AssetMeta.emplace(Guid, Entry->Metadata);
+            NewIndex.emplace(FileSystem::ConvertToUnixPath(MetafilePaths[i].lexically_relative(m_RootPath)).string(), std::move(*Entry));
+        }
+
+        if (IndexHits != NewIndex.size() || Index.size() != NewIndex.size())
+        {
+            WriteIndex(NewIndex);
         }
+
+        NEON_TRACE_TAG("Asset", "Loaded {} assets from directory '{}' ({} from index) in {}ms", m_AssetMeta.size(), m_RootPath.string(), IndexHits.load(), std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - StartTime).count());
     }
 
     Asio::CoGenerator<const Asset::Handle&> DirectoryAssetPackage::GetAssets()
@@ -174,7 +194,7 @@ namespace Neon::Asset
             }
         };
 
-        return StorageImpl::Get()->GetThreadPool().enqueue(std::move(ExportTask));
+        return StorageImpl::Get()->GetJobs().Async(std::move(ExportTask), { .priority = Asio::JobPriority::background });
     }
 
     std::future<void> DirectoryAssetPackage::SaveAsset(
@@ -260,7 +280,7 @@ namespace Neon::Asset
                 std::vector<uint8_t> Buffer(FileSize);
                 AssetFile.read(reinterpret_cast<char*>(Buffer.data()), FileSize);
 
-                Crypto::Sha256 Hash;
+                Crypto::Hash128 Hash;
                 Hash.Append(Buffer.data(), FileSize);
                 Metadata->SetLoaderId(HandlerId);
                 Metadata->SetHash(Hash.Digest().ToString());
@@ -270,7 +290,7 @@ namespace Neon::Asset
             }
         };
 
-        return StorageImpl::Get()->GetThreadPool().enqueue(std::move(SaveAssetTask));
+        return StorageImpl::Get()->GetJobs().Async(std::move(SaveAssetTask), { .priority = Asio::JobPriority::background });
     }
 
     bool DirectoryAssetPackage::RemoveAsset(
@@ -298,9 +318,38 @@ namespace Neon::Asset
         return Iter != m_AssetPath.end() ? Iter->second : Asset::Handle::Null;
     }
 
+    std::optional<std::filesystem::file_time_type> DirectoryAssetPackage::GetWriteTime(
+        const Asset::Handle& AssetGuid) const
+    {
+        std::filesystem::path AssetPath;
+        {
+            RLock Lock(m_CacheMutex);
+            auto  Iter = m_AssetMeta.find(AssetGuid);
+            if (Iter == m_AssetMeta.end())
+            {
+                return std::nullopt;
+            }
+            AssetPath = m_RootPath / Iter->second.GetAssetPath();
+        }
+
+        // A file that cannot be queried anymore must not look unchanged
+        std::error_code Error;
+        auto            WriteTime = std::filesystem::last_write_time(AssetPath, Error);
+        return Error ? std::filesystem::file_time_type::min() : WriteTime;
+    }
+
+    std::optional<AssetMetaDataDef> DirectoryAssetPackage::GetMetadata(
+        const Asset::Handle& AssetGuid) const
+    {
+        RLock Lock(m_CacheMutex);
+        auto  Iter = m_AssetMeta.find(AssetGuid);
+        return Iter != m_AssetMeta.end() ? std::optional(Iter->second) : std::nullopt;
+    }
+
     Ptr<IAsset> DirectoryAssetPackage::LoadAsset(
-        const Asset::Handle& AssetGuid,
-        bool                 LoadTemp)
+        const Asset::Handle&     AssetGuid,
+        bool                     LoadTemp,
+        const CancellationToken& Token)
     {
         auto LoadFromCache =
             [this](const Asset::Handle& AssetGuid) -> Ptr<IAsset>
@@ -317,18 +366,28 @@ namespace Neon::Asset
         // is because we later will only load the asset if it's not already loaded
         if (auto CacheAsset = LoadFromCache(AssetGuid))
         {
+            OnCacheHit(AssetGuid);
             return CacheAsset;
         }
 
         std::stack<Handle> ToLoad;
         ToLoad.push(AssetGuid);
 
-        Asset::DependencyReader  DepReader;
-        std::vector<Ptr<IAsset>> TempAssets;
+        Asset::DependencyReader DepReader;
+
+        // Temporary assets never enter the cache, the dependencies loaded by this call are looked up here instead
+        std::unordered_map<Handle, Ptr<IAsset>> TempAssets;
 
         while (!ToLoad.empty())
         {
-            auto& CurrentGuid = ToLoad.top();
+            // Copied, the guid is still used after it is popped
+            auto CurrentGuid = ToLoad.top();
+
+            if (Token.IsCancelled())
+            {
+                NEON_TRACE_TAG("Asset", "Loading '{}' was cancelled", AssetGuid.ToString());
+                return nullptr;
+            }
 
             // Check if asset is already loaded in cache
             // If not, check if it exists in the package
@@ -349,19 +408,22 @@ namespace Neon::Asset
             bool NeedsDependenciesFirst = false;
 
             // Insert the assets that should be loaded first
+            // LoadFromCache takes the cache lock itself, holding it here too would lock the shared mutex recursively
+            for (auto& DepGuid : Metadata->GetDependencies())
             {
-                RLock Lock(m_CacheMutex);
-                for (auto& DepGuid : Metadata->GetDependencies())
+                if (auto CacheAsset = LoadFromCache(DepGuid))
                 {
-                    if (auto CacheAsset = LoadFromCache(DepGuid))
-                    {
-                        DepReader.Link(DepGuid, CacheAsset);
-                    }
-                    else
-                    {
-                        ToLoad.push(std::move(DepGuid));
-                        NeedsDependenciesFirst = true;
-                    }
+                    OnCacheHit(DepGuid);
+                    DepReader.Link(DepGuid, CacheAsset);
+                }
+                else if (auto TempIter = TempAssets.find(DepGuid); TempIter != TempAssets.end())
+                {
+                    DepReader.Link(DepGuid, TempIter->second);
+                }
+                else
+                {
+                    ToLoad.push(DepGuid);
+                    NeedsDependenciesFirst = true;
                 }
             }
             if (NeedsDependenciesFirst)
@@ -408,12 +470,15 @@ namespace Neon::Asset
 
             if (!LoadTemp) [[likely]]
             {
-                RWLock Lock(m_CacheMutex);
-                m_Cache.emplace(CurrentGuid, std::move(Asset));
+                {
+                    RWLock Lock(m_CacheMutex);
+                    m_Cache.emplace(CurrentGuid, Asset);
+                }
+                OnCacheInsert(CurrentGuid, Asset, Metadata->GetLoaderId());
             }
             else
             {
-                TempAssets.emplace_back(std::move(Asset));
+                TempAssets.emplace(CurrentGuid, std::move(Asset));
             }
         }
 
@@ -423,7 +488,7 @@ namespace Neon::Asset
         }
         else
         {
-            return TempAssets.back();
+            return TempAssets[AssetGuid];
         }
     }
 
@@ -436,10 +501,10 @@ namespace Neon::Asset
         auto Iter = m_Cache.find(AssetGuid);
         if (Iter == m_Cache.end())
         {
-            m_Cache.erase(AssetGuid);
+            return false;
         }
 
-        if (!Force && Iter->second.use_count() == 1)
+        if (Force || Iter->second.use_count() == 1)
         {
             m_Cache.erase(Iter);
         }
@@ -470,4 +535,227 @@ namespace Neon::Asset
         Meta.Export(Metafile);
         Meta.SetDirty(false);
     }
+
+    //
+
+    static bool GetFileStamp(
+        const std::filesystem::path& Path,
+        uint64_t&                    Size,
+        int64_t&                     Time)
+    {
+        std::error_code Error;
+        Size = std::filesystem::file_size(Path, Error);
+        if (Error)
+        {
+            return false;
+        }
+        Time = std::filesystem::last_write_time(Path, Error).time_since_epoch().count();
+        return !Error;
+    }
+
+    auto DirectoryAssetPackage::ScanMetaFile(
+        const std::filesystem::path& MetafilePath,
+        const IndexMap&              Index,
+        bool&                        FromIndex) const -> std::optional<IndexEntry>
+    {
+        uint64_t MetaSize;
+        int64_t  MetaTime;
+        if (!GetFileStamp(MetafilePath, MetaSize, MetaTime))
+        {
+            NEON_ERROR_TAG("Asset", "Failed to open meta file '{}'", MetafilePath.string());
+            return std::nullopt;
+        }
+
+        // Check if the meta file and its asset file did not change since the index was written
+        auto RelativePath = FileSystem::ConvertToUnixPath(MetafilePath.lexically_relative(m_RootPath)).string();
+        if (auto Iter = Index.find(RelativePath); Iter != Index.end())
+        {
+            auto& Cached = Iter->second;
+
+            uint64_t AssetSize;
+            int64_t  AssetTime;
+            if (Cached.MetaSize == MetaSize && Cached.MetaTime == MetaTime &&
+                GetFileStamp(m_RootPath / Cached.Metadata.GetAssetPath(), AssetSize, AssetTime) &&
+                Cached.AssetSize == AssetSize && Cached.AssetTime == AssetTime)
+            {
+                FromIndex = true;
+                return Cached;
+            }
+        }
+
+        std::ifstream File(MetafilePath);
+        if (!File.is_open())
+        {
+            NEON_ERROR_TAG("Asset", "Failed to open meta file '{}'", MetafilePath.string());
+            return std::nullopt;
+        }
+
+        AssetMetaDataDef Metadata(File);
+        File.close();
+
+        if ((m_RootPath / Metadata.GetPath()) != MetafilePath)
+        {
+            NEON_ERROR_TAG("Asset", "Meta file '{}' has a different path than the one in meta file", MetafilePath.string());
+            return std::nullopt;
+        }
+
+        if (Metadata.GetGuid() == Handle::Null)
+        {
+            NEON_ERROR_TAG("Asset", "Meta file '{}' does not have a Guid", MetafilePath.string());
+            return std::nullopt;
+        }
+
+        auto AssetFile = m_RootPath / Metadata.GetAssetPath();
+        File.open(AssetFile, std::ios::ate | std::ios::binary);
+
+        if (!File.is_open())
+        {
+            NEON_ERROR_TAG("Asset", "Failed to open asset file '{}'", AssetFile.string());
+            return std::nullopt;
+        }
+
+        size_t FileSize = File.tellg();
+        File.seekg(std::ios::beg);
+
+        auto ExpectedHash = Metadata.GetHash();
+        if (ExpectedHash.empty())
+        {
+            NEON_ERROR_TAG("Asset", "Meta file '{}' does not have a hash", MetafilePath.string());
+            return std::nullopt;
+        }
+
+        // Meta files written before the switch to Hash128 still carry a SHA-256 hash
+        StringU8 CurrentHash = ExpectedHash.size() == s_LegacyHashLength
+                                   ? Crypto::Sha256().Append(File, FileSize).Digest().ToString()
+                                   : Crypto::Hash128().Append(File, FileSize).Digest().ToString();
+
+        if (CurrentHash != ExpectedHash)
+        {
+#ifndef NEON_ASSET_MGR_DISABLE_HASH_VALIDATION
+            NEON_ERROR_TAG("Asset", "Asset file '{}' has a different hash than the one in meta file", AssetFile.string());
+            return std::nullopt;
+#else
+            // Try to correct the hash
+            NEON_WARNING_TAG("Asset", "Asset file '{}' has a different hash than the one in meta file", AssetFile.string());
+            Metadata.SetHash(CurrentHash);
+            Metadata.SetDirty();
+#endif
+        }
+
+        IndexEntry Entry{
+            .MetaSize = MetaSize,
+            .MetaTime = MetaTime,
+            .Metadata = std::move(Metadata)
+        };
+        GetFileStamp(AssetFile, Entry.AssetSize, Entry.AssetTime);
+        return Entry;
+    }
+
+    //
+
+    static void WriteMetaTree(
+        IO::BinaryStreamWriter& Writer,
+        const AssetMetaData&    Tree)
+    {
+        Writer.Write(Tree.data());
+        Writer.Write(uint32_t(Tree.size()));
+        for (auto& [Key, Child] : Tree)
+        {
+            Writer.Write(Key);
+            WriteMetaTree(Writer, Child);
+        }
+    }
+
+    static void ReadMetaTree(
+        IO::BinaryStreamReader& Reader,
+        AssetMetaData&          Tree)
+    {
+        Tree.data() = Reader.Read<StringU8>();
+        auto Count  = Reader.Read<uint32_t>();
+        for (uint32_t i = 0; i < Count && Reader; i++)
+        {
+            auto  Key   = Reader.Read<StringU8>();
+            auto& Child = Tree.push_back({ std::move(Key), AssetMetaData() })->second;
+            ReadMetaTree(Reader, Child);
+        }
+    }
+
+    auto DirectoryAssetPackage::ReadIndex() const -> IndexMap
+    {
+        IndexMap Index;
+
+        std::ifstream File(m_IndexPath, std::ios::in | std::ios::binary);
+        if (!File.is_open())
+        {
+            return Index;
+        }
+
+        IO::BinaryStreamReader Reader(File);
+        if (Reader.Read<uint32_t>() != s_IndexMagic ||
+            Reader.Read<uint32_t>() != s_IndexVersion)
+        {
+            NEON_TRACE_TAG("Asset", "Package index of '{}' is outdated, rescanning", m_RootPath.string());
+            return Index;
+        }
+
+        auto Count = Reader.Read<uint32_t>();
+        Index.reserve(Count);
+        for (uint32_t i = 0; i < Count && Reader; i++)
+        {
+            auto Path = Reader.Read<StringU8>();
+
+            uint64_t MetaSize  = Reader.Read<uint64_t>();
+            int64_t  MetaTime  = Reader.Read<int64_t>();
+            uint64_t AssetSize = Reader.Read<uint64_t>();
+            int64_t  AssetTime = Reader.Read<int64_t>();
+
+            AssetMetaData Tree;
+            ReadMetaTree(Reader, Tree);
+
+            Index.emplace(
+                std::move(Path),
+                IndexEntry{
+                    .MetaSize  = MetaSize,
+                    .MetaTime  = MetaTime,
+                    .AssetSize = AssetSize,
+                    .AssetTime = AssetTime,
+                    .Metadata  = AssetMetaDataDef(std::move(Tree)) });
+        }
+
+        if (!Reader)
+        {
+            NEON_WARNING_TAG("Asset", "Package index of '{}' is corrupted, rescanning", m_RootPath.string());
+            Index.clear();
+        }
+        return Index;
+    }
+
+    void DirectoryAssetPackage::WriteIndex(
+        const IndexMap& Index) const
+    {
+        std::error_code Error;
+        std::filesystem::create_directories(m_IndexPath.parent_path(), Error);
+
+        std::ofstream File(m_IndexPath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            NEON_WARNING_TAG("Asset", "Failed to write package index of '{}'", m_RootPath.string());
+            return;
+        }
+
+        IO::BinaryStreamWriter Writer(File);
+        Writer.Write(s_IndexMagic);
+        Writer.Write(s_IndexVersion);
+        Writer.Write(uint32_t(Index.size()));
+
+        for (auto& [Path, Entry] : Index)
+        {
+            Writer.Write(Path);
+            Writer.Write(Entry.MetaSize);
+            Writer.Write(Entry.MetaTime);
+            Writer.Write(Entry.AssetSize);
+            Writer.Write(Entry.AssetTime);
+            WriteMetaTree(Writer, Entry.Metadata.GetMetaData());
+        }
+    }
 } // namespace Neon::Asset
@@ -75,7 +75,8 @@ namespace Neon::Asset
 
     Ptr<IAsset> MemoryAssetPackage::LoadAsset(
         const Asset::Handle& AssetGuid,
-        bool)
+        bool,
+        const CancellationToken&)
     {
         RWLock Lock(m_CacheMutex);
         auto   Iter = m_Cache.find(AssetGuid);
@@ -0,0 +1,292 @@
+#include <ResourcePCH.hpp>
+#include <Private/Asset/Residency.hpp>
+#include <Private/Asset/Storage.hpp>
+#include <Asset/Pack.hpp>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::Asset
+{
+    void Residency::SetBudget(
+        size_t Budget)
+    {
+        StorageImpl::Get()->GetResidency().SetBudget(Budget);
+    }
+
+    size_t Residency::GetBudget()
+    {
+        return StorageImpl::Get()->GetResidency().GetBudget();
+    }
+
+    void Residency::Trim()
+    {
+        StorageImpl::Get()->GetResidency().Trim();
+    }
+
+    ResidencyStats Residency::GetStats()
+    {
+        return StorageImpl::Get()->GetResidency().GetStats();
+    }
+
+    std::unordered_map<IAssetPackage*, ResidencyStats> Residency::GetPackageStats()
+    {
+        return StorageImpl::Get()->GetResidency().GetPackageStats();
+    }
+
+    std::unordered_map<size_t, ResidencyStats> Residency::GetLoaderStats()
+    {
+        return StorageImpl::Get()->GetResidency().GetLoaderStats();
+    }
+
+    //
+
+    void ResidencyManager::Track(
+        IAssetPackage* Package,
+        const Handle&  AssetGuid,
+        const IAsset*  Asset,
+        size_t         Size,
+        size_t         LoaderId)
+    {
+        bool OverBudget = false;
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            auto& Entries     = m_Packages[Package];
+            auto& LoaderStats = m_LoaderStats[LoaderId];
+
+            // Reloaded after an unload we did not see, replace the stale entry
+            if (auto Iter = Entries.Entries.find(AssetGuid); Iter != Entries.Entries.end())
+            {
+                RemoveEntry(Entries, Iter->second);
+            }
+
+            m_Lru.emplace_front(Package, AssetGuid, Asset, LoaderId, Size, ++m_Generation);
+            Entries.Entries.emplace(AssetGuid, m_Lru.begin());
+
+            for (auto Stats : { &Entries.Stats, &LoaderStats })
+            {
+                Stats->ResidentBytes += Size;
+                Stats->ResidentCount++;
+                Stats->Misses++;
+            }
+
+            m_ResidentBytes += Size;
+            OverBudget = m_ResidentBytes > m_Budget;
+        }
+
+        if (OverBudget)
+        {
+            Trim();
+        }
+    }
+
+    void ResidencyManager::Touch(
+        IAssetPackage* Package,
+        const Handle&  AssetGuid)
+    {
+        std::scoped_lock Lock(m_Mutex);
+
+        auto& Entries = m_Packages[Package];
+        Entries.Stats.Hits++;
+
+        if (auto Iter = Entries.Entries.find(AssetGuid); Iter != Entries.Entries.end())
+        {
+            m_LoaderStats[Iter->second->LoaderId].Hits++;
+            m_Lru.splice(m_Lru.begin(), m_Lru, Iter->second);
+        }
+    }
+
+    void ResidencyManager::Forget(
+        IAssetPackage* Package)
+    {
+        std::scoped_lock Lock(m_Mutex);
+
+        auto Iter = m_Packages.find(Package);
+        if (Iter == m_Packages.end())
+        {
+            return;
+        }
+
+        while (!Iter->second.Entries.empty())
+        {
+            RemoveEntry(Iter->second, Iter->second.Entries.begin()->second);
+        }
+        m_Packages.erase(Iter);
+    }
+
+    //
+
+    void ResidencyManager::SetBudget(
+        size_t Budget)
+    {
+        bool OverBudget = false;
+        {
+            std::scoped_lock Lock(m_Mutex);
+            m_Budget   = Budget;
+            OverBudget = m_ResidentBytes > m_Budget;
+        }
+
+        if (OverBudget)
+        {
+            Trim();
+        }
+    }
+
+    size_t ResidencyManager::GetBudget() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+        return m_Budget;
+    }
+
+    void ResidencyManager::Trim()
+    {
+        // A single trim at a time is enough, the others would compete for the same candidates
+        std::unique_lock TrimLock(m_TrimMutex, std::try_to_lock);
+        if (!TrimLock)
+        {
+            return;
+        }
+
+        // Snapshot the candidates, so loads only wait for one eviction at a time rather than the whole trim
+        std::vector<Entry> Candidates;
+        {
+            std::scoped_lock Lock(m_Mutex);
+            if (m_ResidentBytes <= m_Budget)
+            {
+                return;
+            }
+
+            Candidates.reserve(m_Lru.size());
+            for (auto& CurEntry : m_Lru | std::views::reverse)
+            {
+                Candidates.emplace_back(CurEntry);
+            }
+        }
+
+        size_t EvictedCount = 0, EvictedBytes = 0;
+        for (auto& Candidate : Candidates)
+        {
+            std::scoped_lock Lock(m_Mutex);
+
+            auto& Entries = m_Packages[Candidate.Package];
+            auto  Iter    = Entries.Entries.find(Candidate.AssetGuid);
+
+            // Skip entries that were reloaded since the snapshot, before touching the package's cache
+            if (Iter == Entries.Entries.end() || Iter->second->Generation != Candidate.Generation)
+            {
+                continue;
+            }
+
+            switch (TryEvict(*Iter->second))
+            {
+            case EvictResult::Evicted:
+            {
+                Entries.Stats.Evictions++;
+                m_LoaderStats[Candidate.LoaderId].Evictions++;
+
+                EvictedCount++;
+                EvictedBytes += Candidate.Size;
+                RemoveEntry(Entries, Iter->second);
+                break;
+            }
+            case EvictResult::Missing:
+            {
+                RemoveEntry(Entries, Iter->second);
+                break;
+            }
+            case EvictResult::Pinned:
+            {
+                // Still referenced, so it is in use
+                m_Lru.splice(m_Lru.begin(), m_Lru, Iter->second);
+                break;
+            }
+            }
+
+            if (m_ResidentBytes <= m_Budget)
+            {
+                break;
+            }
+        }
+
+        if (EvictedCount)
+        {
+            NEON_TRACE_TAG("Asset", "Evicted {} assets ({} bytes) to fit the residency budget", EvictedCount, EvictedBytes);
+        }
+    }
+
+    //
+
+    ResidencyStats ResidencyManager::GetStats() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+
+        ResidencyStats Total;
+        for (auto& Entries : m_Packages | std::views::values)
+        {
+            Total.ResidentBytes += Entries.Stats.ResidentBytes;
+            Total.ResidentCount += Entries.Stats.ResidentCount;
+            Total.Hits += Entries.Stats.Hits;
+            Total.Misses += Entries.Stats.Misses;
+            Total.Evictions += Entries.Stats.Evictions;
+        }
+        return Total;
+    }
+
+    std::unordered_map<IAssetPackage*, ResidencyStats> ResidencyManager::GetPackageStats() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+
+        std::unordered_map<IAssetPackage*, ResidencyStats> Stats;
+        for (auto& [Package, Entries] : m_Packages)
+        {
+            Stats.emplace(Package, Entries.Stats);
+        }
+        return Stats;
+    }
+
+    std::unordered_map<size_t, ResidencyStats> ResidencyManager::GetLoaderStats() const
+    {
+        std::scoped_lock Lock(m_Mutex);
+        return m_LoaderStats;
+    }
+
+    //
+
+    auto ResidencyManager::TryEvict(
+        const Entry& Tracked) -> EvictResult
+    {
+        IAssetPackage::RWLock Lock(Tracked.Package->m_CacheMutex);
+
+        // A copy loaded again after an unload we did not see is not tracked yet, its insert replaces this entry
+        auto Iter = Tracked.Package->m_Cache.find(Tracked.AssetGuid);
+        if (Iter == Tracked.Package->m_Cache.end() || Iter->second.get() != Tracked.Asset)
+        {
+            return EvictResult::Missing;
+        }
+
+        // Referenced outside of the cache, or holding changes that were not saved yet
+        if (Iter->second.use_count() > 1 || Iter->second->IsDirty())
+        {
+            return EvictResult::Pinned;
+        }
+
+        Tracked.Package->m_Cache.erase(Iter);
+        return EvictResult::Evicted;
+    }
+
+    void ResidencyManager::RemoveEntry(
+        PackageEntries&     Entries,
+        EntryList::iterator Iter)
+    {
+        auto& LoaderStats = m_LoaderStats[Iter->LoaderId];
+        for (auto Stats : { &Entries.Stats, &LoaderStats })
+        {
+            Stats->ResidentBytes -= Iter->Size;
+            Stats->ResidentCount--;
+        }
+
+        m_ResidentBytes -= Iter->Size;
+        Entries.Entries.erase(Iter->AssetGuid);
+        m_Lru.erase(Iter);
+    }
+} // namespace Neon::Asset
\ No newline at end of file
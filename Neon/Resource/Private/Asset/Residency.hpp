@@ -0,0 +1,136 @@
+#pragma once
+
+#include <Asset/Residency.hpp>
+#include <Asset/Handle.hpp>
+
+#include <list>
+#include <mutex>
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// Tracks the assets cached by the packages in least recently used order, and evicts the unreferenced
+    /// ones once their size exceeds the budget.
+    /// Eviction only drops the package's reference, so the next load reads the asset again.
+    /// </summary>
+    class ResidencyManager
+    {
+        struct Entry
+        {
+            IAssetPackage* Package;
+            Handle         AssetGuid;
+            const IAsset*  Asset;
+            size_t         LoaderId;
+            size_t         Size;
+            uint64_t       Generation;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        struct PackageEntries
+        {
+            std::unordered_map<Handle, EntryList::iterator> Entries;
+            ResidencyStats                                  Stats;
+        };
+
+        enum class EvictResult : uint8_t
+        {
+            Evicted,
+            Pinned,
+            Missing
+        };
+
+    public:
+        ResidencyManager() = default;
+        NEON_CLASS_NO_COPYMOVE(ResidencyManager);
+        ~ResidencyManager() = default;
+
+        /// <summary>
+        /// Track an asset that was loaded into a package's cache, evicting others if the budget is exceeded.
+        /// </summary>
+        void Track(
+            IAssetPackage* Package,
+            const Handle&  AssetGuid,
+            const IAsset*  Asset,
+            size_t         Size,
+            size_t         LoaderId);
+
+        /// <summary>
+        /// Mark an asset as recently used.
+        /// </summary>
+        void Touch(
+            IAssetPackage* Package,
+            const Handle&  AssetGuid);
+
+        /// <summary>
+        /// Stop tracking every asset of a package.
+        /// </summary>
+        void Forget(
+            IAssetPackage* Package);
+
+    public:
+        /// <summary>
+        /// Set the budget in bytes.
+        /// </summary>
+        void SetBudget(
+            size_t Budget);
+
+        /// <summary>
+        /// Get the budget in bytes.
+        /// </summary>
+        [[nodiscard]] size_t GetBudget() const;
+
+        /// <summary>
+        /// Evict unreferenced assets until the resident bytes fit in the budget.
+        /// </summary>
+        void Trim();
+
+    public:
+        /// <summary>
+        /// Get the stats of every package combined.
+        /// </summary>
+        [[nodiscard]] ResidencyStats GetStats() const;
+
+        /// <summary>
+        /// Get the stats of each package.
+        /// </summary>
+        [[nodiscard]] std::unordered_map<IAssetPackage*, ResidencyStats> GetPackageStats() const;
+
+        /// <summary>
+        /// Get the stats of each loader.
+        /// </summary>
+        [[nodiscard]] std::unordered_map<size_t, ResidencyStats> GetLoaderStats() const;
+
+    private:
+        /// <summary>
+        /// Drop the package's reference to an asset if it is still the tracked copy and nothing else references it.
+        /// The lock must be held, it is taken before the package's cache lock.
+        /// </summary>
+        [[nodiscard]] static EvictResult TryEvict(
+            const Entry& Tracked);
+
+        /// <summary>
+        /// Remove an entry and its bytes from the stats.
+        /// The lock must be held.
+        /// </summary>
+        void RemoveEntry(
+            PackageEntries&     Entries,
+            EntryList::iterator Iter);
+
+    private:
+        mutable std::mutex m_Mutex;
+        std::mutex         m_TrimMutex;
+
+        /// <summary>
+        /// Most recently used first.
+        /// </summary>
+        EntryList m_Lru;
+
+        std::unordered_map<IAssetPackage*, PackageEntries> m_Packages;
+        std::unordered_map<size_t, ResidencyStats>         m_LoaderStats;
+
+        size_t   m_Budget        = Residency::s_Unlimited;
+        uint64_t m_ResidentBytes = 0;
+        uint64_t m_Generation    = 0;
+    };
+} // namespace Neon::Asset
\ No newline at end of file
@@ -158,6 +158,11 @@ namespace Neon::Asset
         return &m_Manager;
     }
 
+    ResidencyManager& StorageImpl::GetResidency()
+    {
+        return m_Residency;
+    }
+
     StorageImpl::StorageImpl()
     {
         Mount(UPtr<IAssetPackage>(NEON_NEW MemoryAssetPackage));
@@ -165,9 +170,9 @@ namespace Neon::Asset
 
     StorageImpl::~StorageImpl() = default;
 
-    Asio::ThreadPool<>& StorageImpl::GetThreadPool()
+    Asio::JobGroup& StorageImpl::GetJobs()
     {
-        return m_ThreadPool;
+        return m_Jobs;
     }
 
     std::future<void> StorageImpl::SaveAsset(
@@ -197,12 +202,30 @@ namespace Neon::Asset
         }
 #endif
 
+        {
+            // The memory package is searched first, so its assets shadow the others
+            std::unique_lock Lock(m_PackageIndexMutex);
+            if (Package == m_Packages.front().get())
+            {
+                m_PackageIndex.insert_or_assign(Desc.Asset->GetGuid(), Package);
+            }
+            else
+            {
+                m_PackageIndex.try_emplace(Desc.Asset->GetGuid(), Package);
+            }
+        }
+
         return Package->SaveAsset(Desc.Asset);
     }
 
     void StorageImpl::RemoveAsset(
         const Handle& AssetGuid)
     {
+        {
+            std::unique_lock Lock(m_PackageIndexMutex);
+            m_PackageIndex.erase(AssetGuid);
+        }
+
         for (auto& Package : m_Packages)
         {
             if (Package->RemoveAsset(AssetGuid))
@@ -265,17 +288,39 @@ namespace Neon::Asset
     IAssetPackage* StorageImpl::Mount(
         UPtr<IAssetPackage> Package)
     {
-        return m_Packages.emplace_back(std::move(Package)).get();
+        auto MountedPackage = m_Packages.emplace_back(std::move(Package)).get();
+        IndexPackage(MountedPackage);
+        return MountedPackage;
     }
 
     void StorageImpl::Unmount(
         IAssetPackage* Package)
     {
+        {
+            std::unique_lock Lock(m_PackageIndexMutex);
+            std::erase_if(
+                m_PackageIndex, [Package](const auto& Entry)
+                { return Entry.second == Package; });
+        }
+
+        m_Residency.Forget(Package);
         std::erase_if(
             m_Packages, [Package](const auto& CurPackage)
             { return CurPackage.get() == Package; });
     }
 
+    void StorageImpl::IndexPackage(
+        IAssetPackage* Package)
+    {
+        std::unique_lock Lock(m_PackageIndexMutex);
+
+        // Packages mounted first are searched first, so keep the existing entries
+        for (auto& AssetGuid : Package->GetAssets())
+        {
+            m_PackageIndex.try_emplace(AssetGuid, Package);
+        }
+    }
+
     //
 
     Asio::CoGenerator<IAssetPackage*> StorageImpl::GetPackages(
@@ -317,10 +362,32 @@ namespace Neon::Asset
         bool          IncludeNonMemoryOnly,
         bool          IncludeMemoryOnly)
     {
+        auto IsIncluded = [&](IAssetPackage* Package)
+        {
+            return Package == m_Packages.front().get() ? IncludeMemoryOnly : IncludeNonMemoryOnly;
+        };
+
+        IAssetPackage* IndexedPackage = nullptr;
+        {
+            std::shared_lock Lock(m_PackageIndexMutex);
+            if (auto Iter = m_PackageIndex.find(AssetGuid); Iter != m_PackageIndex.end())
+            {
+                IndexedPackage = Iter->second;
+            }
+        }
+
+        // Packages can gain or lose assets behind our back, so the index is only a hint
+        if (IndexedPackage && IsIncluded(IndexedPackage) && IndexedPackage->ContainsAsset(AssetGuid))
+        {
+            return IndexedPackage;
+        }
+
         for (auto& Package : GetPackages(IncludeNonMemoryOnly, IncludeMemoryOnly))
         {
             if (Package->ContainsAsset(AssetGuid))
             {
+                std::unique_lock Lock(m_PackageIndexMutex);
+                m_PackageIndex.insert_or_assign(AssetGuid, Package);
                 return Package;
             }
         }
@@ -2,8 +2,10 @@
 
 #include <Asset/Storage.hpp>
 #include <Private/Asset/Manager.hpp>
-#include <Asio/ThreadPool.hpp>
+#include <Private/Asset/Residency.hpp>
+#include <Asio/JobSystem.hpp>
 #include <mutex>
+#include <shared_mutex>
 
 namespace Neon::Asset
 {
@@ -22,14 +24,19 @@ namespace Neon::Asset
         /// </summary>
         [[nodiscard]] ManagerImpl* GetManager();
 
+        /// <summary>
+        /// Gets the residency manager.
+        /// </summary>
+        [[nodiscard]] ResidencyManager& GetResidency();
+
         StorageImpl();
         NEON_CLASS_NO_COPYMOVE(StorageImpl);
         ~StorageImpl();
 
         /// <summary>
-        /// Gets the thread pool used by the storage system.
+        /// Gets the group of the storage system's jobs, they are completed before the storage is destroyed.
         /// </summary>
-        [[nodiscard]] Asio::ThreadPool<>& GetThreadPool();
+        [[nodiscard]] Asio::JobGroup& GetJobs();
 
     public:
         /// <summary>
@@ -109,7 +116,8 @@ namespace Neon::Asset
 
     public:
         /// <summary>
-        /// Finds an asset by guid.
+        /// Finds the package of an asset by guid.
+        /// Resolved through the package index, packages are only scanned on a miss.
         /// </summary>
         [[nodiscard]] IAssetPackage* FindPackage(
             const Handle& AssetGuid,
@@ -132,11 +140,22 @@ namespace Neon::Asset
             bool            IncludeNonMemoryOnly,
             bool            IncludeMemoryOnly);
 
+    private:
+        /// <summary>
+        /// Add the assets of a package to the package index.
+        /// </summary>
+        void IndexPackage(
+            IAssetPackage* Package);
+
     private:
         AssetPackageList                      m_Packages;
         std::map<size_t, UPtr<IAssetHandler>> m_Handlers;
 
-        ManagerImpl        m_Manager;
-        Asio::ThreadPool<> m_ThreadPool;
+        std::unordered_map<Handle, IAssetPackage*> m_PackageIndex;
+        std::shared_mutex                          m_PackageIndexMutex;
+
+        ResidencyManager m_Residency;
+        ManagerImpl      m_Manager;
+        Asio::JobGroup   m_Jobs;
     };
 } // namespace Neon::Asset
\ No newline at end of file
@@ -42,12 +42,22 @@ namespace Neon::Asset
         void MarkDirty(
             bool IsDirty = true) noexcept;
 
+        /// <summary>
+        /// Get the approximate number of bytes the asset keeps in memory, used by the residency budget.
+        /// </summary>
+        [[nodiscard]] virtual size_t GetResidentSize() const noexcept;
+
     protected:
         StringU8     m_AssetPath;
         const Handle m_AssetGuid;
         bool         m_IsDirty = true;
     };
 
+    /// <summary>
+    /// Pending asset load, shared by every requester of the same asset.
+    /// </summary>
+    using AssetFuture = std::shared_future<Ptr<IAsset>>;
+
     //
 
     template<typename _Ty = IAsset>
@@ -57,7 +67,7 @@ namespace Neon::Asset
         AssetTaskPtr() = default;
 
         AssetTaskPtr(
-            std::future<Ptr<IAsset>> Asset) :
+            AssetFuture Asset) :
             m_Asset(std::move(Asset))
         {
         }
@@ -71,7 +81,7 @@ namespace Neon::Asset
         //
 
         void operator=(
-            std::future<Ptr<IAsset>> Asset) noexcept
+            AssetFuture Asset) noexcept
         {
             m_Asset = std::move(Asset);
         }
@@ -120,7 +130,7 @@ namespace Neon::Asset
 
     private:
         mutable std::variant<
-            std::future<Ptr<IAsset>>,
+            AssetFuture,
             Ptr<_Ty>>
             m_Asset;
     };
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// Shared flag used to cancel asset loads, copies refer to the same flag.
+    /// A default constructed token is empty and can never be cancelled.
+    /// </summary>
+    class CancellationToken
+    {
+        struct State;
+
+    public:
+        CancellationToken() = default;
+
+        /// <summary>
+        /// Create a new token that can be cancelled.
+        /// </summary>
+        [[nodiscard]] static CancellationToken Create();
+
+        /// <summary>
+        /// Cancel the token and the tokens linked to it once all of their sources are cancelled.
+        /// </summary>
+        void Cancel() const;
+
+        /// <summary>
+        /// Check if the token was cancelled.
+        /// </summary>
+        [[nodiscard]] bool IsCancelled() const noexcept;
+
+        /// <summary>
+        /// Check if the token can be cancelled.
+        /// </summary>
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return m_State != nullptr;
+        }
+
+        /// <summary>
+        /// Make Dependent a token shared by multiple requesters: it gets cancelled once this token,
+        /// and every other token linked to it, are cancelled.
+        /// Linking an empty token pins Dependent, so it is never cancelled.
+        /// </summary>
+        void Link(
+            const CancellationToken& Dependent) const;
+
+    private:
+        Ptr<State> m_State;
+    };
+} // namespace Neon::Asset
\ No newline at end of file
@@ -43,6 +43,24 @@ namespace Neon::Asset
             DependencyWriter&  DepWriter,
             const Ptr<IAsset>& Asset,
             AssetMetaData&     LoaderData) = 0;
+
+        /// <summary>
+        /// Get the version of the data written by this handler.
+        /// Bump it whenever the output of Save changes so offline cooked assets get rebuilt.
+        /// </summary>
+        virtual uint32_t GetVersion() const
+        {
+            return 0;
+        }
+
+        /// <summary>
+        /// Query if Save writes the asset back as it was read from its source file.
+        /// Offline cookers pack such assets as-is, without loading them.
+        /// </summary>
+        virtual bool IsPassthrough() const
+        {
+            return false;
+        }
     };
 
     //
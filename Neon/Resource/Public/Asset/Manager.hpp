@@ -1,30 +1,51 @@
 #pragma once
 
-#include <Asset/Handle.hpp>
+#include <Asset/Asset.hpp>
+#include <Asset/Cancellation.hpp>
 #include <future>
 
 namespace Neon::Asset
 {
-    class IAsset;
     class IAssetPackage;
 
+    enum class LoadPriority : uint8_t
+    {
+        /// <summary>
+        /// Needed this frame, runs before any other queued load.
+        /// </summary>
+        Critical,
+        Normal,
+        /// <summary>
+        /// Speculative load, runs only when nothing more urgent is queued.
+        /// </summary>
+        Prefetch,
+
+        Count
+    };
+
     class Manager
     {
     public:
         /// <summary>
         /// Load asynchronously an asset from the storage system.
+        /// Concurrent requests for the same asset share a single load, which is cancelled once every requester's token is.
         /// </summary>
-        static std::future<Ptr<IAsset>> LoadAsync(
-            IAssetPackage* Package,
-            const Handle&  AssetGuid,
-            bool           LoadTemp = false);
+        static AssetFuture LoadAsync(
+            IAssetPackage*           Package,
+            const Handle&            AssetGuid,
+            bool                     LoadTemp = false,
+            LoadPriority             Priority = LoadPriority::Normal,
+            const CancellationToken& Token    = {});
 
         /// <summary>
         /// Load asynchronously an asset from the storage system.
+        /// Concurrent requests for the same asset share a single load, which is cancelled once every requester's token is.
         /// </summary>
-        static std::future<Ptr<IAsset>> LoadAsync(
-            const Handle& AssetGuid,
-            bool          LoadTemp = false);
+        static AssetFuture LoadAsync(
+            const Handle&            AssetGuid,
+            bool                     LoadTemp = false,
+            LoadPriority             Priority = LoadPriority::Normal,
+            const CancellationToken& Token    = {});
 
         /// <summary>
         /// Load an asset from the storage system.
@@ -44,8 +65,9 @@ namespace Neon::Asset
         /// <summary>
         /// Load or reload asynchronously an asset from the storage system.
         /// </summary>
-        static std::future<Ptr<IAsset>> ReloadAsync(
-            const Handle& AssetGuid);
+        static AssetFuture ReloadAsync(
+            const Handle& AssetGuid,
+            LoadPriority  Priority = LoadPriority::Normal);
 
         /// <summary>
         /// Load or reload an asset from the storage system.
@@ -28,12 +28,23 @@ namespace Neon::Asset
             const Handle& AssetGuid,
             StringU8      Path);
 
+        /// <summary>
+        /// Creating an asset's metadata from an already parsed tree.
+        /// </summary>
+        AssetMetaDataDef(
+            AssetMetaData MetaData);
+
         /// <summary>
         /// Export the asset's metadata.
         /// </summary>
         void Export(
             std::ofstream& Stream);
 
+        /// <summary>
+        /// Get the asset's metadata tree.
+        /// </summary>
+        [[nodiscard]] const AssetMetaData& GetMetaData() const noexcept;
+
         /// <summary>
         /// Get the asset's GUID.
         /// </summary>
@@ -2,10 +2,13 @@
 
 #include <Asset/Asset.hpp>
 #include <Asset/Metadata.hpp>
+#include <Asset/Cancellation.hpp>
 #include <Asio/Coroutines.hpp>
 
 #include <unordered_map>
 #include <shared_mutex>
+#include <filesystem>
+#include <optional>
 #include <future>
 
 namespace Neon::Asset
@@ -14,6 +17,8 @@ namespace Neon::Asset
     {
         friend class StorageImpl;
         friend class ManagerImpl;
+        friend class LoadScheduler;
+        friend class ResidencyManager;
 
     protected:
         using AssetCacheMap = std::unordered_map<Asset::Handle, Ptr<IAsset>>;
@@ -49,6 +54,16 @@ namespace Neon::Asset
         [[nodiscard]] virtual Asio::CoGenerator<Asset::Handle> FindAssets(
             const StringU8& PathRegex) const = 0;
 
+        /// <summary>
+        /// Get the last write time of an asset's source file.
+        /// Returns nullopt for packages whose assets cannot change once mounted.
+        /// </summary>
+        [[nodiscard]] virtual std::optional<std::filesystem::file_time_type> GetWriteTime(
+            const Asset::Handle& AssetGuid) const
+        {
+            return std::nullopt;
+        }
+
     public:
         /// <summary>
         /// Export this package to the filesystem.
@@ -70,10 +85,12 @@ namespace Neon::Asset
     protected:
         /// <summary>
         /// Load an asset from this package.
+        /// The load, including its dependencies, stops and returns null once Token is cancelled.
         /// </summary>
         [[nodiscard]] virtual Ptr<IAsset> LoadAsset(
-            const Asset::Handle& AssetGuid,
-            bool                 LoadTemp) = 0;
+            const Asset::Handle&     AssetGuid,
+            bool                     LoadTemp,
+            const CancellationToken& Token) = 0;
 
         /// <summary>
         /// Unload an asset from this package.
@@ -82,6 +99,23 @@ namespace Neon::Asset
             const Asset::Handle& AssetGuid,
             bool                 Force) = 0;
 
+    protected:
+        /// <summary>
+        /// Report a load served from the cache, so the asset is kept resident longer.
+        /// Must not be called with the cache lock held, the residency manager takes it while evicting.
+        /// </summary>
+        void OnCacheHit(
+            const Asset::Handle& AssetGuid);
+
+        /// <summary>
+        /// Report an asset added to the cache, so it counts towards the residency budget.
+        /// Must not be called with the cache lock held, as the residency manager takes it while evicting.
+        /// </summary>
+        void OnCacheInsert(
+            const Asset::Handle& AssetGuid,
+            const Ptr<IAsset>&   Asset,
+            size_t               LoaderId);
+
     protected:
         AssetCacheMap             m_Cache;
         mutable std::shared_mutex m_CacheMutex;
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <Asset/Pack.hpp>
+#include <filesystem>
+
+namespace boost::interprocess
+{
+    class file_mapping;
+    class mapped_region;
+} // namespace boost::interprocess
+
+namespace Neon::Asset
+{
+    /// <summary>
+    /// Read only asset package backed by a single memory mapped archive file.
+    /// The archive starts with a table of contents sorted by asset guid, followed by the assets' data.
+    /// </summary>
+    class ArchiveAssetPackage : public IAssetPackage
+    {
+    public:
+        static constexpr uint32_t s_Magic   = 0x4B41504E; // 'NPAK'
+        static constexpr uint32_t s_Version = 1;
+
+        static constexpr size_t s_HashLength = 64;
+        static constexpr size_t s_DataAlign  = 16;
+
+        struct ArchiveHeader
+        {
+            uint32_t Magic;
+            uint32_t Version;
+            uint32_t AssetCount;
+            uint32_t DependencyCount;
+
+            uint64_t StringsOffset;
+            uint64_t StringsSize;
+        };
+
+        struct ArchiveEntry
+        {
+            uint8_t  Guid[16];
+            uint64_t Offset;
+            uint64_t Size;
+            uint64_t LoaderId;
+            char     Hash[s_HashLength];
+            uint32_t DependencyIndex;
+            uint32_t DependencyCount;
+            uint32_t PathOffset;
+            uint32_t PathSize;
+            uint32_t LoaderDataOffset;
+            uint32_t LoaderDataSize;
+        };
+
+        static_assert(sizeof(ArchiveHeader) % alignof(ArchiveEntry) == 0);
+        static_assert(sizeof(ArchiveEntry) % alignof(ArchiveEntry) == 0);
+
+        class Writer;
+
+    public:
+        ArchiveAssetPackage(
+            std::filesystem::path Path);
+
+        NEON_CLASS_NO_COPYMOVE(ArchiveAssetPackage);
+
+        ~ArchiveAssetPackage() override;
+
+        [[nodiscard]] Asio::CoGenerator<const Asset::Handle&> GetAssets() override;
+
+        bool ContainsAsset(
+            const Asset::Handle& AssetGuid) const override;
+
+    public:
+        Asset::Handle FindAsset(
+            const StringU8& Path) const override;
+
+        Asio::CoGenerator<Asset::Handle> FindAssets(
+            const StringU8& PathRegex) const override;
+
+    public:
+        std::future<void> Export() override;
+
+        std::future<void> SaveAsset(
+            Ptr<IAsset> Asset) override;
+
+        bool RemoveAsset(
+            const Asset::Handle& AssetGuid) override;
+
+    protected:
+        Ptr<IAsset> LoadAsset(
+            const Asset::Handle&     AssetGuid,
+            bool                     LoadTemp,
+            const CancellationToken& Token) override;
+
+        bool UnloadAsset(
+            const Asset::Handle& AssetGuid,
+            bool                 Force) override;
+
+    private:
+        /// <summary>
+        /// Find an entry in the table of contents by guid.
+        /// </summary>
+        [[nodiscard]] const ArchiveEntry* FindEntry(
+            const Asset::Handle& AssetGuid) const;
+
+        /// <summary>
+        /// Get the dependencies of an entry.
+        /// </summary>
+        [[nodiscard]] std::span<const Asset::Handle> GetDependencies(
+            const ArchiveEntry& Entry) const;
+
+        /// <summary>
+        /// Get a string from the strings table.
+        /// </summary>
+        [[nodiscard]] StringU8View GetString(
+            uint32_t Offset,
+            uint32_t Size) const;
+
+    private:
+        std::filesystem::path                      m_Path;
+        UPtr<boost::interprocess::file_mapping>    m_File;
+        UPtr<boost::interprocess::mapped_region>   m_Region;
+        std::span<const ArchiveEntry>              m_Entries;
+        std::span<const Asset::Handle>             m_Dependencies;
+        std::span<const uint8_t>                   m_Data;
+        std::unordered_map<StringU8View, uint32_t> m_AssetPath;
+    };
+
+    /// <summary>
+    /// Builds an archive file that can be mounted with ArchiveAssetPackage.
+    /// </summary>
+    class ArchiveAssetPackage::Writer
+    {
+    public:
+        struct Entry
+        {
+            Asset::Handle              Guid;
+            StringU8                   Path;
+            size_t                     LoaderId = 0;
+            StringU8                   Hash;
+            AssetMetaData              LoaderData;
+            std::vector<Asset::Handle> Dependencies;
+            std::vector<uint8_t>       Data;
+        };
+
+        /// <summary>
+        /// Add an asset to the archive.
+        /// </summary>
+        void AddAsset(
+            Entry AssetEntry);
+
+        /// <summary>
+        /// Write the archive to a file.
+        /// </summary>
+        bool Write(
+            const std::filesystem::path& Path) const;
+
+    private:
+        std::vector<Entry> m_Entries;
+    };
+} // namespace Neon::Asset
\ No newline at end of file
@@ -10,9 +10,45 @@ namespace Neon::Asset
         using AssetMetaMap = std::unordered_map<Handle, AssetMetaDataDef>;
         using AssetPathMap = std::unordered_map<StringU8, Handle>;
 
+        struct IndexEntry
+        {
+            uint64_t         MetaSize;
+            int64_t          MetaTime;
+            uint64_t         AssetSize;
+            int64_t          AssetTime;
+            AssetMetaDataDef Metadata;
+        };
+
+        using IndexMap = std::unordered_map<StringU8, IndexEntry>;
+
     public:
+        static constexpr uint32_t    s_IndexMagic     = 0x5844494E; // 'NIDX'
+        static constexpr uint32_t    s_IndexVersion   = 1;
+        static constexpr const char* s_IndexExtension = ".assetindex";
+
+        static constexpr size_t s_LegacyHashLength = 64;
+
+        enum class ScanMode : uint8_t
+        {
+            /// <summary>
+            /// Files whose size and write time match the package index are neither parsed nor hashed.
+            /// </summary>
+            Cached,
+
+            /// <summary>
+            /// Ignore the package index, parse and rehash every file.
+            /// </summary>
+            Validate
+        };
+
+        /// <summary>
+        /// The package index is written to IndexPath, never to the content directory.
+        /// If empty, it is kept in the temp directory, keyed by the package's absolute path.
+        /// </summary>
         DirectoryAssetPackage(
-            std::filesystem::path Path);
+            std::filesystem::path Path,
+            ScanMode              Mode      = ScanMode::Cached,
+            std::filesystem::path IndexPath = {});
 
         [[nodiscard]] Asio::CoGenerator<const Asset::Handle&> GetAssets() override;
 
@@ -26,6 +62,9 @@ namespace Neon::Asset
         Asio::CoGenerator<Asset::Handle> FindAssets(
             const StringU8& PathRegex) const override;
 
+        std::optional<std::filesystem::file_time_type> GetWriteTime(
+            const Asset::Handle& AssetGuid) const override;
+
     public:
         std::future<void> Export() override;
 
@@ -42,10 +81,17 @@ namespace Neon::Asset
         const Asset::Handle& GetGuidOfPath(
             const StringU8& Path) const;
 
+        /// <summary>
+        /// Get a copy of the asset's metadata, or nullopt if not found.
+        /// </summary>
+        [[nodiscard]] std::optional<AssetMetaDataDef> GetMetadata(
+            const Asset::Handle& AssetGuid) const;
+
     protected:
         Ptr<IAsset> LoadAsset(
-            const Asset::Handle& AssetGuid,
-            bool                 LoadTemp) override;
+            const Asset::Handle&     AssetGuid,
+            bool                     LoadTemp,
+            const CancellationToken& Token) override;
 
         bool UnloadAsset(
             const Asset::Handle& AssetGuid,
@@ -58,8 +104,28 @@ namespace Neon::Asset
         void ExportMeta(
             AssetMetaDataDef& Meta);
 
+        /// <summary>
+        /// Parse and validate a meta file and its asset file, or take them from the index if they did not change.
+        /// </summary>
+        [[nodiscard]] std::optional<IndexEntry> ScanMetaFile(
+            const std::filesystem::path& MetafilePath,
+            const IndexMap&              Index,
+            bool&                        FromIndex) const;
+
+        /// <summary>
+        /// Read the package index, returns an empty map if it does not exist or is outdated.
+        /// </summary>
+        [[nodiscard]] IndexMap ReadIndex() const;
+
+        /// <summary>
+        /// Write the package index.
+        /// </summary>
+        void WriteIndex(
+            const IndexMap& Index) const;
+
     private:
         std::filesystem::path m_RootPath;
+        std::filesystem::path m_IndexPath;
         AssetMetaMap          m_AssetMeta;
         AssetPathMap          m_AssetPath;
     };
@@ -30,8 +30,9 @@ namespace Neon::Asset
 
     protected:
         Ptr<IAsset> LoadAsset(
-            const Asset::Handle& AssetGuid,
-            bool                 LoadTemp) override;
+            const Asset::Handle&     AssetGuid,
+            bool                     LoadTemp,
+            const CancellationToken& Token) override;
 
         bool UnloadAsset(
             const Asset::Handle& AssetGuid,
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Core/Neon.hpp>
+#include <unordered_map>
+#include <limits>
+
+namespace Neon::Asset
+{
+    class IAssetPackage;
+
+    struct ResidencyStats
+    {
+        /// <summary>
+        /// Approximate number of bytes held by the resident assets.
+        /// </summary>
+        uint64_t ResidentBytes = 0;
+
+        /// <summary>
+        /// Number of resident assets.
+        /// </summary>
+        uint64_t ResidentCount = 0;
+
+        /// <summary>
+        /// Number of loads served from a package's cache.
+        /// </summary>
+        uint64_t Hits = 0;
+
+        /// <summary>
+        /// Number of loads that had to read the asset.
+        /// </summary>
+        uint64_t Misses = 0;
+
+        /// <summary>
+        /// Number of assets evicted to stay within the budget.
+        /// </summary>
+        uint64_t Evictions = 0;
+    };
+
+    class Residency
+    {
+    public:
+        static constexpr size_t s_Unlimited = std::numeric_limits<size_t>::max();
+
+        /// <summary>
+        /// Set the budget in bytes of the assets cached by the packages.
+        /// Once exceeded, unreferenced assets are evicted from the least recently used, and reloaded on their next load.
+        /// </summary>
+        static void SetBudget(
+            size_t Budget);
+
+        /// <summary>
+        /// Get the budget in bytes of the assets cached by the packages.
+        /// </summary>
+        [[nodiscard]] static size_t GetBudget();
+
+        /// <summary>
+        /// Evict unreferenced assets until the resident bytes fit in the budget.
+        /// </summary>
+        static void Trim();
+
+        /// <summary>
+        /// Get the stats of every package combined.
+        /// </summary>
+        [[nodiscard]] static ResidencyStats GetStats();
+
+        /// <summary>
+        /// Get the stats of each package.
+        /// </summary>
+        [[nodiscard]] static std::unordered_map<IAssetPackage*, ResidencyStats> GetPackageStats();
+
+        /// <summary>
+        /// Get the stats of each loader, indexed by handler id.
+        /// </summary>
+        [[nodiscard]] static std::unordered_map<size_t, ResidencyStats> GetLoaderStats();
+    };
+} // namespace Neon::Asset
\ No newline at end of file
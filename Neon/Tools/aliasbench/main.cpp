@@ -0,0 +1,245 @@
+#include <Allocator/AliasPlanner.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t s_Megabyte = 1024 * 1024;
+
+#define ALIASBENCH_CHECK(Condition)                                                  \
+    if (!(Condition))                                                                \
+    {                                                                                \
+        std::printf("%s: check failed: %s (line %d)\n", Name, #Condition, __LINE__); \
+        return false;                                                                \
+    }
+
+    /// <summary>
+    /// Two resources that are never alive together share their memory, with a barrier at the second one's first use.
+    /// </summary>
+    bool DisjointTest()
+    {
+        const char* Name = "disjoint";
+
+        Allocator::AliasPlanner Planner;
+        auto                    First  = Planner.Add({ .Size = 1024, .Alignement = 256, .FirstUse = 0, .LastUse = 1 });
+        auto                    Second = Planner.Add({ .Size = 512, .Alignement = 256, .FirstUse = 2, .LastUse = 3 });
+        Planner.Build();
+
+        ALIASBENCH_CHECK(Planner.Validate());
+        ALIASBENCH_CHECK(Planner.GetHeapSizes().size() == 1);
+        ALIASBENCH_CHECK(Planner.GetTotalSize() == 1024);
+        ALIASBENCH_CHECK(Planner.GetPlacement(Second).Offset == 0);
+
+        auto Barriers = Planner.GetBarriers(2);
+        ALIASBENCH_CHECK(Barriers.size() == 1);
+        ALIASBENCH_CHECK(Barriers[0].Before == First && Barriers[0].After == Second);
+
+        // The first resource takes the memory back from the second one on the next frame
+        Barriers = Planner.GetBarriers(0);
+        ALIASBENCH_CHECK(Barriers.size() == 1);
+        ALIASBENCH_CHECK(Barriers[0].Before == Allocator::AliasPlanner::s_NullResource && Barriers[0].After == First);
+        return true;
+    }
+
+    /// <summary>
+    /// Resources alive at the same time are placed next to each other, at aligned offsets.
+    /// </summary>
+    bool OverlapTest()
+    {
+        const char* Name = "overlap";
+
+        Allocator::AliasPlanner Planner;
+        auto                    First  = Planner.Add({ .Size = 1000, .Alignement = 1, .FirstUse = 0, .LastUse = 2 });
+        auto                    Second = Planner.Add({ .Size = 100, .Alignement = 4096, .FirstUse = 2, .LastUse = 4 });
+        Planner.Build();
+
+        ALIASBENCH_CHECK(Planner.Validate());
+        ALIASBENCH_CHECK(Planner.GetPlacement(First).Offset == 0);
+        ALIASBENCH_CHECK(Planner.GetPlacement(Second).Offset == 4096);
+        ALIASBENCH_CHECK(Planner.GetBarriers().empty());
+        ALIASBENCH_CHECK(Planner.GetTotalSize() == 4196);
+        ALIASBENCH_CHECK(Planner.GetLowerBound() == 1100);
+        return true;
+    }
+
+    /// <summary>
+    /// A resource placed over two dead ones needs a barrier for each of them, but not for the ones they replaced.
+    /// </summary>
+    bool BarrierTest()
+    {
+        const char* Name = "barrier";
+
+        Allocator::AliasPlanner Planner;
+        auto                    Big    = Planner.Add({ .Size = 200, .FirstUse = 0, .LastUse = 0 });
+        auto                    Left   = Planner.Add({ .Size = 100, .FirstUse = 1, .LastUse = 2 });
+        auto                    Right  = Planner.Add({ .Size = 100, .FirstUse = 2, .LastUse = 2 });
+        auto                    Merged = Planner.Add({ .Size = 150, .FirstUse = 3, .LastUse = 3 });
+        Planner.Build();
+
+        ALIASBENCH_CHECK(Planner.Validate());
+        ALIASBENCH_CHECK(Planner.GetTotalSize() == 200);
+
+        auto Barriers = Planner.GetBarriers(3);
+        ALIASBENCH_CHECK(Barriers.size() == 2);
+        for (auto& Barrier : Barriers)
+        {
+            ALIASBENCH_CHECK(Barrier.After == Merged);
+            ALIASBENCH_CHECK(Barrier.Before == Left || Barrier.Before == Right);
+        }
+
+        ALIASBENCH_CHECK(Planner.GetBarriers(1).size() == 1 && Planner.GetBarriers(1)[0].Before == Big);
+        return true;
+    }
+
+    /// <summary>
+    /// Resources that don't fit in the max heap size go in new heaps.
+    /// </summary>
+    bool HeapTest()
+    {
+        const char* Name = "heap";
+
+        Allocator::AliasPlanner Planner(1000);
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            (void)Planner.Add({ .Size = 400, .FirstUse = 0, .LastUse = 1 });
+        }
+        auto Large = Planner.Add({ .Size = 3000, .FirstUse = 0, .LastUse = 0 });
+        Planner.Build();
+
+        ALIASBENCH_CHECK(Planner.Validate());
+        ALIASBENCH_CHECK(Planner.GetHeapSizes().size() == 3);
+        ALIASBENCH_CHECK(Planner.GetHeapSizes()[Planner.GetPlacement(Large).Heap] == 3000);
+        for (size_t HeapSize : Planner.GetHeapSizes())
+        {
+            ALIASBENCH_CHECK(HeapSize <= 1000 || HeapSize == 3000);
+        }
+        return true;
+    }
+
+#undef ALIASBENCH_CHECK
+
+    //
+
+    /// <summary>
+    /// Transients of a synthetic frame: render targets, depth buffers and buffers of a 1080p or 4k frame, most of
+    /// them only read by the next few passes.
+    /// </summary>
+    void RandomGraph(
+        std::mt19937&            Engine,
+        Allocator::AliasPlanner& Planner,
+        uint32_t                 PassCount,
+        uint32_t                 ResourceCount)
+    {
+        constexpr size_t s_Sizes[]{
+            1920 * 1080 * 4, 1920 * 1080 * 8, 1920 * 1080 * 16, 960 * 540 * 8, 480 * 270 * 8,
+            3840 * 2160 * 4, 3840 * 2160 * 8, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024
+        };
+
+        std::uniform_int_distribution<size_t>   SizeIndex(0, std::size(s_Sizes) - 1);
+        std::uniform_int_distribution<uint32_t> FirstUse(0, PassCount - 1);
+        std::geometric_distribution<uint32_t>   Length(0.35);
+        std::bernoulli_distribution             IsTexture(0.7);
+
+        Planner.Clear();
+        for (uint32_t i = 0; i < ResourceCount; i++)
+        {
+            uint32_t First = FirstUse(Engine);
+            (void)Planner.Add({ .Size       = s_Sizes[SizeIndex(Engine)],
+                                .Alignement = IsTexture(Engine) ? size_t(64 * 1024) : size_t(256),
+                                .FirstUse   = First,
+                                .LastUse    = std::min(PassCount - 1, First + Length(Engine)) });
+        }
+    }
+
+    /// <summary>
+    /// Random graphs must always produce valid placements.
+    /// </summary>
+    bool RandomTest(
+        uint32_t Seed)
+    {
+        std::mt19937 Engine(Seed);
+        for (uint32_t Iter = 0; Iter < 500; Iter++)
+        {
+            Allocator::AliasPlanner Planner(Iter % 2 ? 0 : 64 * s_Megabyte);
+            RandomGraph(Engine, Planner, 4 + Iter % 40, 1 + Iter % 97);
+            Planner.Build();
+
+            if (!Planner.Validate() || Planner.GetTotalSize() > Planner.GetUnaliasedSize() + Planner.GetResources().size() * 64 * 1024)
+            {
+                std::printf("random: invalid plan for graph %u\n", Iter);
+                return false;
+            }
+
+            // Every barrier must go from a dead resource to one starting at the barrier's use
+            for (auto& Barrier : Planner.GetBarriers())
+            {
+                auto& After = Planner.GetResources()[Barrier.After];
+                if (After.FirstUse != Barrier.Use ||
+                    (Barrier.Before != Allocator::AliasPlanner::s_NullResource &&
+                     Planner.GetResources()[Barrier.Before].LastUse >= Barrier.Use))
+                {
+                    std::printf("random: invalid barrier for graph %u\n", Iter);
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 100;
+    uint32_t Seed       = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 1234;
+
+    std::printf("aliasbench: %zu iterations, seed %u\n", Iterations, Seed);
+
+    if (!DisjointTest() || !OverlapTest() || !BarrierTest() || !HeapTest() || !RandomTest(Seed))
+    {
+        return 1;
+    }
+    std::printf("tests passed\n");
+
+    std::mt19937 Engine(Seed);
+    for (auto [PassCount, ResourceCount] : { std::pair{ 16u, 32u }, std::pair{ 64u, 256u }, std::pair{ 256u, 1024u } })
+    {
+        Allocator::AliasPlanner Planner;
+        RandomGraph(Engine, Planner, PassCount, ResourceCount);
+
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            Planner.Build();
+        }
+        double Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Begin).count() / double(Iterations);
+
+        double Unaliased = double(Planner.GetUnaliasedSize()) / s_Megabyte;
+        double Aliased   = double(Planner.GetTotalSize()) / s_Megabyte;
+        double Bound     = double(Planner.GetLowerBound()) / s_Megabyte;
+
+        std::printf(
+            "%4u passes, %4u resources: %8.1f MB -> %7.1f MB (%4.1f%% saved, lower bound %7.1f MB), %3zu barriers, %.3f ms\n",
+            PassCount,
+            ResourceCount,
+            Unaliased,
+            Aliased,
+            100.0 * (1.0 - Aliased / Unaliased),
+            Bound,
+            Planner.GetBarriers().size(),
+            Elapsed);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,525 @@
+#include <Allocator/Buddy.hpp>
+#include <Allocator/TLSF.hpp>
+#include <Allocator/FrameRing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <new>
+#include <random>
+#include <thread>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Operation
+    {
+        size_t Size;
+        size_t Alignement;
+
+        /// <summary>
+        /// Index of the live allocation to free, or -1 to allocate.
+        /// </summary>
+        size_t FreeIndex;
+    };
+
+    /// <summary>
+    /// Generate a random mix of allocations and frees that keeps around LiveTarget allocations alive,
+    /// with sizes and alignments similar to the ones of GPU buffers and descriptors.
+    /// A quarter of the allocations are large ones of up to MaxSize.
+    /// </summary>
+    std::vector<Operation> GenerateOperations(
+        uint32_t Seed,
+        size_t   Count,
+        size_t   LiveTarget,
+        size_t   MaxSize = 65536)
+    {
+        std::mt19937_64 Engine(Seed);
+
+        std::vector<Operation> Operations;
+        Operations.reserve(Count);
+
+        size_t Live = 0;
+        for (size_t i = 0; i < Count; i++)
+        {
+            bool DoFree = Live && (Live >= LiveTarget * 2 || Engine() % (LiveTarget * 2) < Live);
+            if (DoFree)
+            {
+                Operations.push_back({ .FreeIndex = size_t(Engine() % Live) });
+                Live--;
+            }
+            else
+            {
+                size_t Size       = Engine() % 4 ? 1 + Engine() % 256 : 1 + Engine() % MaxSize;
+                size_t Alignement = size_t(1) << (Engine() % 9);
+                Operations.push_back({ .Size = Size, .Alignement = Alignement, .FreeIndex = size_t(-1) });
+                Live++;
+            }
+        }
+        return Operations;
+    }
+
+    /// <summary>
+    /// Replay the operations on an allocator and return the time it took.
+    /// Allocations that fail are skipped, along with their free.
+    /// </summary>
+    template<typename _AllocTy>
+    double Replay(
+        _AllocTy&                     Allocator,
+        const std::vector<Operation>& Operations,
+        size_t&                       Failures)
+    {
+        std::vector<typename _AllocTy::Handle> Live;
+        Live.reserve(Operations.size());
+
+        auto Begin = Clock::now();
+        for (auto& Op : Operations)
+        {
+            if (Op.FreeIndex == size_t(-1))
+            {
+                Live.push_back(Allocator.Allocate(Op.Size, Op.Alignement));
+                Failures += !Live.back();
+            }
+            else
+            {
+                if (Live[Op.FreeIndex])
+                {
+                    Allocator.Free(Live[Op.FreeIndex]);
+                }
+                Live[Op.FreeIndex] = Live.back();
+                Live.pop_back();
+            }
+        }
+        auto End = Clock::now();
+
+        for (auto& Hndl : Live)
+        {
+            if (Hndl)
+            {
+                Allocator.Free(Hndl);
+            }
+        }
+        return std::chrono::duration<double, std::milli>(End - Begin).count();
+    }
+
+    /// <summary>
+    /// Validate every allocation of a random run against a reference map of the live blocks:
+    /// blocks must be in range, aligned and never overlap, an allocation may only fail if no free range fits it, and
+    /// freeing everything must leave a single free block that can be allocated whole.
+    /// </summary>
+    bool StressTest(
+        uint32_t Seed,
+        size_t   Iterations,
+        size_t   HeapSize,
+        size_t   LiveTarget,
+        size_t   MaxSize)
+    {
+        Allocator::TLSFAllocator Allocator(HeapSize);
+        std::map<size_t, size_t> Reference;
+        std::vector<Allocator::TLSFAllocator::Handle> Live;
+
+        auto HasFreeRange = [&](size_t Size, size_t Alignement)
+        {
+            size_t Begin    = 0;
+            auto   RangeFits = [&](size_t End)
+            {
+                size_t Offset = Math::AlignUp(Begin, Alignement);
+                return Offset <= End && End - Offset >= Size;
+            };
+
+            for (auto& [Offset, BlockSize] : Reference)
+            {
+                if (RangeFits(Offset))
+                {
+                    return true;
+                }
+                Begin = Offset + BlockSize;
+            }
+            return RangeFits(HeapSize);
+        };
+
+        auto   Operations = GenerateOperations(Seed, Iterations, LiveTarget, MaxSize);
+        size_t UsedSize   = 0;
+        for (auto& Op : Operations)
+        {
+            if (Op.FreeIndex == size_t(-1))
+            {
+                auto Hndl = Allocator.Allocate(Op.Size, Op.Alignement);
+                Live.push_back(Hndl);
+                if (!Hndl)
+                {
+                    if (HasFreeRange(Math::AlignUp(Op.Size, Op.Alignement), Op.Alignement))
+                    {
+                        std::printf("stress: allocating %zu bytes failed while a free range fits it\n", Op.Size);
+                        return false;
+                    }
+                    continue;
+                }
+
+                if (Hndl.Offset % Op.Alignement || Hndl.Size < Op.Size || Hndl.Offset + Hndl.Size > HeapSize)
+                {
+                    std::printf("stress: invalid block at %zu (%zu bytes)\n", Hndl.Offset, Hndl.Size);
+                    return false;
+                }
+
+                auto Next = Reference.lower_bound(Hndl.Offset);
+                if ((Next != Reference.end() && Next->first < Hndl.Offset + Hndl.Size) ||
+                    (Next != Reference.begin() && std::prev(Next)->first + std::prev(Next)->second > Hndl.Offset))
+                {
+                    std::printf("stress: block at %zu (%zu bytes) overlaps\n", Hndl.Offset, Hndl.Size);
+                    return false;
+                }
+
+                Reference.emplace(Hndl.Offset, Hndl.Size);
+                UsedSize += Hndl.Size;
+            }
+            else
+            {
+                auto Hndl = Live[Op.FreeIndex];
+                Live[Op.FreeIndex] = Live.back();
+                Live.pop_back();
+                if (!Hndl)
+                {
+                    continue;
+                }
+
+                // Free with a handle rebuilt from offset and size, like the callers that only keep an id
+                Allocator.Free({ .Offset = Hndl.Offset, .Size = Hndl.Size });
+                Reference.erase(Hndl.Offset);
+                UsedSize -= Hndl.Size;
+            }
+
+            if (Allocator.GetStats().UsedSize != UsedSize)
+            {
+                std::printf("stress: used size mismatch\n");
+                return false;
+            }
+        }
+
+        for (auto& Hndl : Live)
+        {
+            if (Hndl)
+            {
+                Allocator.Free(Hndl);
+            }
+        }
+
+        auto Stats = Allocator.GetStats();
+        if (Stats.UsedSize || Stats.AllocationCount || Stats.FreeBlockCount != 1 || Stats.LargestFreeBlock != HeapSize)
+        {
+            std::printf("stress: the heap was not fully merged back\n");
+            return false;
+        }
+
+        if (!Allocator.Allocate(HeapSize))
+        {
+            std::printf("stress: the whole heap can't be allocated once freed\n");
+            return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Requests that fit a free block but not once rounded up to the next size class must still succeed.
+    /// </summary>
+    bool FitTest()
+    {
+        // The whole heap, with a size that is not a power of two
+        {
+            Allocator::TLSFAllocator Allocator(1000);
+            if (!Allocator.Allocate(1000))
+            {
+                std::printf("fit: allocating the whole heap failed\n");
+                return false;
+            }
+        }
+
+        // The remainder of a split block
+        {
+            Allocator::TLSFAllocator Allocator(65536);
+            auto                     First = Allocator.Allocate(30000);
+            if (!First || !Allocator.Allocate(35000) || Allocator.Allocate(537))
+            {
+                std::printf("fit: allocating the rest of the heap failed\n");
+                return false;
+            }
+        }
+
+        // The remainder of a split block, aligned
+        {
+            Allocator::TLSFAllocator Allocator(65536);
+            auto                     First = Allocator.Allocate(30000);
+            auto                     Rest  = Allocator.Allocate(35000, 16);
+            if (!First || !Rest || Rest.Offset % 16)
+            {
+                std::printf("fit: allocating the aligned rest of the heap failed\n");
+                return false;
+            }
+        }
+
+        // A whole heap that is not a power of two, once every allocation was freed
+        {
+            Allocator::TLSFAllocator                      Allocator(100'000);
+            std::vector<Allocator::TLSFAllocator::Handle> Live;
+            for (size_t Size : { 10'000, 333, 25'000, 7, 40'000 })
+            {
+                Live.push_back(Allocator.Allocate(Size, 8));
+            }
+            for (auto& Hndl : Live)
+            {
+                Allocator.Free(Hndl);
+            }
+            if (!Allocator.Allocate(100'000))
+            {
+                std::printf("fit: allocating the whole heap once freed failed\n");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Drive the frame ring with a CPU backend and a fence that lags a few frames behind.
+    /// Every allocation is filled with its own pattern, which must still be intact when its frame is completed,
+    /// so a page recycled too early or two allocations overlapping is caught.
+    /// </summary>
+    bool FrameRingTest(
+        uint32_t Seed,
+        size_t   FrameCount,
+        double&  Elapsed)
+    {
+        constexpr uint64_t FramesInFlight = 3;
+        constexpr size_t   ThreadCount    = 4;
+        constexpr size_t   PageSize       = 256 * 1024;
+
+        struct Record
+        {
+            uint8_t* CpuAddress;
+            size_t   Size;
+            uint8_t  Pattern;
+        };
+
+        size_t   CreatedPages   = 0;
+        size_t   DestroyedPages = 0;
+        uint64_t NextGpuAddress = 1 << 16;
+
+        Allocator::FrameRingAllocator Ring(
+            [&](size_t Size)
+            {
+                CreatedPages++;
+                auto Data = static_cast<uint8_t*>(::operator new(Size));
+
+                Allocator::FrameRingAllocator::PageMemory Memory{
+                    .Context    = Data,
+                    .CpuAddress = Data,
+                    .GpuAddress = NextGpuAddress,
+                    .Size       = Size
+                };
+                NextGpuAddress += Math::AlignUp(Size, size_t(1) << 16);
+                return Memory;
+            },
+            [&](const Allocator::FrameRingAllocator::PageMemory& Page)
+            {
+                DestroyedPages++;
+                ::operator delete(Page.Context);
+            },
+            PageSize);
+
+        std::deque<std::vector<Record>> InFlight;
+        std::atomic<bool>               Failed = false;
+
+        auto Begin = Clock::now();
+        for (uint64_t Frame = 1; Frame <= FrameCount && !Failed; Frame++)
+        {
+            // The oldest frame is completed by this BeginFrame, its memory must not have been touched until now
+            if (InFlight.size() >= FramesInFlight)
+            {
+                for (auto& Rec : InFlight.front())
+                {
+                    for (size_t i = 0; i < Rec.Size; i++)
+                    {
+                        if (Rec.CpuAddress[i] != Rec.Pattern)
+                        {
+                            std::printf("frame ring: allocation overwritten before its frame completed\n");
+                            return false;
+                        }
+                    }
+                }
+                InFlight.pop_front();
+            }
+
+            uint64_t Completed = Frame > FramesInFlight ? Frame - FramesInFlight : 0;
+            Ring.BeginFrame(Frame, Completed);
+
+            std::vector<std::vector<Record>> Records(ThreadCount);
+            {
+                std::vector<std::jthread> Threads;
+                for (size_t i = 0; i < ThreadCount; i++)
+                {
+                    Threads.emplace_back(
+                        [&, i]
+                        {
+                            std::mt19937 Engine(uint32_t(Seed + Frame * ThreadCount + i));
+                            size_t       Count = 64 + Engine() % 192;
+                            for (size_t j = 0; j < Count; j++)
+                            {
+                                size_t Size       = Engine() % 512 ? 1 + Engine() % 1024 : PageSize + Engine() % PageSize;
+                                size_t Alignement = size_t(1) << (Engine() % 9);
+
+                                auto Allocation = Ring.Allocate(Size, Alignement);
+                                if (!Allocation || Allocation.GpuAddress % Alignement || Allocation.Size != Size)
+                                {
+                                    Failed.store(true);
+                                    return;
+                                }
+
+                                uint8_t Pattern = uint8_t(Engine());
+                                std::memset(Allocation.CpuAddress, Pattern, Size);
+                                Records[i].push_back({ Allocation.CpuAddress, Size, Pattern });
+                            }
+                        });
+                }
+            }
+
+            auto& FrameRecords = InFlight.emplace_back();
+            for (auto& ThreadRecords : Records)
+            {
+                FrameRecords.insert(FrameRecords.end(), ThreadRecords.begin(), ThreadRecords.end());
+            }
+        }
+        Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Begin).count();
+
+        if (Failed)
+        {
+            std::printf("frame ring: invalid allocation\n");
+            return false;
+        }
+
+        // Once everything is completed, only the current page is still in use
+        Ring.BeginFrame(FrameCount + 1, FrameCount);
+        auto Stats = Ring.GetStats();
+        if (Stats.DedicatedCount || Stats.FreePageCount + 1 != Stats.PageCount)
+        {
+            std::printf("frame ring: pages were not recycled\n");
+            return false;
+        }
+
+        std::printf(
+            "frame ring: %zu frames, %zu pages, %zu pages created in total\n",
+            FrameCount,
+            Stats.PageCount,
+            CreatedPages);
+
+        Ring.Shutdown();
+        if (CreatedPages != DestroyedPages)
+        {
+            std::printf("frame ring: %zu pages leaked\n", CreatedPages - DestroyedPages);
+            return false;
+        }
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 1'000'000;
+    uint32_t Seed       = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 1234;
+
+    std::printf("allocbench: %zu operations, seed %u\n", Iterations, Seed);
+
+    if (!FitTest())
+    {
+        std::printf("fit test failed\n");
+        return 1;
+    }
+    std::printf("fit test passed\n");
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        if (!StressTest(Seed + i, Iterations / 4, size_t(1) << 24, 2048, 65536))
+        {
+            std::printf("stress test failed with seed %u\n", Seed + i);
+            return 1;
+        }
+
+        // Few allocations that are large compared to a heap whose size is not a power of two
+        if (!StressTest(Seed + i, Iterations / 16, 1'000'003, 8, 400'000))
+        {
+            std::printf("large stress test failed with seed %u\n", Seed + i);
+            return 1;
+        }
+    }
+    std::printf("stress test passed\n");
+
+    double RingTime = 0;
+    if (!FrameRingTest(Seed, std::max<size_t>(Iterations / 1000, 16), RingTime))
+    {
+        std::printf("frame ring test failed\n");
+        return 1;
+    }
+    std::printf("frame ring test passed in %.2f ms\n", RingTime);
+
+    constexpr size_t HeapSize = size_t(1) << 30;
+    for (size_t LiveTarget : { 256, 4096, 32768 })
+    {
+        auto Operations = GenerateOperations(Seed, Iterations, LiveTarget);
+
+        size_t                    BuddyFailures = 0;
+        Allocator::BuddyAllocator Buddy(HeapSize);
+        double                    BuddyTime = Replay(Buddy, Operations, BuddyFailures);
+
+        size_t                   TLSFFailures = 0;
+        Allocator::TLSFAllocator TLSF(HeapSize, LiveTarget * 2);
+        double                   TLSFTime = Replay(TLSF, Operations, TLSFFailures);
+
+        std::printf(
+            "%6zu live: buddy %8.2f ms (%zu failed), tlsf %8.2f ms (%zu failed), %.2fx\n",
+            LiveTarget,
+            BuddyTime,
+            BuddyFailures,
+            TLSFTime,
+            TLSFFailures,
+            BuddyTime / TLSFTime);
+    }
+
+    // Fragmentation after a long random run, measured while the allocations are still alive
+    {
+        Allocator::TLSFAllocator TLSF(size_t(1) << 26);
+        std::vector<Allocator::TLSFAllocator::Handle> Live;
+        for (auto& Op : GenerateOperations(Seed, Iterations, 4096))
+        {
+            if (Op.FreeIndex == size_t(-1))
+            {
+                Live.push_back(TLSF.Allocate(Op.Size, Op.Alignement));
+            }
+            else
+            {
+                TLSF.Free(Live[Op.FreeIndex]);
+                Live[Op.FreeIndex] = Live.back();
+                Live.pop_back();
+            }
+        }
+
+        auto Stats = TLSF.GetStats();
+        std::printf(
+            "tlsf: %zu allocations, %zu free blocks, utilization %.1f%%, fragmentation %.1f%%\n",
+            Stats.AllocationCount,
+            Stats.FreeBlockCount,
+            Stats.GetUtilization() * 100.f,
+            Stats.GetFragmentation() * 100.f);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+project "allocbench"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+    staticruntime "On"
+    architecture "x64"
+    
+	common_dir_setup()
+    common_neon()
\ No newline at end of file
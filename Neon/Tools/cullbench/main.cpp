@@ -0,0 +1,414 @@
+#include <Geometry/Culling.hpp>
+#include <Geometry/BVH.hpp>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// Perspective frustum with a random orientation and origin.
+    /// </summary>
+    Geometry::Frustum RandomFrustum(
+        std::mt19937& Engine)
+    {
+        std::uniform_real_distribution<float> Slope(0.2f, 2.f);
+        std::uniform_real_distribution<float> Unit(-1.f, 1.f);
+        std::uniform_real_distribution<float> Position(-100.f, 100.f);
+
+        Geometry::Frustum Fr;
+        Fr.RightSlope  = Slope(Engine);
+        Fr.LeftSlope   = -Slope(Engine);
+        Fr.TopSlope    = Slope(Engine);
+        Fr.BottomSlope = -Slope(Engine);
+        Fr.Near        = 0.1f;
+        Fr.Far         = 50.f + Slope(Engine) * 200.f;
+        Fr.Orientation = glm::normalize(Quaternion(Unit(Engine), Unit(Engine), Unit(Engine), Unit(Engine) + 0.01f));
+        Fr.Origin      = { Position(Engine), Position(Engine), Position(Engine) };
+        return Fr;
+    }
+
+    /// <summary>
+    /// Boxes spread around the frustums, some of them degenerate.
+    /// </summary>
+    Geometry::AABBList RandomBoxes(
+        std::mt19937& Engine,
+        size_t        Count,
+        float         WorldSize = 300.f)
+    {
+        std::uniform_real_distribution<float> Position(-WorldSize, WorldSize);
+        std::uniform_real_distribution<float> Extent(0.f, 20.f);
+
+        Geometry::AABBList Boxes;
+        Boxes.Reserve(Count);
+        for (size_t i = 0; i < Count; i++)
+        {
+            Geometry::AABB Box{
+                .Center  = { Position(Engine), Position(Engine), Position(Engine) },
+                .Extents = { Extent(Engine), Extent(Engine), Extent(Engine) }
+            };
+            if (i % 97 == 0)
+            {
+                Box.Extents = Vec::Zero<Vector3>;
+            }
+            Boxes.Add(Box);
+        }
+        return Boxes;
+    }
+
+    [[nodiscard]] bool IsSet(
+        const std::vector<uint64_t>& Visibility,
+        size_t                       Index)
+    {
+        return Visibility[Index / 64] & (uint64_t(1) << (Index % 64));
+    }
+
+    /// <summary>
+    /// The batch results must be the same as Frustum::Contains for every box, including the batches' tails.
+    /// </summary>
+    bool CompareTest(
+        uint32_t Seed)
+    {
+        std::mt19937 Engine(Seed);
+        for (size_t Count : { 0, 1, 3, 4, 7, 8, 63, 64, 65, 1000, 4099 })
+        {
+            for (int Iter = 0; Iter < 16; Iter++)
+            {
+                auto Fr    = RandomFrustum(Engine);
+                auto Boxes = RandomBoxes(Engine, Count);
+
+                Geometry::FrustumCuller Culler(Fr);
+                std::vector<uint64_t>   Visibility(Geometry::FrustumCuller::GetMaskSize(Count), ~uint64_t(0));
+                Culler.Cull(Boxes, Visibility);
+
+                for (size_t i = 0; i < Count; i++)
+                {
+                    bool Expected = Fr.Contains(Boxes.Get(i)) != Geometry::ContainmentType::Disjoint;
+                    if (IsSet(Visibility, i) != Expected)
+                    {
+                        std::printf("compare: box %zu of %zu is %s by the batch test\n", i, Count, Expected ? "culled" : "kept");
+                        return false;
+                    }
+                }
+                for (size_t i = Count; i < Visibility.size() * 64; i++)
+                {
+                    if (IsSet(Visibility, i))
+                    {
+                        std::printf("compare: bit %zu past the end of %zu boxes is set\n", i, Count);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Visible boxes from the tree: proxies fully inside are accepted, the others are tested with their exact box.
+    /// </summary>
+    size_t CullTree(
+        const Geometry::DynamicBVH&    Tree,
+        const Geometry::FrustumCuller& Culler,
+        const Geometry::AABBList&      Boxes,
+        Geometry::AABBList&            Candidates,
+        std::vector<uint64_t>&         CandidateIds,
+        std::vector<uint64_t>&         Visibility,
+        std::vector<uint64_t>&         Visible)
+    {
+        Visible.clear();
+        Candidates.Clear();
+        CandidateIds.clear();
+
+        Tree.QueryFrustum(
+            Culler.GetPlanes(),
+            [&](Geometry::DynamicBVH::ProxyId, uint64_t Index, bool Inside)
+            {
+                if (Inside)
+                {
+                    Visible.push_back(Index);
+                }
+                else
+                {
+                    Candidates.Add(Boxes.Get(Index));
+                    CandidateIds.push_back(Index);
+                }
+                return true;
+            });
+
+        Visibility.resize(Geometry::FrustumCuller::GetMaskSize(Candidates.GetSize()));
+        Culler.Cull(Candidates, Visibility);
+        for (size_t i = 0; i < CandidateIds.size(); i++)
+        {
+            if (IsSet(Visibility, i))
+            {
+                Visible.push_back(CandidateIds[i]);
+            }
+        }
+        return Visible.size();
+    }
+
+    /// <summary>
+    /// Insert, move and remove boxes in the tree, its structure must stay valid and frustum queries must find the same
+    /// boxes as the batch test.
+    /// </summary>
+    bool TreeTest(
+        uint32_t Seed)
+    {
+        std::mt19937                          Engine(Seed);
+        std::uniform_real_distribution<float> Step(-5.f, 5.f);
+
+        auto Boxes = RandomBoxes(Engine, 20'000);
+
+        Geometry::DynamicBVH                              Tree;
+        std::map<uint64_t, Geometry::DynamicBVH::ProxyId> Proxies;
+        for (size_t i = 0; i < Boxes.GetSize(); i++)
+        {
+            Proxies[i] = Tree.Insert(Boxes.Get(i), i);
+        }
+
+        Geometry::AABBList    Candidates;
+        std::vector<uint64_t> CandidateIds, Visibility, Visible, Expected;
+
+        for (int Iter = 0; Iter < 64; Iter++)
+        {
+            // Move some boxes a bit and some far away, remove and insert others
+            for (int i = 0; i < 500; i++)
+            {
+                uint64_t Index = Engine() % Boxes.GetSize();
+                auto     Box   = Boxes.Get(Index);
+                auto     Found = Proxies.find(Index);
+                if (Found == Proxies.end())
+                {
+                    Proxies[Index] = Tree.Insert(Box, Index);
+                    continue;
+                }
+
+                switch (Engine() % 4)
+                {
+                case 0:
+                    Tree.Remove(Found->second);
+                    Proxies.erase(Found);
+                    break;
+                case 1:
+                    Box.Center = RandomBoxes(Engine, 1).Get(0).Center;
+                    [[fallthrough]];
+                default:
+                    Box.Center += Vector3(Step(Engine), Step(Engine), Step(Engine));
+                    Tree.Move(Found->second, Box);
+                    Boxes.Set(Index, Box);
+                    break;
+                }
+            }
+
+            if (Iter == 32)
+            {
+                Tree.Rebuild();
+            }
+
+            if (!Tree.Validate())
+            {
+                std::printf("tree: invalid structure after %d iterations\n", Iter);
+                return false;
+            }
+
+            Geometry::FrustumCuller Culler(RandomFrustum(Engine));
+            CullTree(Tree, Culler, Boxes, Candidates, CandidateIds, Visibility, Visible);
+
+            Expected.clear();
+            for (auto& [Index, Proxy] : Proxies)
+            {
+                if (Culler.IsVisible(Boxes.Get(Index)))
+                {
+                    Expected.push_back(Index);
+                }
+            }
+
+            std::ranges::sort(Visible);
+            if (Visible != Expected)
+            {
+                std::printf("tree: %zu boxes found, %zu expected\n", Visible.size(), Expected.size());
+                return false;
+            }
+
+            // The query takes up to 64 planes, repeating the frustum's planes must find the same proxies
+            std::array<Math::Plane, 64> ManyPlanes;
+            for (size_t i = 0; i < ManyPlanes.size(); i++)
+            {
+                ManyPlanes[i] = Culler.GetPlanes()[i % Culler.GetPlanes().size()];
+            }
+
+            size_t ManyPlanesCount = 0;
+            Tree.QueryFrustum(
+                ManyPlanes,
+                [&](Geometry::DynamicBVH::ProxyId, uint64_t Index, bool Inside)
+                {
+                    ManyPlanesCount += Inside || Culler.IsVisible(Boxes.Get(Index));
+                    return true;
+                });
+            if (ManyPlanesCount != Expected.size())
+            {
+                std::printf("tree: %zu boxes found with 64 planes, %zu expected\n", ManyPlanesCount, Expected.size());
+                return false;
+            }
+        }
+
+        // Boxes that keep moving by less than the margin must not drift away from their siblings
+        std::uniform_real_distribution<float> Drift(-Geometry::DynamicBVH::s_DefaultMargin, Geometry::DynamicBVH::s_DefaultMargin);
+
+        auto DriftStats = Tree.GetStats();
+        for (int Iter = 0; Iter < 64; Iter++)
+        {
+            for (auto& [Index, Proxy] : Proxies)
+            {
+                auto Box = Boxes.Get(Index);
+                Box.Center += Vector3(Drift(Engine), Drift(Engine), Drift(Engine));
+                Tree.Move(Proxy, Box);
+                Boxes.Set(Index, Box);
+            }
+        }
+
+        auto Stats = Tree.GetStats();
+        if (!Tree.Validate() || Stats.AreaRatio > DriftStats.AreaRatio * 2.f)
+        {
+            std::printf("tree: area ratio went from %.1f to %.1f after drifting\n", DriftStats.AreaRatio, Stats.AreaRatio);
+            return false;
+        }
+
+        std::printf("tree passed: %zu proxies, height %u, area ratio %.1f\n", Stats.ProxyCount, Stats.Height, Stats.AreaRatio);
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   Count      = Argc > 1 ? size_t(std::atoll(Argv[1])) : 100'000;
+    size_t   Iterations = Argc > 2 ? size_t(std::atoll(Argv[2])) : 100;
+    uint32_t Seed       = Argc > 3 ? uint32_t(std::atoi(Argv[3])) : 1234;
+
+    std::printf("cullbench: %zu boxes, %zu iterations, seed %u\n", Count, Iterations, Seed);
+
+    if (!CompareTest(Seed))
+    {
+        return 1;
+    }
+    std::printf("compare passed\n");
+
+    if (!TreeTest(Seed))
+    {
+        return 1;
+    }
+
+    std::mt19937 Engine(Seed);
+
+    auto Fr    = RandomFrustum(Engine);
+    auto Boxes = RandomBoxes(Engine, Count);
+
+    std::vector<uint64_t> Visibility(Geometry::FrustumCuller::GetMaskSize(Count));
+
+    size_t VisibleCount = 0;
+    auto   Measure      = [&](const char* Name, auto&& Cull)
+    {
+        VisibleCount = 0;
+        auto Begin   = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            VisibleCount += Cull();
+        }
+        double Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Begin).count();
+        std::printf("%-22s %8.2f ms (%6.2f ns/box), %zu visible\n", Name, Elapsed, Elapsed * 1e6 / double(Count * Iterations), VisibleCount / Iterations);
+        return Elapsed;
+    };
+
+    // The previous scene update, the planes are rebuilt for every box
+    double FrustumTime = Measure(
+        "Frustum::Contains",
+        [&]
+        {
+            size_t Visible = 0;
+            for (size_t i = 0; i < Count; i++)
+            {
+                Visible += Fr.Contains(Boxes.Get(i)) != Geometry::ContainmentType::Disjoint;
+            }
+            return Visible;
+        });
+
+    auto CountVisible = [&]
+    {
+        size_t Visible = 0;
+        for (auto Word : Visibility)
+        {
+            Visible += std::popcount(Word);
+        }
+        return Visible;
+    };
+
+    double ScalarTime = Measure(
+        "FrustumCuller scalar",
+        [&]
+        {
+            Geometry::FrustumCuller(Fr).CullScalar(Boxes, Visibility);
+            return CountVisible();
+        });
+
+    double BatchTime = Measure(
+        "FrustumCuller batch",
+        [&]
+        {
+            Geometry::FrustumCuller(Fr).Cull(Boxes, Visibility);
+            return CountVisible();
+        });
+
+    std::printf("batch speedup: %.2fx over Frustum::Contains, %.2fx over scalar\n", FrustumTime / BatchTime, ScalarTime / BatchTime);
+
+    // Static props in a large world, most of them outside the view
+    Boxes = RandomBoxes(Engine, Count, 2000.f);
+
+    double WorldBatchTime = Measure(
+        "Batch, large world",
+        [&]
+        {
+            Geometry::FrustumCuller(Fr).Cull(Boxes, Visibility);
+            return CountVisible();
+        });
+
+    Geometry::DynamicBVH Tree;
+    for (size_t i = 0; i < Count; i++)
+    {
+        (void)Tree.Insert(Boxes.Get(i), i);
+    }
+
+    Geometry::AABBList    Candidates;
+    std::vector<uint64_t> CandidateIds, CandidateVisibility, Visible;
+
+    double TreeTime = Measure(
+        "DynamicBVH",
+        [&]
+        {
+            return CullTree(Tree, Geometry::FrustumCuller(Fr), Boxes, Candidates, CandidateIds, CandidateVisibility, Visible);
+        });
+
+    Tree.Rebuild();
+    double RebuiltTime = Measure(
+        "DynamicBVH rebuilt",
+        [&]
+        {
+            return CullTree(Tree, Geometry::FrustumCuller(Fr), Boxes, Candidates, CandidateIds, CandidateVisibility, Visible);
+        });
+
+    std::printf("tree speedup: %.2fx over batch (%.2fx rebuilt)\n", WorldBatchTime / TreeTime, WorldBatchTime / RebuiltTime);
+    return 0;
+}
\ No newline at end of file
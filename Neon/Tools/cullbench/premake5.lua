@@ -0,0 +1,14 @@
+project "cullbench"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+    staticruntime "On"
+    architecture "x64"
+    
+	common_dir_setup()
+    common_neon()
+
+    links
+    {
+        "NeonCore"
+    }
\ No newline at end of file
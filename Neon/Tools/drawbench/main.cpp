@@ -0,0 +1,410 @@
+#include <RenderGraph/DrawQueue.hpp>
+#include <Geometry/Culling.hpp>
+#include <Allocator/Arena.hpp>
+#include <Allocator/MemoryResource.hpp>
+#include <Asio/JobSystem.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include <set>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t s_PipelineCount = 16;
+    constexpr size_t s_MaterialCount = 64;
+    constexpr size_t s_MeshCount     = 256;
+    constexpr size_t s_ChunkSize     = 1024;
+
+    /// <summary>
+    /// Entity of the synthetic scene, the pointers are fake and never dereferenced.
+    /// Inside stands for the proxies that the spatial index reports fully inside the frustum.
+    /// </summary>
+    struct Entity
+    {
+        RG::DrawQueue::DrawItem    Item;
+        const RHI::IPipelineState* PipelineState;
+        bool                       Transparent;
+        float                      Dist;
+
+        Geometry::AABB  Box;
+        TransformMatrix Transform;
+        bool            Inside;
+    };
+
+    /// <summary>
+    /// Candidates culled by a single job, like SceneContext's cull chunks.
+    /// </summary>
+    struct CullChunk
+    {
+        Geometry::AABBList         Boxes;
+        std::vector<const Entity*> Entities;
+        std::vector<float>         Dists;
+        std::vector<uint64_t>      Visibility;
+    };
+
+    /// <summary>
+    /// Entities spread over a few pipelines, materials and submeshes, one material out of eight is transparent.
+    /// </summary>
+    std::vector<Entity> RandomScene(
+        std::mt19937&                  Engine,
+        size_t                         Count,
+        std::vector<std::max_align_t>& Storage)
+    {
+        Storage.resize(s_PipelineCount + s_MaterialCount + s_MeshCount * 2);
+
+        auto Address = [&](size_t Index)
+        {
+            return static_cast<void*>(&Storage[Index]);
+        };
+
+        std::uniform_int_distribution<size_t> Material(0, s_MaterialCount - 1);
+        std::uniform_int_distribution<size_t> Mesh(0, s_MeshCount - 1);
+        std::uniform_real_distribution<float> Dist(0.f, 1e6f);
+        std::uniform_real_distribution<float> Position(-300.f, 300.f);
+        std::uniform_real_distribution<float> Extent(0.5f, 5.f);
+
+        std::vector<Entity> Entities(Count);
+        for (size_t i = 0; i < Count; i++)
+        {
+            size_t MaterialIndex = Material(Engine);
+            size_t MeshIndex     = Mesh(Engine);
+
+            Entities[i] = {
+                .Item = {
+                    .Material   = static_cast<RHI::IMaterial*>(Address(s_PipelineCount + MaterialIndex)),
+                    .Model      = static_cast<const Mdl::Model*>(Address(s_PipelineCount + s_MaterialCount + MeshIndex / 16)),
+                    .Data       = static_cast<const Mdl::SubMeshData*>(Address(s_PipelineCount + s_MaterialCount + s_MeshCount + MeshIndex)),
+                    .InstanceId = uint32_t(i) },
+                .PipelineState = static_cast<const RHI::IPipelineState*>(Address(MaterialIndex % s_PipelineCount)),
+                .Transparent   = MaterialIndex % 8 == 0,
+                .Dist          = Dist(Engine),
+                .Box           = { .Extents = { Extent(Engine), Extent(Engine), Extent(Engine) } },
+                .Inside        = i % 4 == 0
+            };
+            Entities[i].Transform.SetPosition({ Position(Engine), Position(Engine), Position(Engine) });
+            Entities[i].Transform.SetScale(Vector3(Extent(Engine)));
+        }
+        return Entities;
+    }
+
+    /// <summary>
+    /// Fill the queue with one job per chunk, like SceneContext::Update.
+    /// </summary>
+    void FillQueue(
+        RG::DrawQueue&             Queue,
+        const std::vector<Entity>& Entities)
+    {
+        size_t ChunkCount = (Entities.size() + s_ChunkSize - 1) / s_ChunkSize;
+        Queue.Reset(ChunkCount);
+
+        Asio::JobGroup Jobs;
+        for (size_t i = 0; i < ChunkCount; i++)
+        {
+            Jobs.Run(
+                [&Queue, &Entities, i]
+                {
+                    size_t Last = std::min(Entities.size(), (i + 1) * s_ChunkSize);
+                    for (size_t j = i * s_ChunkSize; j < Last; j++)
+                    {
+                        auto& Ent = Entities[j];
+                        Queue.Add(i, Ent.Item, Ent.PipelineState, Ent.Transparent, Ent.Dist);
+                    }
+                },
+                { .priority = Asio::JobPriority::critical });
+        }
+        Jobs.Wait();
+
+        Queue.Build();
+    }
+
+    /// <summary>
+    /// Cull the entities like SceneContext::Update: each chunk computes the distances, transforms the boxes of the
+    /// entities that aren't fully inside and tests them at once before filling the queue.
+    /// The chunks run as jobs, or on the calling thread when Parallel is false.
+    /// </summary>
+    void CullScene(
+        RG::DrawQueue&                 Queue,
+        const std::vector<Entity>&     Entities,
+        const Geometry::FrustumCuller& Culler,
+        const Vector3&                 Eye,
+        std::vector<CullChunk>&        Chunks,
+        bool                           Parallel)
+    {
+        size_t ChunkCount = (Entities.size() + s_ChunkSize - 1) / s_ChunkSize;
+        if (Chunks.size() < ChunkCount)
+        {
+            Chunks.resize(ChunkCount);
+        }
+        Queue.Reset(ChunkCount);
+
+        auto CullTask = [&](size_t ChunkIndex)
+        {
+            auto& Chunk = Chunks[ChunkIndex];
+            Chunk.Boxes.Clear();
+            Chunk.Entities.clear();
+            Chunk.Dists.clear();
+
+            size_t Last = std::min(Entities.size(), (ChunkIndex + 1) * s_ChunkSize);
+            for (size_t i = ChunkIndex * s_ChunkSize; i < Last; i++)
+            {
+                auto& Ent = Entities[i];
+
+                float Dist = glm::distance2(Eye, Ent.Transform.GetPosition());
+                if (Ent.Inside)
+                {
+                    Queue.Add(ChunkIndex, Ent.Item, Ent.PipelineState, Ent.Transparent, Dist);
+                }
+                else
+                {
+                    auto Box = Ent.Box;
+                    Box.Transform(Ent.Transform);
+
+                    Chunk.Boxes.Add(Box);
+                    Chunk.Entities.push_back(&Ent);
+                    Chunk.Dists.push_back(Dist);
+                }
+            }
+
+            Chunk.Visibility.resize(Geometry::FrustumCuller::GetMaskSize(Chunk.Boxes.GetSize()));
+            Culler.Cull(Chunk.Boxes, Chunk.Visibility);
+
+            for (size_t i = 0; i < Chunk.Entities.size(); i++)
+            {
+                if (Chunk.Visibility[i / 64] & (uint64_t(1) << (i % 64)))
+                {
+                    auto& Ent = *Chunk.Entities[i];
+                    Queue.Add(ChunkIndex, Ent.Item, Ent.PipelineState, Ent.Transparent, Chunk.Dists[i]);
+                }
+            }
+        };
+
+        if (Parallel)
+        {
+            Asio::JobGroup Jobs;
+            for (size_t i = 0; i < ChunkCount; i++)
+            {
+                Jobs.Run(
+                    [&CullTask, i]
+                    { CullTask(i); },
+                    { .priority = Asio::JobPriority::critical });
+            }
+            Jobs.Wait();
+        }
+        else
+        {
+            for (size_t i = 0; i < ChunkCount; i++)
+            {
+                CullTask(i);
+            }
+        }
+
+        Queue.Build();
+    }
+
+    /// <summary>
+    /// Check that every entity is drawn once, that batches only merge identical draws, that the opaque draws come
+    /// first and that the instances of an opaque batch are sorted front to back.
+    /// </summary>
+    bool CheckQueue(
+        const RG::DrawQueue&       Queue,
+        const std::vector<Entity>& Entities)
+    {
+        auto InstanceIds = Queue.GetInstanceIds();
+        if (InstanceIds.size() != Entities.size())
+        {
+            std::printf("check: %zu instances, %zu expected\n", InstanceIds.size(), Entities.size());
+            return false;
+        }
+
+        std::vector<bool> Drawn(Entities.size());
+        bool              InTransparent = false;
+        uint32_t          Next          = 0;
+        for (auto& Batch : Queue.GetBatches())
+        {
+            if (Batch.FirstInstance != Next || !Batch.InstanceCount)
+            {
+                std::printf("check: batch at %u is not contiguous\n", Batch.FirstInstance);
+                return false;
+            }
+            Next += Batch.InstanceCount;
+
+            for (uint32_t i = Batch.FirstInstance; i < Next; i++)
+            {
+                auto& Ent = Entities[InstanceIds[i]];
+                if (Drawn[InstanceIds[i]] ||
+                    Ent.Item.Material != Batch.Material ||
+                    Ent.Item.Model != Batch.Model ||
+                    Ent.Item.Data != Batch.Data)
+                {
+                    std::printf("check: instance %u is drawn twice or with the wrong batch\n", InstanceIds[i]);
+                    return false;
+                }
+                Drawn[InstanceIds[i]] = true;
+
+                if (Ent.Transparent < InTransparent)
+                {
+                    std::printf("check: opaque instance %u is drawn after transparent ones\n", InstanceIds[i]);
+                    return false;
+                }
+                InTransparent = Ent.Transparent;
+
+                // The queue keeps the top 16 bits of the depth, in the low bits of the opaque keys
+                if (!Ent.Transparent && i > Batch.FirstInstance)
+                {
+                    auto& Prev      = Entities[InstanceIds[i - 1]];
+                    auto  PrevDepth = RG::DrawQueue::MakeKey(Prev.Item, Prev.PipelineState, false, Prev.Dist) & 0xFFFF;
+                    auto  Depth     = RG::DrawQueue::MakeKey(Ent.Item, Ent.PipelineState, false, Ent.Dist) & 0xFFFF;
+                    if (Depth < PrevDepth)
+                    {
+                        std::printf("check: opaque instance %u is drawn before a nearer one\n", InstanceIds[i]);
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    //
+
+    /// <summary>
+    /// The previous scene context, one sorted set of entities per pipeline state.
+    /// </summary>
+    struct EntityInfo
+    {
+        uint32_t Id;
+        float    Dist;
+
+        auto operator<=>(const EntityInfo& Other) const noexcept
+        {
+            return Dist <=> Other.Dist;
+        }
+    };
+
+    using EntityList      = std::pmr::set<EntityInfo>;
+    using EntityListGroup = std::pmr::map<const RHI::IPipelineState*, EntityList>;
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 10;
+    uint32_t Seed       = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 1234;
+
+    Asio::JobSystem::Initialize();
+
+    std::printf("drawbench: %zu iterations, seed %u, %u workers\n", Iterations, Seed, Asio::JobSystem::GetWorkerCount());
+
+    std::mt19937                  Engine(Seed);
+    std::vector<std::max_align_t> Storage;
+
+    // A 90 degree frustum at the center of the scene, looking down +Z
+    Geometry::Frustum Fr;
+    Fr.Near = 0.1f;
+    Fr.Far  = 300.f;
+
+    Geometry::FrustumCuller Culler(Fr);
+
+    for (size_t Count : { 10'000, 100'000, 1'000'000 })
+    {
+        auto Entities = RandomScene(Engine, Count, Storage);
+
+        RG::DrawQueue Queue;
+        FillQueue(Queue, Entities);
+        if (!CheckQueue(Queue, Entities))
+        {
+            Asio::JobSystem::Shutdown();
+            return 1;
+        }
+
+        auto Measure = [&](const char* Name, auto&& Build)
+        {
+            auto Begin = Clock::now();
+            for (size_t i = 0; i < Iterations; i++)
+            {
+                Build();
+            }
+            double Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Begin).count() / double(Iterations);
+            std::printf("  %-20s %8.2f ms (%6.2f ns/entity)\n", Name, Elapsed, Elapsed * 1e6 / double(Count));
+            return Elapsed;
+        };
+
+        std::printf("%zu entities\n", Count);
+
+        Allocator::LinearArena   Arena;
+        Allocator::ArenaResource Resource{ Arena };
+        EntityListGroup          EntityLists{ &Resource };
+
+        double SetTime = Measure(
+            "std::set lists",
+            [&]
+            {
+                EntityLists.clear();
+                Arena.Reset();
+                for (auto& Ent : Entities)
+                {
+                    EntityLists[Ent.PipelineState].emplace(Ent.Item.InstanceId, Ent.Dist);
+                }
+            });
+
+        double QueueTime = Measure(
+            "DrawQueue",
+            [&]
+            {
+                FillQueue(Queue, Entities);
+            });
+
+        size_t SetDraws = 0;
+        for (auto& List : EntityLists | std::views::values)
+        {
+            SetDraws += List.size();
+        }
+
+        std::printf("  speedup: %.2fx, draw calls: %zu -> %zu\n", SetTime / QueueTime, SetDraws, Queue.GetBatches().size());
+
+        // The chunks are concatenated in order, culling them on one thread or as jobs must give the same draws
+        std::vector<CullChunk> Chunks;
+        RG::DrawQueue          SerialQueue;
+        CullScene(SerialQueue, Entities, Culler, Fr.Origin, Chunks, false);
+        CullScene(Queue, Entities, Culler, Fr.Origin, Chunks, true);
+        if (!std::ranges::equal(SerialQueue.GetInstanceIds(), Queue.GetInstanceIds()))
+        {
+            std::printf("check: the chunk jobs culled a different set of draws\n");
+            Asio::JobSystem::Shutdown();
+            return 1;
+        }
+
+        double SerialCullTime = Measure(
+            "cull, one thread",
+            [&]
+            {
+                CullScene(SerialQueue, Entities, Culler, Fr.Origin, Chunks, false);
+            });
+
+        double CullTime = Measure(
+            "cull, chunk jobs",
+            [&]
+            {
+                CullScene(Queue, Entities, Culler, Fr.Origin, Chunks, true);
+            });
+
+        std::printf("  cull speedup: %.2fx, %zu of %zu visible\n", SerialCullTime / CullTime, Queue.GetDrawCount(), Count);
+    }
+
+    Asio::JobSystem::Shutdown();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+project "drawbench"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+    staticruntime "On"
+    architecture "x64"
+    
+	common_dir_setup()
+    common_neon()
+
+    link_engine_library()
\ No newline at end of file
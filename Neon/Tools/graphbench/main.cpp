@@ -0,0 +1,439 @@
+#include <RenderGraph/Compiler.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// Name of the pass at an index, the names outlive the declarations that point to them.
+    /// </summary>
+    StringU8View PassName(
+        uint32_t Index)
+    {
+        static std::deque<StringU8> s_Names;
+        while (s_Names.size() <= Index)
+        {
+            s_Names.emplace_back(StringUtils::Format("Pass{}", s_Names.size()));
+        }
+        return s_Names[Index];
+    }
+
+    /// <summary>
+    /// Chain of passes where each one creates a texture and reads a few of the previous ones, the last pass writes
+    /// the imported output image. Textures are written as render targets or unordered access, and read by pixel or
+    /// non-pixel shaders, sometimes a single mip. Passes are spread over levels of up to four passes.
+    /// </summary>
+    RG::GraphDeclaration RandomGraph(
+        std::mt19937& Engine,
+        uint32_t      PassCount)
+    {
+        RG::GraphDeclaration Graph;
+        Graph.Imported.emplace(StringU8("OutputImage"));
+
+        constexpr RHI::EResourceState s_WriteStates[]{ RHI::EResourceState::RenderTarget, RHI::EResourceState::UnorderedAccess };
+        constexpr RHI::EResourceState s_ReadStates[]{ RHI::EResourceState::PixelShaderResource, RHI::EResourceState::NonPixelShaderResource };
+
+        std::uniform_int_distribution<size_t>   Type(0, 7);
+        std::uniform_int_distribution<uint32_t> State(0, 1);
+        std::uniform_int_distribution<uint32_t> Subresource(0, 3);
+        std::bernoulli_distribution             NextLevel(0.3);
+
+        uint32_t LevelStart = 0;
+        for (uint32_t i = 0; i < PassCount; i++)
+        {
+            if (i - LevelStart == 4 || (i && NextLevel(Engine)))
+            {
+                LevelStart = i;
+            }
+
+            auto& Pass = Graph.Passes.emplace_back();
+            Pass.Type  = Type(Engine);
+            Pass.Name  = PassName(i);
+
+            RG::ResourceId Id(StringUtils::Format("Texture{}", i));
+            Pass.Created.emplace(Id);
+            Pass.Written.emplace(Id);
+            Pass.States.emplace_back(Id, RHI::Resource_AllSubresources, RHI::MResourceState::FromEnum(s_WriteStates[State(Engine)]));
+
+            // Only the textures of the previous levels can be read
+            for (uint32_t j = 0; LevelStart && j < 3; j++)
+            {
+                std::uniform_int_distribution<uint32_t> Previous(0, LevelStart - 1);
+
+                RG::ResourceId Read(StringUtils::Format("Texture{}", Previous(Engine)));
+                Pass.Read.emplace(Read);
+
+                uint32_t Index = Subresource(Engine);
+                Pass.States.emplace_back(
+                    Read,
+                    Index < 3 ? RHI::Resource_AllSubresources : Index,
+                    RHI::MResourceState::FromEnum(s_ReadStates[State(Engine)]));
+            }
+        }
+
+        RG::ResourceId Output(StringU8("OutputImage"));
+        Graph.Passes.back().Written.emplace(Output);
+        Graph.Passes.back().States.emplace_back(Output, RHI::Resource_AllSubresources, RHI::MResourceState::FromEnum(RHI::EResourceState::RenderTarget));
+        return Graph;
+    }
+
+    //
+
+#define GRAPHBENCH_CHECK(Condition)                                        \
+    if (!(Condition))                                                      \
+    {                                                                      \
+        std::printf("check failed: %s (line %d)\n", #Condition, __LINE__); \
+        return false;                                                      \
+    }
+
+    /// <summary>
+    /// Rebuilding the same structure hits and finds the graph a fresh compilation gives, changing a pass's resources or
+    /// name misses and toggling a feature back hits again.
+    /// </summary>
+    bool CacheTest(
+        std::mt19937& Engine)
+    {
+        RG::GraphCache    Cache(2);
+        RG::GraphCompiler Compiler;
+
+        auto Graph     = RandomGraph(Engine, 16);
+        auto Structure = RG::GraphCompiler::GetStructure(Graph);
+
+        GRAPHBENCH_CHECK(!Cache.Find(Structure));
+        Cache.Insert(Structure, Compiler.Compile(Graph));
+
+        auto Hit = Cache.Find(RG::GraphCompiler::GetStructure(Graph));
+        GRAPHBENCH_CHECK(Hit && Hit->HasSameLayout(Compiler.Compile(Graph)));
+        GRAPHBENCH_CHECK(Hit->GetPassCount() && Hit->GetLevelCount() && !Hit->GetLifetimes().empty());
+
+        // A feature toggle removes the reads of a pass
+        auto Toggled = Graph;
+        Toggled.Passes[8].Read.clear();
+        auto ToggledStructure = RG::GraphCompiler::GetStructure(Toggled);
+
+        GRAPHBENCH_CHECK(ToggledStructure.GetHash() != Structure.GetHash());
+        GRAPHBENCH_CHECK(!Cache.Find(ToggledStructure));
+        Cache.Insert(ToggledStructure, Compiler.Compile(Toggled));
+        GRAPHBENCH_CHECK(Cache.Find(Structure));
+
+        Hit = Cache.Find(ToggledStructure);
+        GRAPHBENCH_CHECK(Hit && Hit->HasSameLayout(Compiler.Compile(Toggled)));
+
+        // Importing a resource that was transient changes what the graph keeps
+        auto Imported = Graph;
+        Imported.Imported.emplace(StringU8("Texture3"));
+        GRAPHBENCH_CHECK(!(RG::GraphCompiler::GetStructure(Imported) == Structure));
+
+        // Reordering passes changes the dependencies
+        auto Reordered = Graph;
+        std::swap(Reordered.Passes[14], Reordered.Passes[15]);
+        GRAPHBENCH_CHECK(!(RG::GraphCompiler::GetStructure(Reordered) == Structure));
+
+        // The names are part of the structure, the compiled graph keeps the names of the culled passes
+        auto Renamed           = Graph;
+        Renamed.Passes[0].Name = PassName(100);
+        GRAPHBENCH_CHECK(!(RG::GraphCompiler::GetStructure(Renamed) == Structure));
+
+        // The least recently used structure is evicted
+        (void)Cache.Find(Structure);
+        auto Resized = RandomGraph(Engine, 17);
+        Cache.Insert(RG::GraphCompiler::GetStructure(Resized), Compiler.Compile(Resized));
+        GRAPHBENCH_CHECK(Cache.GetSize() == 2);
+        GRAPHBENCH_CHECK(!Cache.Find(ToggledStructure));
+        GRAPHBENCH_CHECK(Cache.Find(Structure) && Cache.Find(RG::GraphCompiler::GetStructure(Resized)));
+
+        GRAPHBENCH_CHECK(Cache.GetHitCount() == 6 && Cache.GetMissCount() == 3);
+        return true;
+    }
+
+    /// <summary>
+    /// Random graphs that differ by a single read never share a hash, and every cached graph matches a fresh
+    /// compilation of the structure it is found with.
+    /// </summary>
+    bool CollisionTest(
+        std::mt19937& Engine)
+    {
+        RG::GraphCache    Cache(0);
+        RG::GraphCompiler Compiler;
+
+        std::vector<RG::GraphDeclaration> Graphs;
+        std::set<size_t>                  Hashes;
+        for (uint32_t Iter = 0; Iter < 200; Iter++)
+        {
+            auto& Graph = Graphs.emplace_back(RandomGraph(Engine, 4 + Iter % 60));
+            GRAPHBENCH_CHECK(Hashes.emplace(RG::GraphCompiler::GetStructure(Graph).GetHash()).second);
+            Cache.Insert(RG::GraphCompiler::GetStructure(Graph), Compiler.Compile(Graph));
+
+            std::uniform_int_distribution<size_t> Pass(0, Graph.Passes.size() - 1);
+
+            auto Extra = Graph;
+            Extra.Passes[Pass(Engine)].Read.emplace(StringU8("Extra"));
+            GRAPHBENCH_CHECK(Hashes.emplace(RG::GraphCompiler::GetStructure(Extra).GetHash()).second);
+        }
+
+        for (auto& Graph : Graphs)
+        {
+            auto Hit = Cache.Find(RG::GraphCompiler::GetStructure(Graph));
+            GRAPHBENCH_CHECK(Hit && Hit->HasSameLayout(Compiler.Compile(Graph)));
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// States of a level are merged, read states that already cover the new one are kept and subresources that may
+    /// be in different states are transitioned without a known state before.
+    /// </summary>
+    bool TransitionTest()
+    {
+        auto State = [](RHI::EResourceState Value)
+        {
+            return RHI::MResourceState::FromEnum(Value);
+        };
+
+        constexpr uint32_t All = RHI::Resource_AllSubresources;
+
+        RG::ResourceId Color(StringU8("Color")), Depth(StringU8("Depth"));
+
+        RG::TransitionPlan Plan;
+        Plan.Reset(5);
+        Plan.Add(0, Color, All, State(RHI::EResourceState::RenderTarget));
+        Plan.Add(0, Depth, All, State(RHI::EResourceState::DepthWrite));
+        Plan.Add(1, Color, All, State(RHI::EResourceState::PixelShaderResource));
+        Plan.Add(1, Color, All, State(RHI::EResourceState::NonPixelShaderResource));
+        Plan.Add(1, Depth, All, State(RHI::EResourceState::DepthRead));
+        Plan.Add(2, Color, All, State(RHI::EResourceState::PixelShaderResource));
+        Plan.Add(3, Depth, 1, State(RHI::EResourceState::PixelShaderResource));
+        Plan.Add(4, Color, All, State(RHI::EResourceState::RenderTarget));
+        Plan.Add(4, Depth, All, State(RHI::EResourceState::DepthWrite));
+        Plan.Build();
+
+        GRAPHBENCH_CHECK(Plan.Validate());
+
+        auto Find = [&Plan](uint32_t Level, const RG::ResourceId& Id) -> const RG::TransitionPlan::Transition*
+        {
+            for (auto& Transition : Plan.GetTransitions(Level))
+            {
+                if (Transition.Resource.Get() == Id.Get())
+                {
+                    return &Transition;
+                }
+            }
+            return nullptr;
+        };
+
+        GRAPHBENCH_CHECK(Plan.GetTransitions().size() == 7);
+        GRAPHBENCH_CHECK(Plan.GetTransitions(0).size() == 2 && !Find(0, Color)->HasBefore && !Find(0, Depth)->HasBefore);
+
+        auto ColorRead = Find(1, Color);
+        GRAPHBENCH_CHECK(ColorRead && ColorRead->HasBefore && ColorRead->After == RHI::MResourceState_AllShaderResource);
+        GRAPHBENCH_CHECK(ColorRead->Before == State(RHI::EResourceState::RenderTarget) && ColorRead->BeginLevel == 1);
+        GRAPHBENCH_CHECK(Plan.GetTransitions(2).empty());
+
+        auto DepthMip = Find(3, Depth);
+        GRAPHBENCH_CHECK(DepthMip && DepthMip->Subresource == 1 && DepthMip->Before == State(RHI::EResourceState::DepthRead));
+        GRAPHBENCH_CHECK(DepthMip->BeginLevel == 2);
+
+        // The color was last read during level 2, the depth's mips are in different states
+        auto ColorWrite = Find(4, Color);
+        auto DepthWrite = Find(4, Depth);
+        GRAPHBENCH_CHECK(ColorWrite && ColorWrite->Before == RHI::MResourceState_AllShaderResource && ColorWrite->BeginLevel == 3);
+        GRAPHBENCH_CHECK(DepthWrite && !DepthWrite->HasBefore && DepthWrite->BeginLevel == 4);
+        return true;
+    }
+
+    /// <summary>
+    /// Random graphs must always produce transitions that match a state tracker fed with every request.
+    /// </summary>
+    bool RandomTransitionTest(
+        std::mt19937& Engine)
+    {
+        RG::GraphCompiler Compiler;
+        for (uint32_t Iter = 0; Iter < 200; Iter++)
+        {
+            auto  Graph    = RandomGraph(Engine, 1 + Iter % 80);
+            auto  Compiled = Compiler.Compile(Graph);
+            auto& Plan     = Compiled.GetTransitions();
+
+            size_t RequestCount = 0;
+            for (auto& Pass : Graph.Passes)
+            {
+                RequestCount += Pass.States.size();
+            }
+
+            GRAPHBENCH_CHECK(Plan.Validate());
+            GRAPHBENCH_CHECK(Plan.GetTransitions().size() <= RequestCount);
+        }
+        return true;
+    }
+
+#undef GRAPHBENCH_CHECK
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 10'000;
+    uint32_t Seed       = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 1234;
+
+    std::printf("graphbench: %zu iterations, seed %u\n", Iterations, Seed);
+
+    std::mt19937 Engine(Seed);
+    if (!CacheTest(Engine) || !CollisionTest(Engine) || !TransitionTest() || !RandomTransitionTest(Engine))
+    {
+        return 1;
+    }
+    std::printf("tests passed\n");
+
+    // Cost of a build, like GraphBuilder: getting the declared structure and either compiling it or copying the
+    // cached compiled graph
+    RG::GraphCompiler Compiler;
+    for (uint32_t PassCount : { 16u, 64u, 256u })
+    {
+        auto Graph = RandomGraph(Engine, PassCount);
+
+        RG::GraphCache    Cache;
+        RG::CompiledGraph Compiled;
+
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            Cache.Clear();
+
+            auto Structure = RG::GraphCompiler::GetStructure(Graph);
+            if (!Cache.Find(Structure))
+            {
+                Compiled = Compiler.Compile(Graph);
+                Cache.Insert(std::move(Structure), Compiled);
+            }
+        }
+        double CompileTime = std::chrono::duration<double, std::micro>(Clock::now() - Begin).count() / double(Iterations);
+
+        Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            auto Cached = Cache.Find(RG::GraphCompiler::GetStructure(Graph));
+            if (!Cached)
+            {
+                std::printf("unexpected cache miss\n");
+                return 1;
+            }
+            Compiled = *Cached;
+        }
+        double CachedTime = std::chrono::duration<double, std::micro>(Clock::now() - Begin).count() / double(Iterations);
+
+        std::printf(
+            "%4u passes: %.2f us -> %.2f us per build, %u of the passes kept in %u levels\n",
+            PassCount,
+            CompileTime,
+            CachedTime,
+            Compiled.GetPassCount(),
+            Compiled.GetLevelCount());
+    }
+
+    // Cost of a frame's barriers: the previous map of maps per level, looked up in the storage, against the planned
+    // transitions with their resolved handles
+    for (uint32_t PassCount : { 16u, 64u, 256u })
+    {
+        auto  Graph    = RandomGraph(Engine, PassCount);
+        auto  Compiled = Compiler.Compile(Graph);
+        auto& Plan     = Compiled.GetTransitions();
+
+        std::map<RG::ResourceId, uint64_t> Storage;
+
+        using StateMapType = std::map<RG::ResourceId, std::map<uint32_t, RHI::MResourceState>>;
+        std::vector<StateMapType> StateMaps(Plan.GetLevelCount());
+        for (size_t i = 0; i < Graph.Passes.size(); i++)
+        {
+            uint32_t Level = Compiled.GetPassLevels()[i];
+            if (Level == RG::CompiledGraph::s_CulledPass)
+            {
+                continue;
+            }
+
+            for (auto& [Resource, Subresource, State] : Graph.Passes[i].States)
+            {
+                Storage.emplace(Resource, Storage.size());
+                StateMaps[Level][Resource][Subresource] |= State;
+            }
+        }
+
+        struct TransitionInfo
+        {
+            const uint64_t*     Handle;
+            uint32_t            Subresource;
+            RHI::MResourceState State;
+        };
+
+        std::vector<std::vector<TransitionInfo>> Transitions(Plan.GetLevelCount());
+        for (uint32_t Level = 0; Level < Plan.GetLevelCount(); Level++)
+        {
+            for (auto& Transition : Plan.GetTransitions(Level))
+            {
+                Transitions[Level].emplace_back(&Storage.at(Transition.Resource), Transition.Subresource, Transition.After);
+            }
+        }
+
+        // Stands for the state manager's pending barriers
+        std::vector<std::pair<const uint64_t*, uint32_t>> Barriers;
+
+        size_t MapCount = 0, PlanCount = 0;
+
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            Barriers.clear();
+            for (auto& StateMap : StateMaps)
+            {
+                for (auto& [Resource, Subresources] : StateMap)
+                {
+                    auto& Handle = Storage.at(Resource);
+                    for (auto& [Subresource, State] : Subresources)
+                    {
+                        Barriers.emplace_back(&Handle, Subresource);
+                    }
+                }
+            }
+            MapCount = Barriers.size();
+        }
+        double MapTime = std::chrono::duration<double, std::micro>(Clock::now() - Begin).count() / double(Iterations);
+
+        Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            Barriers.clear();
+            for (auto& Level : Transitions)
+            {
+                for (auto& Info : Level)
+                {
+                    Barriers.emplace_back(Info.Handle, Info.Subresource);
+                }
+            }
+            PlanCount = Barriers.size();
+        }
+        double PlanTime = std::chrono::duration<double, std::micro>(Clock::now() - Begin).count() / double(Iterations);
+
+        std::printf(
+            "%4u passes: %.2f us -> %.2f us of barriers per frame, %zu -> %zu transitions\n",
+            PassCount,
+            MapTime,
+            PlanTime,
+            MapCount,
+            PlanCount);
+    }
+
+    return 0;
+}
\ No newline at end of file
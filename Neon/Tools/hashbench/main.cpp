@@ -0,0 +1,111 @@
+#include <Crypto/Hash128.hpp>
+#include <Crypto/Sha256.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// Hash the buffer in one go, then in random chunks, and check that both digests match.
+    /// </summary>
+    template<typename _HashTy>
+    bool ChunkTest(
+        std::mt19937&               Engine,
+        const std::vector<uint8_t>& Data)
+    {
+        _HashTy Whole;
+        Whole.Append(Data.data(), Data.size());
+
+        _HashTy Chunked;
+        for (size_t Offset = 0; Offset < Data.size();)
+        {
+            size_t Size = std::min<size_t>(Engine() % 300, Data.size() - Offset);
+            Chunked.Append(Data.data() + Offset, Size);
+            Offset += Size;
+        }
+        return Whole.Digest() == Chunked.Digest();
+    }
+
+    /// <summary>
+    /// Hash Size bytes repeatedly until at least MinBytes were hashed, and return the throughput in GB/s.
+    /// </summary>
+    template<typename _HashTy>
+    double Measure(
+        const std::vector<uint8_t>& Data,
+        size_t                      Size,
+        size_t                      MinBytes,
+        uint64_t&                   Sink)
+    {
+        size_t Iterations = std::max<size_t>(MinBytes / Size, 1);
+
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            _HashTy Hash;
+            Hash.Append(Data.data(), Size);
+            Sink += Hash.Digest()[0];
+        }
+        double Seconds = std::chrono::duration<double>(Clock::now() - Begin).count();
+        return double(Size) * Iterations / Seconds / 1e9;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t   MinBytes = Argc > 1 ? size_t(std::atoll(Argv[1])) : size_t(256) << 20;
+    uint32_t Seed     = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 1234;
+
+    constexpr size_t MinSize = 64;
+    constexpr size_t MaxSize = size_t(64) << 20;
+
+    std::printf("hashbench: %zu bytes per size, seed %u\n", MinBytes, Seed);
+
+    std::mt19937         Engine(Seed);
+    std::vector<uint8_t> Data(MaxSize);
+    for (auto& Byte : Data)
+    {
+        Byte = uint8_t(Engine());
+    }
+
+    for (size_t Size : { size_t(0), size_t(1), size_t(63), size_t(64), size_t(65), size_t(1000), size_t(1) << 16 })
+    {
+        std::vector<uint8_t> Slice(Data.begin(), Data.begin() + Size);
+        if (!ChunkTest<Crypto::Hash128>(Engine, Slice) || !ChunkTest<Crypto::Sha256>(Engine, Slice))
+        {
+            std::printf("chunked digest of %zu bytes does not match\n", Size);
+            return 1;
+        }
+    }
+    std::printf("chunk test passed\n");
+
+    uint64_t Sink = 0;
+    for (size_t Size = MinSize; Size <= MaxSize; Size *= 4)
+    {
+        // Sha256 is two orders of magnitude slower, it gets a smaller budget
+        double Hash128Speed = Measure<Crypto::Hash128>(Data, Size, MinBytes, Sink);
+        double Sha256Speed  = Measure<Crypto::Sha256>(Data, Size, MinBytes / 16, Sink);
+
+        std::printf(
+            "%10zu bytes: hash128 %7.2f GB/s, sha256 %7.3f GB/s, %.1fx\n",
+            Size,
+            Hash128Speed,
+            Sha256Speed,
+            Hash128Speed / Sha256Speed);
+    }
+
+    // Printed so the digests are not optimized away
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(Sink));
+    return 0;
+}
\ No newline at end of file
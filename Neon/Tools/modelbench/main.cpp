@@ -0,0 +1,152 @@
+#include <Asset/Handlers/Model.hpp>
+#include <Mdl/CookedModel.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// Wavefront obj of a Size x Size grid, used when no model is given on the command line.
+    /// </summary>
+    std::string GenerateGrid(
+        size_t Size)
+    {
+        std::ostringstream Stream;
+        for (size_t y = 0; y <= Size; y++)
+        {
+            for (size_t x = 0; x <= Size; x++)
+            {
+                Stream << "v " << x << ' ' << ((x * 7 + y * 13) % 5) * 0.1f << ' ' << y << '\n';
+                Stream << "vt " << float(x) / Size << ' ' << float(y) / Size << '\n';
+            }
+        }
+
+        // Obj indices are 1-based
+        for (size_t y = 0; y < Size; y++)
+        {
+            for (size_t x = 0; x < Size; x++)
+            {
+                size_t I0 = y * (Size + 1) + x + 1, I1 = I0 + 1, I2 = I0 + Size + 1, I3 = I2 + 1;
+                Stream << "f " << I0 << '/' << I0 << ' ' << I2 << '/' << I2 << ' ' << I1 << '/' << I1 << '\n';
+                Stream << "f " << I1 << '/' << I1 << ' ' << I2 << '/' << I2 << ' ' << I3 << '/' << I3 << '\n';
+            }
+        }
+        return std::move(Stream).str();
+    }
+
+    /// <summary>
+    /// Load the model Iterations times from the data and return the average time in milliseconds.
+    /// </summary>
+    double Measure(
+        const std::string&     Data,
+        const StringU8&        Path,
+        bool                   UseCache,
+        size_t                 Iterations,
+        Ptr<Mdl::CookedModel>& Cooked)
+    {
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+        {
+            std::istringstream Stream(Data, std::ios::binary);
+            Cooked = Asset::ModelAsset::Handler::LoadCooked(Stream, Path, UseCache);
+            if (!Cooked)
+            {
+                return -1.0;
+            }
+        }
+        return std::chrono::duration<double, std::milli>(Clock::now() - Begin).count() / Iterations;
+    }
+
+    /// <summary>
+    /// Check that two loads of the same model produced the same geometry.
+    /// </summary>
+    bool SameGeometry(
+        const Mdl::CookedModel& Lhs,
+        const Mdl::CookedModel& Rhs)
+    {
+        return Lhs.Vertices.size() == Rhs.Vertices.size() &&
+               Lhs.Indices == Rhs.Indices &&
+               Lhs.Submeshes.size() == Rhs.Submeshes.size() &&
+               Lhs.Nodes.size() == Rhs.Nodes.size() &&
+               Lhs.Materials.size() == Rhs.Materials.size() &&
+               Lhs.SmallIndices == Rhs.SmallIndices;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 10;
+
+    StringU8    Path = "grid.obj";
+    std::string Source;
+    if (Argc > 2)
+    {
+        Path = Argv[2];
+
+        std::ifstream File(Path, std::ios::binary);
+        if (!File.is_open())
+        {
+            std::printf("failed to open '%s'\n", Path.c_str());
+            return 1;
+        }
+        Source.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+    }
+    else
+    {
+        Source = GenerateGrid(512);
+    }
+
+    std::printf("modelbench: '%s' (%zu bytes), %zu iterations\n", Path.c_str(), Source.size(), Iterations);
+
+    Ptr<Mdl::CookedModel> Imported, Cached, Cooked;
+
+    double ImportTime = Measure(Source, Path, false, Iterations, Imported);
+    if (ImportTime < 0)
+    {
+        std::printf("failed to import '%s' with assimp\n", Path.c_str());
+        return 1;
+    }
+
+    // The first load fills the cache, only the next ones read from it
+    Measure(Source, Path, true, 1, Cached);
+    double CachedTime = Measure(Source, Path, true, Iterations, Cached);
+
+    std::ostringstream CookedStream(std::ios::binary);
+    Imported->Write(CookedStream);
+    auto   CookedData = std::move(CookedStream).str();
+    double CookedTime = Measure(CookedData, Path, false, Iterations, Cooked);
+
+    if (CachedTime < 0 || CookedTime < 0 || !SameGeometry(*Imported, *Cached) || !SameGeometry(*Imported, *Cooked))
+    {
+        std::printf("cached or cooked model does not match the imported one\n");
+        return 1;
+    }
+
+    std::printf(
+        "%zu vertices, %zu indices, %zu bytes cooked\n",
+        Imported->Vertices.size(),
+        Imported->GetIndexCount(),
+        CookedData.size());
+    std::printf(
+        "assimp %8.2f ms, cached %8.2f ms (%.1fx), cooked %8.2f ms (%.1fx)\n",
+        ImportTime,
+        CachedTime,
+        ImportTime / CachedTime,
+        CookedTime,
+        ImportTime / CookedTime);
+
+    return 0;
+}
\ No newline at end of file
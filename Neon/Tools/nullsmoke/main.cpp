@@ -0,0 +1,216 @@
+#include <RHI/Device.hpp>
+#include <RHI/Swapchain.hpp>
+#include <RHI/SwapchainConfig.hpp>
+#include <RHI/ImGui.hpp>
+#include <RHI/Commands/Context.hpp>
+#include <RHI/Resource/Resource.hpp>
+#include <RHI/Resource/State.hpp>
+#include <RHI/Null/CommandLog.hpp>
+#include <Log/Logger.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    constexpr size_t s_BufferSize = 4096;
+
+    using SubmissionList = std::vector<RHI::NullCommandLog::Submission>;
+
+    /// <summary>
+    /// Recorded commands of a type, in submission order.
+    /// </summary>
+    template<typename _Ty>
+    std::vector<const _Ty*> GetCommands(
+        const SubmissionList& Submissions)
+    {
+        std::vector<const _Ty*> Commands;
+        for (auto& Submitted : Submissions)
+        {
+            for (auto& Command : Submitted.Commands)
+            {
+                if (auto Found = std::get_if<_Ty>(&Command))
+                {
+                    Commands.push_back(Found);
+                }
+            }
+        }
+        return Commands;
+    }
+
+    /// <summary>
+    /// Buffers of the render step, the pattern goes from the upload buffer through the default buffer to the
+    /// readback buffer.
+    /// </summary>
+    struct CopyBuffers
+    {
+        UPtr<RHI::IGpuResource> Upload;
+        UPtr<RHI::IGpuResource> Default;
+        UPtr<RHI::IGpuResource> Readback;
+        std::vector<uint8_t>    Pattern;
+
+        CopyBuffers(
+            uint8_t Seed) :
+            Upload(RHI::IGpuResource::Create(RHI::ResourceDesc::BufferUpload(s_BufferSize))),
+            Default(RHI::IGpuResource::Create(RHI::ResourceDesc::Buffer(s_BufferSize))),
+            Readback(RHI::IGpuResource::Create(RHI::ResourceDesc::BufferReadback(s_BufferSize))),
+            Pattern(s_BufferSize)
+        {
+            std::iota(Pattern.begin(), Pattern.end(), Seed);
+            Upload->Write(0, Pattern.data(), Pattern.size());
+        }
+
+        [[nodiscard]] bool ReadBack()
+        {
+            std::vector<uint8_t> Data(s_BufferSize);
+            Readback->Read(0, Data.data(), Data.size());
+            return Data == Pattern;
+        }
+    };
+
+    /// <summary>
+    /// Frame like GameEngine's loop: prepare, begin the ImGui frame, render, end the ImGui frame and present.
+    /// </summary>
+    void RunFrame(
+        CopyBuffers& Buffers)
+    {
+        auto Swapchain    = RHI::ISwapchain::Get();
+        auto StateManager = RHI::IResourceStateManager::Get();
+
+        Swapchain->PrepareFrame();
+        RHI::ImGuiRHI::BeginImGuiFrame();
+        {
+            RHI::CommandContext Context;
+            auto                CommandList = Context.Append();
+
+            StateManager->TransitionResource(Buffers.Default.get(), RHI::EResourceState::CopyDest);
+            StateManager->FlushBarriers(CommandList);
+            CommandList->CopyBufferRegion(Buffers.Default.get(), 0, Buffers.Upload.get(), 0, s_BufferSize);
+
+            StateManager->TransitionResource(Buffers.Default.get(), RHI::EResourceState::CopySource);
+            StateManager->FlushBarriers(CommandList);
+            CommandList->CopyBufferRegion(Buffers.Readback.get(), 0, Buffers.Default.get(), 0, s_BufferSize);
+        }
+        RHI::ImGuiRHI::EndImGuiFrame();
+        Swapchain->Present(0.f);
+    }
+
+    //
+
+#define NULLSMOKE_CHECK(Condition)                                         \
+    if (!(Condition))                                                      \
+    {                                                                      \
+        std::printf("check failed: %s (line %d)\n", #Condition, __LINE__); \
+        return false;                                                      \
+    }
+
+    /// <summary>
+    /// A frame records its commands under its frame id, clears the back buffer, leaves it in the present state and
+    /// executes the copies on the CPU memory.
+    /// </summary>
+    bool FrameTest()
+    {
+        auto Log       = RHI::NullCommandLog::Get();
+        auto Swapchain = RHI::ISwapchain::Get();
+
+        Log->Clear();
+        uint64_t FrameId = Log->GetFrameId();
+
+        CopyBuffers Buffers(1);
+
+        // Present moves to the next back buffer
+        auto BackBuffer     = Swapchain->GetBackBuffer();
+        auto BackBufferView = Swapchain->GetBackBufferView();
+        RunFrame(Buffers);
+
+        NULLSMOKE_CHECK(Log->GetFrameId() == FrameId + 1);
+
+        auto Submissions = Log->Take();
+        NULLSMOKE_CHECK(!Submissions.empty());
+        NULLSMOKE_CHECK(std::ranges::all_of(
+            Submissions,
+            [FrameId](const RHI::NullCommandLog::Submission& Submitted)
+            { return Submitted.FrameId == FrameId; }));
+
+        auto Clears = GetCommands<RHI::NullCommands::ClearRtv>(Submissions);
+        NULLSMOKE_CHECK(Clears.size() == 1 && Clears[0]->RtvHandle.Value == BackBufferView.Value);
+
+        std::vector<const RHI::NullCommands::Barrier*> BackBufferBarriers;
+        std::ranges::copy_if(
+            GetCommands<RHI::NullCommands::Barrier>(Submissions),
+            std::back_inserter(BackBufferBarriers),
+            [BackBuffer](const RHI::NullCommands::Barrier* Barrier)
+            { return Barrier->Resource == BackBuffer; });
+        NULLSMOKE_CHECK(BackBufferBarriers.size() >= 2);
+        NULLSMOKE_CHECK(BackBufferBarriers.front()->After == RHI::MResourceState::FromEnum(RHI::EResourceState::RenderTarget));
+        NULLSMOKE_CHECK(BackBufferBarriers.back()->After == RHI::MResourceState_Present);
+
+        auto Copies = GetCommands<RHI::NullCommands::CopyBufferRegion>(Submissions);
+        NULLSMOKE_CHECK(Copies.size() == 2);
+        NULLSMOKE_CHECK(Buffers.ReadBack());
+
+        NULLSMOKE_CHECK(Log->GetSubmissionCount() == 0);
+        return true;
+    }
+
+    /// <summary>
+    /// The commands are still executed when the log doesn't record them.
+    /// </summary>
+    bool NoRecordingTest()
+    {
+        auto Log = RHI::NullCommandLog::Get();
+
+        Log->Clear();
+        Log->SetRecording(false);
+
+        CopyBuffers Buffers(7);
+        RunFrame(Buffers);
+
+        Log->SetRecording(true);
+
+        NULLSMOKE_CHECK(Log->GetSubmissionCount() == 0);
+        NULLSMOKE_CHECK(Buffers.ReadBack());
+        return true;
+    }
+
+#undef NULLSMOKE_CHECK
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    uint32_t FrameCount = Argc > 1 ? uint32_t(std::atoi(Argv[1])) : 8;
+
+    std::printf("nullsmoke: %u frames\n", FrameCount);
+
+    Logger::Initialize();
+    std::atexit(&Logger::Shutdown);
+
+    // No window, the swapchain has CPU back buffers
+    RHI::IRenderDevice::Create(nullptr, {}, {});
+
+    // Run more frames than there are back buffers to go through every frame in flight
+    bool Passed = true;
+    for (uint32_t i = 0; i < FrameCount && Passed; i++)
+    {
+        Passed = FrameTest();
+    }
+    Passed = Passed && NoRecordingTest();
+
+    RHI::IRenderDevice::Destroy();
+
+    if (!Passed)
+    {
+        return 1;
+    }
+    std::printf("tests passed\n");
+    return 0;
+}
\ No newline at end of file
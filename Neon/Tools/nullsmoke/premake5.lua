@@ -0,0 +1,16 @@
+project "nullsmoke"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+    staticruntime "On"
+    architecture "x64"
+    
+	common_dir_setup()
+    common_neon()
+
+    defines
+    {
+        "NEON_GRAPHICS_NULL"
+    }
+
+    link_engine_library_no_engine()
\ No newline at end of file
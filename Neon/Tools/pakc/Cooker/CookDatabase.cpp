@@ -0,0 +1,191 @@
+#include <PakCPCH.hpp>
+#include <Cooker/CookDatabase.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <fstream>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::PakC
+{
+    CookDatabase::CookDatabase(
+        std::filesystem::path CachePath) :
+        m_CachePath(std::move(CachePath))
+    {
+        std::filesystem::create_directories(m_CachePath);
+    }
+
+    bool CookDatabase::Load()
+    {
+        std::ifstream File(m_CachePath / s_DatabaseName);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        boost::property_tree::ptree Root;
+        try
+        {
+            boost::property_tree::read_json(File, Root);
+        }
+        catch (const boost::property_tree::json_parser_error& Error)
+        {
+            NEON_WARNING_TAG("PakC", "Cook database is corrupted, cooking everything: {}", Error.what());
+            return false;
+        }
+
+        if (Root.get<uint32_t>("Version", 0) != s_Version)
+        {
+            NEON_TRACE_TAG("PakC", "Cook database is outdated, cooking everything");
+            return false;
+        }
+
+        std::scoped_lock Lock(m_Mutex);
+        m_Records.clear();
+
+        for (auto& [GuidStr, Node] : Root.get_child("Assets", {}))
+        {
+            auto Guid = Asset::Handle::FromString(GuidStr);
+            if (Guid == Asset::Handle::Null)
+            {
+                continue;
+            }
+
+            CookRecord Record{
+                .SourceHash     = Node.get<StringU8>("SourceHash", ""),
+                .LoaderId       = Node.get<size_t>("LoaderId", 0),
+                .HandlerVersion = Node.get<uint32_t>("HandlerVersion", 0),
+                .Path           = Node.get<StringU8>("Path", ""),
+                .CookedHash     = Node.get<StringU8>("CookedHash", ""),
+                .LoaderData     = Node.get_child("Loader", {})
+            };
+
+            for (auto& Dependency : Node.get_child("Dependencies", {}) | std::views::values)
+            {
+                Record.Dependencies.emplace_back(Asset::Handle::FromString(Dependency.get_value<StringU8>()));
+            }
+
+            m_Records.emplace(Guid, std::move(Record));
+        }
+
+        return true;
+    }
+
+    bool CookDatabase::Save() const
+    {
+        boost::property_tree::ptree Root;
+        Root.put("Version", s_Version);
+
+        boost::property_tree::ptree Assets;
+        {
+            std::scoped_lock Lock(m_Mutex);
+            for (auto& [Guid, Record] : m_Records)
+            {
+                boost::property_tree::ptree Node;
+                Node.put("SourceHash", Record.SourceHash);
+                Node.put("LoaderId", Record.LoaderId);
+                Node.put("HandlerVersion", Record.HandlerVersion);
+                Node.put("Path", Record.Path);
+                Node.put("CookedHash", Record.CookedHash);
+                Node.put_child("Loader", Record.LoaderData);
+
+                boost::property_tree::ptree Dependencies;
+                for (auto& Dependency : Record.Dependencies)
+                {
+                    Dependencies.push_back({ "", boost::property_tree::ptree(Dependency.ToString()) });
+                }
+                Node.put_child("Dependencies", Dependencies);
+
+                // Guids contain no '.', so they are safe to use as keys
+                Assets.push_back({ Guid.ToString(), std::move(Node) });
+            }
+        }
+        Root.put_child("Assets", Assets);
+
+        std::ofstream File(m_CachePath / s_DatabaseName, std::ios::out | std::ios::trunc);
+        if (!File.is_open())
+        {
+            NEON_ERROR_TAG("PakC", "Failed to write cook database '{}'", (m_CachePath / s_DatabaseName).string());
+            return false;
+        }
+
+        boost::property_tree::write_json(File, Root);
+        return true;
+    }
+
+    std::optional<CookRecord> CookDatabase::Find(
+        const Asset::Handle& AssetGuid) const
+    {
+        std::scoped_lock Lock(m_Mutex);
+        auto             Iter = m_Records.find(AssetGuid);
+        return Iter != m_Records.end() ? std::optional(Iter->second) : std::nullopt;
+    }
+
+    void CookDatabase::Update(
+        const Asset::Handle& AssetGuid,
+        CookRecord           Record)
+    {
+        std::scoped_lock Lock(m_Mutex);
+        m_Records.insert_or_assign(AssetGuid, std::move(Record));
+    }
+
+    void CookDatabase::Retain(
+        const std::unordered_set<Asset::Handle>& AssetGuids)
+    {
+        std::scoped_lock Lock(m_Mutex);
+        for (auto Iter = m_Records.begin(); Iter != m_Records.end();)
+        {
+            if (AssetGuids.contains(Iter->first))
+            {
+                ++Iter;
+                continue;
+            }
+
+            std::error_code Error;
+            std::filesystem::remove(GetCookedPath(Iter->first), Error);
+            Iter = m_Records.erase(Iter);
+        }
+    }
+
+    //
+
+    std::filesystem::path CookDatabase::GetCookedPath(
+        const Asset::Handle& AssetGuid) const
+    {
+        return m_CachePath / (AssetGuid.ToString() + ".bin");
+    }
+
+    std::optional<std::vector<uint8_t>> CookDatabase::ReadCooked(
+        const Asset::Handle& AssetGuid) const
+    {
+        std::ifstream File(GetCookedPath(AssetGuid), std::ios::in | std::ios::binary | std::ios::ate);
+        if (!File.is_open())
+        {
+            return std::nullopt;
+        }
+
+        std::vector<uint8_t> Data(size_t(File.tellg()));
+        File.seekg(std::ios::beg);
+        File.read(std::bit_cast<char*>(Data.data()), Data.size());
+
+        if (!File)
+        {
+            return std::nullopt;
+        }
+        return Data;
+    }
+
+    bool CookDatabase::WriteCooked(
+        const Asset::Handle&     AssetGuid,
+        std::span<const uint8_t> Data) const
+    {
+        std::ofstream File(GetCookedPath(AssetGuid), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        File.write(std::bit_cast<const char*>(Data.data()), Data.size());
+        return bool(File);
+    }
+} // namespace Neon::PakC
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <Asset/Handle.hpp>
+#include <Asset/Metadata.hpp>
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+
+namespace Neon::PakC
+{
+    struct CookRecord
+    {
+        /// <summary>
+        /// Hash of the source asset, its loader id, loader data and the source hashes of its dependencies.
+        /// </summary>
+        StringU8 SourceHash;
+
+        /// <summary>
+        /// Id of the handler that cooked the asset.
+        /// </summary>
+        size_t LoaderId = 0;
+
+        /// <summary>
+        /// Version of the handler that cooked the asset.
+        /// </summary>
+        uint32_t HandlerVersion = 0;
+
+        /// <summary>
+        /// Path of the asset inside the package.
+        /// </summary>
+        StringU8 Path;
+
+        /// <summary>
+        /// Hash of the cooked data.
+        /// </summary>
+        StringU8 CookedHash;
+
+        /// <summary>
+        /// Loader data written by the handler when the asset was cooked.
+        /// </summary>
+        Asset::AssetMetaData LoaderData;
+
+        /// <summary>
+        /// Dependencies written by the handler when the asset was cooked.
+        /// </summary>
+        std::vector<Asset::Handle> Dependencies;
+    };
+
+    /// <summary>
+    /// Persistent database of cooked assets, used to skip assets that did not change since the last cook.
+    /// The cooked data of each asset is stored next to the database as '<guid>.bin'.
+    /// </summary>
+    class CookDatabase
+    {
+    public:
+        static constexpr uint32_t    s_Version      = 2;
+        static constexpr const char* s_DatabaseName = "cook.db";
+
+        CookDatabase(
+            std::filesystem::path CachePath);
+
+        /// <summary>
+        /// Load the database from the cache directory.
+        /// Returns false if the database does not exist or is outdated.
+        /// </summary>
+        bool Load();
+
+        /// <summary>
+        /// Save the database to the cache directory.
+        /// </summary>
+        bool Save() const;
+
+        /// <summary>
+        /// Find the record of an asset.
+        /// </summary>
+        [[nodiscard]] std::optional<CookRecord> Find(
+            const Asset::Handle& AssetGuid) const;
+
+        /// <summary>
+        /// Insert or replace the record of an asset.
+        /// </summary>
+        void Update(
+            const Asset::Handle& AssetGuid,
+            CookRecord           Record);
+
+        /// <summary>
+        /// Remove the records and cooked data of assets that are not in the set.
+        /// </summary>
+        void Retain(
+            const std::unordered_set<Asset::Handle>& AssetGuids);
+
+    public:
+        /// <summary>
+        /// Get the path of the cooked data of an asset.
+        /// </summary>
+        [[nodiscard]] std::filesystem::path GetCookedPath(
+            const Asset::Handle& AssetGuid) const;
+
+        /// <summary>
+        /// Read the cooked data of an asset.
+        /// </summary>
+        [[nodiscard]] std::optional<std::vector<uint8_t>> ReadCooked(
+            const Asset::Handle& AssetGuid) const;
+
+        /// <summary>
+        /// Write the cooked data of an asset.
+        /// </summary>
+        bool WriteCooked(
+            const Asset::Handle&     AssetGuid,
+            std::span<const uint8_t> Data) const;
+
+    private:
+        std::filesystem::path m_CachePath;
+
+        mutable std::mutex                            m_Mutex;
+        std::unordered_map<Asset::Handle, CookRecord> m_Records;
+    };
+} // namespace Neon::PakC
\ No newline at end of file
@@ -0,0 +1,343 @@
+#include <PakCPCH.hpp>
+#include <Cooker/Cooker.hpp>
+
+#include <Asset/Packs/Directory.hpp>
+#include <Asset/Handler.hpp>
+#include <Asset/Manager.hpp>
+#include <Asset/Storage.hpp>
+#include <Asio/JobSystem.hpp>
+
+#include <Crypto/Sha256.hpp>
+#include <Crypto/Hash128.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <sstream>
+#include <fstream>
+
+#include <Log/Logger.hpp>
+
+namespace Neon::PakC
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    /// <summary>
+    /// Append the source hash of the asset's dependencies, and of their own dependencies, to the hash.
+    /// An asset is cooked again whenever the content of one of its dependencies changed.
+    /// </summary>
+    static void HashDependencies(
+        Asset::DirectoryAssetPackage*      Package,
+        const Asset::AssetMetaDataDef&     Metadata,
+        Crypto::Hash128&                   Hash,
+        std::unordered_set<Asset::Handle>& Visited)
+    {
+        for (auto DepGuid : Metadata.GetDependencies())
+        {
+            if (!Visited.emplace(DepGuid).second)
+            {
+                continue;
+            }
+
+            Hash << DepGuid.ToString();
+            if (auto DepMetadata = Package->GetMetadata(DepGuid))
+            {
+                Hash << DepMetadata->GetHash() << DepMetadata->GetLoaderId();
+                HashDependencies(Package, *DepMetadata, Hash, Visited);
+            }
+        }
+    }
+
+    Cooker::Cooker(
+        CookOptions Options) :
+        m_Options(std::move(Options)),
+        m_Database(m_Options.CachePath)
+    {
+    }
+
+    bool Cooker::Run(
+        Asset::DirectoryAssetPackage* Package)
+    {
+        auto StartTime = Clock::now();
+
+        if (!m_Options.Force && !m_Database.Load())
+        {
+            NEON_INFO_TAG("PakC", "No cook database found in '{}', cooking everything", m_Options.CachePath.string());
+        }
+
+        std::vector<Asset::Handle> AssetGuids;
+        for (auto& AssetGuid : Package->GetAssets())
+        {
+            AssetGuids.emplace_back(AssetGuid);
+        }
+
+        NEON_INFO_TAG("PakC", "Cooking {} assets from '{}' with {} jobs", AssetGuids.size(), m_Options.ProjectPath.string(), Asio::JobSystem::GetWorkerCount());
+
+        std::vector<CookResult> Results;
+        {
+            std::vector<std::future<CookResult>> Tasks;
+            Tasks.reserve(AssetGuids.size());
+
+            for (auto& AssetGuid : AssetGuids)
+            {
+                Tasks.emplace_back(Asio::JobSystem::Async(
+                    [this, Package, &AssetGuid]
+                    { return CookAsset(Package, AssetGuid); }));
+            }
+
+            Results.reserve(Tasks.size());
+            for (auto& Task : Tasks)
+            {
+                Asio::JobSystem::Wait(Task);
+                Results.emplace_back(Task.get());
+            }
+        }
+
+        // Drop the records of assets that were removed from the project
+        m_Database.Retain(std::unordered_set<Asset::Handle>(AssetGuids.begin(), AssetGuids.end()));
+        m_Database.Save();
+
+        //
+
+        bool Succeeded = true;
+
+        Asset::ArchiveAssetPackage::Writer Writer;
+        for (auto& Result : Results)
+        {
+            if (Result.Status == CookStatus::Failed)
+            {
+                Succeeded = false;
+                continue;
+            }
+            Writer.AddAsset(Result.Entry);
+        }
+
+        if (!m_Options.OutputPath.parent_path().empty())
+        {
+            std::filesystem::create_directories(m_Options.OutputPath.parent_path());
+        }
+
+        if (!Writer.Write(m_Options.OutputPath))
+        {
+            NEON_ERROR_TAG("PakC", "Failed to write archive '{}'", m_Options.OutputPath.string());
+            Succeeded = false;
+        }
+
+        double TotalMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+
+        if (!m_Options.ReportPath.empty())
+        {
+            WriteReport(Results, TotalMilliseconds);
+        }
+
+        auto CountOf = [&Results](CookStatus Status)
+        {
+            return std::ranges::count(Results, Status, &CookResult::Status);
+        };
+
+        NEON_INFO_TAG("PakC", "Cooked {} assets, packed {}, {} up to date, {} failed in {}ms", CountOf(CookStatus::Cooked), CountOf(CookStatus::Packed), CountOf(CookStatus::UpToDate), CountOf(CookStatus::Failed), TotalMilliseconds);
+        return Succeeded;
+    }
+
+    auto Cooker::CookAsset(
+        Asset::DirectoryAssetPackage* Package,
+        const Asset::Handle&          AssetGuid) -> CookResult
+    {
+        auto StartTime = Clock::now();
+
+        CookResult Result;
+        Result.Entry.Guid = AssetGuid;
+
+        auto Metadata = Package->GetMetadata(AssetGuid);
+        if (!Metadata)
+        {
+            NEON_ERROR_TAG("PakC", "Asset '{}' has no metadata", AssetGuid.ToString());
+            return Result;
+        }
+
+        Result.Entry.Path = Metadata->GetAssetPath().string();
+
+        std::error_code Error;
+        Result.SourceSize = std::filesystem::file_size(m_Options.ProjectPath / Metadata->GetAssetPath(), Error);
+
+        auto Handler = Asset::Storage::GetHandler(Metadata->GetLoaderId());
+        if (!Handler)
+        {
+            NEON_ERROR_TAG("PakC", "Asset '{}' has no handler", Result.Entry.Path);
+            return Result;
+        }
+
+        // The metadata's hash is the hash of the source file, checked when the package was mounted (see --validate)
+        StringU8 SourceHash;
+        {
+            std::ostringstream LoaderDataStream;
+            boost::property_tree::write_json(LoaderDataStream, Metadata->GetLoaderData(), false);
+
+            Crypto::Hash128 Hash;
+            Hash << Metadata->GetHash() << LoaderDataStream.str() << Metadata->GetLoaderId();
+
+            std::unordered_set<Asset::Handle> Visited{ AssetGuid };
+            HashDependencies(Package, *Metadata, Hash, Visited);
+
+            SourceHash = Hash.Digest().ToString();
+        }
+
+        //
+        // Reuse the cooked data if nothing changed
+        //
+
+        if (!m_Options.Force)
+        {
+            auto Record = m_Database.Find(AssetGuid);
+            if (Record &&
+                Record->SourceHash == SourceHash &&
+                Record->LoaderId == Metadata->GetLoaderId() &&
+                Record->HandlerVersion == Handler->GetVersion())
+            {
+                if (auto Data = m_Database.ReadCooked(AssetGuid))
+                {
+                    Result.Status             = CookStatus::UpToDate;
+                    Result.Entry.LoaderId     = Record->LoaderId;
+                    Result.Entry.Hash         = std::move(Record->CookedHash);
+                    Result.Entry.LoaderData   = std::move(Record->LoaderData);
+                    Result.Entry.Dependencies = std::move(Record->Dependencies);
+                    Result.Entry.Data         = std::move(*Data);
+                    Result.Milliseconds       = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+                    return Result;
+                }
+            }
+        }
+
+        //
+        // Cook the asset
+        //
+
+        std::vector<uint8_t> CookedData;
+        Asset::AssetMetaData LoaderData = Metadata->GetLoaderData();
+
+        size_t HandlerId = Metadata->GetLoaderId();
+        if (Handler->IsPassthrough())
+        {
+            // Saving the asset back would only copy its source file
+            std::ifstream File(m_Options.ProjectPath / Metadata->GetAssetPath(), std::ios::in | std::ios::binary);
+            if (!File.is_open())
+            {
+                NEON_ERROR_TAG("PakC", "Failed to read asset '{}'", Result.Entry.Path);
+                return Result;
+            }
+
+            CookedData.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+            for (auto Dependency : Metadata->GetDependencies())
+            {
+                Result.Entry.Dependencies.emplace_back(Dependency);
+            }
+        }
+        else
+        {
+            // Loaded through the package's cache, so the dependencies shared between assets are loaded once
+            auto Asset = Asset::Manager::Load(Package, AssetGuid);
+            if (!Asset)
+            {
+                NEON_ERROR_TAG("PakC", "Failed to load asset '{}'", Result.Entry.Path);
+                return Result;
+            }
+
+            Handler = Asset::Storage::GetHandler(Asset, &HandlerId);
+            if (!Handler)
+            {
+                NEON_ERROR_TAG("PakC", "Asset '{}' has no handler to save it", Result.Entry.Path);
+                return Result;
+            }
+
+            std::stringstream Stream(std::ios::in | std::ios::out | std::ios::binary);
+
+            Asset::DependencyWriter DepWriter;
+            Handler->Save(Stream, DepWriter, Asset, LoaderData);
+
+            auto Data = std::move(Stream).str();
+            CookedData.assign(Data.begin(), Data.end());
+
+            for (auto& Dependency : DepWriter.GetDependencies())
+            {
+                Result.Entry.Dependencies.emplace_back(Dependency->GetGuid());
+            }
+
+            // Dependencies stay cached for the assets cooked next, the asset itself is not needed anymore
+            Asset.reset();
+            Asset::Manager::RequestUnload(AssetGuid);
+        }
+
+        Result.Entry.LoaderId   = HandlerId;
+        Result.Entry.LoaderData = std::move(LoaderData);
+        Result.Entry.Data       = std::move(CookedData);
+        Result.Entry.Hash       = Crypto::Sha256().Append(Result.Entry.Data.data(), Result.Entry.Data.size()).Digest().ToString();
+
+        if (!m_Database.WriteCooked(AssetGuid, Result.Entry.Data))
+        {
+            NEON_WARNING_TAG("PakC", "Failed to write cooked data of '{}' to the cache", Result.Entry.Path);
+        }
+        else
+        {
+            m_Database.Update(
+                AssetGuid,
+                CookRecord{
+                    .SourceHash     = std::move(SourceHash),
+                    .LoaderId       = HandlerId,
+                    .HandlerVersion = Handler->GetVersion(),
+                    .Path           = Result.Entry.Path,
+                    .CookedHash     = Result.Entry.Hash,
+                    .LoaderData     = Result.Entry.LoaderData,
+                    .Dependencies   = Result.Entry.Dependencies });
+        }
+
+        Result.Status       = Handler->IsPassthrough() ? CookStatus::Packed : CookStatus::Cooked;
+        Result.Milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - StartTime).count();
+
+        NEON_TRACE_TAG("PakC", "{} '{}' in {}ms", Result.Status == CookStatus::Packed ? "Packed" : "Cooked", Result.Entry.Path, Result.Milliseconds);
+        return Result;
+    }
+
+    void Cooker::WriteReport(
+        const std::vector<CookResult>& Results,
+        double                         TotalMilliseconds) const
+    {
+        static constexpr const char* StatusNames[]{
+            "Cooked",
+            "Packed",
+            "UpToDate",
+            "Failed"
+        };
+
+        boost::property_tree::ptree Report;
+        Report.put("Archive", m_Options.OutputPath.string());
+        Report.put("Milliseconds", TotalMilliseconds);
+
+        size_t SourceSize = 0, CookedSize = 0;
+
+        boost::property_tree::ptree Assets;
+        for (auto& Result : Results)
+        {
+            boost::property_tree::ptree Node;
+            Node.put("Guid", Result.Entry.Guid.ToString());
+            Node.put("Path", Result.Entry.Path);
+            Node.put("Status", StatusNames[size_t(Result.Status)]);
+            Node.put("Milliseconds", Result.Milliseconds);
+            Node.put("SourceSize", Result.SourceSize);
+            Node.put("CookedSize", Result.Entry.Data.size());
+            Assets.push_back({ "", std::move(Node) });
+
+            SourceSize += Result.SourceSize;
+            CookedSize += Result.Entry.Data.size();
+        }
+
+        Report.put("SourceSize", SourceSize);
+        Report.put("CookedSize", CookedSize);
+        Report.put_child("Assets", Assets);
+
+        std::ofstream File(m_Options.ReportPath, std::ios::out | std::ios::trunc);
+        if (!File.is_open())
+        {
+            NEON_ERROR_TAG("PakC", "Failed to write build report '{}'", m_Options.ReportPath.string());
+            return;
+        }
+
+        boost::property_tree::write_json(File, Report);
+    }
+} // namespace Neon::PakC
\ No newline at end of file
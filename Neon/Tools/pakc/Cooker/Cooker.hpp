@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Cooker/CookDatabase.hpp>
+#include <Asset/Packs/Archive.hpp>
+
+#include <thread>
+
+namespace Neon::Asset
+{
+    class DirectoryAssetPackage;
+} // namespace Neon::Asset
+
+namespace Neon::PakC
+{
+    struct CookOptions
+    {
+        /// <summary>
+        /// Directory containing the project's assets.
+        /// </summary>
+        std::filesystem::path ProjectPath;
+
+        /// <summary>
+        /// Path of the archive to write.
+        /// </summary>
+        std::filesystem::path OutputPath;
+
+        /// <summary>
+        /// Directory where the cook database and the cooked assets are stored.
+        /// </summary>
+        std::filesystem::path CachePath;
+
+        /// <summary>
+        /// Path of the build report, empty to skip writing it.
+        /// </summary>
+        std::filesystem::path ReportPath;
+
+        /// <summary>
+        /// Number of job system workers cooking assets in parallel.
+        /// </summary>
+        uint32_t Jobs = std::thread::hardware_concurrency();
+
+        /// <summary>
+        /// Cook every asset even if it is up to date.
+        /// </summary>
+        bool Force : 1 = false;
+    };
+
+    /// <summary>
+    /// Cooks the assets of a directory package into a single archive.
+    /// Cooking an asset means loading it with its handler and saving it back, assets whose handler is a passthrough
+    /// (e.g. textures and shaders) are packed as-is instead.
+    /// Assets whose source, loader data, dependencies and handler version did not change since the last cook
+    /// are taken from the cook database.
+    /// </summary>
+    class Cooker
+    {
+        enum class CookStatus : uint8_t
+        {
+            Cooked,
+            Packed,
+            UpToDate,
+            Failed
+        };
+
+        struct CookResult
+        {
+            CookStatus Status       = CookStatus::Failed;
+            double     Milliseconds = 0.0;
+            size_t     SourceSize   = 0;
+
+            Asset::ArchiveAssetPackage::Writer::Entry Entry;
+        };
+
+    public:
+        Cooker(
+            CookOptions Options);
+
+        /// <summary>
+        /// Cook all assets of the package and write the archive.
+        /// Returns false if any asset failed to cook or the archive could not be written.
+        /// </summary>
+        bool Run(
+            Asset::DirectoryAssetPackage* Package);
+
+    private:
+        /// <summary>
+        /// Cook a single asset, or fetch it from the cook database if it is up to date.
+        /// </summary>
+        [[nodiscard]] CookResult CookAsset(
+            Asset::DirectoryAssetPackage* Package,
+            const Asset::Handle&          AssetGuid);
+
+        /// <summary>
+        /// Write the build report.
+        /// </summary>
+        void WriteReport(
+            const std::vector<CookResult>& Results,
+            double                         TotalMilliseconds) const;
+
+    private:
+        CookOptions  m_Options;
+        CookDatabase m_Database;
+    };
+} // namespace Neon::PakC
\ No newline at end of file
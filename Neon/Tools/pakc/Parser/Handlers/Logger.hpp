@@ -1,9 +0,0 @@
-#pragma once
-
-#include <Parser/JsonReader.hpp>
-
-namespace PakC::Handler
-{
-    AssetResourcePtr LoadLoggerResource(
-        const boost::json::object& Object);
-}
\ No newline at end of file
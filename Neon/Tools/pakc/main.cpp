@@ -1,41 +1,132 @@
 #include <PakCPCH.hpp>
 #include <Runtime/EntryPoint.hpp>
-#include <Parser/JsonReader.hpp>
+#include <Cooker/Cooker.hpp>
+#include <Asset/Packs/Directory.hpp>
+#include <Asset/Storage.hpp>
+#include <Asio/JobSystem.hpp>
+
+#include <Asset/Handlers/Json.hpp>
+#include <Asset/Handlers/Logger.hpp>
+#include <Asset/Handlers/Model.hpp>
+#include <Asset/Handlers/PropertyTree.hpp>
+#include <Asset/Handlers/RootSignature.hpp>
+#include <Asset/Handlers/RuntimeScene.hpp>
+#include <Asset/Handlers/Shader.hpp>
+#include <Asset/Handlers/Texture.hpp>
+#include <Asset/Handlers/TextFile.hpp>
+
+#include <iostream>
+#include <boost/program_options.hpp>
 
 #include <Log/Logger.hpp>
 
+//
+
 using namespace Neon;
+namespace bpo = boost::program_options;
 
 NEON_MAIN(Argc, Argv)
 {
     Logger::SetLogTag("", Logger::LogSeverity::Info);
-    Logger::SetLogTag("Resource", Logger::LogSeverity::Info);
-    Logger::SetLogTag("Graphics", Logger::LogSeverity::Info);
-    Logger::SetLogTag("ShaderCompiler", Logger::LogSeverity::Info);
+    Logger::SetLogTag("Asset", Logger::LogSeverity::Warning);
+    Logger::SetLogTag("PakC", Logger::LogSeverity::Info);
+
+    PakC::CookOptions Options;
+    bool              Validate = false;
 
-    if (Argc <= 1)
     {
-        NEON_FATAL("Usage: pakc <file>...");
-        return 0;
+        bpo::options_description Description("Allowed options");
+        Description.add_options()(
+            "help", "Produce help message")(
+
+            "project,p", bpo::value<StringU8>()->required()->notifier([&](const StringU8& Val)
+                                                                      { Options.ProjectPath = Val; }),
+            "Directory containing the assets to cook")(
+
+            "output,o", bpo::value<StringU8>()->default_value("Content.npak")->notifier([&](const StringU8& Val)
+                                                                                       { Options.OutputPath = Val; }),
+            "Path of the archive to write")(
+
+            "cache,c", bpo::value<StringU8>()->default_value(".pakc")->notifier([&](const StringU8& Val)
+                                                                               { Options.CachePath = Val; }),
+            "Directory of the cook database and cooked assets")(
+
+            "report,r", bpo::value<StringU8>()->notifier([&](const StringU8& Val)
+                                                         { Options.ReportPath = Val; }),
+            "Path of the json build report")(
+
+            "jobs,j", bpo::value<uint32_t>()->default_value(std::thread::hardware_concurrency())->notifier([&](uint32_t Val)
+                                                                                                          { Options.Jobs = Val; }),
+            "Number of job system workers cooking assets in parallel")(
+
+            "force,f", bpo::bool_switch()->notifier([&](bool Val)
+                                                    { Options.Force = Val; }),
+            "Cook every asset even if it is up to date")(
+
+            "validate", bpo::bool_switch()->notifier([&](bool Val)
+                                                     { Validate = Val; }),
+            "Ignore the package index and rehash every source file");
+
+        bpo::variables_map Vars;
+
+        try
+        {
+            bpo::store(bpo::parse_command_line(Argc, Argv, Description), Vars);
+
+            if (Vars.count("help"))
+            {
+                std::cout << Description << std::endl;
+                return nullptr;
+            }
+
+            bpo::notify(Vars);
+        }
+        catch (const bpo::error& Error)
+        {
+            NEON_FATAL(Error.what());
+            return nullptr;
+        }
+    }
+
+    if (!std::filesystem::is_directory(Options.ProjectPath))
+    {
+        NEON_FATAL("Project path '{}' is not a directory", Options.ProjectPath.string());
+        return nullptr;
     }
 
-    Config::EngineConfig Config{
-        .Window = {
-            .Title          = STR("PakC"),
-            .Windowed       = true,
-            .Fullscreen     = false,
-            .InitialVisible = false },
-        .LoggerAssetUid = std::nullopt
-    };
+    //
 
-    Runtime::DefaultGameEngine Engine;
-    Engine.Initialize(Config);
+    // The cooker runs headless: no window nor render device, only the job system and the asset storage
+    Asio::JobSystem::Initialize(std::max(Options.Jobs, 1u));
+    Asset::Storage::Initialize();
 
-    PakC::JsonHandler Handler;
-    for (int i = 1; i < Argc; i++)
+    Asset::Storage::RegisterHandler<Asset::JsonAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::LoggerAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::ModelAsset::Handler>(Asset::ModelAsset::Handler::LoadMode::CookedOnly);
+    Asset::Storage::RegisterHandler<Asset::PropertyTreeAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::RootSignatureAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::RuntimeSceneAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::ShaderAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::TextFileAsset::Handler>();
+    Asset::Storage::RegisterHandler<Asset::TextureAsset::Handler>();
+
+    auto Package = static_cast<Asset::DirectoryAssetPackage*>(Asset::Storage::Mount(std::make_unique<Asset::DirectoryAssetPackage>(
+        Options.ProjectPath,
+        Validate ? Asset::DirectoryAssetPackage::ScanMode::Validate : Asset::DirectoryAssetPackage::ScanMode::Cached,
+        Options.CachePath / StringUtils::Format("Content{}", Asset::DirectoryAssetPackage::s_IndexExtension))));
+
+    bool Succeeded;
     {
-        Handler.Parse(StringUtils::Transform<StringU8>(String(Argv[i])));
+        PakC::Cooker Cooker(std::move(Options));
+        Succeeded = Cooker.Run(Package);
     }
 
-    return 0;
+    Asset::Storage::Shutdown();
+    Asio::JobSystem::Shutdown();
+
+    if (!Succeeded)
+    {
+        std::exit(EXIT_FAILURE);
+    }
+    return nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,411 @@
+#include <Asio/ThreadPool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <latch>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchResult
+    {
+        size_t Tasks;
+        double Milliseconds;
+    };
+
+    void PrintResult(
+        const char*        Name,
+        const BenchResult& Result)
+    {
+        std::printf(
+            "%-28s %10zu tasks %10.2f ms %12.0f tasks/s\n",
+            Name,
+            Result.Tasks,
+            Result.Milliseconds,
+            double(Result.Tasks) / (Result.Milliseconds / 1000.0));
+    }
+
+    /// <summary>
+    /// Several external threads enqueue tiny tasks at the same time.
+    /// Stresses the injection queues and stealing between idle workers.
+    /// </summary>
+    BenchResult ExternalFanOut(
+        Asio::ThreadPool<>& Pool,
+        uint32_t            Producers,
+        size_t              TasksPerProducer)
+    {
+        const size_t     TotalTasks = Producers * TasksPerProducer;
+        std::latch       Done{ ptrdiff_t(TotalTasks) };
+        std::atomic_bool Start = false;
+
+        std::vector<std::jthread> ProducerThreads;
+        ProducerThreads.reserve(Producers);
+        for (uint32_t i = 0; i < Producers; i++)
+        {
+            ProducerThreads.emplace_back(
+                [&]
+                {
+                    Start.wait(false);
+                    for (size_t j = 0; j < TasksPerProducer; j++)
+                    {
+                        Pool.enqueue_detach([&Done]
+                                            { Done.count_down(); });
+                    }
+                });
+        }
+
+        auto Begin = Clock::now();
+        Start      = true;
+        Start.notify_all();
+        Done.wait();
+        auto End = Clock::now();
+
+        return { TotalTasks, std::chrono::duration<double, std::milli>(End - Begin).count() };
+    }
+
+    /// <summary>
+    /// Tasks recursively spawn child tasks from the workers, like nested asset loads or render graph passes.
+    /// Stresses the owner's LIFO path and batch stealing.
+    /// </summary>
+    BenchResult NestedFanOut(
+        Asio::ThreadPool<>& Pool,
+        uint32_t            Depth,
+        uint32_t            Branches)
+    {
+        size_t TotalTasks = 0;
+        for (size_t i = 0, Level = 1; i <= Depth; i++, Level *= Branches)
+        {
+            TotalTasks += Level;
+        }
+
+        std::latch Done{ ptrdiff_t(TotalTasks) };
+
+        std::function<void(uint32_t)> Spawn;
+        Spawn = [&](uint32_t Level)
+        {
+            if (Level < Depth)
+            {
+                for (uint32_t i = 0; i < Branches; i++)
+                {
+                    Pool.enqueue_detach([&Spawn, Level]
+                                        { Spawn(Level + 1); });
+                }
+            }
+            Done.count_down();
+        };
+
+        auto Begin = Clock::now();
+        Pool.enqueue_detach([&Spawn]
+                            { Spawn(0); });
+        Done.wait();
+        auto End = Clock::now();
+
+        return { TotalTasks, std::chrono::duration<double, std::milli>(End - Begin).count() };
+    }
+
+    /// <summary>
+    /// Enqueue tasks returning a value and wait on their futures.
+    /// </summary>
+    BenchResult FutureRoundTrip(
+        Asio::ThreadPool<>& Pool,
+        size_t              Tasks)
+    {
+        std::vector<std::future<size_t>> Futures;
+        Futures.reserve(Tasks);
+
+        auto Begin = Clock::now();
+        for (size_t i = 0; i < Tasks; i++)
+        {
+            Futures.emplace_back(Pool.enqueue([i]
+                                              { return i; }));
+        }
+        size_t Sum = 0;
+        for (auto& Future : Futures)
+        {
+            Sum += Future.get();
+        }
+        auto End = Clock::now();
+
+        if (Sum != Tasks * (Tasks - 1) / 2)
+        {
+            std::printf("FutureRoundTrip: invalid result\n");
+        }
+
+        return { Tasks, std::chrono::duration<double, std::milli>(End - Begin).count() };
+    }
+    //
+
+    /// <summary>
+    /// Keeps a worker busy until it is opened, so the tests can queue tasks before any of them runs.
+    /// </summary>
+    class WorkerGate
+    {
+    public:
+        WorkerGate(
+            Asio::ThreadPool<>& Pool,
+            uint64_t            Affinity = 0)
+        {
+            Pool.enqueue_detach(
+                { .affinity = Affinity },
+                [this]
+                {
+                    m_Started = true;
+                    m_Started.notify_all();
+                    m_Open.wait(false);
+                });
+            m_Started.wait(false);
+        }
+
+        WorkerGate(const WorkerGate&)            = delete;
+        WorkerGate& operator=(const WorkerGate&) = delete;
+
+        ~WorkerGate()
+        {
+            Open();
+        }
+
+        void Open()
+        {
+            m_Open = true;
+            m_Open.notify_all();
+        }
+
+    private:
+        std::atomic_bool m_Started = false;
+        std::atomic_bool m_Open    = false;
+    };
+
+    /// <summary>
+    /// Wait for a counter to reach a value, returns false after a few seconds.
+    /// </summary>
+    bool WaitFor(
+        const std::atomic_size_t& Counter,
+        size_t                    Value)
+    {
+        auto Deadline = Clock::now() + std::chrono::seconds(5);
+        while (Counter.load() < Value)
+        {
+            if (Clock::now() > Deadline)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// A single worker gets the same number of tasks of every priority, interleaved.
+    /// On average more urgent tasks must run earlier.
+    /// </summary>
+    bool CheckPriorities(
+        size_t TasksPerPriority)
+    {
+        constexpr size_t PriorityCount = size_t(Asio::task_priority::count);
+
+        Asio::ThreadPool<> Pool(1);
+        std::vector<size_t> Order;
+        std::latch          Done{ ptrdiff_t(TasksPerPriority * PriorityCount) };
+        {
+            WorkerGate Gate(Pool);
+            for (size_t i = 0; i < TasksPerPriority; i++)
+            {
+                for (size_t Priority = PriorityCount; Priority--;)
+                {
+                    Pool.enqueue_detach(
+                        { .priority = Asio::task_priority(Priority) },
+                        [&Order, &Done, Priority]
+                        {
+                            Order.push_back(Priority);
+                            Done.count_down();
+                        });
+                }
+            }
+        }
+        Done.wait();
+
+        std::array<double, PriorityCount> AverageRank{};
+        for (size_t Rank = 0; Rank < Order.size(); Rank++)
+        {
+            AverageRank[Order[Rank]] += double(Rank) / TasksPerPriority;
+        }
+
+        std::printf("priorities: average rank critical %.0f, normal %.0f, background %.0f\n", AverageRank[0], AverageRank[1], AverageRank[2]);
+        if (!std::ranges::is_sorted(AverageRank))
+        {
+            std::printf("priorities: more urgent tasks did not run first\n");
+            return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// A single worker has a long backlog of critical tasks and a single background task.
+    /// The background task must not wait for the whole backlog.
+    /// </summary>
+    bool CheckStarvation(
+        size_t CriticalTasks)
+    {
+        Asio::ThreadPool<> Pool(1);
+        std::atomic_size_t CriticalDone = 0;
+        std::atomic_size_t RunAfter     = 0;
+        std::latch         Done{ ptrdiff_t(CriticalTasks + 1) };
+        {
+            WorkerGate Gate(Pool);
+            for (size_t i = 0; i < CriticalTasks; i++)
+            {
+                Pool.enqueue_detach(
+                    { .priority = Asio::task_priority::critical },
+                    [&]
+                    {
+                        CriticalDone++;
+                        Done.count_down();
+                    });
+            }
+            Pool.enqueue_detach(
+                { .priority = Asio::task_priority::background },
+                [&]
+                {
+                    RunAfter = CriticalDone.load();
+                    Done.count_down();
+                });
+        }
+        Done.wait();
+
+        std::printf("starvation: background task ran after %zu of %zu critical tasks\n", RunAfter.load(), CriticalTasks);
+        if (RunAfter.load() >= CriticalTasks / 2)
+        {
+            std::printf("starvation: background task was starved\n");
+            return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Tasks with a mask of several workers must only run on those workers, and must not wait for a busy one
+    /// while another worker of the mask is free. Masks without any existing worker must be rejected.
+    /// </summary>
+    bool CheckAffinity(
+        size_t Tasks)
+    {
+        constexpr uint32_t WorkerCount = 4;
+        constexpr uint64_t SharedMask  = 0b0110;
+
+        Asio::ThreadPool<> Pool(WorkerCount);
+
+        // Learn which thread is which worker
+        std::map<std::thread::id, size_t> WorkerIds;
+        for (size_t i = 0; i < WorkerCount; i++)
+        {
+            auto Thread = Pool.enqueue({ .affinity = uint64_t(1) << i }, []
+                                       { return std::this_thread::get_id(); });
+            WorkerIds.emplace(Thread.get(), i);
+        }
+        if (WorkerIds.size() != WorkerCount)
+        {
+            std::printf("affinity: single worker masks ran on the same thread\n");
+            return false;
+        }
+
+        std::vector<std::atomic_size_t> RunsPerWorker(WorkerCount);
+        std::atomic_size_t              Executed = 0;
+
+        auto EnqueueShared = [&]
+        {
+            for (size_t i = 0; i < Tasks; i++)
+            {
+                Pool.enqueue_detach(
+                    { .affinity = SharedMask },
+                    [&]
+                    {
+                        RunsPerWorker[WorkerIds.at(std::this_thread::get_id())]++;
+                        Executed++;
+                    });
+            }
+        };
+
+        // Worker 1 is busy, worker 2 must take every task of the shared mask
+        {
+            WorkerGate Gate(Pool, 0b0010);
+            EnqueueShared();
+            if (!WaitFor(Executed, Tasks))
+            {
+                std::printf("affinity: tasks waited for a busy worker of their mask\n");
+                return false;
+            }
+        }
+
+        EnqueueShared();
+        if (!WaitFor(Executed, Tasks * 2))
+        {
+            std::printf("affinity: tasks were not executed\n");
+            return false;
+        }
+
+        std::printf("affinity: shared mask ran %zu / %zu / %zu / %zu tasks on workers 0-3\n", RunsPerWorker[0].load(), RunsPerWorker[1].load(), RunsPerWorker[2].load(), RunsPerWorker[3].load());
+        if (RunsPerWorker[0] || RunsPerWorker[3])
+        {
+            std::printf("affinity: tasks ran outside of their mask\n");
+            return false;
+        }
+
+        try
+        {
+            Pool.enqueue_detach({ .affinity = uint64_t(1) << 40 }, [] {});
+            std::printf("affinity: a mask without any worker was accepted\n");
+            return false;
+        }
+        catch (const std::invalid_argument&)
+        {
+        }
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    uint32_t Workers   = Argc > 1 ? uint32_t(std::atoi(Argv[1])) : std::thread::hardware_concurrency();
+    uint32_t Producers = Argc > 2 ? uint32_t(std::atoi(Argv[2])) : 4;
+    uint32_t Rounds    = Argc > 3 ? uint32_t(std::atoi(Argv[3])) : 3;
+
+    std::printf("poolbench: %u workers, %u producers, %u rounds\n", Workers, Producers, Rounds);
+
+    if (!CheckPriorities(10'000) || !CheckStarvation(10'000) || !CheckAffinity(10'000))
+    {
+        return 1;
+    }
+
+    Asio::ThreadPool<> Pool(Workers);
+    for (uint32_t i = 0; i < Rounds; i++)
+    {
+        PrintResult("external fan-out", ExternalFanOut(Pool, Producers, 250'000));
+        PrintResult("nested fan-out", NestedFanOut(Pool, 6, 8));
+        PrintResult("future round trip", FutureRoundTrip(Pool, 250'000));
+    }
+
+    const char* PriorityNames[] = { "critical", "normal", "background" };
+    for (size_t i = 0; i < size_t(Asio::task_priority::count); i++)
+    {
+        auto Stats = Pool.stats(Asio::task_priority(i));
+        std::printf(
+            "%-12s %10llu executed, latency avg %8.3f ms, max %8.3f ms\n",
+            PriorityNames[i],
+            (unsigned long long)Stats.executed,
+            Stats.average_latency.count() / 1e6,
+            Stats.max_latency.count() / 1e6);
+    }
+
+    return 0;
+}
\ No newline at end of file
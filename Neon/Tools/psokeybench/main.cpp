@@ -0,0 +1,288 @@
+#include <RHI/PipelineCache.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Key   = RHI::PipelineCache::Key;
+
+    struct KeyInputs
+    {
+        RHI::PipelineStateBuilderG Builder;
+        Key                        RootSignature{};
+        std::array<Key, 5>         Shaders{};
+        std::array<bool, 5>        HasShader{ true, true, false, false, false };
+
+        [[nodiscard]] Key MakeKey() const
+        {
+            RHI::PipelineCache::GraphicsShaderKeys ShaderKeys{};
+            for (size_t i = 0; i < Shaders.size(); i++)
+            {
+                ShaderKeys[i] = HasShader[i] ? &Shaders[i] : nullptr;
+            }
+            return RHI::PipelineCache::MakeKey(Builder, RootSignature, ShaderKeys);
+        }
+    };
+
+    struct Mutation
+    {
+        StringU8                        Name;
+        std::function<void(KeyInputs&)> Apply;
+    };
+
+    /// <summary>
+    /// A typical opaque pass description, every mutation below changes exactly one thing about it.
+    /// </summary>
+    KeyInputs BaseInputs()
+    {
+        KeyInputs Inputs;
+        Inputs.RootSignature[0] = 1;
+        for (size_t i = 0; i < Inputs.Shaders.size(); i++)
+        {
+            Inputs.Shaders[i][0] = uint8_t(2 + i);
+        }
+
+        auto& Builder = Inputs.Builder;
+        Builder.Input = {
+            { "POSITION", RHI::EResourceFormat::R32G32B32_Float },
+            { "NORMAL", RHI::EResourceFormat::R32G32B32_Float },
+            { "TEXCOORD", RHI::EResourceFormat::R32G32_Float }
+        };
+        Builder.RTFormats = { RHI::EResourceFormat::R8G8B8A8_UNorm };
+        Builder.DSFormat  = RHI::EResourceFormat::D32_Float;
+        Builder.Topology  = RHI::PrimitiveTopologyCategory::Triangle;
+        return Inputs;
+    }
+
+    std::vector<Mutation> Mutations()
+    {
+        using Builder = RHI::PipelineStateBuilderG;
+
+        std::vector<Mutation> List{
+            { "root signature", [](KeyInputs& In)
+              { In.RootSignature[15] ^= 1; } },
+            { "vertex shader", [](KeyInputs& In)
+              { In.Shaders[0][15] ^= 1; } },
+            { "pixel shader", [](KeyInputs& In)
+              { In.Shaders[1][15] ^= 1; } },
+            { "geometry shader added", [](KeyInputs& In)
+              { In.HasShader[2] = true; } },
+            { "pixel shader removed", [](KeyInputs& In)
+              { In.HasShader[1] = false; } },
+            { "shaders swapped", [](KeyInputs& In)
+              { std::swap(In.Shaders[0], In.Shaders[1]); } },
+            { "pixel shader moved to hull", [](KeyInputs& In)
+              { std::swap(In.HasShader[1], In.HasShader[3]); std::swap(In.Shaders[1], In.Shaders[3]); } },
+
+            { "alpha to coverage", [](KeyInputs& In)
+              { In.Builder.Blend.AlphaToCoverageEnable = true; } },
+            { "independent blend", [](KeyInputs& In)
+              { In.Builder.Blend.IndependentBlendEnable = true; } },
+
+            { "fill mode", [](KeyInputs& In)
+              { In.Builder.Rasterizer.FillMode = RHI::FillMode::Wireframe; } },
+            { "cull mode", [](KeyInputs& In)
+              { In.Builder.Rasterizer.CullMode = RHI::ECullMode::None; } },
+            { "front counter clockwise", [](KeyInputs& In)
+              { In.Builder.Rasterizer.FrontCounterClockwise = true; } },
+            { "depth bias", [](KeyInputs& In)
+              { In.Builder.Rasterizer.DepthBias = 4; } },
+            { "depth bias clamp", [](KeyInputs& In)
+              { In.Builder.Rasterizer.DepthBiasClamp = 0.5f; } },
+            { "slope scaled depth bias", [](KeyInputs& In)
+              { In.Builder.Rasterizer.SlopeScaledDepthBias = 1.5f; } },
+            { "depth clip", [](KeyInputs& In)
+              { In.Builder.Rasterizer.DepthClipEnable = false; } },
+            { "multisample", [](KeyInputs& In)
+              { In.Builder.Rasterizer.MultisampleEnable = true; } },
+            { "antialiased line", [](KeyInputs& In)
+              { In.Builder.Rasterizer.AntialiasedLineEnable = true; } },
+            { "forced sample count", [](KeyInputs& In)
+              { In.Builder.Rasterizer.ForcedSampleCount = 4; } },
+            { "conservative raster", [](KeyInputs& In)
+              { In.Builder.Rasterizer.ConservativeRaster = true; } },
+
+            { "depth enable", [](KeyInputs& In)
+              { In.Builder.DepthStencil.DepthEnable = false; } },
+            { "depth compare", [](KeyInputs& In)
+              { In.Builder.DepthStencil.DepthCmpFunc = RHI::ECompareFunc::Greater; } },
+            { "depth write", [](KeyInputs& In)
+              { In.Builder.DepthStencil.DepthWriteEnable = false; } },
+            { "stencil enable", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilEnable = true; } },
+            { "stencil read mask", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilReadMask = 0x0F; } },
+            { "stencil write mask", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilWriteMask = 0x0F; } },
+            { "front stencil fail", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilFrontFace.FailOp = RHI::EStencilOp::Zero; } },
+            { "front stencil depth fail", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilFrontFace.DepthFailOp = RHI::EStencilOp::Zero; } },
+            { "front stencil pass", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilFrontFace.PassOp = RHI::EStencilOp::Zero; } },
+            { "front stencil compare", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilFrontFace.CmpOp = RHI::ECompareFunc::Never; } },
+            { "back stencil fail", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilBackFace.FailOp = RHI::EStencilOp::Zero; } },
+            { "back stencil depth fail", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilBackFace.DepthFailOp = RHI::EStencilOp::Zero; } },
+            { "back stencil pass", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilBackFace.PassOp = RHI::EStencilOp::Zero; } },
+            { "back stencil compare", [](KeyInputs& In)
+              { In.Builder.DepthStencil.StencilBackFace.CmpOp = RHI::ECompareFunc::Never; } },
+
+            { "input format", [](KeyInputs& In)
+              { In.Builder.Input[2].second = RHI::EResourceFormat::R16G16_Float; } },
+            { "input name", [](KeyInputs& In)
+              { In.Builder.Input[2].first = "TEXCOORD#1"; } },
+            { "input order", [](KeyInputs& In)
+              { std::swap(In.Builder.Input[0], In.Builder.Input[1]); } },
+            { "input removed", [](KeyInputs& In)
+              { In.Builder.Input.pop_back(); } },
+            { "input names shifted", [](KeyInputs& In)
+              { In.Builder.Input[0].first = "POSITIONNORMAL";
+                In.Builder.Input[1].first = ""; } },
+
+            { "render target format", [](KeyInputs& In)
+              { In.Builder.RTFormats[0] = RHI::EResourceFormat::R16G16B16A16_Float; } },
+            { "render target added", [](KeyInputs& In)
+              { In.Builder.RTFormats.push_back(RHI::EResourceFormat::R8G8B8A8_UNorm); } },
+            { "render targets removed", [](KeyInputs& In)
+              { In.Builder.RTFormats.clear(); } },
+            { "depth stencil format", [](KeyInputs& In)
+              { In.Builder.DSFormat = RHI::EResourceFormat::D24_UNorm_S8_UInt; } },
+
+            { "sample mask", [](KeyInputs& In)
+              { In.Builder.SampleMask = 0xF; } },
+            { "sample count", [](KeyInputs& In)
+              { In.Builder.SampleCount = 4; } },
+            { "sample quality", [](KeyInputs& In)
+              { In.Builder.SampleQuality = 1; } },
+            { "topology", [](KeyInputs& In)
+              { In.Builder.Topology = RHI::PrimitiveTopologyCategory::Line; } },
+            { "strip cut", [](KeyInputs& In)
+              { In.Builder.StripCut = Builder::StripCutType::MaxUInt32; } },
+        };
+
+        // Every field of every render target
+        for (size_t i = 0; i < 8; i++)
+        {
+            auto Add = [&List, i](const char* Field, void (*Apply)(Builder::RenderTarget&))
+            {
+                List.push_back({ "render target " + std::to_string(i) + " " + Field,
+                                 [i, Apply](KeyInputs& In)
+                                 { Apply(In.Builder.Blend.RenderTargets[i]); } });
+            };
+
+            Add("blend enable", [](auto& Target)
+                { Target.BlendEnable = true; });
+            Add("logic enable", [](auto& Target)
+                { Target.LogicEnable = true; });
+            Add("logic op", [](auto& Target)
+                { Target.OpLogic = RHI::LogicOp::Clear; });
+            Add("blend src", [](auto& Target)
+                { Target.Src = RHI::BlendTarget::SrcAlpha; });
+            Add("blend dest", [](auto& Target)
+                { Target.Dest = RHI::BlendTarget::InvSrcColor; });
+            Add("blend op", [](auto& Target)
+                { Target.OpSrc = RHI::BlendOp::Max; });
+            Add("blend src alpha", [](auto& Target)
+                { Target.SrcAlpha = RHI::BlendTarget::SrcAlpha; });
+            Add("blend dest alpha", [](auto& Target)
+                { Target.DestAlpha = RHI::BlendTarget::InvSrcColor; });
+            Add("blend op alpha", [](auto& Target)
+                { Target.OpAlpha = RHI::BlendOp::Max; });
+            Add("write mask", [](auto& Target)
+                { Target.WriteMask = 0x7; });
+        }
+        return List;
+    }
+
+    /// <summary>
+    /// Check that equal descriptions make equal keys and that every single change makes a key of its own.
+    /// </summary>
+    bool CheckKeys()
+    {
+        auto BaseKey = BaseInputs().MakeKey();
+        if (BaseInputs().MakeKey() != BaseKey)
+        {
+            std::printf("equal descriptions made different keys\n");
+            return false;
+        }
+
+        // The compute key only depends on the root signature and the shader
+        RHI::PipelineStateBuilderC Compute;
+        Key                        RootSignature{}, Shader{};
+        auto                       ComputeKey = RHI::PipelineCache::MakeKey(Compute, RootSignature, Shader);
+        if (RHI::PipelineCache::MakeKey(Compute, RootSignature, Shader) != ComputeKey)
+        {
+            std::printf("equal compute descriptions made different keys\n");
+            return false;
+        }
+        Shader[0] = 1;
+        if (RHI::PipelineCache::MakeKey(Compute, RootSignature, Shader) == ComputeKey)
+        {
+            std::printf("compute shader change did not change the key\n");
+            return false;
+        }
+
+        std::map<Key, StringU8> Seen{ { BaseKey, "base" } };
+
+        for (auto& [Name, Apply] : Mutations())
+        {
+            auto Inputs = BaseInputs();
+            Apply(Inputs);
+
+            auto [Iter, Inserted] = Seen.emplace(Inputs.MakeKey(), Name);
+            if (!Inserted)
+            {
+                std::printf("'%s' made the same key as '%s'\n", Name.c_str(), Iter->second.c_str());
+                return false;
+            }
+        }
+
+        std::printf("key test passed: %zu distinct keys\n", Seen.size());
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    size_t Iterations = Argc > 1 ? size_t(std::atoll(Argv[1])) : 1000000;
+
+    std::printf("psokeybench: %zu iterations\n", Iterations);
+
+    if (!CheckKeys())
+    {
+        return 1;
+    }
+
+    auto     Inputs = BaseInputs();
+    uint64_t Sink   = 0;
+
+    auto Begin = Clock::now();
+    for (size_t i = 0; i < Iterations; i++)
+    {
+        Inputs.Builder.SampleMask = uint32_t(i);
+        Sink += Inputs.MakeKey()[0];
+    }
+    double Seconds = std::chrono::duration<double>(Clock::now() - Begin).count();
+
+    std::printf("graphics key: %.1f ns per key\n", Seconds * 1e9 / double(Iterations));
+
+    // Printed so the keys are not optimized away
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(Sink));
+    return 0;
+}
\ No newline at end of file
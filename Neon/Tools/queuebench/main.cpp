@@ -0,0 +1,435 @@
+#include <Asio/MPMCQueue.hpp>
+#include <Asio/QueueTS.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// How the threads push and pop items.
+    /// </summary>
+    enum class Mode : uint8_t
+    {
+        /// TryPush and TryPop, retrying after a yield
+        Single,
+        /// TryPushBatch and TryPopBatch of up to s_BatchSize items
+        Batch,
+        /// Push and Pop, sleeping on a full or empty queue
+        Blocking
+    };
+
+    constexpr const char* s_ModeNames[]{ "single", "batch", "blocking" };
+
+    constexpr size_t s_BatchSize = 32;
+
+    struct BenchResult
+    {
+        size_t Items;
+        double Milliseconds;
+        double AverageLatency;
+        double MaxLatency;
+    };
+
+    void PrintResult(
+        const char*        Name,
+        Mode               RunMode,
+        uint32_t           Producers,
+        uint32_t           Consumers,
+        const BenchResult& Result)
+    {
+        std::printf(
+            "%-12s %-9s %3u/%-3u %10.2f ms %12.0f items/s  latency avg %8.3f us, max %10.3f us\n",
+            Name,
+            s_ModeNames[size_t(RunMode)],
+            Producers,
+            Consumers,
+            Result.Milliseconds,
+            double(Result.Items) / (Result.Milliseconds / 1000.0),
+            Result.AverageLatency / 1000.0,
+            Result.MaxLatency / 1000.0);
+    }
+
+    /// <summary>
+    /// Items carry the time they were pushed at, so the consumers can measure the queue's latency.
+    /// </summary>
+    using Item = Clock::rep;
+
+    struct MutexQueue
+    {
+        static constexpr const char* Name = "QueueTS";
+
+        /// QueueTS has no batch or blocking operations
+        static constexpr bool SingleOnly = true;
+
+        bool TryPush(
+            Item Value)
+        {
+            Queue.push_back(std::move(Value));
+            return true;
+        }
+
+        std::optional<Item> TryPop()
+        {
+            return Queue.pop_front();
+        }
+
+        Asio::QueueTS<Item> Queue;
+    };
+
+    struct BoundedQueue
+    {
+        static constexpr const char* Name       = "Bounded";
+        static constexpr bool        SingleOnly = false;
+
+        bool TryPush(
+            Item Value)
+        {
+            return Queue.TryPush(Value);
+        }
+
+        std::optional<Item> TryPop()
+        {
+            return Queue.TryPop();
+        }
+
+        size_t TryPushBatch(
+            Item*  Items,
+            size_t Count)
+        {
+            return Queue.TryPushBatch(Items, Items + Count);
+        }
+
+        size_t TryPopBatch(
+            Item*  Items,
+            size_t Count)
+        {
+            return Queue.TryPopBatch(Items, Count);
+        }
+
+        void Push(
+            Item Value)
+        {
+            Queue.Push(Value);
+        }
+
+        Item Pop()
+        {
+            return Queue.Pop();
+        }
+
+        Asio::BoundedMPMCQueue<Item> Queue{ 4096 };
+    };
+
+    struct UnboundedQueue
+    {
+        static constexpr const char* Name       = "Unbounded";
+        static constexpr bool        SingleOnly = false;
+
+        bool TryPush(
+            Item Value)
+        {
+            return Queue.TryPush(Value);
+        }
+
+        std::optional<Item> TryPop()
+        {
+            return Queue.TryPop();
+        }
+
+        size_t TryPushBatch(
+            Item*  Items,
+            size_t Count)
+        {
+            return Queue.TryPushBatch(Items, Items + Count);
+        }
+
+        size_t TryPopBatch(
+            Item*  Items,
+            size_t Count)
+        {
+            return Queue.TryPopBatch(Items, Count);
+        }
+
+        void Push(
+            Item Value)
+        {
+            Queue.Push(Value);
+        }
+
+        Item Pop()
+        {
+            return Queue.Pop();
+        }
+
+        Asio::UnboundedMPMCQueue<Item> Queue;
+    };
+
+    /// <summary>
+    /// Collects the latency of the items a consumer popped.
+    /// </summary>
+    struct LatencyStats
+    {
+        double Total = 0;
+        double Max   = 0;
+
+        void Add(
+            Item Value)
+        {
+            double Latency = double(Clock::now().time_since_epoch().count() - Value);
+            Total += Latency;
+            Max = std::max(Max, Latency);
+        }
+    };
+
+    /// <summary>
+    /// Push every item with the given mode, retrying whatever did not fit.
+    /// </summary>
+    template<typename _QueueTy>
+    void Produce(
+        _QueueTy& Queue,
+        Mode      RunMode,
+        size_t    Count)
+    {
+        std::array<Item, s_BatchSize> Batch;
+        for (size_t Pushed = 0; Pushed < Count;)
+        {
+            switch (RunMode)
+            {
+            case Mode::Single:
+                while (!Queue.TryPush(Clock::now().time_since_epoch().count()))
+                {
+                    std::this_thread::yield();
+                }
+                Pushed++;
+                break;
+
+            case Mode::Batch:
+            {
+                if constexpr (!_QueueTy::SingleOnly)
+                {
+                    size_t BatchSize = std::min(s_BatchSize, Count - Pushed);
+                    Batch.fill(Clock::now().time_since_epoch().count());
+                    for (size_t Offset = 0; Offset < BatchSize;)
+                    {
+                        size_t Done = Queue.TryPushBatch(Batch.data() + Offset, BatchSize - Offset);
+                        if (!Done)
+                        {
+                            std::this_thread::yield();
+                        }
+                        Offset += Done;
+                    }
+                    Pushed += BatchSize;
+                }
+                break;
+            }
+
+            case Mode::Blocking:
+                if constexpr (!_QueueTy::SingleOnly)
+                {
+                    Queue.Push(Clock::now().time_since_epoch().count());
+                    Pushed++;
+                }
+                break;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Pop exactly Count items with the given mode.
+    /// </summary>
+    template<typename _QueueTy>
+    void Consume(
+        _QueueTy&     Queue,
+        Mode          RunMode,
+        size_t        Count,
+        LatencyStats& Stats)
+    {
+        std::array<Item, s_BatchSize> Batch;
+        for (size_t Popped = 0; Popped < Count;)
+        {
+            switch (RunMode)
+            {
+            case Mode::Single:
+                if (auto Value = Queue.TryPop())
+                {
+                    Stats.Add(*Value);
+                    Popped++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+                break;
+
+            case Mode::Batch:
+                if constexpr (!_QueueTy::SingleOnly)
+                {
+                    size_t Done = Queue.TryPopBatch(Batch.data(), std::min(s_BatchSize, Count - Popped));
+                    for (size_t i = 0; i < Done; i++)
+                    {
+                        Stats.Add(Batch[i]);
+                    }
+                    if (!Done)
+                    {
+                        std::this_thread::yield();
+                    }
+                    Popped += Done;
+                }
+                break;
+
+            case Mode::Blocking:
+                if constexpr (!_QueueTy::SingleOnly)
+                {
+                    Stats.Add(Queue.Pop());
+                    Popped++;
+                }
+                break;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Producers push items as fast as they can while consumers pop them, like external threads feeding the job system.
+    /// Every consumer pops a fixed share of the items, so blocking pops never wait for items that will not come.
+    /// </summary>
+    template<typename _QueueTy>
+    BenchResult ProducerConsumer(
+        Mode     RunMode,
+        uint32_t Producers,
+        uint32_t Consumers,
+        size_t   ItemsPerProducer)
+    {
+        _QueueTy         Queue;
+        const size_t     TotalItems = Producers * ItemsPerProducer;
+        std::atomic_bool Start      = false;
+
+        std::vector<LatencyStats> Stats(Consumers);
+
+        std::vector<std::jthread> Threads;
+        Threads.reserve(Producers + Consumers);
+        for (uint32_t i = 0; i < Producers; i++)
+        {
+            Threads.emplace_back(
+                [&]
+                {
+                    Start.wait(false);
+                    Produce(Queue, RunMode, ItemsPerProducer);
+                });
+        }
+        for (uint32_t i = 0; i < Consumers; i++)
+        {
+            Threads.emplace_back(
+                [&, i]
+                {
+                    Start.wait(false);
+                    Consume(Queue, RunMode, TotalItems / Consumers + (i < TotalItems % Consumers), Stats[i]);
+                });
+        }
+
+        auto Begin = Clock::now();
+        Start      = true;
+        Start.notify_all();
+        Threads.clear();
+        auto End = Clock::now();
+
+        LatencyStats Total;
+        for (auto& CurStats : Stats)
+        {
+            Total.Total += CurStats.Total;
+            Total.Max = std::max(Total.Max, CurStats.Max);
+        }
+
+        const double NanosecondsPerTick = 1e9 * Clock::period::num / Clock::period::den;
+        return {
+            TotalItems,
+            std::chrono::duration<double, std::milli>(End - Begin).count(),
+            Total.Total / double(TotalItems) * NanosecondsPerTick,
+            Total.Max * NanosecondsPerTick
+        };
+    }
+
+    /// <summary>
+    /// A single thread pushes a batch worth of items and pops them back, the uncontended cost of the operations.
+    /// </summary>
+    template<typename _QueueTy>
+    BenchResult SingleThread(
+        Mode   RunMode,
+        size_t Items)
+    {
+        _QueueTy     Queue;
+        LatencyStats Stats;
+
+        auto Begin = Clock::now();
+        for (size_t Done = 0; Done < Items; Done += s_BatchSize)
+        {
+            size_t Count = std::min(s_BatchSize, Items - Done);
+            Produce(Queue, RunMode, Count);
+            Consume(Queue, RunMode, Count, Stats);
+        }
+        auto End = Clock::now();
+
+        const double NanosecondsPerTick = 1e9 * Clock::period::num / Clock::period::den;
+        return {
+            Items,
+            std::chrono::duration<double, std::milli>(End - Begin).count(),
+            Stats.Total / double(Items) * NanosecondsPerTick,
+            Stats.Max * NanosecondsPerTick
+        };
+    }
+
+    template<typename _QueueTy>
+    void Run(
+        uint32_t Threads,
+        size_t   Items)
+    {
+        for (auto RunMode : { Mode::Single, Mode::Batch, Mode::Blocking })
+        {
+            if (_QueueTy::SingleOnly && RunMode != Mode::Single)
+            {
+                continue;
+            }
+
+            if (Threads == 1)
+            {
+                PrintResult(_QueueTy::Name, RunMode, 1, 0, SingleThread<_QueueTy>(RunMode, Items));
+                continue;
+            }
+
+            uint32_t Producers = std::max(Threads / 2, 1u);
+            uint32_t Consumers = std::max(Threads - Producers, 1u);
+            PrintResult(_QueueTy::Name, RunMode, Producers, Consumers, ProducerConsumer<_QueueTy>(RunMode, Producers, Consumers, Items / Producers));
+        }
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    uint32_t MaxThreads = Argc > 1 ? uint32_t(std::atoi(Argv[1])) : 32;
+    size_t   Items      = Argc > 2 ? size_t(std::atoll(Argv[2])) : 1'000'000;
+
+    std::printf("queuebench: up to %u threads, %zu items\n", MaxThreads, Items);
+    std::printf("%-12s %-9s %-7s %13s %18s\n", "queue", "mode", "P/C", "time", "throughput");
+
+    // A single thread both pushes and pops, it is printed as 1/0
+    for (uint32_t Threads = 1; Threads <= MaxThreads; Threads *= 2)
+    {
+        Run<MutexQueue>(Threads, Items);
+        Run<BoundedQueue>(Threads, Items);
+        Run<UnboundedQueue>(Threads, Items);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,365 @@
+#include <Allocator/CachedRange.hpp>
+#include <Allocator/TLSF.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+//
+
+using namespace Neon;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    using RangeHandle = Allocator::CachedRangeAllocator::Handle;
+
+    /// <summary>
+    /// The previous descriptor heap allocator, a TLSF allocator behind a mutex.
+    /// </summary>
+    struct MutexRange
+    {
+        static constexpr const char* Name = "Mutex+TLSF";
+
+        MutexRange(
+            uint32_t Size) :
+            Allocator(Size)
+        {
+        }
+
+        RangeHandle Allocate(
+            uint32_t Count)
+        {
+            std::scoped_lock Lock(Mutex);
+            auto             Hndl = Allocator.Allocate(Count);
+            return { uint32_t(Hndl.Offset), uint32_t(Hndl.Size) };
+        }
+
+        void Free(
+            std::span<const RangeHandle> Handles)
+        {
+            std::scoped_lock Lock(Mutex);
+            for (auto& Hndl : Handles)
+            {
+                if (Hndl)
+                {
+                    Allocator.Free({ .Offset = Hndl.Offset, .Size = Hndl.Size });
+                }
+            }
+        }
+
+        std::mutex               Mutex;
+        Allocator::TLSFAllocator Allocator;
+    };
+
+    struct CachedRange
+    {
+        static constexpr const char* Name = "Cached";
+
+        CachedRange(
+            uint32_t Size) :
+            Allocator(Size)
+        {
+        }
+
+        RangeHandle Allocate(
+            uint32_t Count)
+        {
+            return Allocator.Allocate(Count);
+        }
+
+        void Free(
+            std::span<const RangeHandle> Handles)
+        {
+            Allocator.Free(Handles);
+        }
+
+        Allocator::CachedRangeAllocator Allocator;
+    };
+
+    /// <summary>
+    /// Every thread allocates descriptor tables of 1 to 8 descriptors, like passes recording their views,
+    /// and frees them in batches like the frame's stale descriptors.
+    /// With an owner table, every slot of an allocation must be unowned when it is handed out.
+    /// </summary>
+    template<typename _RangeTy>
+    bool Run(
+        uint32_t ThreadCount,
+        size_t   Iterations,
+        uint32_t Seed,
+        bool     Validate,
+        double&  Elapsed,
+        size_t&  Failures)
+    {
+        constexpr uint32_t HeapSize  = 1 << 20;
+        constexpr size_t   BatchSize = 256;
+
+        _RangeTy                                 Range(HeapSize);
+        std::unique_ptr<std::atomic<uint32_t>[]> Owners(Validate ? new std::atomic<uint32_t>[HeapSize]{} : nullptr);
+
+        std::atomic_bool   Start             = false;
+        std::atomic_bool   Failed            = false;
+        std::atomic_size_t FailedAllocations = 0;
+
+        std::vector<std::jthread> Threads;
+        for (uint32_t i = 0; i < ThreadCount; i++)
+        {
+            Threads.emplace_back(
+                [&, i]
+                {
+                    std::mt19937             Engine(Seed + i);
+                    std::vector<RangeHandle> Live;
+                    Live.reserve(BatchSize * 2);
+
+                    auto FreeBatch = [&]
+                    {
+                        if (Validate)
+                        {
+                            for (auto& Hndl : Live)
+                            {
+                                for (uint32_t j = 0; j < Hndl.Size; j++)
+                                {
+                                    if (Owners[Hndl.Offset + j].exchange(0, std::memory_order_relaxed) != i + 1)
+                                    {
+                                        Failed = true;
+                                    }
+                                }
+                            }
+                        }
+                        Range.Free(Live);
+                        Live.clear();
+                    };
+
+                    Start.wait(false);
+                    for (size_t j = 0; j < Iterations; j++)
+                    {
+                        auto Hndl = Range.Allocate(1 + Engine() % 8);
+                        if (!Hndl)
+                        {
+                            FailedAllocations.fetch_add(1, std::memory_order_relaxed);
+                            continue;
+                        }
+
+                        if (Validate)
+                        {
+                            for (uint32_t k = 0; k < Hndl.Size; k++)
+                            {
+                                if (Hndl.Offset + k >= HeapSize || Owners[Hndl.Offset + k].exchange(i + 1, std::memory_order_relaxed))
+                                {
+                                    Failed = true;
+                                }
+                            }
+                        }
+
+                        Live.push_back(Hndl);
+                        if (Live.size() >= BatchSize + Engine() % BatchSize)
+                        {
+                            FreeBatch();
+                        }
+                    }
+                    FreeBatch();
+                });
+        }
+
+        auto Begin = Clock::now();
+        Start      = true;
+        Start.notify_all();
+        Threads.clear();
+        Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Begin).count();
+
+        Failures = FailedAllocations;
+        return !Failed;
+    }
+
+    /// <summary>
+    /// Fill the range with chunked allocations, free them and check that a single large allocation can take the
+    /// whole range back once the free chunks are returned to the shared allocator, freeing both single handles and batches.
+    /// </summary>
+    bool ReclaimTest()
+    {
+        constexpr uint32_t HeapSize = 1 << 14;
+
+        Allocator::CachedRangeAllocator Range(HeapSize);
+
+        std::vector<RangeHandle> Live;
+        while (auto Hndl = Range.Allocate(4))
+        {
+            Live.push_back(Hndl);
+        }
+        if (Live.size() != HeapSize / 4)
+        {
+            std::printf("reclaim: only %zu of %u allocations fit\n", Live.size(), HeapSize / 4);
+            return false;
+        }
+
+        // Free half of them one by one to go through the single handle path
+        size_t Half = Live.size() / 2;
+        for (size_t i = 0; i < Half; i++)
+        {
+            Range.Free(Live[i]);
+        }
+        Range.Free(std::span(Live).subspan(Half));
+
+        // The last chunk is still owned by this thread's slot
+        auto Large = Range.Allocate(HeapSize - Allocator::CachedRangeAllocator::s_DefaultChunkSize);
+        if (!Large)
+        {
+            std::printf("reclaim: free chunks were not returned\n");
+            return false;
+        }
+
+        Range.FreeAll();
+        auto Stats = Range.GetStats();
+        if (Stats.CarvedChunks || Stats.Shared.UsedSize)
+        {
+            std::printf("reclaim: FreeAll left allocations behind\n");
+            return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Worst case of the per thread chunks: the threads fill the range with single slots, then every slot but the first
+    /// of each chunk is freed. The remaining allocations keep their whole chunk, and once they are freed too the idle
+    /// thread slots still keep the last chunk they bumped from.
+    /// </summary>
+    bool PinningTest(
+        uint32_t ThreadCount)
+    {
+        constexpr uint32_t HeapSize   = 1 << 16;
+        constexpr uint32_t ChunkSize  = Allocator::CachedRangeAllocator::s_DefaultChunkSize;
+        constexpr uint32_t ChunkCount = HeapSize / ChunkSize;
+
+        Allocator::CachedRangeAllocator Range(HeapSize);
+
+        std::vector<std::vector<RangeHandle>> Allocations(ThreadCount);
+        {
+            std::vector<std::jthread> Threads;
+            for (uint32_t i = 0; i < ThreadCount; i++)
+            {
+                Threads.emplace_back(
+                    [&, i]
+                    {
+                        for (uint32_t j = 0; j < HeapSize / ThreadCount; j++)
+                        {
+                            if (auto Hndl = Range.Allocate(1))
+                            {
+                                Allocations[i].push_back(Hndl);
+                            }
+                        }
+                    });
+            }
+        }
+
+        std::vector<RangeHandle> Kept, Freed;
+        std::vector<bool>        ChunkKept(ChunkCount);
+        for (auto& ThreadAllocations : Allocations)
+        {
+            for (auto& Hndl : ThreadAllocations)
+            {
+                uint32_t Chunk = Hndl.Offset / ChunkSize;
+                (ChunkKept[Chunk] ? Freed : Kept).push_back(Hndl);
+                ChunkKept[Chunk] = true;
+            }
+        }
+        Range.Free(Freed);
+
+        // A shared allocation that can't fit gives the free chunks back to the shared allocator
+        auto Large = Range.Allocate(ChunkSize * 2);
+        auto Stats = Range.GetStats();
+        if (Large || Stats.CarvedChunks != Kept.size())
+        {
+            std::printf("pinning: %zu live slots should pin %zu chunks, %zu are pinned\n", Kept.size(), Kept.size(), Stats.CarvedChunks);
+            return false;
+        }
+
+        std::printf(
+            "pinning: %2u threads, %5zu live slots pin %5zu slots (%.1f%% used), ",
+            ThreadCount,
+            Kept.size(),
+            Stats.CarvedChunks * ChunkSize,
+            100.0 * double(Kept.size()) / double(Stats.CarvedChunks * ChunkSize));
+
+        Range.Free(Kept);
+        Large = Range.Allocate(HeapSize);
+        Stats = Range.GetStats();
+        if (Large || Stats.CarvedChunks > ThreadCount)
+        {
+            std::printf("\npinning: %zu chunks are still pinned by %u idle thread slots\n", Stats.CarvedChunks, ThreadCount);
+            return false;
+        }
+
+        std::printf(
+            "idle thread slots pin %zu slots, largest free range %zu of %u\n",
+            Stats.CarvedChunks * ChunkSize,
+            Stats.Shared.LargestFreeBlock,
+            HeapSize);
+        return true;
+    }
+} // namespace
+
+int main(
+    int   Argc,
+    char* Argv[])
+{
+    uint32_t MaxThreads = Argc > 1 ? uint32_t(std::atoi(Argv[1])) : 32;
+    size_t   Iterations = Argc > 2 ? size_t(std::atoll(Argv[2])) : 200'000;
+    uint32_t Seed       = Argc > 3 ? uint32_t(std::atoi(Argv[3])) : 1234;
+
+    std::printf("rangebench: up to %u threads, %zu allocations per thread, seed %u\n", MaxThreads, Iterations, Seed);
+
+    if (!ReclaimTest())
+    {
+        return 1;
+    }
+
+    for (uint32_t Threads = 1; Threads <= MaxThreads; Threads *= 2)
+    {
+        if (!PinningTest(Threads))
+        {
+            return 1;
+        }
+    }
+
+    for (uint32_t Threads = 1; Threads <= MaxThreads; Threads *= 2)
+    {
+        double Elapsed;
+        size_t Failures;
+        if (!Run<CachedRange>(Threads, Iterations / 4, Seed, true, Elapsed, Failures) || Failures)
+        {
+            std::printf("fuzz failed with %u threads\n", Threads);
+            return 1;
+        }
+    }
+    std::printf("fuzz passed\n");
+
+    for (uint32_t Threads = 1; Threads <= MaxThreads; Threads *= 2)
+    {
+        double MutexTime, CachedTime;
+        size_t MutexFailures, CachedFailures;
+        Run<MutexRange>(Threads, Iterations, Seed, false, MutexTime, MutexFailures);
+        Run<CachedRange>(Threads, Iterations, Seed, false, CachedTime, CachedFailures);
+
+        double Allocations = double(Threads) * double(Iterations);
+        std::printf(
+            "%3u threads: %-10s %8.2f ms (%6.1f M/s), %-10s %8.2f ms (%6.1f M/s), %.2fx\n",
+            Threads,
+            MutexRange::Name,
+            MutexTime,
+            Allocations / MutexTime / 1000.0,
+            CachedRange::Name,
+            CachedTime,
+            Allocations / CachedTime / 1000.0,
+            MutexTime / CachedTime);
+    }
+
+    return 0;
+}
\ No newline at end of file
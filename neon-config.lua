@@ -4,7 +4,8 @@ newoption {
 	value = "API",
 	description = "Choose a particular 3D API for rendering",
 	allowed = {
-		{ "Directx12",  "Direct3D 12 (Windows only)" }
+		{ "Directx12",  "Direct3D 12 (Windows only)" },
+		{ "Null",       "Headless, commands are recorded instead of rendered (testing and benchmarking)" }
 	},
 	default = "Directx12"
 }
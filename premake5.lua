@@ -94,7 +94,21 @@ workspace "Neon"
     group ""
 
     group "Neon/Tools"
---        include "Neon/Tools/pakc"
+        include "Neon/Tools/pakc"
+        include "Neon/Tools/aliasbench"
+        include "Neon/Tools/allocbench"
+        include "Neon/Tools/cullbench"
+        include "Neon/Tools/drawbench"
+        include "Neon/Tools/graphbench"
+        include "Neon/Tools/hashbench"
+        include "Neon/Tools/modelbench"
+        include "Neon/Tools/poolbench"
+        include "Neon/Tools/psokeybench"
+        include "Neon/Tools/queuebench"
+        include "Neon/Tools/rangebench"
+        if _OPTIONS["GraphicsAPI"] == "Null" then
+            include "Neon/Tools/nullsmoke"
+        end
     group ""
 
     group "Samples"